@@ -49,13 +49,7 @@ void BdxOtaSender::HandleTransferSessionOutput(TransferSession::OutputEvent & ev
     case TransferSession::OutputEventType::kNone:
         break;
     case TransferSession::OutputEventType::kMsgToSend: {
-        chip::Messaging::SendFlags sendFlags;
-        if (!event.msgTypeData.HasMessageType(chip::Protocols::SecureChannel::MsgType::StatusReport))
-        {
-            // All messages sent from the Sender expect a response, except for a StatusReport which would indicate an error and the
-            // end of the transfer.
-            sendFlags.Set(chip::Messaging::SendMessageFlags::kExpectResponse);
-        }
+        const chip::Messaging::SendFlags sendFlags = GetSendFlags(event.msgTypeData);
         VerifyOrReturn(mExchangeCtx != nullptr, ChipLogError(BDX, "%s: mExchangeCtx is null", __FUNCTION__));
         err = mExchangeCtx->SendMessage(event.msgTypeData.ProtocolId, event.msgTypeData.MessageType, std::move(event.MsgData),
                                         sendFlags);
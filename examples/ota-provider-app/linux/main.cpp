@@ -139,7 +139,7 @@ int main(int argc, char * argv[])
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
     OTAProviderExample otaProvider;
-    BdxOtaSender bdxServer;
+    BdxOtaSenderPool bdxServer;
 
     if (chip::Platform::MemoryInit() != CHIP_NO_ERROR)
     {
@@ -176,8 +176,12 @@ int main(int argc, char * argv[])
 
     if (gOtaFilepath != nullptr)
     {
+        if (!bdxServer.SetFilepath(gOtaFilepath))
+        {
+            ChipLogError(SoftwareUpdate, "Cannot serve OTA file %s", gOtaFilepath);
+            return 1;
+        }
         otaProvider.SetOTAFilePath(gOtaFilepath);
-        bdxServer.SetFilepath(gOtaFilepath);
     }
 
     otaProvider.SetQueryImageBehavior(gQueryImageBehavior);
@@ -187,8 +191,7 @@ int main(int argc, char * argv[])
 
     BitFlags<TransferControlFlags> bdxFlags;
     bdxFlags.Set(TransferControlFlags::kReceiverDrive);
-    err = bdxServer.PrepareForTransfer(&chip::DeviceLayer::SystemLayer(), chip::bdx::TransferRole::kSender, bdxFlags,
-                                       kMaxBdxBlockSize, kBdxTimeout, kBdxPollFreq);
+    err = bdxServer.Init(&chip::DeviceLayer::SystemLayer(), bdxFlags, kMaxBdxBlockSize, kBdxTimeout, kBdxPollFreq);
     if (err != CHIP_NO_ERROR)
     {
         ChipLogError(BDX, "failed to init BDX server: %s", chip::ErrorStr(err));
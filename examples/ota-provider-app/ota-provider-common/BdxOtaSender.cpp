@@ -19,32 +19,44 @@
 
 #include <lib/core/CHIPError.h>
 #include <lib/support/BitFlags.h>
-#include <lib/support/CHIPMemString.h>
+#include <lib/support/CodeUtils.h>
 #include <messaging/ExchangeContext.h>
 #include <messaging/Flags.h>
 #include <protocols/bdx/BdxTransferSession.h>
 
-#include <fstream>
-
 using chip::bdx::StatusCode;
 using chip::bdx::TransferControlFlags;
 using chip::bdx::TransferSession;
 
-BdxOtaSender::BdxOtaSender()
+BdxOtaSender::BdxOtaSender() {}
+
+BdxOtaSender::~BdxOtaSender()
 {
-    memset(mFilepath, 0, kFilepathMaxLength);
+    SetImage(nullptr);
 }
 
 void BdxOtaSender::SetFilepath(const char * path)
 {
-    if (path != nullptr)
+    MappedOTAImage * image = (path != nullptr) ? MappedOTAImage::Acquire(path) : nullptr;
+    SetImage(image);
+    if (image != nullptr)
+    {
+        // SetImage() took its own reference
+        image->Release();
+    }
+}
+
+void BdxOtaSender::SetImage(MappedOTAImage * image)
+{
+    if (image != nullptr)
     {
-        chip::Platform::CopyString(mFilepath, path);
+        image->Retain();
     }
-    else
+    if (mImage != nullptr)
     {
-        memset(mFilepath, 0, kFilepathMaxLength);
+        mImage->Release();
     }
+    mImage = image;
 }
 
 void BdxOtaSender::HandleTransferSessionOutput(TransferSession::OutputEvent & event)
@@ -61,13 +73,7 @@ void BdxOtaSender::HandleTransferSessionOutput(TransferSession::OutputEvent & ev
     case TransferSession::OutputEventType::kNone:
         break;
     case TransferSession::OutputEventType::kMsgToSend: {
-        chip::Messaging::SendFlags sendFlags;
-        if (!event.msgTypeData.HasMessageType(chip::Protocols::SecureChannel::MsgType::StatusReport))
-        {
-            // All messages sent from the Sender expect a response, except for a StatusReport which would indicate an error and the
-            // end of the transfer.
-            sendFlags.Set(chip::Messaging::SendMessageFlags::kExpectResponse);
-        }
+        const chip::Messaging::SendFlags sendFlags = GetSendFlags(event.msgTypeData);
         VerifyOrReturn(mExchangeCtx != nullptr, ChipLogError(BDX, "%s: mExchangeCtx is null", __FUNCTION__));
         err = mExchangeCtx->SendMessage(event.msgTypeData.ProtocolId, event.msgTypeData.MessageType, std::move(event.MsgData),
                                         sendFlags);
@@ -78,6 +84,19 @@ void BdxOtaSender::HandleTransferSessionOutput(TransferSession::OutputEvent & ev
         break;
     }
     case TransferSession::OutputEventType::kInitReceived: {
+        if (mImage == nullptr || mTransfer.GetStartOffset() > mImage->GetSize())
+        {
+            mTransfer.AbortTransfer(mImage == nullptr ? StatusCode::kFileDesignatorUnknown : StatusCode::kStartOffsetNotSupported);
+            return;
+        }
+
+        // The image size is known, so always announce a definite length, unless the requestor asked for less
+        uint64_t length = mImage->GetSize() - mTransfer.GetStartOffset();
+        if (mTransfer.GetTransferLength() > 0 && mTransfer.GetTransferLength() < length)
+        {
+            length = mTransfer.GetTransferLength();
+        }
+
         // TransferSession will automatically reject a transfer if there are no
         // common supported control modes. It will also default to the smaller
         // block size.
@@ -85,13 +104,17 @@ void BdxOtaSender::HandleTransferSessionOutput(TransferSession::OutputEvent & ev
         acceptData.ControlMode  = TransferControlFlags::kReceiverDrive; // OTA must use receiver drive
         acceptData.MaxBlockSize = mTransfer.GetTransferBlockSize();
         acceptData.StartOffset  = mTransfer.GetStartOffset();
-        acceptData.Length       = mTransfer.GetTransferLength();
-        VerifyOrReturn(mTransfer.AcceptTransfer(acceptData) == CHIP_NO_ERROR,
-                       ChipLogError(BDX, "%s: %s", __FUNCTION__, chip::ErrorStr(err)));
+        acceptData.Length       = length;
+        err                     = mTransfer.AcceptTransfer(acceptData);
+        VerifyOrReturn(err == CHIP_NO_ERROR, ChipLogError(BDX, "%s: %s", __FUNCTION__, chip::ErrorStr(err)));
+
+        mStats             = TransferStats();
+        mTransferStartTime = chip::System::SystemClock().GetMonotonicTimestamp();
         break;
     }
     case TransferSession::OutputEventType::kQueryReceived: {
-        TransferSession::BlockData blockData;
+        VerifyOrReturn(mImage != nullptr, mTransfer.AbortTransfer(StatusCode::kTransferFailedUnknownError));
+
         uint16_t blockSize   = mTransfer.GetTransferBlockSize();
         uint16_t bytesToRead = blockSize;
 
@@ -102,34 +125,42 @@ void BdxOtaSender::HandleTransferSessionOutput(TransferSession::OutputEvent & ev
             bytesToRead = static_cast<uint16_t>(mTransfer.GetTransferLength() - mNumBytesSent);
         }
 
-        chip::System::PacketBufferHandle blockBuf = chip::System::PacketBufferHandle::New(bytesToRead);
-        if (blockBuf.IsNull())
+        // The Block data is copied straight from the mapped image into the outgoing message
+        const uint64_t offset      = mTransfer.GetStartOffset() + mNumBytesSent;
+        const chip::ByteSpan block = mImage->GetBlock(offset, bytesToRead);
+
+        TransferSession::BlockData blockData;
+        blockData.Data   = block.data();
+        blockData.Length = block.size();
+        blockData.IsEof  = (blockData.Length < blockSize) ||
+            (mNumBytesSent + static_cast<uint64_t>(blockData.Length) == mTransfer.GetTransferLength()) ||
+            (offset + blockData.Length == mImage->GetSize());
+
+        // BlockEOF may be empty, but PrepareBlock() still needs a valid pointer
+        static const uint8_t kEmptyBlock[1] = { 0 };
+        if (blockData.Data == nullptr)
         {
-            // TODO: AbortTransfer() needs to support GeneralStatusCode failures as well as BDX specific errors.
-            mTransfer.AbortTransfer(StatusCode::kUnknown);
-            return;
+            blockData.Data = kEmptyBlock;
         }
 
-        std::ifstream otaFile(mFilepath, std::ifstream::in);
-        VerifyOrReturn(otaFile.good(), ChipLogError(BDX, "%s: file read failed", __FUNCTION__));
-        otaFile.seekg(mNumBytesSent);
-        otaFile.read(reinterpret_cast<char *>(blockBuf->Start()), bytesToRead);
-        VerifyOrReturn(otaFile.good() || otaFile.eof(), ChipLogError(BDX, "%s: file read failed", __FUNCTION__));
+        err = mTransfer.PrepareBlock(blockData);
+        VerifyOrReturn(err == CHIP_NO_ERROR, ChipLogError(BDX, "%s: PrepareBlock failed: %s", __FUNCTION__, chip::ErrorStr(err)));
 
-        blockData.Data   = blockBuf->Start();
-        blockData.Length = static_cast<size_t>(otaFile.gcount());
-        blockData.IsEof  = (blockData.Length < blockSize) ||
-            (mNumBytesSent + static_cast<uint64_t>(blockData.Length) == mTransfer.GetTransferLength() || (otaFile.peek() == EOF));
         mNumBytesSent = static_cast<uint32_t>(mNumBytesSent + blockData.Length);
-
-        VerifyOrReturn(CHIP_NO_ERROR == mTransfer.PrepareBlock(blockData),
-                       ChipLogError(BDX, "%s: PrepareBlock failed: %s", __FUNCTION__, chip::ErrorStr(err)));
+        mStats.bytesSent += blockData.Length;
+        mStats.blocksSent++;
+        mStats.duration = std::chrono::duration_cast<chip::System::Clock::Milliseconds64>(
+            chip::System::SystemClock().GetMonotonicTimestamp() - mTransferStartTime);
         break;
     }
     case TransferSession::OutputEventType::kAckReceived:
         break;
     case TransferSession::OutputEventType::kAckEOFReceived:
-        ChipLogDetail(BDX, "Transfer completed, got AckEOF");
+        mStats.duration = std::chrono::duration_cast<chip::System::Clock::Milliseconds64>(
+            chip::System::SystemClock().GetMonotonicTimestamp() - mTransferStartTime);
+        ChipLogProgress(BDX, "Transfer completed: %u bytes in %u blocks, %u ms (%u B/s)", static_cast<unsigned>(mStats.bytesSent),
+                        static_cast<unsigned>(mStats.blocksSent), static_cast<unsigned>(mStats.duration.count()),
+                        static_cast<unsigned>(mStats.GetBytesPerSecond()));
         Reset();
         break;
     case TransferSession::OutputEventType::kStatusReceived:
@@ -158,8 +189,84 @@ void BdxOtaSender::Reset()
     if (mExchangeCtx != nullptr)
     {
         mExchangeCtx->Close();
+        mExchangeCtx = nullptr;
     }
 
+    // The image stays mapped for the next transfer
     mNumBytesSent = 0;
-    memset(mFilepath, 0, kFilepathMaxLength);
+}
+
+BdxOtaSenderPool::~BdxOtaSenderPool()
+{
+    if (mImage != nullptr)
+    {
+        mImage->Release();
+    }
+}
+
+bool BdxOtaSenderPool::SetFilepath(const char * path)
+{
+    MappedOTAImage * image = (path != nullptr) ? MappedOTAImage::Acquire(path) : nullptr;
+    for (BdxOtaSender & sender : mSenders)
+    {
+        sender.SetImage(image);
+    }
+
+    if (mImage != nullptr)
+    {
+        mImage->Release();
+    }
+    mImage = image;
+
+    return (path == nullptr) || (image != nullptr);
+}
+
+CHIP_ERROR BdxOtaSenderPool::Init(chip::System::Layer * layer, chip::BitFlags<TransferControlFlags> xferControlOpts,
+                                  uint16_t maxBlockSize, chip::System::Clock::Timeout timeout,
+                                  chip::System::Clock::Timeout pollFreq)
+{
+    VerifyOrReturnError(layer != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+
+    mSystemLayer     = layer;
+    mXferControlOpts = xferControlOpts;
+    mMaxBlockSize    = maxBlockSize;
+    mTimeout         = timeout;
+    mPollFreq        = pollFreq;
+
+    return CHIP_NO_ERROR;
+}
+
+size_t BdxOtaSenderPool::GetActiveTransferCount() const
+{
+    size_t count = 0;
+    for (const BdxOtaSender & sender : mSenders)
+    {
+        count += sender.IsIdle() ? 0 : 1;
+    }
+    return count;
+}
+
+CHIP_ERROR BdxOtaSenderPool::OnMessageReceived(chip::Messaging::ExchangeContext * ec, const chip::PayloadHeader & payloadHeader,
+                                               chip::System::PacketBufferHandle && payload)
+{
+    VerifyOrReturnError(mSystemLayer != nullptr, CHIP_ERROR_INCORRECT_STATE);
+
+    // Only the first message of a transfer reaches the pool: the exchange is then handed over to the sender serving it.
+    for (BdxOtaSender & sender : mSenders)
+    {
+        if (!sender.IsIdle())
+        {
+            continue;
+        }
+
+        ReturnErrorOnFailure(sender.PrepareForTransfer(mSystemLayer, chip::bdx::TransferRole::kSender, mXferControlOpts,
+                                                       mMaxBlockSize, mTimeout, mPollFreq));
+        ec->SetDelegate(&sender);
+
+        chip::Messaging::ExchangeDelegate & delegate = sender;
+        return delegate.OnMessageReceived(ec, payloadHeader, std::move(payload));
+    }
+
+    ChipLogError(BDX, "No sender available for a new transfer, %u in progress", static_cast<unsigned>(kMaxConcurrentTransfers));
+    return CHIP_ERROR_NO_MEMORY;
 }
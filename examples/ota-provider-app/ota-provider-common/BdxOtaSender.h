@@ -15,26 +15,96 @@
  *    limitations under the License.
  */
 
+#include <messaging/ExchangeDelegate.h>
+#include <ota-provider-common/MappedOTAImage.h>
 #include <protocols/bdx/BdxTransferSession.h>
 #include <protocols/bdx/TransferFacilitator.h>
+#include <system/SystemClock.h>
 
 #pragma once
 
 class BdxOtaSender : public chip::bdx::Responder
 {
 public:
+    struct TransferStats
+    {
+        uint64_t bytesSent                           = 0;
+        uint32_t blocksSent                          = 0;
+        chip::System::Clock::Milliseconds64 duration = chip::System::Clock::kZero;
+
+        uint64_t GetBytesPerSecond() const { return duration.count() > 0 ? bytesSent * 1000 / duration.count() : 0; }
+    };
+
     BdxOtaSender();
+    ~BdxOtaSender();
 
     void SetFilepath(const char * path);
 
+    /**
+     * Serve the given image, which is shared with other senders and released when this sender is destroyed or given another
+     * image.
+     */
+    void SetImage(MappedOTAImage * image);
+
+    bool IsIdle() const { return mExchangeCtx == nullptr; }
+
+    /**
+     * Statistics of the transfer in progress, or of the last one if the sender is idle.
+     */
+    const TransferStats & GetTransferStats() const { return mStats; }
+
 private:
     // Inherited from bdx::TransferFacilitator
     void HandleTransferSessionOutput(chip::bdx::TransferSession::OutputEvent & event) override;
 
     void Reset();
 
-    static constexpr size_t kFilepathMaxLength = 256;
-    char mFilepath[kFilepathMaxLength];
+    MappedOTAImage * mImage = nullptr;
 
+    chip::System::Clock::Timestamp mTransferStartTime = chip::System::Clock::kZero;
+    TransferStats mStats;
     uint32_t mNumBytesSent = 0;
 };
+
+/**
+ * Serves an OTA image to several requestors at once.
+ *
+ * Registered as the handler for unsolicited BDX messages, it hands each new exchange to an idle BdxOtaSender. All the senders
+ * share a single mapping of the image.
+ */
+class BdxOtaSenderPool : public chip::Messaging::ExchangeDelegate
+{
+public:
+    static constexpr size_t kMaxConcurrentTransfers = 8;
+
+    ~BdxOtaSenderPool();
+
+    /**
+     * Map the image at path and serve it from every sender. Returns false if the image cannot be mapped.
+     */
+    bool SetFilepath(const char * path);
+
+    /**
+     * Store the parameters used to prepare a sender for each incoming transfer.
+     */
+    CHIP_ERROR Init(chip::System::Layer * layer, chip::BitFlags<chip::bdx::TransferControlFlags> xferControlOpts,
+                    uint16_t maxBlockSize, chip::System::Clock::Timeout timeout, chip::System::Clock::Timeout pollFreq);
+
+    size_t GetActiveTransferCount() const;
+    const BdxOtaSender & GetSender(size_t index) const { return mSenders[index]; }
+
+private:
+    // Inherited from ExchangeDelegate
+    CHIP_ERROR OnMessageReceived(chip::Messaging::ExchangeContext * ec, const chip::PayloadHeader & payloadHeader,
+                                 chip::System::PacketBufferHandle && payload) override;
+    void OnResponseTimeout(chip::Messaging::ExchangeContext * ec) override {}
+
+    BdxOtaSender mSenders[kMaxConcurrentTransfers];
+    MappedOTAImage * mImage = nullptr;
+
+    chip::System::Layer * mSystemLayer = nullptr;
+    chip::BitFlags<chip::bdx::TransferControlFlags> mXferControlOpts;
+    uint16_t mMaxBlockSize = 0;
+    chip::System::Clock::Timeout mTimeout;
+    chip::System::Clock::Timeout mPollFreq;
+};
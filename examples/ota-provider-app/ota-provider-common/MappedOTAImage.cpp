@@ -0,0 +1,128 @@
+/*
+ *
+ *    Copyright (c) 2022 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <ota-provider-common/MappedOTAImage.h>
+
+#include <lib/support/CHIPMemString.h>
+#include <lib/support/CodeUtils.h>
+#include <lib/support/logging/CHIPLogging.h>
+
+#include <errno.h>
+#include <fcntl.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+MappedOTAImage MappedOTAImage::sImages[kMaxMappedImages];
+
+MappedOTAImage * MappedOTAImage::Acquire(const char * path)
+{
+    VerifyOrReturnError(path != nullptr && strlen(path) < kFilepathMaxLength, nullptr);
+
+    MappedOTAImage * freeImage = nullptr;
+    for (MappedOTAImage & image : sImages)
+    {
+        if (image.mRefCount > 0 && strcmp(image.mPath, path) == 0)
+        {
+            image.mRefCount++;
+            return &image;
+        }
+        if (image.mRefCount == 0 && freeImage == nullptr)
+        {
+            freeImage = &image;
+        }
+    }
+
+    if (freeImage == nullptr)
+    {
+        ChipLogError(SoftwareUpdate, "Too many OTA images mapped");
+        return nullptr;
+    }
+    VerifyOrReturnError(freeImage->Map(path), nullptr);
+
+    freeImage->mRefCount = 1;
+    return freeImage;
+}
+
+void MappedOTAImage::Release()
+{
+    VerifyOrReturn(mRefCount > 0);
+
+    if (--mRefCount == 0)
+    {
+        Unmap();
+    }
+}
+
+chip::ByteSpan MappedOTAImage::GetBlock(uint64_t offset, size_t maxLength) const
+{
+    if (mData == nullptr || offset >= mSize)
+    {
+        return chip::ByteSpan();
+    }
+
+    const size_t start = static_cast<size_t>(offset);
+    return chip::ByteSpan(mData + start, chip::min(maxLength, mSize - start));
+}
+
+bool MappedOTAImage::Map(const char * path)
+{
+    int fd = open(path, O_RDONLY | O_CLOEXEC);
+    if (fd < 0)
+    {
+        ChipLogError(SoftwareUpdate, "Cannot open OTA image %s: %s", path, strerror(errno));
+        return false;
+    }
+
+    struct stat fileStat;
+    void * data = MAP_FAILED;
+    if (fstat(fd, &fileStat) == 0 && fileStat.st_size > 0)
+    {
+        data = mmap(nullptr, static_cast<size_t>(fileStat.st_size), PROT_READ, MAP_SHARED, fd, 0);
+    }
+
+    // The mapping stays valid once the file is closed
+    close(fd);
+    if (data == MAP_FAILED)
+    {
+        ChipLogError(SoftwareUpdate, "Cannot map OTA image %s", path);
+        return false;
+    }
+
+    // Concurrent transfers read the image at different offsets: bring it all in once rather than faulting pages one by one
+    madvise(data, static_cast<size_t>(fileStat.st_size), MADV_WILLNEED);
+
+    chip::Platform::CopyString(mPath, path);
+    mData = static_cast<const uint8_t *>(data);
+    mSize = static_cast<size_t>(fileStat.st_size);
+
+    ChipLogProgress(SoftwareUpdate, "Mapped OTA image %s (%u bytes)", mPath, static_cast<unsigned>(mSize));
+    return true;
+}
+
+void MappedOTAImage::Unmap()
+{
+    if (mData != nullptr)
+    {
+        munmap(const_cast<uint8_t *>(mData), mSize);
+    }
+
+    memset(mPath, 0, sizeof(mPath));
+    mData = nullptr;
+    mSize = 0;
+}
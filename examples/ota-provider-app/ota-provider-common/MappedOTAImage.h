@@ -0,0 +1,74 @@
+/*
+ *
+ *    Copyright (c) 2022 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#pragma once
+
+#include <lib/support/Span.h>
+
+#include <stddef.h>
+#include <stdint.h>
+
+/**
+ * A read-only memory mapping of an OTA image file.
+ *
+ * Each image is mapped once and shared by every transfer serving it: Acquire() returns the existing mapping of a path if there is
+ * one, and the mapping is removed when the last reference is released. Blocks are handed out as views into the mapping, so they
+ * can be copied straight into the outgoing message without going through a file handle or an intermediate buffer.
+ */
+class MappedOTAImage
+{
+public:
+    /**
+     * Return the mapping of the image at path, mapping it if needed, or nullptr if the file cannot be mapped or too many images
+     * are mapped already. Every successful call must be balanced by a call to Release().
+     */
+    static MappedOTAImage * Acquire(const char * path);
+
+    /**
+     * Add a reference to an acquired image.
+     */
+    MappedOTAImage * Retain()
+    {
+        mRefCount++;
+        return this;
+    }
+
+    void Release();
+
+    const char * GetPath() const { return mPath; }
+    uint64_t GetSize() const { return mSize; }
+
+    /**
+     * Return a view of up to maxLength bytes of the image starting at offset. The view is empty past the end of the image and
+     * remains valid until Release() is called.
+     */
+    chip::ByteSpan GetBlock(uint64_t offset, size_t maxLength) const;
+
+private:
+    static constexpr size_t kMaxMappedImages   = 4;
+    static constexpr size_t kFilepathMaxLength = 256;
+
+    bool Map(const char * path);
+    void Unmap();
+
+    static MappedOTAImage sImages[kMaxMappedImages];
+
+    char mPath[kFilepathMaxLength] = { 0 };
+    const uint8_t * mData          = nullptr;
+    size_t mSize                   = 0;
+    uint32_t mRefCount             = 0;
+};
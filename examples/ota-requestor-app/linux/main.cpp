@@ -64,12 +64,14 @@ constexpr uint16_t kOptionProviderFabricIndex = 'f';
 constexpr uint16_t kOptionUdpPort             = 'u';
 constexpr uint16_t kOptionDiscriminator       = 'd';
 constexpr uint16_t kOptionDelayQuery          = 'q';
+constexpr uint16_t kOptionAllowNoHeader       = 'a';
 
 NodeId providerNodeId           = 0x0;
 FabricIndex providerFabricIndex = 1;
 uint16_t requestorSecurePort    = 0;
 uint16_t setupDiscriminator     = CHIP_DEVICE_CONFIG_USE_TEST_SETUP_DISCRIMINATOR;
 uint16_t delayQueryTimeInSec    = 0;
+bool allowImagesWithoutHeader   = false;
 
 OptionDef cmdLineOptionsDef[] = {
     { "providerNodeId", chip::ArgParser::kArgumentRequired, kOptionProviderNodeId },
@@ -77,6 +79,7 @@ OptionDef cmdLineOptionsDef[] = {
     { "udpPort", chip::ArgParser::kArgumentRequired, kOptionUdpPort },
     { "discriminator", chip::ArgParser::kArgumentRequired, kOptionDiscriminator },
     { "delayQuery", chip::ArgParser::kArgumentRequired, kOptionDelayQuery },
+    { "allowImagesWithoutHeader", chip::ArgParser::kNoArgument, kOptionAllowNoHeader },
     {},
 };
 
@@ -94,7 +97,10 @@ OptionSet cmdLineOptions = { HandleOptions, cmdLineOptionsDef, "PROGRAM OPTIONS"
                              "        advertisements. If none is specified, default value is 3840.\n"
                              "  -q/--delayQuery <Time in seconds>\n"
                              "        From boot up, the amount of time to wait before triggering the QueryImage\n"
-                             "        command. If none or zero is supplied, QueryImage will not be triggered.\n" };
+                             "        command. If none or zero is supplied, QueryImage will not be triggered.\n"
+                             "  -a/--allowImagesWithoutHeader\n"
+                             "        Store downloaded images that do not start with an OTA image header without verifying\n"
+                             "        them. By default, such images are rejected.\n" };
 
 HelpOptions helpOptions("ota-requestor-app", "Usage: ota-requestor-app [options]", "1.0");
 
@@ -142,6 +148,9 @@ bool HandleOptions(const char * aProgram, OptionSet * aOptions, int aIdentifier,
     case kOptionDelayQuery:
         delayQueryTimeInSec = static_cast<uint16_t>(strtol(aValue, NULL, 0));
         break;
+    case kOptionAllowNoHeader:
+        allowImagesWithoutHeader = true;
+        break;
     default:
         PrintArgError("%s: INTERNAL ERROR: Unhandled option: %s\n", aProgram, aName);
         retval = false;
@@ -210,6 +219,7 @@ int main(int argc, char * argv[])
     ipParams.imageFile = CharSpan("test.txt");
     gImageProcessor.SetOTAImageProcessorParams(ipParams);
     gImageProcessor.SetOTADownloader(&gDownloader);
+    gImageProcessor.SetAllowImagesWithoutHeader(allowImagesWithoutHeader);
 
     // Connect the Downloader and Image Processor objects
     gDownloader.SetImageProcessorDelegate(&gImageProcessor);
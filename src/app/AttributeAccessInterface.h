@@ -95,6 +95,11 @@ public:
 class AttributeValueEncoder
 {
 public:
+    /**
+     * Opaque position in a list, used by EncodeResumableList to resume encoding a list where the previous chunk stopped.
+     */
+    using ListCursor = uint64_t;
+
     class ListEncodeHelper
     {
     public:
@@ -118,10 +123,42 @@ public:
         AttributeValueEncoder & mAttributeValueEncoder;
     };
 
+    class ResumableListEncodeHelper
+    {
+    public:
+        ResumableListEncodeHelper(AttributeValueEncoder & encoder) : mAttributeValueEncoder(encoder) {}
+
+        /**
+         * Encode aArg as the next list item. aNextCursor is the position the list generator has to resume from to generate the
+         * items that follow aArg.
+         */
+        template <typename T, std::enable_if_t<DataModel::IsFabricScoped<T>::value, bool> = true>
+        CHIP_ERROR Encode(T && aArg, ListCursor aNextCursor) const
+        {
+            // If the fabric index does not match that present in the request, skip encoding this list item, but do not generate
+            // it again in the next chunk.
+            if (!aArg.MatchesFabricIndex(mAttributeValueEncoder.mAccessingFabricIndex))
+            {
+                mAttributeValueEncoder.mEncodeState.mListCursor = aNextCursor;
+                return CHIP_NO_ERROR;
+            }
+            return mAttributeValueEncoder.EncodeResumableListItem(std::forward<T>(aArg), aNextCursor);
+        }
+
+        template <typename T, std::enable_if_t<!DataModel::IsFabricScoped<T>::value, bool> = true>
+        CHIP_ERROR Encode(T && aArg, ListCursor aNextCursor) const
+        {
+            return mAttributeValueEncoder.EncodeResumableListItem(std::forward<T>(aArg), aNextCursor);
+        }
+
+    private:
+        AttributeValueEncoder & mAttributeValueEncoder;
+    };
+
     class AttributeEncodeState
     {
     public:
-        AttributeEncodeState() : mAllowPartialData(false), mCurrentEncodingListIndex(kInvalidListIndex) {}
+        AttributeEncodeState() : mAllowPartialData(false), mCurrentEncodingListIndex(kInvalidListIndex), mListCursor(0) {}
         bool AllowPartialData() const { return mAllowPartialData; }
 
     private:
@@ -147,6 +184,11 @@ public:
          * encoded (i.e. the count of items encoded so far).
          */
         ListIndex mCurrentEncodingListIndex = kInvalidListIndex;
+        /**
+         * Only used by EncodeResumableList: the position the list generator has to resume from to generate the item at
+         * mCurrentEncodingListIndex.
+         */
+        ListCursor mListCursor = 0;
     };
 
     AttributeValueEncoder(AttributeReportIBs::Builder & aAttributeReportIBsBuilder, FabricIndex aAccessingFabricIndex,
@@ -217,6 +259,31 @@ public:
         return CHIP_NO_ERROR;
     }
 
+    /**
+     * EncodeResumableList behaves like EncodeList for list generators that can restart from any position in the list.  Instead of
+     * generating again the items that were encoded in previous chunks, which makes encoding a long list quadratic in its length,
+     * aCallback resumes from where the previous chunk stopped.
+     *
+     * aCallback is expected to take a ListCursor argument and a const auto & argument.  The cursor is the position to start
+     * generating items from: 0 for the first item of the list, otherwise a value aCallback has handed to the encoder.  For each
+     * item, aCallback calls Encode(item, nextCursor) on the second argument, where nextCursor is the position of the item that
+     * follows.  The rules of EncodeList apply otherwise.
+     *
+     * Consumers are allowed to make either one call to EncodeResumableList, EncodeList or Encode to handle a read.
+     */
+    template <typename ResumableListGenerator>
+    CHIP_ERROR EncodeResumableList(ResumableListGenerator aCallback)
+    {
+        mTriedEncode = true;
+        ReturnErrorOnFailure(EnsureListStarted());
+        // The items encoded in previous chunks are not generated again, so there is nothing to skip.
+        mCurrentEncodingListIndex = mEncodeState.mCurrentEncodingListIndex;
+        ReturnErrorOnFailure(aCallback(mEncodeState.mListCursor, ResumableListEncodeHelper(*this)));
+        // The Encode procedure finished without any error, clear the state.
+        mEncodeState = AttributeEncodeState();
+        return CHIP_NO_ERROR;
+    }
+
     bool TriedEncode() const { return mTriedEncode; }
 
     /**
@@ -232,6 +299,15 @@ public:
 private:
     // We made EncodeListItem() private, and ListEncoderHelper will expose it by Encode()
     friend class ListEncodeHelper;
+    friend class ResumableListEncodeHelper;
+
+    template <typename T>
+    CHIP_ERROR EncodeResumableListItem(T && aArg, ListCursor aNextCursor)
+    {
+        ReturnErrorOnFailure(EncodeListItem(std::forward<T>(aArg)));
+        mEncodeState.mListCursor = aNextCursor;
+        return CHIP_NO_ERROR;
+    }
 
     template <typename... Ts>
     CHIP_ERROR EncodeListItem(Ts &&... aArgs)
@@ -377,6 +453,12 @@ public:
     void SetNext(AttributeAccessInterface * aNext) { mNext = aNext; }
     AttributeAccessInterface * GetNext() const { return mNext; }
 
+    /**
+     * The endpoint this object was registered for, or Missing if it is meant to be used with all endpoints.
+     */
+    const Optional<EndpointId> & GetEndpointId() const { return mEndpointId; }
+    ClusterId GetClusterId() const { return mClusterId; }
+
     /**
      * Check whether a this AttributeAccessInterface is relevant for a
      * particular endpoint+cluster.  An AttributeAccessInterface will be used
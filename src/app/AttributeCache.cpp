@@ -16,10 +16,10 @@
  *    limitations under the License.
  */
 
-#include "system/SystemPacketBuffer.h"
 #include <app/AttributeCache.h>
 #include <app/InteractionModelEngine.h>
-#include <tuple>
+#include <string.h>
+#include <utility>
 
 namespace chip {
 namespace app {
@@ -27,69 +27,233 @@ namespace app {
 CHIP_ERROR AttributeCache::UpdateCache(const ConcreteDataAttributePath & aPath, TLV::TLVReader * apData, const StatusIB & aStatus)
 {
     AttributeState state;
-    System::PacketBufferHandle handle;
-    System::PacketBufferTLVWriter writer;
 
     if (apData)
     {
-        handle = System::PacketBufferHandle::New(chip::app::kMaxSecureSduLengthBytes);
+        TLV::TLVWriter writer;
+        DataSlot slot;
+        size_t offset = mArena.size();
 
-        writer.Init(std::move(handle), false);
-
-        ReturnErrorOnFailure(writer.CopyElement(TLV::AnonymousTag, *apData));
-        ReturnErrorOnFailure(writer.Finalize(&handle));
+        VerifyOrReturnError(offset + kMaxSecureSduLengthBytes <= UINT32_MAX, CHIP_ERROR_NO_MEMORY);
 
         //
-        // Compact the buffer down to a more reasonably sized packet buffer
-        // if we can.
+        // Encode the value directly onto the tail of the arena, and then trim the arena back down
+        // to what was actually written.
         //
-        handle.RightSize();
-
-        state.Set<System::PacketBufferHandle>(std::move(handle));
+        mArena.resize(offset + kMaxSecureSduLengthBytes);
+        writer.Init(mArena.data() + offset, kMaxSecureSduLengthBytes);
+
+        CHIP_ERROR err = writer.CopyElement(TLV::AnonymousTag, *apData);
+        if (err == CHIP_NO_ERROR)
+        {
+            err = writer.Finalize();
+        }
+
+        if (err != CHIP_NO_ERROR)
+        {
+            mArena.resize(offset);
+            return err;
+        }
+
+        slot.mOffset = static_cast<uint32_t>(offset);
+        slot.mLength = writer.GetLengthWritten();
+        mArena.resize(offset + slot.mLength);
+
+        state.Set<DataSlot>(slot);
     }
     else
     {
         state.Set<StatusIB>(aStatus);
     }
 
+    auto iter = LowerBound(aPath);
+    if (iter != mAttributes.end() && iter->mPath == aPath)
+    {
+        if (iter->mState.Is<DataSlot>())
+        {
+            DataSlot & oldSlot = iter->mState.Get<DataSlot>();
+
+            //
+            // If the new value fits where the old one was, move it there instead of leaving it on the tail
+            // of the arena. Either way, account for the bytes that are no longer referenced.
+            //
+            if (state.Is<DataSlot>() && state.Get<DataSlot>().mLength <= oldSlot.mLength)
+            {
+                DataSlot & newSlot = state.Get<DataSlot>();
+
+                memmove(mArena.data() + oldSlot.mOffset, mArena.data() + newSlot.mOffset, newSlot.mLength);
+                mArena.resize(newSlot.mOffset);
+                newSlot.mOffset = oldSlot.mOffset;
+                mArenaWaste += oldSlot.mLength - newSlot.mLength;
+            }
+            else
+            {
+                mArenaWaste += oldSlot.mLength;
+            }
+        }
+
+        iter->mState = std::move(state);
+    }
+    else
+    {
+        //
+        // if the endpoint didn't exist previously, let's track the insertion
+        // so that we can inform our callback of a new endpoint being added appropriately.
+        //
+        bool endpointExists = (iter != mAttributes.end() && iter->mPath.mEndpointId == aPath.mEndpointId) ||
+            (iter != mAttributes.begin() && (iter - 1)->mPath.mEndpointId == aPath.mEndpointId);
+        if (!endpointExists)
+        {
+            mAddedEndpoints.push_back(aPath.mEndpointId);
+        }
+
+        AttributeEntry entry;
+        entry.mPath  = ConcreteAttributePath(aPath.mEndpointId, aPath.mClusterId, aPath.mAttributeId);
+        entry.mState = std::move(state);
+
+        //
+        // Reports generally arrive in path order, so this is usually an append.
+        //
+        mAttributes.insert(iter, std::move(entry));
+    }
+
     //
-    // if the endpoint didn't exist previously, let's track the insertion
-    // so that we can inform our callback of a new endpoint being added appropriately.
+    // Latch the cluster's data version if one was provided. It only takes effect once the report is complete.
     //
-    if (mCache.find(aPath.mEndpointId) == mCache.end())
+    ClusterDataVersion & clusterDataVersion = GetOrCreateClusterDataVersion(aPath.mEndpointId, aPath.mClusterId);
+    if (apData && aPath.mDataVersion.HasValue())
     {
-        mAddedEndpoints.push_back(aPath.mEndpointId);
+        clusterDataVersion.mPendingDataVersion = aPath.mDataVersion;
     }
 
-    mCache[aPath.mEndpointId][aPath.mClusterId][aPath.mAttributeId] = std::move(state);
-    mChangedAttributeSet.insert(aPath);
+    mChangedAttributes.push_back(aPath);
     return CHIP_NO_ERROR;
 }
 
+std::vector<AttributeCache::ClusterDataVersion>::iterator AttributeCache::LowerBoundClusterDataVersion(EndpointId endpointId,
+                                                                                                      ClusterId clusterId)
+{
+    return std::lower_bound(mClusterDataVersions.begin(), mClusterDataVersions.end(), std::make_pair(endpointId, clusterId),
+                            [](const ClusterDataVersion & entry, const std::pair<EndpointId, ClusterId> & key) {
+                                return std::make_pair(entry.mEndpointId, entry.mClusterId) < key;
+                            });
+}
+
+AttributeCache::ClusterDataVersion & AttributeCache::GetOrCreateClusterDataVersion(EndpointId endpointId, ClusterId clusterId)
+{
+    auto iter = LowerBoundClusterDataVersion(endpointId, clusterId);
+
+    if (iter == mClusterDataVersions.end() || iter->mEndpointId != endpointId || iter->mClusterId != clusterId)
+    {
+        ClusterDataVersion entry;
+        entry.mEndpointId = endpointId;
+        entry.mClusterId  = clusterId;
+        iter              = mClusterDataVersions.insert(iter, entry);
+    }
+
+    return *iter;
+}
+
+bool AttributeCache::RequestIncludesAllAttributes(EndpointId endpointId, ClusterId clusterId) const
+{
+    for (auto & path : mRequestPaths)
+    {
+        if (path.HasWildcardAttributeId() && (path.HasWildcardEndpointId() || path.mEndpointId == endpointId) &&
+            (path.HasWildcardClusterId() || path.mClusterId == clusterId))
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+void AttributeCache::CompactArena()
+{
+    std::vector<uint8_t> arena;
+
+    arena.reserve(mArena.size() - mArenaWaste);
+
+    for (auto & entry : mAttributes)
+    {
+        if (entry.mState.Is<DataSlot>())
+        {
+            DataSlot & slot = entry.mState.Get<DataSlot>();
+            size_t offset   = arena.size();
+
+            arena.insert(arena.end(), mArena.begin() + slot.mOffset, mArena.begin() + slot.mOffset + slot.mLength);
+            slot.mOffset = static_cast<uint32_t>(offset);
+        }
+    }
+
+    mArena      = std::move(arena);
+    mArenaWaste = 0;
+}
+
 void AttributeCache::OnReportBegin(const ReadClient * apReadClient)
 {
-    mChangedAttributeSet.clear();
+    mChangedAttributes.clear();
     mAddedEndpoints.clear();
+
+    //
+    // Discard any versions latched by a prior report that never completed.
+    //
+    for (auto & clusterDataVersion : mClusterDataVersions)
+    {
+        clusterDataVersion.mPendingDataVersion.ClearValue();
+    }
+
     mCallback.OnReportBegin(apReadClient);
 }
 
 void AttributeCache::OnReportEnd(const ReadClient * apReadClient)
 {
-    std::set<std::tuple<EndpointId, ClusterId>> changedClusters;
+    for (auto & clusterDataVersion : mClusterDataVersions)
+    {
+        if (clusterDataVersion.mPendingDataVersion.HasValue())
+        {
+            //
+            // A report for only some of the attributes leaves the others at an older version, unless the version did not move.
+            //
+            bool sameVersion = clusterDataVersion.mCommittedDataVersion == clusterDataVersion.mPendingDataVersion;
+            clusterDataVersion.mComplete =
+                RequestIncludesAllAttributes(clusterDataVersion.mEndpointId, clusterDataVersion.mClusterId) ||
+                (sameVersion && clusterDataVersion.mComplete);
+
+            clusterDataVersion.mCommittedDataVersion = clusterDataVersion.mPendingDataVersion;
+            clusterDataVersion.mPendingDataVersion.ClearValue();
+        }
+    }
+
+    if (mArenaWaste > kArenaCompactionThreshold && mArenaWaste > mArena.size() / 2)
+    {
+        CompactArena();
+    }
 
     //
-    // Add the EndpointId and ClusterId into a set so that we only
-    // convey unique combinations in the subsequent OnClusterChanged callback.
+    // A path may have been updated more than once during the report, so sort and de-duplicate the
+    // changed paths before notifying.
     //
-    for (auto & path : mChangedAttributeSet)
+    std::sort(mChangedAttributes.begin(), mChangedAttributes.end());
+    mChangedAttributes.erase(std::unique(mChangedAttributes.begin(), mChangedAttributes.end()), mChangedAttributes.end());
+
+    for (auto & path : mChangedAttributes)
     {
         mCallback.OnAttributeChanged(this, path);
-        changedClusters.insert(std::make_tuple(path.mEndpointId, path.mClusterId));
     }
 
-    for (auto & item : changedClusters)
+    //
+    // Since the changed paths are sorted, all the paths for a given EndpointId and ClusterId are adjacent,
+    // so we only convey unique combinations in the subsequent OnClusterChanged callback.
+    //
+    for (size_t i = 0; i < mChangedAttributes.size(); i++)
     {
-        mCallback.OnClusterChanged(this, std::get<0>(item), std::get<1>(item));
+        const auto & path = mChangedAttributes[i];
+        if (i == 0 || path.mEndpointId != mChangedAttributes[i - 1].mEndpointId ||
+            path.mClusterId != mChangedAttributes[i - 1].mClusterId)
+        {
+            mCallback.OnClusterChanged(this, path.mEndpointId, path.mClusterId);
+        }
     }
 
     for (auto endpoint : mAddedEndpoints)
@@ -128,7 +292,7 @@ CHIP_ERROR AttributeCache::Get(const ConcreteAttributePath & path, TLV::TLVReade
 {
     CHIP_ERROR err;
 
-    auto attributeState = GetAttributeState(path.mEndpointId, path.mClusterId, path.mAttributeId, err);
+    auto attributeState = GetAttributeState(path, err);
     ReturnErrorOnFailure(err);
 
     if (attributeState->Is<StatusIB>())
@@ -136,72 +300,91 @@ CHIP_ERROR AttributeCache::Get(const ConcreteAttributePath & path, TLV::TLVReade
         return CHIP_ERROR_IM_STATUS_CODE_RECEIVED;
     }
 
-    System::PacketBufferTLVReader bufReader;
-
-    bufReader.Init(attributeState->Get<System::PacketBufferHandle>().Retain());
-    ReturnErrorOnFailure(bufReader.Next());
+    const DataSlot & slot = attributeState->Get<DataSlot>();
 
-    reader.Init(bufReader);
-    return CHIP_NO_ERROR;
+    reader.Init(mArena.data() + slot.mOffset, slot.mLength);
+    return reader.Next();
 }
 
-AttributeCache::EndpointState * AttributeCache::GetEndpointState(EndpointId endpointId, CHIP_ERROR & err)
+AttributeCache::AttributeState * AttributeCache::GetAttributeState(const ConcreteAttributePath & path, CHIP_ERROR & err)
 {
-    auto endpointIter = mCache.find(endpointId);
-    if (endpointIter == mCache.end())
+    auto iter = LowerBound(path);
+    if (iter == mAttributes.end() || !(iter->mPath == path))
     {
         err = CHIP_ERROR_KEY_NOT_FOUND;
         return nullptr;
     }
 
     err = CHIP_NO_ERROR;
-    return &endpointIter->second;
+    return &iter->mState;
 }
 
-AttributeCache::ClusterState * AttributeCache::GetClusterState(EndpointId endpointId, ClusterId clusterId, CHIP_ERROR & err)
+CHIP_ERROR AttributeCache::GetVersion(EndpointId endpointId, ClusterId clusterId, Optional<DataVersion> & aVersion)
 {
-    auto endpointState = GetEndpointState(endpointId, err);
-    if (err != CHIP_NO_ERROR)
+    auto iter = LowerBoundClusterDataVersion(endpointId, clusterId);
+    if (iter == mClusterDataVersions.end() || iter->mEndpointId != endpointId || iter->mClusterId != clusterId)
     {
-        return nullptr;
+        return CHIP_ERROR_KEY_NOT_FOUND;
     }
 
-    auto clusterState = endpointState->find(clusterId);
-    if (clusterState == endpointState->end())
-    {
-        err = CHIP_ERROR_KEY_NOT_FOUND;
-        return nullptr;
-    }
-
-    err = CHIP_NO_ERROR;
-    return &clusterState->second;
+    aVersion = iter->mCommittedDataVersion;
+    return CHIP_NO_ERROR;
 }
 
-AttributeCache::AttributeState * AttributeCache::GetAttributeState(EndpointId endpointId, ClusterId clusterId,
-                                                                   AttributeId attributeId, CHIP_ERROR & err)
+CHIP_ERROR AttributeCache::OnUpdateDataVersionFilterList(DataVersionFilterIBs::Builder & aDataVersionFilterIBsBuilder,
+                                                         const Span<AttributePathParams> & aAttributePaths,
+                                                         bool & aEncodedDataVersionList)
 {
-    auto clusterState = GetClusterState(endpointId, clusterId, err);
-    if (err != CHIP_NO_ERROR)
-    {
-        return nullptr;
-    }
+    aEncodedDataVersionList = false;
+
+    mRequestPaths.assign(aAttributePaths.begin(), aAttributePaths.end());
 
-    auto attributeState = clusterState->find(attributeId);
-    if (attributeState == clusterState->end())
+    for (auto & clusterDataVersion : mClusterDataVersions)
     {
-        err = CHIP_ERROR_KEY_NOT_FOUND;
-        return nullptr;
+        if (!clusterDataVersion.mCommittedDataVersion.HasValue() || !clusterDataVersion.mComplete)
+        {
+            continue;
+        }
+
+        DataVersionFilter filter(clusterDataVersion.mEndpointId, clusterDataVersion.mClusterId,
+                                 clusterDataVersion.mCommittedDataVersion.Value());
+
+        bool intersected = false;
+        for (auto & path : aAttributePaths)
+        {
+            if (path.IncludesAttributesInCluster(filter))
+            {
+                intersected = true;
+                break;
+            }
+        }
+
+        if (!intersected)
+        {
+            continue;
+        }
+
+        CHIP_ERROR err = ReadClient::EncodeDataVersionFilter(aDataVersionFilterIBsBuilder, filter);
+        if (err == CHIP_ERROR_NO_MEMORY)
+        {
+            //
+            // Out of space; the clusters that didn't make it in will just be reported in full.
+            //
+            break;
+        }
+        ReturnErrorOnFailure(err);
+
+        aEncodedDataVersionList = true;
     }
 
-    err = CHIP_NO_ERROR;
-    return &attributeState->second;
+    return CHIP_NO_ERROR;
 }
 
 CHIP_ERROR AttributeCache::GetStatus(const ConcreteAttributePath & path, StatusIB & status)
 {
     CHIP_ERROR err;
 
-    auto attributeState = GetAttributeState(path.mEndpointId, path.mClusterId, path.mAttributeId, err);
+    auto attributeState = GetAttributeState(path, err);
     ReturnErrorOnFailure(err);
 
     if (!attributeState->Is<StatusIB>())
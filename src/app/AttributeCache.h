@@ -26,9 +26,8 @@
 #include <app/ReadClient.h>
 #include <app/data-model/Decode.h>
 #include <lib/support/Variant.h>
+#include <algorithm>
 #include <list>
-#include <map>
-#include <set>
 #include <vector>
 
 namespace chip {
@@ -50,7 +49,9 @@ namespace app {
  * flexibility when dealing with interactions that use wildcards heavily.
  *
  * The data is stored internally in the cache as TLV. This permits re-use of the existing cluster objects
- * to de-serialize the state on-demand.
+ * to de-serialize the state on-demand. To keep per-node memory and allocation churn low when caching large
+ * wildcard subscriptions, attributes are indexed by path in a sorted flat vector and their TLV is packed
+ * into a single per-cache arena.
  *
  * The cache serves as a callback adapter as well in that it 'forwards' the ReadClient::Callback calls transparently
  * through to a registered callback. In addition, it provides its own enhancements to the base ReadClient::Callback
@@ -96,7 +97,7 @@ public:
      *
      * For some types of attributes, the value for the attribute is directly backed by the underlying TLV buffer
      * and has pointers into that buffer. (e.g octet strings, char strings and lists).  This buffer only remains
-     * valid until the cached value for that path is updated, so it must not be held
+     * valid until the cache is next updated, so it must not be held
      * across any async call boundaries.
      *
      * The template parameter AttributeObjectTypeT is generally expected to be a
@@ -157,7 +158,7 @@ public:
      *
      * For some types of attributes, the value for the attribute is directly backed by the underlying TLV buffer
      * and has pointers into that buffer. (e.g octet strings, char strings and lists).  This buffer only remains
-     * valid until the cached value for that path is updated, so it must not be held
+     * valid until the cache is next updated, so it must not be held
      * across any async call boundaries.
      *
      * The template parameter ClusterObjectT is generally expected to be a
@@ -203,7 +204,7 @@ public:
      * Retrieve the value of an attribute by updating a in-out TLVReader to be positioned
      * right at the attribute value.
      *
-     * The underlying TLV buffer only remains valid until the cached value for that path is updated, so it must
+     * The underlying TLV buffer only remains valid until the cache is next updated, so it must
      * not be held across any async call boundaries.
      *
      * Notable return values:
@@ -235,14 +236,15 @@ public:
     template <typename IteratorFunc>
     CHIP_ERROR ForEachAttribute(EndpointId endpointId, ClusterId clusterId, IteratorFunc func)
     {
-        CHIP_ERROR err;
-
-        auto clusterState = GetClusterState(endpointId, clusterId, err);
-        ReturnErrorOnFailure(err);
+        auto iter = LowerBound(ConcreteAttributePath(endpointId, clusterId, 0));
+        if (iter == mAttributes.end() || iter->mPath.mEndpointId != endpointId || iter->mPath.mClusterId != clusterId)
+        {
+            return CHIP_ERROR_KEY_NOT_FOUND;
+        }
 
-        for (auto & attributeIter : *clusterState)
+        for (; iter != mAttributes.end() && iter->mPath.mEndpointId == endpointId && iter->mPath.mClusterId == clusterId; ++iter)
         {
-            const ConcreteAttributePath path(endpointId, clusterId, attributeIter.first);
+            const ConcreteAttributePath path(iter->mPath);
             ReturnErrorOnFailure(func(path));
         }
 
@@ -265,20 +267,16 @@ public:
     template <typename IteratorFunc>
     CHIP_ERROR ForEachAttribute(ClusterId clusterId, IteratorFunc func)
     {
-        for (auto & endpointIter : mCache)
+        for (size_t i = 0; i < mAttributes.size(); i++)
         {
-            for (auto & clusterIter : endpointIter.second)
+            if (mAttributes[i].mPath.mClusterId == clusterId)
             {
-                if (clusterIter.first == clusterId)
-                {
-                    for (auto & attributeIter : clusterIter.second)
-                    {
-                        const ConcreteAttributePath path(endpointIter.first, clusterId, attributeIter.first);
-                        ReturnErrorOnFailure(func(path));
-                    }
-                }
+                const ConcreteAttributePath path(mAttributes[i].mPath);
+                ReturnErrorOnFailure(func(path));
             }
         }
+
+        return CHIP_NO_ERROR;
     }
 
     /*
@@ -297,37 +295,117 @@ public:
     template <typename IteratorFunc>
     CHIP_ERROR ForEachCluster(EndpointId endpointId, IteratorFunc func)
     {
-        auto endpointIter = mCache.find(endpointId);
-        if (endpointIter->first == endpointId)
+        for (auto iter = LowerBound(ConcreteAttributePath(endpointId, 0, 0));
+             iter != mAttributes.end() && iter->mPath.mEndpointId == endpointId;)
         {
-            for (auto & clusterIter : endpointIter->second)
+            const ClusterId clusterId = iter->mPath.mClusterId;
+            ReturnErrorOnFailure(func(clusterId));
+
+            //
+            // Attributes are sorted by path, so skip past the rest of this cluster's attributes.
+            //
+            while (iter != mAttributes.end() && iter->mPath.mEndpointId == endpointId && iter->mPath.mClusterId == clusterId)
             {
-                ReturnErrorOnFailure(func(clusterIter.first));
+                ++iter;
             }
         }
-    }
 
-private:
-    using AttributeState = Variant<System::PacketBufferHandle, StatusIB>;
-    using ClusterState   = std::map<AttributeId, AttributeState>;
-    using EndpointState  = std::map<ClusterId, ClusterState>;
-    using NodeState      = std::map<EndpointId, EndpointState>;
+        return CHIP_NO_ERROR;
+    }
 
     /*
-     * These functions provide a way to index into the cached state with different sub-sets of a path, returning
-     * appropriate slices of the data as requested.
+     * Retrieve the data version of a cluster instance, as last conveyed by a complete report covering it.
      *
-     * In all variants, the respective slice is returned if a valid path is provided. 'err' is updated to reflect
-     * the status of the operation.
+     * aVersion is left empty if the cluster instance is known but no report carrying a data version for it
+     * has completed yet.
      *
-     * Notable status values:
-     *      - If a cluster instance corresponding to endpointId and clusterId doesn't exist in the cache,
-     *        CHIP_ERROR_KEY_NOT_FOUND shall be returned.
+     * Notable return values:
+     *      - If the cluster instance doesn't exist in the cache, CHIP_ERROR_KEY_NOT_FOUND shall be returned.
+     *
+     */
+    CHIP_ERROR GetVersion(EndpointId endpointId, ClusterId clusterId, Optional<DataVersion> & aVersion);
+
+    /*
+     * Returns the number of bytes of attribute TLV currently held in the cache's arena, including any space
+     * left over by values that have since been replaced and not yet reclaimed.
+     */
+    size_t GetArenaSize() const { return mArena.size(); }
+
+private:
+    /*
+     * Locates the TLV-encoded value of an attribute within mArena.
+     */
+    struct DataSlot
+    {
+        uint32_t mOffset = 0;
+        uint32_t mLength = 0;
+    };
+
+    using AttributeState = Variant<DataSlot, StatusIB>;
+
+    struct AttributeEntry
+    {
+        ConcreteAttributePath mPath;
+        AttributeState mState;
+    };
+
+    /*
+     * Tracks the data version of a cluster instance. A version received during a report only becomes the committed
+     * version (and is used for data version filters) once the report has been received in its entirety.
      *
+     * mComplete is set when every attribute of the cluster instance in the cache is known to be at the committed version,
+     * i.e. the version was committed from a request that covered all the attributes of the cluster.
      */
-    EndpointState * GetEndpointState(EndpointId endpointId, CHIP_ERROR & err);
-    ClusterState * GetClusterState(EndpointId endpointId, ClusterId clusterId, CHIP_ERROR & err);
-    AttributeState * GetAttributeState(EndpointId endpointId, ClusterId clusterId, AttributeId attributeId, CHIP_ERROR & err);
+    struct ClusterDataVersion
+    {
+        EndpointId mEndpointId = kInvalidEndpointId;
+        ClusterId mClusterId   = kInvalidClusterId;
+        Optional<DataVersion> mCommittedDataVersion;
+        Optional<DataVersion> mPendingDataVersion;
+        bool mComplete = false;
+    };
+
+    //
+    // Once the space taken up by replaced values in the arena exceeds this threshold (and accounts for more than
+    // half of the arena), the arena is compacted at the end of the report.
+    //
+    static constexpr size_t kArenaCompactionThreshold = 1024;
+
+    /*
+     * Returns an iterator to the first entry whose path is not less than the provided path.
+     */
+    std::vector<AttributeEntry>::iterator LowerBound(const ConcreteAttributePath & path)
+    {
+        return std::lower_bound(mAttributes.begin(), mAttributes.end(), path,
+                                [](const AttributeEntry & entry, const ConcreteAttributePath & key) { return entry.mPath < key; });
+    }
+
+    /*
+     * Returns an iterator to the first tracked data version whose cluster instance is not less than the provided one.
+     */
+    std::vector<ClusterDataVersion>::iterator LowerBoundClusterDataVersion(EndpointId endpointId, ClusterId clusterId);
+
+    /*
+     * Returns the tracked data version state for a cluster instance, creating it if it doesn't exist yet.
+     */
+    ClusterDataVersion & GetOrCreateClusterDataVersion(EndpointId endpointId, ClusterId clusterId);
+
+    /*
+     * Whether the paths of the outstanding request cover every attribute of the given cluster instance.
+     */
+    bool RequestIncludesAllAttributes(EndpointId endpointId, ClusterId clusterId) const;
+
+    /*
+     * Returns the state of the attribute at the provided path, or nullptr with 'err' set to CHIP_ERROR_KEY_NOT_FOUND
+     * if there's no such attribute in the cache.
+     */
+    AttributeState * GetAttributeState(const ConcreteAttributePath & path, CHIP_ERROR & err);
+
+    /*
+     * Copies all live attribute values into a new, tightly packed arena, reclaiming the space
+     * occupied by replaced values.
+     */
+    void CompactArena();
 
     /*
      * Updates the state of an attribute in the cache given a reader. If the reader is null, the state is updated
@@ -350,13 +428,45 @@ private:
         return mCallback.OnEventData(apReadClient, aEventHeader, apData, apStatus);
     }
 
-    void OnDone(ReadClient * apReadClient) override { return mCallback.OnDone(apReadClient); }
+    void OnDone(ReadClient * apReadClient) override
+    {
+        mRequestPaths.clear();
+        return mCallback.OnDone(apReadClient);
+    }
     void OnSubscriptionEstablished(const ReadClient * apReadClient) override { mCallback.OnSubscriptionEstablished(apReadClient); }
 
+    //
+    // Encodes a data version filter for every cluster instance in the cache that is complete at its committed data version
+    // and is covered by the request's paths, so that re-subscribing or re-reading only pulls down clusters that have changed.
+    // Clusters the cache only holds some attributes of are not filtered, since the server would then omit the rest.
+    //
+    CHIP_ERROR OnUpdateDataVersionFilterList(DataVersionFilterIBs::Builder & aDataVersionFilterIBsBuilder,
+                                             const Span<AttributePathParams> & aAttributePaths,
+                                             bool & aEncodedDataVersionList) override;
+
 private:
     Callback & mCallback;
-    NodeState mCache;
-    std::set<ConcreteAttributePath> mChangedAttributeSet;
+
+    //
+    // Attribute state is kept sorted by path in a flat vector, with the TLV for all data values packed
+    // back-to-back in a single arena rather than in individual packet buffers.
+    //
+    std::vector<AttributeEntry> mAttributes;
+    std::vector<uint8_t> mArena;
+    size_t mArenaWaste = 0;
+
+    //
+    // Sorted by endpoint and cluster.
+    //
+    std::vector<ClusterDataVersion> mClusterDataVersions;
+
+    //
+    // The attribute paths of the outstanding request, as seen by OnUpdateDataVersionFilterList. Requests that carry their
+    // own data version filters are not seen there, so these are cleared once the ReadClient is done.
+    //
+    std::vector<AttributePathParams> mRequestPaths;
+
+    std::vector<ConcreteAttributePath> mChangedAttributes;
     std::vector<EndpointId> mAddedEndpoints;
     BufferedReadCallback mBufferedReader;
 };
@@ -21,6 +21,7 @@
 #include <app/util/basic-types.h>
 
 #include <app/ClusterInfo.h>
+#include <app/DataVersionFilter.h>
 
 namespace chip {
 namespace app {
@@ -60,6 +61,15 @@ struct AttributePathParams
      */
     bool IsValidAttributePath() const { return HasWildcardListIndex() || !HasWildcardAttributeId(); }
 
+    /**
+     * Check whether this path covers any attributes of the cluster instance referenced by the data version filter.
+     */
+    bool IncludesAttributesInCluster(const DataVersionFilter & other) const
+    {
+        return (HasWildcardEndpointId() || mEndpointId == other.mEndpointId) &&
+            (HasWildcardClusterId() || mClusterId == other.mClusterId);
+    }
+
     inline bool HasWildcardEndpointId() const { return mEndpointId == kInvalidEndpointId; }
     inline bool HasWildcardClusterId() const { return mClusterId == kInvalidClusterId; }
     inline bool HasWildcardAttributeId() const { return mAttributeId == kInvalidAttributeId; }
@@ -25,6 +25,9 @@
 #include <app/BufferedReadCallback.h>
 #include <app/InteractionModelEngine.h>
 #include <lib/support/ScopedBuffer.h>
+#include <lib/support/TypeTraits.h>
+#include <algorithm>
+#include <string.h>
 
 namespace chip {
 namespace app {
@@ -42,93 +45,154 @@ void BufferedReadCallback::OnReportEnd(const ReadClient * apReadClient)
         mCallback.OnError(apReadClient, err);
     }
 
+    //
+    // Don't hold on to the arena between reports, since it can be sizable after a large list.
+    //
+    mListArena.Free();
+    mListArenaSize   = 0;
+    mListArenaLength = 0;
+
     mCallback.OnReportEnd(apReadClient);
 }
 
-CHIP_ERROR BufferedReadCallback::GenerateListTLV(TLV::ScopedBufferTLVReader & aReader)
+CHIP_ERROR BufferedReadCallback::ReserveListArena(size_t aLength)
 {
-    TLV::TLVType outerType;
-    Platform::ScopedMemoryBuffer<uint8_t> backingBuffer;
+    if (mListArenaSize - mListArenaLength >= aLength)
+    {
+        return CHIP_NO_ERROR;
+    }
 
     //
-    // To generate the final reconstituted list, we need to allocate a contiguous
-    // buffer than can hold the entirety of its contents. To do so, we need to figure out
-    // how big a buffer to allocate. This requires walking the buffered list items and computing their TLV sizes,
-    // summing them all up and adding a bit of slop to account for the TLV array the list elements will go into.
-    //
-    // The alternative was to use a PacketBufferTLVWriter backed by chained packet buffers to
-    // write out the list - this would have removed the need for this first pass. However,
-    // we cannot actually back a TLVReader with a chained buffer since that violates the ability
-    // for us to create readers off-of readers. Each reader would assume exclusive ownership of the chained
-    // buffer and mutate the state within TLVPacketBufferBackingStore, preventing shared use.
+    // Grow geometrically so that the cost of copying the arena over as it grows stays linear in the size of the list.
     //
-    // To avoid that, a single contiguous buffer is the best likely approach for now.
-    //
-    uint32_t totalBufSize = 0;
-    for (size_t i = 0; i < mBufferedList.size(); i++)
+    size_t newSize = std::max(mListArenaSize * 2, mListArenaLength + aLength);
+    Platform::ScopedMemoryBuffer<uint8_t> newArena;
+
+    newArena.Alloc(newSize);
+    VerifyOrReturnError(newArena.Get() != nullptr, CHIP_ERROR_NO_MEMORY);
+
+    if (mListArenaLength > 0)
     {
-        totalBufSize += mBufferedList[i]->TotalLength();
+        memcpy(newArena.Get(), mListArena.Get(), mListArenaLength);
     }
 
-    //
-    // Size of the start container and end container are just 1 byte each, but, let's just be safe.
-    //
-    totalBufSize += 4;
+    mListArena.Free();
+    mListArena     = std::move(newArena);
+    mListArenaSize = newSize;
 
-    backingBuffer.Calloc(totalBufSize);
-    VerifyOrReturnError(backingBuffer.Get() != nullptr, CHIP_ERROR_NO_MEMORY);
+    return CHIP_NO_ERROR;
+}
 
-    TLV::ScopedBufferTLVWriter writer(std::move(backingBuffer), totalBufSize);
-    ReturnErrorOnFailure(writer.StartContainer(TLV::AnonymousTag, TLV::kTLVType_Array, outerType));
+CHIP_ERROR BufferedReadCallback::ResetListArena()
+{
+    mListArenaLength = 0;
 
-    for (auto & bufHandle : mBufferedList)
-    {
-        System::PacketBufferTLVReader reader;
+    ReturnErrorOnFailure(ReserveListArena(1));
+    mListArena[mListArenaLength++] =
+        static_cast<uint8_t>(to_underlying(TLV::TLVTagControl::Anonymous) | to_underlying(TLV::TLVElementType::Array));
 
-        reader.Init(std::move(bufHandle));
+    return CHIP_NO_ERROR;
+}
 
-        ReturnErrorOnFailure(reader.Next());
-        ReturnErrorOnFailure(writer.CopyElement(TLV::AnonymousTag, reader));
+CHIP_ERROR BufferedReadCallback::GenerateListTLV(TLV::TLVReader & aReader)
+{
+    //
+    // The arena already holds the start of the array and every list item, so all that's left is to terminate the array.
+    //
+    if (mListArenaLength == 0)
+    {
+        ReturnErrorOnFailure(ResetListArena());
     }
 
-    ReturnErrorOnFailure(writer.EndContainer(outerType));
-
-    writer.Finalize(backingBuffer);
+    ReturnErrorOnFailure(ReserveListArena(1));
+    mListArena[mListArenaLength++] = static_cast<uint8_t>(to_underlying(TLV::TLVElementType::EndOfContainer));
 
-    aReader.Init(std::move(backingBuffer), totalBufSize);
+    aReader.Init(mListArena.Get(), mListArenaLength);
 
     return CHIP_NO_ERROR;
 }
 
 CHIP_ERROR BufferedReadCallback::BufferListItem(TLV::TLVReader & reader)
 {
-    System::PacketBufferTLVWriter writer;
-    System::PacketBufferHandle handle;
-
     //
-    // We conservatively allocate a packet buffer as big as an IPv6 MTU (since we're buffering
-    // data received over the wire, which should always fit within that).
+    // We conservatively reserve as much as an IPv6 MTU (since we're buffering
+    // data received over the wire, which should always fit within that), and only
+    // advance the arena by what was actually written.
     //
     // We could have snapshotted the reader at its current position, advanced it past the current element
-    // and computed the delta in its read point to figure out the size of the element before allocating
-    // our target buffer. However, the reader's current position is already set past the control octet
+    // and computed the delta in its read point to figure out the size of the element before reserving
+    // space. However, the reader's current position is already set past the control octet
     // and the tag. Consequently, the computed size is always going to omit the sizes of these two parts of the
     // TLV element. Since the tag can vary in size, for now, let's just do the safe thing. In the future, if this is a problem,
     // we can improve this.
     //
-    handle = System::PacketBufferHandle::New(chip::app::kMaxSecureSduLengthBytes);
+    TLV::TLVWriter writer;
+
+    if (mListArenaLength == 0)
+    {
+        ReturnErrorOnFailure(ResetListArena());
+    }
 
-    writer.Init(std::move(handle), false);
+    ReturnErrorOnFailure(ReserveListArena(chip::app::kMaxSecureSduLengthBytes));
+
+    writer.Init(mListArena.Get() + mListArenaLength, mListArenaSize - mListArenaLength);
 
     ReturnErrorOnFailure(writer.CopyElement(TLV::AnonymousTag, reader));
-    ReturnErrorOnFailure(writer.Finalize(&handle));
+    ReturnErrorOnFailure(writer.Finalize());
 
-    // Compact the buffer down to a more reasonably sized packet buffer
-    // if we can.
-    //
-    handle.RightSize();
+    mListArenaLength += writer.GetLengthWritten();
 
-    mBufferedList.push_back(std::move(handle));
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR BufferedReadCallback::StreamData(const ReadClient * apReadClient, const ConcreteDataAttributePath & aPath,
+                                            TLV::TLVReader * apData)
+{
+    StatusIB statusIB;
+    ConcreteDataAttributePath path = aPath;
+
+    if (aPath.mListOp == ConcreteDataAttributePath::ListOperation::ReplaceAll)
+    {
+        TLV::TLVType outerContainer;
+        TLV::TLVReader emptyListReader;
+        const uint8_t emptyList[] = {
+            static_cast<uint8_t>(to_underlying(TLV::TLVTagControl::Anonymous) | to_underlying(TLV::TLVElementType::Array)),
+            static_cast<uint8_t>(to_underlying(TLV::TLVElementType::EndOfContainer)),
+        };
+
+        VerifyOrReturnError(apData->GetType() == TLV::kTLVType_Array, CHIP_ERROR_INVALID_TLV_ELEMENT);
+
+        //
+        // Signal the start of the list (and the clearing of any previous contents) with an empty list.
+        //
+        emptyListReader.Init(emptyList);
+        ReturnErrorOnFailure(emptyListReader.Next());
+        mCallback.OnAttributeData(apReadClient, path, &emptyListReader, statusIB);
+
+        path.mListOp = ConcreteDataAttributePath::ListOperation::AppendItem;
+
+        ReturnErrorOnFailure(apData->EnterContainer(outerContainer));
+
+        CHIP_ERROR err;
+
+        while ((err = apData->Next()) == CHIP_NO_ERROR)
+        {
+            TLV::TLVReader itemReader(*apData);
+            mCallback.OnAttributeData(apReadClient, path, &itemReader, statusIB);
+        }
+
+        if (err == CHIP_END_OF_TLV)
+        {
+            err = CHIP_NO_ERROR;
+        }
+
+        ReturnErrorOnFailure(err);
+        ReturnErrorOnFailure(apData->ExitContainer(outerContainer));
+    }
+    else if (aPath.mListOp == ConcreteDataAttributePath::ListOperation::AppendItem)
+    {
+        mCallback.OnAttributeData(apReadClient, path, apData, statusIB);
+    }
 
     return CHIP_NO_ERROR;
 }
@@ -141,7 +205,7 @@ CHIP_ERROR BufferedReadCallback::BufferData(const ConcreteDataAttributePath & aP
         TLV::TLVType outerContainer;
 
         VerifyOrReturnError(apData->GetType() == TLV::kTLVType_Array, CHIP_ERROR_INVALID_TLV_ELEMENT);
-        mBufferedList.clear();
+        ReturnErrorOnFailure(ResetListArena());
 
         ReturnErrorOnFailure(apData->EnterContainer(outerContainer));
 
@@ -200,7 +264,7 @@ CHIP_ERROR BufferedReadCallback::DispatchBufferedData(const ReadClient * apReadC
     }
 
     StatusIB statusIB;
-    TLV::ScopedBufferTLVReader reader;
+    TLV::TLVReader reader;
 
     ReturnErrorOnFailure(GenerateListTLV(reader));
 
@@ -218,10 +282,10 @@ CHIP_ERROR BufferedReadCallback::DispatchBufferedData(const ReadClient * apReadC
     mCallback.OnAttributeData(apReadClient, mBufferedPath, &reader, statusIB);
 
     //
-    // Clear out our buffered contents to free up allocated buffers, and reset the buffered path.
+    // Clear out our buffered contents so the arena can be re-used for the next list, and reset the buffered path.
     //
-    mBufferedList.clear();
-    mBufferedPath = ConcreteDataAttributePath();
+    mListArenaLength = 0;
+    mBufferedPath    = ConcreteDataAttributePath();
 
     return CHIP_NO_ERROR;
 }
@@ -238,8 +302,21 @@ void BufferedReadCallback::OnAttributeData(const ReadClient * apReadClient, cons
     SuccessOrExit(err);
 
     //
-    // We buffer up list data (only if the status was successful)
+    // We buffer up list data (only if the status was successful), or stream it straight through if configured to.
     //
+    if (aPath.IsListOperation() && aStatus.mStatus == Protocols::InteractionModel::Status::Success &&
+        mMode == ListDeliveryMode::kStreaming)
+    {
+        err = StreamData(apReadClient, aPath, apData);
+        SuccessOrExit(err);
+
+        //
+        // Nothing was buffered, so there's no list path to latch.
+        //
+        mBufferedPath = ConcreteDataAttributePath();
+        ExitNow();
+    }
+
     if (aPath.IsListOperation() && aStatus.mStatus == Protocols::InteractionModel::Status::Success)
     {
         err = BufferData(aPath, apData);
@@ -23,7 +23,7 @@
 #include "system/TLVPacketBufferBackingStore.h"
 #include <app/AttributePathParams.h>
 #include <app/ReadClient.h>
-#include <vector>
+#include <lib/support/ScopedBuffer.h>
 
 namespace chip {
 namespace app {
@@ -34,17 +34,48 @@ namespace app {
  * upon completion of delivery of all chunks. This is then delivered to a compliant ReadClient::Callback
  * without any awareness on their part that chunking happened.
  *
+ * List items are copied once, as they arrive, into a single growing arena that already holds the TLV array
+ * they will be delivered in, so no separate re-encoding pass over the list is needed.
+ *
+ * Alternatively, in streaming mode, nothing is buffered: every list is delivered as a ReplaceAll of an empty list
+ * followed by an AppendItem for each item as soon as the chunk carrying it arrives, regardless of how the list was
+ * split up over the wire. This suits consumers that process large lists item-by-item and never need the whole
+ * list in memory at once.
+ *
  */
 class BufferedReadCallback : public ReadClient::Callback
 {
 public:
-    BufferedReadCallback(Callback & callback) : mCallback(callback) {}
+    enum class ListDeliveryMode : uint8_t
+    {
+        kReassemble, ///< Deliver each list as a single ReplaceAll once all of its chunks have been received.
+        kStreaming,  ///< Deliver each list as an empty ReplaceAll followed by one AppendItem per item, as they arrive.
+    };
+
+    BufferedReadCallback(Callback & callback, ListDeliveryMode mode = ListDeliveryMode::kReassemble) :
+        mCallback(callback), mMode(mode)
+    {}
 
 private:
     /*
-     * Generates the reconsistuted TLV array from the stored individual list elements
+     * Terminates the TLV array in the list arena and positions the provided reader on it.
+     */
+    CHIP_ERROR GenerateListTLV(TLV::TLVReader & reader);
+
+    /*
+     * Deliver list data straight through to the registered callback as individual items (streaming mode).
+     */
+    CHIP_ERROR StreamData(const ReadClient * apReadClient, const ConcreteDataAttributePath & aPath, TLV::TLVReader * apData);
+
+    /*
+     * Ensure that at least aLength bytes are available at the tail of the list arena, growing it as necessary.
      */
-    CHIP_ERROR GenerateListTLV(TLV::ScopedBufferTLVReader & reader);
+    CHIP_ERROR ReserveListArena(size_t aLength);
+
+    /*
+     * Reset the list arena to hold just the start of an empty TLV array.
+     */
+    CHIP_ERROR ResetListArena();
 
     /*
      * Dispatch any buffered list data if we need to. Buffered data will only be dispatched if:
@@ -81,11 +112,17 @@ private:
 
     void OnDone(ReadClient * apReadClient) override { return mCallback.OnDone(apReadClient); }
     void OnSubscriptionEstablished(const ReadClient * apReadClient) override { mCallback.OnSubscriptionEstablished(apReadClient); }
+    CHIP_ERROR OnUpdateDataVersionFilterList(DataVersionFilterIBs::Builder & aDataVersionFilterIBsBuilder,
+                                             const Span<AttributePathParams> & aAttributePaths,
+                                             bool & aEncodedDataVersionList) override
+    {
+        return mCallback.OnUpdateDataVersionFilterList(aDataVersionFilterIBsBuilder, aAttributePaths, aEncodedDataVersionList);
+    }
 
 private:
     /*
-     * Given a reader positioned at a list element, allocate a packet buffer, copy the list item where
-     * the reader is positioned into that buffer and add it to our buffered list for tracking.
+     * Given a reader positioned at a list element, copy the list item where the reader is positioned onto the
+     * tail of the list arena.
      *
      * This should be called in list index order starting from the lowest index that needs to be buffered.
      *
@@ -93,8 +130,17 @@ private:
     CHIP_ERROR BufferListItem(TLV::TLVReader & reader);
 
     ConcreteDataAttributePath mBufferedPath;
-    std::vector<System::PacketBufferHandle> mBufferedList;
+
+    //
+    // The list arena holds the start of the TLV array followed by every list item buffered so far, back-to-back.
+    // It is released at the end of every report.
+    //
+    Platform::ScopedMemoryBuffer<uint8_t> mListArena;
+    size_t mListArenaSize   = 0;
+    size_t mListArenaLength = 0;
+
     Callback & mCallback;
+    ListDeliveryMode mMode;
 };
 
 } // namespace app
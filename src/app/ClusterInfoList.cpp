@@ -0,0 +1,148 @@
+/*
+ *
+ *    Copyright (c) 2022 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <app/ClusterInfoList.h>
+
+#include <lib/support/CHIPMem.h>
+#include <lib/support/CodeUtils.h>
+
+#include <algorithm>
+
+namespace chip {
+namespace app {
+
+namespace {
+
+constexpr size_t kInitialCapacity = 4;
+
+bool IsOrderedBefore(const ClusterInfo & aLeft, const ClusterInfo & aRight)
+{
+    if (aLeft.mEndpointId != aRight.mEndpointId)
+    {
+        return aLeft.mEndpointId < aRight.mEndpointId;
+    }
+    if (aLeft.mClusterId != aRight.mClusterId)
+    {
+        return aLeft.mClusterId < aRight.mClusterId;
+    }
+    if (aLeft.mAttributeId != aRight.mAttributeId)
+    {
+        return aLeft.mAttributeId < aRight.mAttributeId;
+    }
+    return aLeft.mEventId < aRight.mEventId;
+}
+
+} // namespace
+
+CHIP_ERROR ClusterInfoList::Insert(const ClusterInfo & aPath)
+{
+    if (mSize == mCapacity)
+    {
+        const size_t capacity = (mCapacity == 0) ? kInitialCapacity : mCapacity * 2;
+        auto * paths          = static_cast<ClusterInfo *>(Platform::MemoryRealloc(mpPaths, capacity * sizeof(ClusterInfo)));
+        VerifyOrReturnError(paths != nullptr, CHIP_ERROR_NO_MEMORY);
+        mpPaths   = paths;
+        mCapacity = capacity;
+    }
+
+    // Equal paths keep their request order
+    ClusterInfo * position = std::upper_bound(mpPaths, mpPaths + mSize, aPath, IsOrderedBefore);
+    std::copy_backward(position, mpPaths + mSize, mpPaths + mSize + 1);
+    *position = aPath;
+    mSize++;
+
+    Relink();
+    return CHIP_NO_ERROR;
+}
+
+void ClusterInfoList::Release()
+{
+    if (mpPaths != nullptr)
+    {
+        Platform::MemoryFree(mpPaths);
+    }
+
+    mpPaths   = nullptr;
+    mSize     = 0;
+    mCapacity = 0;
+}
+
+void ClusterInfoList::Relink()
+{
+    for (size_t index = 0; index < mSize; index++)
+    {
+        mpPaths[index].mpNext = (index + 1 < mSize) ? &mpPaths[index + 1] : nullptr;
+    }
+}
+
+template <typename Predicate>
+bool ClusterInfoList::AnyMatchingPathInCluster(const ClusterInfo * aFirst, const ClusterInfo * aLast, ClusterId aClusterId,
+                                               Predicate aPredicate) const
+{
+    auto first = std::lower_bound(aFirst, aLast, aClusterId,
+                                  [](const ClusterInfo & path, ClusterId clusterId) { return path.mClusterId < clusterId; });
+    auto last  = std::upper_bound(first, aLast, aClusterId,
+                                 [](ClusterId clusterId, const ClusterInfo & path) { return clusterId < path.mClusterId; });
+    return std::any_of(first, last, aPredicate);
+}
+
+template <typename Predicate>
+bool ClusterInfoList::AnyMatchingPath(EndpointId aEndpointId, ClusterId aClusterId, Predicate aPredicate) const
+{
+    // A wildcard endpoint may match any entry
+    if (aEndpointId == kInvalidEndpointId)
+    {
+        return std::any_of(begin(), end(), aPredicate);
+    }
+
+    // Otherwise only entries on that endpoint or on the wildcard endpoint may match, and the same goes for the cluster
+    for (EndpointId endpointId : { aEndpointId, kInvalidEndpointId })
+    {
+        auto first = std::lower_bound(begin(), end(), endpointId,
+                                      [](const ClusterInfo & path, EndpointId id) { return path.mEndpointId < id; });
+        auto last  = std::upper_bound(first, end(), endpointId,
+                                     [](EndpointId id, const ClusterInfo & path) { return id < path.mEndpointId; });
+
+        if (aClusterId == kInvalidClusterId)
+        {
+            VerifyOrReturnError(!std::any_of(first, last, aPredicate), true);
+            continue;
+        }
+
+        VerifyOrReturnError(!AnyMatchingPathInCluster(first, last, aClusterId, aPredicate), true);
+        VerifyOrReturnError(!AnyMatchingPathInCluster(first, last, kInvalidClusterId, aPredicate), true);
+    }
+
+    return false;
+}
+
+bool ClusterInfoList::IntersectsAttributePath(const ClusterInfo & aPath) const
+{
+    return AnyMatchingPath(aPath.mEndpointId, aPath.mClusterId, [&aPath](const ClusterInfo & path) {
+        return path.IsAttributePathSupersetOf(aPath) || aPath.IsAttributePathSupersetOf(path);
+    });
+}
+
+bool ClusterInfoList::HasEventPathSupersetOf(const ConcreteEventPath & aPath) const
+{
+    return AnyMatchingPath(aPath.mEndpointId, aPath.mClusterId,
+                           [&aPath](const ClusterInfo & path) { return path.IsEventPathSupersetOf(aPath); });
+}
+
+} // namespace app
+} // namespace chip
@@ -0,0 +1,93 @@
+/*
+ *
+ *    Copyright (c) 2022 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#pragma once
+
+#include <app/ClusterInfo.h>
+#include <app/ConcreteEventPath.h>
+#include <lib/core/CHIPError.h>
+
+#include <stddef.h>
+
+namespace chip {
+namespace app {
+
+/**
+ * ClusterInfoList holds the attribute or event paths requested by a ReadHandler in a single heap allocated array, grown on
+ * demand. The list itself is unbounded: ReadHandler limits the paths of an interaction to
+ * CHIP_IM_MAX_NUM_PATHS_PER_READ_HANDLER.
+ *
+ * Entries are kept sorted by endpoint, cluster and attribute / event id. Wildcards use the largest value of each field and
+ * therefore sort last, which lets the paths intersecting a concrete endpoint and cluster be found with a binary search.
+ *
+ * The entries are also chained in order through their mpNext field, so Head() can be given to code walking a ClusterInfo
+ * linked list such as AttributePathExpandIterator. The chain is only valid until the next call to Insert() or Release().
+ */
+class ClusterInfoList
+{
+public:
+    ClusterInfoList() = default;
+    ~ClusterInfoList() { Release(); }
+
+    ClusterInfoList(const ClusterInfoList &) = delete;
+    ClusterInfoList & operator=(const ClusterInfoList &) = delete;
+
+    /**
+     * Insert a copy of aPath at its sorted position.
+     *
+     * @retval #CHIP_ERROR_NO_MEMORY if the array could not be grown.
+     */
+    CHIP_ERROR Insert(const ClusterInfo & aPath);
+
+    /**
+     * Remove all the paths and free the array.
+     */
+    void Release();
+
+    size_t Size() const { return mSize; }
+    bool IsEmpty() const { return mSize == 0; }
+
+    ClusterInfo * Head() const { return mSize > 0 ? mpPaths : nullptr; }
+    const ClusterInfo * begin() const { return mpPaths; }
+    const ClusterInfo * end() const { return mpPaths + mSize; }
+
+    /**
+     * Returns whether a path of the list is a superset or a subset of the attribute path aPath, which may contain wildcards.
+     */
+    bool IntersectsAttributePath(const ClusterInfo & aPath) const;
+
+    /**
+     * Returns whether a path of the list is a superset of the event path aPath.
+     */
+    bool HasEventPathSupersetOf(const ConcreteEventPath & aPath) const;
+
+private:
+    template <typename Predicate>
+    bool AnyMatchingPath(EndpointId aEndpointId, ClusterId aClusterId, Predicate aPredicate) const;
+    template <typename Predicate>
+    bool AnyMatchingPathInCluster(const ClusterInfo * aFirst, const ClusterInfo * aLast, ClusterId aClusterId,
+                                  Predicate aPredicate) const;
+    void Relink();
+
+    ClusterInfo * mpPaths = nullptr;
+    size_t mSize          = 0;
+    size_t mCapacity      = 0;
+};
+
+} // namespace app
+} // namespace chip
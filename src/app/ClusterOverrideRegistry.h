@@ -0,0 +1,196 @@
+/*
+ *
+ *    Copyright (c) 2022 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#pragma once
+
+#include <lib/core/CHIPConfig.h>
+#include <lib/core/DataModelTypes.h>
+
+#include <stddef.h>
+#include <stdint.h>
+
+namespace chip {
+namespace app {
+
+/**
+ * An index of cluster overrides (AttributeAccessInterface, CommandHandlerInterface) keyed by endpoint and cluster.
+ *
+ * Overrides are chained through their own SetNext()/GetNext() links into a fixed number of hash buckets, so the registry never
+ * allocates. An override registered for one endpoint is filed under (endpoint, cluster) and one registered for all endpoints
+ * under (kInvalidEndpointId, cluster), so a lookup only walks the two buckets that can hold a match instead of every
+ * registered override.
+ *
+ * T must provide GetEndpointId(), GetClusterId(), SetNext(), GetNext(), Matches(EndpointId, ClusterId), Matches(const T &) and
+ * MatchesEndpoint(EndpointId).
+ */
+template <typename T, size_t kBucketCount = CHIP_IM_OVERRIDE_REGISTRY_BUCKETS>
+class ClusterOverrideRegistry
+{
+public:
+    static_assert(kBucketCount > 0, "ClusterOverrideRegistry needs at least one bucket");
+
+    /**
+     * Add aOverride to the registry.
+     *
+     * Returns false, and leaves the registry unchanged, if an override that handles any of the same endpoint+cluster
+     * pairs is already registered.
+     */
+    bool Register(T * aOverride)
+    {
+        if (FindConflict(*aOverride) != nullptr)
+        {
+            return false;
+        }
+
+        T *& head = mBuckets[BucketIndex(KeyEndpoint(*aOverride), aOverride->GetClusterId())];
+        aOverride->SetNext(head);
+        head = aOverride;
+        return true;
+    }
+
+    /**
+     * Remove the registered override that handles the same endpoint+cluster pairs as aOverride.
+     *
+     * Returns false if there is no such override.
+     */
+    bool Unregister(const T & aOverride)
+    {
+        return RemoveIf([&aOverride](const T & aCandidate) { return aCandidate.Matches(aOverride); }, true) > 0;
+    }
+
+    /**
+     * Remove all the overrides registered for the specific endpoint aEndpointId. Overrides registered for all endpoints are
+     * kept.
+     */
+    void UnregisterEndpoint(EndpointId aEndpointId)
+    {
+        RemoveIf([aEndpointId](const T & aCandidate) { return aCandidate.MatchesEndpoint(aEndpointId); }, false);
+    }
+
+    /**
+     * Remove all the registered overrides.
+     */
+    void Clear() { RemoveIf([](const T &) { return true; }, false); }
+
+    /**
+     * Find the override to use for aEndpointId+aClusterId. An override registered for that specific endpoint is preferred
+     * over one registered for all endpoints (registration makes sure there are never both).
+     */
+    T * Find(EndpointId aEndpointId, ClusterId aClusterId) const
+    {
+        T * found = FindInBucket(aEndpointId, aClusterId, aEndpointId);
+        if (found == nullptr && aEndpointId != kInvalidEndpointId)
+        {
+            found = FindInBucket(kInvalidEndpointId, aClusterId, aEndpointId);
+        }
+        return found;
+    }
+
+private:
+    static EndpointId KeyEndpoint(const T & aOverride)
+    {
+        return aOverride.GetEndpointId().HasValue() ? aOverride.GetEndpointId().Value() : kInvalidEndpointId;
+    }
+
+    static size_t BucketIndex(EndpointId aEndpointId, ClusterId aClusterId)
+    {
+        // Standard cluster ids only use the low half, vendor-specific ones carry the vendor prefix in the high half: fold it in
+        // so clusters of different vendors do not all collide.
+        uint32_t hash = (aClusterId ^ (aClusterId >> 16)) * 31u + aEndpointId;
+        return hash % kBucketCount;
+    }
+
+    T * FindInBucket(EndpointId aKeyEndpointId, ClusterId aClusterId, EndpointId aEndpointId) const
+    {
+        for (T * cur = mBuckets[BucketIndex(aKeyEndpointId, aClusterId)]; cur != nullptr; cur = cur->GetNext())
+        {
+            if (cur->Matches(aEndpointId, aClusterId))
+            {
+                return cur;
+            }
+        }
+        return nullptr;
+    }
+
+    T * FindConflict(const T & aOverride) const
+    {
+        const ClusterId clusterId = aOverride.GetClusterId();
+        if (aOverride.GetEndpointId().HasValue())
+        {
+            // Only an override for the same endpoint or for all endpoints can conflict, and Find() looks at exactly those.
+            return Find(aOverride.GetEndpointId().Value(), clusterId);
+        }
+
+        // An override for all endpoints conflicts with any override of the cluster, wherever it is filed.
+        for (T * head : mBuckets)
+        {
+            for (T * cur = head; cur != nullptr; cur = cur->GetNext())
+            {
+                if (cur->Matches(aOverride))
+                {
+                    return cur;
+                }
+            }
+        }
+        return nullptr;
+    }
+
+    template <typename Predicate>
+    size_t RemoveIf(Predicate aPredicate, bool aFirstOnly)
+    {
+        size_t removed = 0;
+        for (T *& head : mBuckets)
+        {
+            T * prev = nullptr;
+            T * cur  = head;
+            while (cur != nullptr)
+            {
+                T * next = cur->GetNext();
+                if (aPredicate(*cur))
+                {
+                    if (prev == nullptr)
+                    {
+                        head = next;
+                    }
+                    else
+                    {
+                        prev->SetNext(next);
+                    }
+                    cur->SetNext(nullptr);
+
+                    if (aFirstOnly)
+                    {
+                        return 1;
+                    }
+                    ++removed;
+                }
+                else
+                {
+                    prev = cur;
+                }
+                cur = next;
+            }
+        }
+        return removed;
+    }
+
+    T * mBuckets[kBucketCount] = {};
+};
+
+} // namespace app
+} // namespace chip
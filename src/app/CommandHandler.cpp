@@ -34,6 +34,37 @@
 namespace chip {
 namespace app {
 
+namespace {
+
+size_t EncodedCommandPathSize(TLV::Tag aTag, const ConcreteCommandPath & aCommandPath)
+{
+    size_t size = TLV::EncodedContainerOverhead(aTag);
+    size += TLV::EncodedUnsignedIntegerSize(TLV::ContextTag(CommandPathIB::kCsTag_EndpointId), aCommandPath.mEndpointId);
+    size += TLV::EncodedUnsignedIntegerSize(TLV::ContextTag(CommandPathIB::kCsTag_ClusterId), aCommandPath.mClusterId);
+    size += TLV::EncodedUnsignedIntegerSize(TLV::ContextTag(CommandPathIB::kCsTag_CommandId), aCommandPath.mCommandId);
+    return size;
+}
+
+// Size of an InvokeResponseIB carrying a status, as written by AddStatusInternal
+size_t EncodedStatusResponseSize(const ConcreteCommandPath & aCommandPath, const Protocols::InteractionModel::Status aStatus,
+                                 const Optional<ClusterStatus> & aClusterStatus)
+{
+    const auto StatusTag = [](StatusIB::Tag tag) { return TLV::ContextTag(to_underlying(tag)); };
+
+    size_t size = TLV::EncodedContainerOverhead(TLV::AnonymousTag);
+    size += TLV::EncodedContainerOverhead(TLV::ContextTag(to_underlying(InvokeResponseIB::Tag::kStatus)));
+    size += EncodedCommandPathSize(TLV::ContextTag(to_underlying(CommandStatusIB::Tag::kPath)), aCommandPath);
+    size += TLV::EncodedContainerOverhead(TLV::ContextTag(to_underlying(CommandStatusIB::Tag::kErrorStatus)));
+    size += TLV::EncodedUnsignedIntegerSize(StatusTag(StatusIB::Tag::kStatus), to_underlying(aStatus));
+    if (aClusterStatus.HasValue())
+    {
+        size += TLV::EncodedUnsignedIntegerSize(StatusTag(StatusIB::Tag::kClusterStatus), aClusterStatus.Value());
+    }
+    return size;
+}
+
+} // namespace
+
 CommandHandler::CommandHandler(Callback * apCallback) : mpCallback(apCallback), mSuppressResponse(false) {}
 
 CHIP_ERROR CommandHandler::AllocateBuffer()
@@ -42,10 +73,17 @@ CHIP_ERROR CommandHandler::AllocateBuffer()
     {
         mCommandMessageWriter.Reset();
 
-        System::PacketBufferHandle commandPacket = System::PacketBufferHandle::New(chip::app::kMaxSecureSduLengthBytes);
-        VerifyOrReturnError(!commandPacket.IsNull(), CHIP_ERROR_NO_MEMORY);
+        // Responses sent over a TCP session may be larger than kMaxSecureSduLengthBytes.
+        size_t maxPayloadSize = kMaxSecureSduLengthBytes;
+        if (mpExchangeCtx != nullptr && mpExchangeCtx->GetExchangeMgr()->GetSessionManager() != nullptr)
+        {
+            maxPayloadSize = mpExchangeCtx->GetExchangeMgr()->GetSessionManager()->GetMaxPayloadSize(
+                mpExchangeCtx->GetSessionHandle(), kMaxSecureSduLengthBytes);
+        }
 
-        mCommandMessageWriter.Init(std::move(commandPacket));
+        // With CHIP_SYSTEM_CONFIG_PACKETBUFFER_CHAIN_BLOCK_SIZE set, grow the response buffer as commands are added rather than
+        // holding a full-size buffer for a small status response
+        ReturnErrorOnFailure(mCommandMessageWriter.InitChained(static_cast<uint32_t>(maxPayloadSize)));
         ReturnErrorOnFailure(mInvokeResponseBuilder.Init(&mCommandMessageWriter));
 
         mInvokeResponseBuilder.SuppressResponse(mSuppressResponse);
@@ -98,6 +136,9 @@ CHIP_ERROR CommandHandler::ProcessInvokeRequest(System::PacketBufferHandle && pa
     ReturnErrorOnFailure(invokeRequestMessage.GetTimedRequest(&mTimedRequest));
     ReturnErrorOnFailure(invokeRequestMessage.GetInvokeRequests(&invokeRequests));
 
+    mCheckedEndpointId = kInvalidEndpointId;
+    mCheckedClusterId  = kInvalidClusterId;
+
     if (mTimedRequest != isTimedInvoke)
     {
         // The message thinks it should be part of a timed interaction but it's
@@ -254,11 +295,8 @@ CHIP_ERROR CommandHandler::ProcessCommandDataIB(CommandDataIB::Parser & aCommand
     VerifyOrExit(mpCallback->CommandExists(concretePath), err = CHIP_ERROR_INVALID_PROFILE_ID);
 
     {
-        Access::SubjectDescriptor subjectDescriptor; // TODO: get actual subject descriptor
-        Access::RequestPath requestPath{ .cluster = concretePath.mClusterId, .endpoint = concretePath.mEndpointId };
         Access::Privilege requestPrivilege = Access::Privilege::kOperate; // TODO: get actual request privilege
-        err                                = Access::GetAccessControl().Check(subjectDescriptor, requestPath, requestPrivilege);
-        err                                = CHIP_NO_ERROR; // TODO: remove override
+        err                                = CheckAccess(concretePath, requestPrivilege);
         if (err != CHIP_NO_ERROR)
         {
             if (err != CHIP_ERROR_ACCESS_DENIED)
@@ -311,11 +349,50 @@ exit:
     return CHIP_NO_ERROR;
 }
 
+CHIP_ERROR CommandHandler::CheckAccess(const ConcreteCommandPath & aCommandPath, Access::Privilege aRequestPrivilege)
+{
+    // Access is granted per cluster, so consecutive commands of a request addressed to the same cluster share one check
+    if (aCommandPath.mEndpointId != mCheckedEndpointId || aCommandPath.mClusterId != mCheckedClusterId ||
+        aRequestPrivilege != mCheckedPrivilege)
+    {
+        Access::SubjectDescriptor subjectDescriptor; // TODO: get actual subject descriptor
+        Access::RequestPath requestPath{ .cluster = aCommandPath.mClusterId, .endpoint = aCommandPath.mEndpointId };
+        mCheckedAccessResult = Access::GetAccessControl().Check(subjectDescriptor, requestPath, aRequestPrivilege);
+        mCheckedAccessResult = CHIP_NO_ERROR; // TODO: remove override
+        mCheckedEndpointId   = aCommandPath.mEndpointId;
+        mCheckedClusterId    = aCommandPath.mClusterId;
+        mCheckedPrivilege    = aRequestPrivilege;
+    }
+    return mCheckedAccessResult;
+}
+
+CHIP_ERROR CommandHandler::CheckResponseFits(const ConcreteCommandPath & aCommandPath, size_t aResponseSize)
+{
+    ReturnErrorOnFailure(AllocateBuffer());
+    if (aResponseSize > mCommandMessageWriter.GetTotalRemainingFreeLength())
+    {
+        ChipLogError(DataManagement,
+                     "No room for the response to Endpoint=%" PRIu16 " Cluster=" ChipLogFormatMEI " Command=" ChipLogFormatMEI,
+                     aCommandPath.mEndpointId, ChipLogValueMEI(aCommandPath.mClusterId), ChipLogValueMEI(aCommandPath.mCommandId));
+        return CHIP_ERROR_BUFFER_TOO_SMALL;
+    }
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR CommandHandler::CheckCommandResponseFits(const ConcreteCommandPath & aCommandPath, size_t aDataSize)
+{
+    size_t size = TLV::EncodedContainerOverhead(TLV::AnonymousTag);
+    size += TLV::EncodedContainerOverhead(TLV::ContextTag(to_underlying(InvokeResponseIB::Tag::kCommand)));
+    size += EncodedCommandPathSize(TLV::ContextTag(to_underlying(CommandDataIB::Tag::kPath)), aCommandPath);
+    return CheckResponseFits(aCommandPath, size + aDataSize);
+}
+
 CHIP_ERROR CommandHandler::AddStatusInternal(const ConcreteCommandPath & aCommandPath,
                                              const Protocols::InteractionModel::Status aStatus,
                                              const Optional<ClusterStatus> & aClusterStatus)
 {
     StatusIB statusIB;
+    ReturnErrorOnFailure(CheckResponseFits(aCommandPath, EncodedStatusResponseSize(aCommandPath, aStatus, aClusterStatus)));
     ReturnLogErrorOnFailure(PrepareStatus(aCommandPath));
     CommandStatusIB::Builder & commandStatus = mInvokeResponseBuilder.GetInvokeResponses().GetInvokeResponse().GetStatus();
     StatusIB::Builder & statusIBBuilder      = commandStatus.CreateErrorStatus();
@@ -354,9 +431,10 @@ CHIP_ERROR CommandHandler::PrepareCommand(const ConcreteCommandPath & aCommandPa
 {
     ReturnErrorOnFailure(AllocateBuffer());
     //
-    // We must not be in the middle of preparing a command, or having prepared or sent one.
+    // We must not be in the middle of preparing a command, or having sent one. Responses to the other commands of the request
+    // may have been added already.
     //
-    VerifyOrReturnError(mState == State::Idle, CHIP_ERROR_INCORRECT_STATE);
+    VerifyOrReturnError(mState == State::Idle || mState == State::AddedCommand, CHIP_ERROR_INCORRECT_STATE);
     InvokeResponseIBs::Builder & invokeResponses = mInvokeResponseBuilder.GetInvokeResponses();
     InvokeResponseIB::Builder & invokeResponse   = invokeResponses.CreateInvokeResponse();
     ReturnErrorOnFailure(invokeResponses.GetError());
@@ -385,8 +463,6 @@ CHIP_ERROR CommandHandler::FinishCommand(bool aStartDataStruct)
     }
     ReturnErrorOnFailure(commandData.EndOfCommandDataIB().GetError());
     ReturnErrorOnFailure(mInvokeResponseBuilder.GetInvokeResponses().GetInvokeResponse().EndOfInvokeResponseIB().GetError());
-    ReturnErrorOnFailure(mInvokeResponseBuilder.GetInvokeResponses().EndOfInvokeResponses().GetError());
-    ReturnErrorOnFailure(mInvokeResponseBuilder.EndOfInvokeResponseMessage().GetError());
     MoveToState(State::AddedCommand);
     return CHIP_NO_ERROR;
 }
@@ -395,9 +471,10 @@ CHIP_ERROR CommandHandler::PrepareStatus(const ConcreteCommandPath & aCommandPat
 {
     ReturnErrorOnFailure(AllocateBuffer());
     //
-    // We must not be in the middle of preparing a command, or having prepared or sent one.
+    // We must not be in the middle of preparing a command, or having sent one. Responses to the other commands of the request
+    // may have been added already.
     //
-    VerifyOrReturnError(mState == State::Idle, CHIP_ERROR_INCORRECT_STATE);
+    VerifyOrReturnError(mState == State::Idle || mState == State::AddedCommand, CHIP_ERROR_INCORRECT_STATE);
     InvokeResponseIBs::Builder & invokeResponses = mInvokeResponseBuilder.GetInvokeResponses();
     InvokeResponseIB::Builder & invokeResponse   = invokeResponses.CreateInvokeResponse();
     ReturnErrorOnFailure(invokeResponses.GetError());
@@ -416,12 +493,19 @@ CHIP_ERROR CommandHandler::FinishStatus()
     ReturnErrorOnFailure(
         mInvokeResponseBuilder.GetInvokeResponses().GetInvokeResponse().GetStatus().EndOfCommandStatusIB().GetError());
     ReturnErrorOnFailure(mInvokeResponseBuilder.GetInvokeResponses().GetInvokeResponse().EndOfInvokeResponseIB().GetError());
-    ReturnErrorOnFailure(mInvokeResponseBuilder.GetInvokeResponses().EndOfInvokeResponses().GetError());
-    ReturnErrorOnFailure(mInvokeResponseBuilder.EndOfInvokeResponseMessage().GetError());
     MoveToState(State::AddedCommand);
     return CHIP_NO_ERROR;
 }
 
+void CommandHandler::Rollback(const TLV::TLVWriter & aBackup, State aState)
+{
+    InvokeResponseIBs::Builder & invokeResponses = mInvokeResponseBuilder.GetInvokeResponses();
+    invokeResponses.Rollback(aBackup);
+    // A failure to start the InvokeResponseIB is recorded in the InvokeResponseIBs builder
+    invokeResponses.ResetError();
+    MoveToState(aState);
+}
+
 TLV::TLVWriter * CommandHandler::GetCommandDataIBTLVWriter()
 {
     if (mState != State::AddingCommand)
@@ -470,6 +554,8 @@ CommandHandler::Handle::Handle(CommandHandler * handle)
 CHIP_ERROR CommandHandler::Finalize(System::PacketBufferHandle & commandPacket)
 {
     VerifyOrReturnError(mState == State::AddedCommand, CHIP_ERROR_INCORRECT_STATE);
+    ReturnErrorOnFailure(mInvokeResponseBuilder.GetInvokeResponses().EndOfInvokeResponses().GetError());
+    ReturnErrorOnFailure(mInvokeResponseBuilder.EndOfInvokeResponseMessage().GetError());
     return mCommandMessageWriter.Finalize(&commandPacket);
 }
 
@@ -24,6 +24,7 @@
 
 #pragma once
 
+#include <access/Privilege.h>
 #include <app/ConcreteCommandPath.h>
 #include <app/InteractionModelDelegate.h>
 #include <app/data-model/Encode.h>
@@ -164,20 +165,37 @@ public:
      * object that can be encoded using the DataModel::Encode machinery and
      * exposes the right command id will work.
      *
+     * The responses to all the commands of an invoke request are sent in one
+     * InvokeResponseMessage.  When the size of aData can be computed with
+     * DataModel::EncodedSize, a response that would not fit in what is left of
+     * that message is rejected before anything is written, so the caller may
+     * still add a status response for the command instead.  A response that
+     * fails to encode for any other reason is removed from the message as
+     * well.
+     *
      * @param [in] aRequestCommandPath the concrete path of the command we are
      *             responding to.
      * @param [in] aData the data for the response.
+     *
+     * @retval #CHIP_ERROR_BUFFER_TOO_SMALL if the response does not fit in the message.
      */
     template <typename CommandData>
     CHIP_ERROR AddResponseData(const ConcreteCommandPath & aRequestCommandPath, const CommandData & aData)
     {
         ConcreteCommandPath path = { aRequestCommandPath.mEndpointId, aRequestCommandPath.mClusterId, CommandData::GetCommandId() };
-        ReturnErrorOnFailure(PrepareCommand(path, false));
-        TLV::TLVWriter * writer = GetCommandDataIBTLVWriter();
-        VerifyOrReturnError(writer != nullptr, CHIP_ERROR_INCORRECT_STATE);
-        ReturnErrorOnFailure(DataModel::Encode(*writer, TLV::ContextTag(to_underlying(CommandDataIB::Tag::kData)), aData));
+        ReturnErrorOnFailure(CheckResponseDataFits(path, aData));
+        ReturnErrorOnFailure(AllocateBuffer());
 
-        return FinishCommand(/* aEndDataStruct = */ false);
+        TLV::TLVWriter backup;
+        State backupState = mState;
+        mInvokeResponseBuilder.GetInvokeResponses().Checkpoint(backup);
+
+        CHIP_ERROR err = AddResponseDataInternal(path, aData);
+        if (err != CHIP_NO_ERROR)
+        {
+            Rollback(backup, backupState);
+        }
+        return err;
     }
 
     /**
@@ -210,7 +228,7 @@ private:
     {
         Idle,                ///< Default state that the object starts out in, where no work has commenced
         AddingCommand,       ///< In the process of adding a command.
-        AddedCommand,        ///< A command has been completely encoded and is awaiting transmission.
+        AddedCommand,        ///< At least one command has been completely encoded, more may be added before transmission.
         CommandSent,         ///< The command has been sent successfully.
         AwaitingDestruction, ///< The object has completed its work and is awaiting destruction by the application.
     };
@@ -253,6 +271,48 @@ private:
     CHIP_ERROR AddStatusInternal(const ConcreteCommandPath & aCommandPath, const Protocols::InteractionModel::Status aStatus,
                                  const Optional<ClusterStatus> & aClusterStatus);
 
+    /**
+     * Checks the access to the cluster of aCommandPath.  The outcome is kept and reused by the following commands of the
+     * request addressed to the same cluster.
+     */
+    CHIP_ERROR CheckAccess(const ConcreteCommandPath & aCommandPath, Access::Privilege aRequestPrivilege);
+
+    /**
+     * Checks that an InvokeResponseIB of aResponseSize bytes fits in what is left of the response message.
+     */
+    CHIP_ERROR CheckResponseFits(const ConcreteCommandPath & aCommandPath, size_t aResponseSize);
+    CHIP_ERROR CheckCommandResponseFits(const ConcreteCommandPath & aCommandPath, size_t aDataSize);
+
+    template <typename CommandData, typename std::enable_if_t<DataModel::HasEncodedSize<CommandData>::value, int> = 0>
+    CHIP_ERROR CheckResponseDataFits(const ConcreteCommandPath & aCommandPath, const CommandData & aData)
+    {
+        return CheckCommandResponseFits(aCommandPath,
+                                        DataModel::EncodedSize(TLV::ContextTag(to_underlying(CommandDataIB::Tag::kData)), aData));
+    }
+
+    // The size of other responses is only known once they are encoded
+    template <typename CommandData, typename std::enable_if_t<!DataModel::HasEncodedSize<CommandData>::value, int> = 0>
+    CHIP_ERROR CheckResponseDataFits(const ConcreteCommandPath &, const CommandData &)
+    {
+        return CHIP_NO_ERROR;
+    }
+
+    template <typename CommandData>
+    CHIP_ERROR AddResponseDataInternal(const ConcreteCommandPath & aCommandPath, const CommandData & aData)
+    {
+        ReturnErrorOnFailure(PrepareCommand(aCommandPath, false));
+        TLV::TLVWriter * writer = GetCommandDataIBTLVWriter();
+        VerifyOrReturnError(writer != nullptr, CHIP_ERROR_INCORRECT_STATE);
+        ReturnErrorOnFailure(DataModel::Encode(*writer, TLV::ContextTag(to_underlying(CommandDataIB::Tag::kData)), aData));
+
+        return FinishCommand(/* aEndDataStruct = */ false);
+    }
+
+    /**
+     * Drops whatever was written to the response message since the checkpoint aBackup was taken, in state aState.
+     */
+    void Rollback(const TLV::TLVWriter & aBackup, State aState);
+
     Messaging::ExchangeContext * mpExchangeCtx = nullptr;
     Callback * mpCallback                      = nullptr;
     InvokeResponseMessage::Builder mInvokeResponseBuilder;
@@ -261,6 +321,12 @@ private:
     bool mSuppressResponse                 = false;
     bool mTimedRequest                     = false;
 
+    // Cluster and outcome of the last access check of the request being processed
+    EndpointId mCheckedEndpointId       = kInvalidEndpointId;
+    ClusterId mCheckedClusterId         = kInvalidClusterId;
+    Access::Privilege mCheckedPrivilege = Access::Privilege::kView;
+    CHIP_ERROR mCheckedAccessResult     = CHIP_NO_ERROR;
+
     State mState = State::Idle;
     chip::System::PacketBufferTLVWriter mCommandMessageWriter;
     bool mBufferAllocated = false;
@@ -104,6 +104,12 @@ public:
     void SetNext(CommandHandlerInterface * aNext) { mNext = aNext; }
     CommandHandlerInterface * GetNext() const { return mNext; }
 
+    /**
+     * The endpoint this object was registered for, or Missing if it is meant to be used with all endpoints.
+     */
+    const Optional<EndpointId> & GetEndpointId() const { return mEndpointId; }
+    ClusterId GetClusterId() const { return mClusterId; }
+
     /**
      * Check whether a this CommandHandlerInterface is relevant for a
      * particular endpoint+cluster.  An CommandHandlerInterface will be used
@@ -42,10 +42,7 @@ CHIP_ERROR CommandSender::AllocateBuffer()
     {
         mCommandMessageWriter.Reset();
 
-        System::PacketBufferHandle commandPacket = System::PacketBufferHandle::New(chip::app::kMaxSecureSduLengthBytes);
-        VerifyOrReturnError(!commandPacket.IsNull(), CHIP_ERROR_NO_MEMORY);
-
-        mCommandMessageWriter.Init(std::move(commandPacket));
+        ReturnErrorOnFailure(mCommandMessageWriter.InitChained(chip::app::kMaxSecureSduLengthBytes));
         ReturnErrorOnFailure(mInvokeRequestBuilder.Init(&mCommandMessageWriter));
 
         mInvokeRequestBuilder.SuppressResponse(mSuppressResponse).TimedRequest(mTimedRequest);
@@ -310,9 +307,10 @@ CHIP_ERROR CommandSender::PrepareCommand(const CommandPathParams & aCommandPathP
     ReturnLogErrorOnFailure(AllocateBuffer());
 
     //
-    // We must not be in the middle of preparing a command, or having prepared or sent one.
+    // We must not be in the middle of preparing a command, or having sent one. Other commands may have been added to the
+    // request already.
     //
-    VerifyOrReturnError(mState == State::Idle, CHIP_ERROR_INCORRECT_STATE);
+    VerifyOrReturnError(mState == State::Idle || mState == State::AddedCommand, CHIP_ERROR_INCORRECT_STATE);
     InvokeRequests::Builder & invokeRequests = mInvokeRequestBuilder.GetInvokeRequests();
     CommandDataIB::Builder & invokeRequest   = invokeRequests.CreateCommandData();
     ReturnErrorOnFailure(invokeRequests.GetError());
@@ -330,6 +328,24 @@ CHIP_ERROR CommandSender::PrepareCommand(const CommandPathParams & aCommandPathP
     return CHIP_NO_ERROR;
 }
 
+CHIP_ERROR CommandSender::CheckRequestFits(const CommandPathParams & aCommandPath, size_t aDataSize)
+{
+    ReturnErrorOnFailure(AllocateBuffer());
+
+    size_t size = TLV::EncodedContainerOverhead(TLV::AnonymousTag);
+    size += TLV::EncodedContainerOverhead(TLV::ContextTag(to_underlying(CommandDataIB::Tag::kPath)));
+    if (aCommandPath.mFlags.Has(CommandPathFlags::kEndpointIdValid))
+    {
+        size += TLV::EncodedUnsignedIntegerSize(TLV::ContextTag(CommandPathIB::kCsTag_EndpointId), aCommandPath.mEndpointId);
+    }
+    size += TLV::EncodedUnsignedIntegerSize(TLV::ContextTag(CommandPathIB::kCsTag_ClusterId), aCommandPath.mClusterId);
+    size += TLV::EncodedUnsignedIntegerSize(TLV::ContextTag(CommandPathIB::kCsTag_CommandId), aCommandPath.mCommandId);
+    size += aDataSize;
+
+    VerifyOrReturnError(size <= mCommandMessageWriter.GetTotalRemainingFreeLength(), CHIP_ERROR_BUFFER_TOO_SMALL);
+    return CHIP_NO_ERROR;
+}
+
 CHIP_ERROR CommandSender::FinishCommand(bool aEndDataStruct)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -344,8 +360,6 @@ CHIP_ERROR CommandSender::FinishCommand(bool aEndDataStruct)
     }
 
     ReturnErrorOnFailure(commandData.EndOfCommandDataIB().GetError());
-    ReturnErrorOnFailure(mInvokeRequestBuilder.GetInvokeRequests().EndOfInvokeRequests().GetError());
-    ReturnErrorOnFailure(mInvokeRequestBuilder.EndOfInvokeRequestMessage().GetError());
 
     MoveToState(State::AddedCommand);
 
@@ -390,6 +404,8 @@ CHIP_ERROR CommandSender::FinishCommand(const Optional<uint16_t> & aTimedInvokeT
 CHIP_ERROR CommandSender::Finalize(System::PacketBufferHandle & commandPacket)
 {
     VerifyOrReturnError(mState == State::AddedCommand, CHIP_ERROR_INCORRECT_STATE);
+    ReturnErrorOnFailure(mInvokeRequestBuilder.GetInvokeRequests().EndOfInvokeRequests().GetError());
+    ReturnErrorOnFailure(mInvokeRequestBuilder.EndOfInvokeRequestMessage().GetError());
     return mCommandMessageWriter.Finalize(&commandPacket);
 }
 
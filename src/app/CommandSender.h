@@ -147,8 +147,17 @@ public:
      * object that can be encoded using the DataModel::Encode machinery and
      * exposes the right command id will work.
      *
+     * Several requests may be added before calling SendCommandRequest, they are
+     * then all sent in one InvokeRequestMessage.  When the size of aData can be
+     * computed with DataModel::EncodedSize, a request that would not fit in
+     * what is left of that message is rejected before anything is written:
+     * the requests added so far can still be sent, and the rejected one added
+     * to another CommandSender.
+     *
      * @param [in] aCommandPath  The path of the command being requested.
      * @param [in] aData         The data for the request.
+     *
+     * @retval #CHIP_ERROR_BUFFER_TOO_SMALL if the request does not fit in the message.
      */
     template <typename CommandDataT, typename std::enable_if_t<!CommandDataT::MustUseTimedInvoke(), int> = 0>
     CHIP_ERROR AddRequestData(const CommandPathParams & aCommandPath, const CommandDataT & aData)
@@ -189,6 +198,7 @@ private:
     CHIP_ERROR AddRequestDataInternal(const CommandPathParams & aCommandPath, const CommandDataT & aData,
                                       const Optional<uint16_t> & aTimedInvokeTimeoutMs)
     {
+        ReturnErrorOnFailure(CheckRequestDataFits(aCommandPath, aData));
         ReturnErrorOnFailure(PrepareCommand(aCommandPath, /* aStartDataStruct = */ false));
         TLV::TLVWriter * writer = GetCommandDataIBTLVWriter();
         VerifyOrReturnError(writer != nullptr, CHIP_ERROR_INCORRECT_STATE);
@@ -196,6 +206,25 @@ private:
         return FinishCommand(aTimedInvokeTimeoutMs);
     }
 
+    /**
+     * Checks that a CommandDataIB with aDataSize bytes of data fits in what is left of the request message.
+     */
+    CHIP_ERROR CheckRequestFits(const CommandPathParams & aCommandPath, size_t aDataSize);
+
+    template <typename CommandDataT, typename std::enable_if_t<DataModel::HasEncodedSize<CommandDataT>::value, int> = 0>
+    CHIP_ERROR CheckRequestDataFits(const CommandPathParams & aCommandPath, const CommandDataT & aData)
+    {
+        return CheckRequestFits(aCommandPath,
+                                DataModel::EncodedSize(TLV::ContextTag(to_underlying(CommandDataIB::Tag::kData)), aData));
+    }
+
+    // The size of other requests is only known once they are encoded
+    template <typename CommandDataT, typename std::enable_if_t<!DataModel::HasEncodedSize<CommandDataT>::value, int> = 0>
+    CHIP_ERROR CheckRequestDataFits(const CommandPathParams &, const CommandDataT &)
+    {
+        return CHIP_NO_ERROR;
+    }
+
 public:
     // Sends a queued up command request to the target encapsulated by the secureSession handle.
     //
@@ -222,7 +251,7 @@ private:
     {
         Idle,                ///< Default state that the object starts out in, where no work has commenced
         AddingCommand,       ///< In the process of adding a command.
-        AddedCommand,        ///< A command has been completely encoded and is awaiting transmission.
+        AddedCommand,        ///< At least one command has been completely encoded, more may be added before transmission.
         AwaitingTimedStatus, ///< Sent a Timed Request and waiting for response.
         CommandSent,         ///< The command has been sent successfully.
         ResponseReceived,    ///< Received a response to our invoke and request and processing the response.
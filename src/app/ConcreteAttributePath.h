@@ -46,7 +46,7 @@ struct ConcreteAttributePath
     bool operator<(const ConcreteAttributePath & path) const
     {
         return (mEndpointId < path.mEndpointId) || ((mEndpointId == path.mEndpointId) && (mClusterId < path.mClusterId)) ||
-            ((mClusterId == path.mClusterId) && (mAttributeId < path.mAttributeId));
+            ((mEndpointId == path.mEndpointId) && (mClusterId == path.mClusterId) && (mAttributeId < path.mAttributeId));
     }
 
     EndpointId mEndpointId   = 0;
@@ -121,6 +121,12 @@ struct ConcreteDataAttributePath : public ConcreteAttributePath
     //
     uint16_t mListIndex   = 0;
     ListOperation mListOp = ListOperation::NotList;
+
+    //
+    // The data version of the cluster instance this path belongs to, as conveyed alongside the attribute data
+    // in a Report. Not set for status reports or when the peer did not provide one.
+    //
+    Optional<DataVersion> mDataVersion;
 };
 
 } // namespace app
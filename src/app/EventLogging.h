@@ -36,6 +36,11 @@ public:
     {
         return DataModel::Encode(aWriter, TLV::ContextTag(to_underlying(EventDataIB::Tag::kData)), mEventData);
     }
+    CHIP_ERROR GetEventDataSize(size_t & aSize) final override
+    {
+        aSize = DataModel::EncodedSize(TLV::ContextTag(to_underlying(EventDataIB::Tag::kData)), mEventData);
+        return CHIP_NO_ERROR;
+    }
 
 private:
     const T & mEventData;
@@ -67,6 +67,24 @@ public:
      *
      */
     virtual CHIP_ERROR WriteEvent(chip::TLV::TLVWriter & aWriter) = 0;
+
+    /**
+     *  @brief
+     *    A function that supplies the size of the eventData element written by WriteEvent.
+     *
+     *  The event logging subsystem needs the size of an event before it
+     *  writes it, to make room for it in the event buffers. Delegates
+     *  that can tell that size without serializing the event data spare
+     *  the subsystem writing the event twice.
+     *
+     *  @param[out] aSize       The number of bytes WriteEvent writes.
+     *
+     *  @retval #CHIP_NO_ERROR  On success.
+     *
+     *  @retval #CHIP_ERROR_NOT_IMPLEMENTED  The size is only known by
+     *                          serializing the event data.
+     */
+    virtual CHIP_ERROR GetEventDataSize(size_t & aSize) { return CHIP_ERROR_NOT_IMPLEMENTED; }
 };
 } // namespace app
 } // namespace chip
@@ -298,9 +298,47 @@ exit:
     return err;
 }
 
+/**
+ * @brief
+ *   The number of bytes ConstructEvent writes for an event, not counting its eventData element. Any change to the
+ *   elements written by ConstructEvent must be reflected here.
+ */
+static size_t CalculateEventEnvelopeSize(const EventOptions * apOptions, EventNumber aEventNumber)
+{
+    const auto PathTag = [](EventPathIB::Tag tag) { return TLV::ContextTag(to_underlying(tag)); };
+    const auto DataTag = [](EventDataIB::Tag tag) { return TLV::ContextTag(to_underlying(tag)); };
+    const EventDataIB::Tag timestampTag =
+        apOptions->mTimestamp.IsSystem() ? EventDataIB::Tag::kSystemTimestamp : EventDataIB::Tag::kEpochTimestamp;
+
+    size_t size = TLV::EncodedContainerOverhead(TLV::AnonymousTag);
+    size += TLV::EncodedContainerOverhead(TLV::ContextTag(to_underlying(EventReportIB::Tag::kEventData)));
+    size += TLV::EncodedContainerOverhead(DataTag(EventDataIB::Tag::kPath));
+    size += TLV::EncodedUnsignedIntegerSize(PathTag(EventPathIB::Tag::kEndpoint), apOptions->mPath.mEndpointId);
+    size += TLV::EncodedUnsignedIntegerSize(PathTag(EventPathIB::Tag::kCluster), apOptions->mPath.mClusterId);
+    size += TLV::EncodedUnsignedIntegerSize(PathTag(EventPathIB::Tag::kEvent), apOptions->mPath.mEventId);
+    size += TLV::EncodedFixedSize(PathTag(EventPathIB::Tag::kIsUrgent));
+    size += TLV::EncodedUnsignedIntegerSize(DataTag(EventDataIB::Tag::kEventNumber), aEventNumber);
+    size += TLV::EncodedUnsignedIntegerSize(DataTag(EventDataIB::Tag::kPriority), to_underlying(apOptions->mPriority));
+    size += TLV::EncodedUnsignedIntegerSize(DataTag(timestampTag), apOptions->mTimestamp.mValue);
+    return size;
+}
+
 CHIP_ERROR EventManagement::CalculateEventSize(EventLoggingDelegate * apDelegate, const EventOptions * apOptions,
                                                uint32_t & requiredSize)
 {
+    size_t eventDataSize;
+
+    // Only write the event to measure it when its delegate cannot tell the size of the event data
+    if (apDelegate->GetEventDataSize(eventDataSize) == CHIP_NO_ERROR)
+    {
+        const size_t eventSize = CalculateEventEnvelopeSize(apOptions, mLastEventNumber) + eventDataSize;
+
+        // Larger events would not have fit the buffer the event is otherwise measured in
+        VerifyOrReturnError(eventSize <= kMaxEventSizeReserve, CHIP_ERROR_NO_MEMORY);
+        requiredSize = static_cast<uint32_t>(eventSize);
+        return CHIP_NO_ERROR;
+    }
+
     System::PacketBufferTLVWriter writer;
     EventLoadOutContext ctxt       = EventLoadOutContext(writer, apOptions->mPriority, GetLastEventNumber());
     System::PacketBufferHandle buf = System::PacketBufferHandle::New(kMaxEventSizeReserve);
@@ -60,20 +60,10 @@ CHIP_ERROR InteractionModelEngine::Init(Messaging::ExchangeManager * apExchangeM
 
 void InteractionModelEngine::Shutdown()
 {
-    CommandHandlerInterface * handlerIter = mCommandHandlerList;
-
     //
-    // Walk our list of command handlers and de-register them, before finally
-    // nulling out the list entirely.
+    // De-register all our command handlers.
     //
-    while (handlerIter)
-    {
-        CommandHandlerInterface * next = handlerIter->GetNext();
-        handlerIter->SetNext(nullptr);
-        handlerIter = next;
-    }
-
-    mCommandHandlerList = nullptr;
+    mCommandHandlers.Clear();
 
     // Increase magic number to invalidate all Handle-s.
     mMagic++;
@@ -87,13 +77,11 @@ void InteractionModelEngine::Shutdown()
 
     mTimedHandlers.ReleaseAll();
 
-    for (auto & readHandler : mReadHandlers)
-    {
-        if (!readHandler.IsFree())
-        {
-            readHandler.Shutdown();
-        }
-    }
+    // Shutting a handler down releases it to mReadHandlers through OnDone()
+    mReadHandlers.ForEachActiveObject([](ReadHandler * handler) {
+        handler->Shutdown();
+        return Loop::Continue;
+    });
 
     //
     // We hold weak references to ReadClient objects. The application ultimately
@@ -143,16 +131,21 @@ void InteractionModelEngine::Shutdown()
 }
 
 uint32_t InteractionModelEngine::GetNumActiveReadHandlers() const
+{
+    return static_cast<uint32_t>(mReadHandlers.Allocated());
+}
+
+uint32_t InteractionModelEngine::GetNumActiveSubscriptions(FabricIndex aFabricIndex) const
 {
     uint32_t numActive = 0;
 
-    for (auto & readHandler : mReadHandlers)
-    {
-        if (!readHandler.IsFree())
+    mReadHandlers.ForEachActiveObject([aFabricIndex, &numActive](const ReadHandler * handler) {
+        if (handler->IsSubscriptionType() && handler->GetAccessingFabricIndex() == aFabricIndex)
         {
             numActive++;
         }
-    }
+        return Loop::Continue;
+    });
 
     return numActive;
 }
@@ -216,7 +209,7 @@ CHIP_ERROR InteractionModelEngine::ShutdownSubscriptions(FabricIndex aFabricInde
 }
 
 CHIP_ERROR InteractionModelEngine::NewWriteClient(WriteClientHandle & apWriteClient, WriteClient::Callback * apCallback,
-                                                  const Optional<uint16_t> & aTimedWriteTimeoutMs)
+                                                  const Optional<uint16_t> & aTimedWriteTimeoutMs, size_t aMaxPayloadSize)
 {
     apWriteClient.SetWriteClient(nullptr);
 
@@ -226,7 +219,7 @@ CHIP_ERROR InteractionModelEngine::NewWriteClient(WriteClientHandle & apWriteCli
         {
             continue;
         }
-        ReturnLogErrorOnFailure(writeClient.Init(mpExchangeMgr, apCallback, aTimedWriteTimeoutMs));
+        ReturnLogErrorOnFailure(writeClient.Init(mpExchangeMgr, apCallback, aTimedWriteTimeoutMs, aMaxPayloadSize));
         apWriteClient.SetWriteClient(&writeClient);
         return CHIP_NO_ERROR;
     }
@@ -239,6 +232,11 @@ void InteractionModelEngine::OnDone(CommandHandler & apCommandObj)
     mCommandHandlerObjs.ReleaseObject(&apCommandObj);
 }
 
+void InteractionModelEngine::OnDone(ReadHandler & apReadObj)
+{
+    mReadHandlers.ReleaseObject(&apReadObj);
+}
+
 CHIP_ERROR InteractionModelEngine::OnInvokeCommandRequest(Messaging::ExchangeContext * apExchangeContext,
                                                           const PayloadHeader & aPayloadHeader,
                                                           System::PacketBufferHandle && aPayload, bool aIsTimedInvoke,
@@ -266,25 +264,28 @@ CHIP_ERROR InteractionModelEngine::OnReadInitialRequest(Messaging::ExchangeConte
     ChipLogDetail(InteractionModel, "Received %s request",
                   aInteractionType == ReadHandler::InteractionType::Subscribe ? "Subscribe" : "Read");
 
-    for (auto & readHandler : mReadHandlers)
-    {
-        if (!readHandler.IsFree() && readHandler.IsSubscriptionType() &&
-            readHandler.GetInitiatorNodeId() == apExchangeContext->GetSessionHandle().GetPeerNodeId() &&
-            readHandler.GetAccessingFabricIndex() == apExchangeContext->GetSessionHandle().GetFabricIndex())
+    CHIP_ERROR err = CHIP_NO_ERROR;
+    mReadHandlers.ForEachActiveObject([apExchangeContext, &aPayload, &err](ReadHandler * handler) {
+        if (handler->IsSubscriptionType() &&
+            handler->GetInitiatorNodeId() == apExchangeContext->GetSessionHandle().GetPeerNodeId() &&
+            handler->GetAccessingFabricIndex() == apExchangeContext->GetSessionHandle().GetFabricIndex())
         {
             bool keepSubscriptions = true;
             System::PacketBufferTLVReader reader;
             reader.Init(aPayload.Retain());
-            ReturnErrorOnFailure(reader.Next());
             SubscribeRequestMessage::Parser subscribeRequestParser;
-            ReturnErrorOnFailure(subscribeRequestParser.Init(reader));
-            CHIP_ERROR err = subscribeRequestParser.GetKeepSubscriptions(&keepSubscriptions);
-            if (err == CHIP_NO_ERROR && !keepSubscriptions)
+            if ((err = reader.Next()) != CHIP_NO_ERROR || (err = subscribeRequestParser.Init(reader)) != CHIP_NO_ERROR)
+            {
+                return Loop::Break;
+            }
+            if (subscribeRequestParser.GetKeepSubscriptions(&keepSubscriptions) == CHIP_NO_ERROR && !keepSubscriptions)
             {
-                readHandler.Shutdown(ReadHandler::ShutdownOptions::AbortCurrentExchange);
+                handler->Shutdown(ReadHandler::ShutdownOptions::AbortCurrentExchange);
             }
         }
-    }
+        return Loop::Continue;
+    });
+    ReturnErrorOnFailure(err);
 
     // Reserve the last ReadHandler for ReadInteraction
     if (aInteractionType == ReadHandler::InteractionType::Subscribe &&
@@ -295,21 +296,49 @@ CHIP_ERROR InteractionModelEngine::OnReadInitialRequest(Messaging::ExchangeConte
         return CHIP_NO_ERROR;
     }
 
-    for (auto & readHandler : mReadHandlers)
+    // Keep a fabric from taking the subscriptions of the others
+    if (aInteractionType == ReadHandler::InteractionType::Subscribe &&
+        GetNumActiveSubscriptions(apExchangeContext->GetSessionHandle().GetFabricIndex()) >= mMaxSubscriptionsPerFabric)
     {
-        if (readHandler.IsFree())
-        {
-            ReturnErrorOnFailure(readHandler.Init(mpExchangeMgr, mpDelegate, apExchangeContext, aInteractionType));
-            ReturnErrorOnFailure(readHandler.OnReadInitialRequest(std::move(aPayload)));
-            aStatus = Protocols::InteractionModel::Status::Success;
-            return CHIP_NO_ERROR;
-        }
+        ChipLogProgress(InteractionModel, "Subscription quota of fabric %u exhausted",
+                        apExchangeContext->GetSessionHandle().GetFabricIndex());
+        aStatus = Protocols::InteractionModel::Status::ResourceExhausted;
+        return CHIP_NO_ERROR;
     }
 
-    ChipLogProgress(InteractionModel, "no resource for %s interaction",
-                    aInteractionType == ReadHandler::InteractionType::Subscribe ? "Subscribe" : "Read");
-    aStatus = Protocols::InteractionModel::Status::ResourceExhausted;
+    ReadHandler * readHandler = nullptr;
+    if (GetNumActiveReadHandlers() < CHIP_IM_MAX_NUM_READ_HANDLER)
+    {
+        readHandler = mReadHandlers.CreateObject(this);
+    }
 
+    if (readHandler == nullptr)
+    {
+        ChipLogProgress(InteractionModel, "no resource for %s interaction",
+                        aInteractionType == ReadHandler::InteractionType::Subscribe ? "Subscribe" : "Read");
+        aStatus = Protocols::InteractionModel::Status::ResourceExhausted;
+        return CHIP_NO_ERROR;
+    }
+
+    err = readHandler->Init(mpExchangeMgr, mpDelegate, apExchangeContext, aInteractionType);
+    if (err != CHIP_NO_ERROR)
+    {
+        mReadHandlers.ReleaseObject(readHandler);
+        return err;
+    }
+
+    // On failure, the handler has already shut itself down and been released
+    err = readHandler->OnReadInitialRequest(std::move(aPayload));
+    if (err == CHIP_ERROR_NO_MEMORY)
+    {
+        ChipLogProgress(InteractionModel, "no resource for the paths of %s interaction",
+                        aInteractionType == ReadHandler::InteractionType::Subscribe ? "Subscribe" : "Read");
+        aStatus = Protocols::InteractionModel::Status::ResourceExhausted;
+        return CHIP_NO_ERROR;
+    }
+    ReturnErrorOnFailure(err);
+
+    aStatus = Protocols::InteractionModel::Status::Success;
     return CHIP_NO_ERROR;
 }
 
@@ -443,11 +472,6 @@ uint16_t InteractionModelEngine::GetWriteClientArrayIndex(const WriteClient * co
     return static_cast<uint16_t>(apWriteClient - mWriteClients);
 }
 
-uint16_t InteractionModelEngine::GetReadHandlerArrayIndex(const ReadHandler * const apReadHandler) const
-{
-    return static_cast<uint16_t>(apReadHandler - mReadHandlers);
-}
-
 void InteractionModelEngine::AddReadClient(ReadClient * apReadClient)
 {
     apReadClient->SetNextClient(mpActiveReadClientList);
@@ -570,22 +594,14 @@ bool InteractionModelEngine::MergeOverlappedAttributePath(ClusterInfo * apAttrib
 
 bool InteractionModelEngine::IsOverlappedAttributePath(ClusterInfo & aAttributePath)
 {
-    for (auto & handler : mReadHandlers)
-    {
-        if (handler.IsSubscriptionType() && (handler.IsGeneratingReports() || handler.IsAwaitingReportResponse()))
+    return mReadHandlers.ForEachActiveObject([&aAttributePath](ReadHandler * handler) {
+        if (handler->IsSubscriptionType() && (handler->IsGeneratingReports() || handler->IsAwaitingReportResponse()) &&
+            handler->GetAttributePathList().IntersectsAttributePath(aAttributePath))
         {
-            for (auto clusterInfo = handler.GetAttributeClusterInfolist(); clusterInfo != nullptr;
-                 clusterInfo      = clusterInfo->mpNext)
-            {
-                if (clusterInfo->IsAttributePathSupersetOf(aAttributePath) ||
-                    aAttributePath.IsAttributePathSupersetOf(*clusterInfo))
-                {
-                    return true;
-                }
-            }
+            return Loop::Break;
         }
-    }
-    return false;
+        return Loop::Continue;
+    }) == Loop::Break;
 }
 
 void InteractionModelEngine::DispatchCommand(CommandHandler & apCommandObj, const ConcreteCommandPath & aCommandPath,
@@ -622,87 +638,29 @@ CHIP_ERROR InteractionModelEngine::RegisterCommandHandler(CommandHandlerInterfac
 {
     VerifyOrReturnError(handler != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
 
-    for (auto * cur = mCommandHandlerList; cur; cur = cur->GetNext())
+    if (!mCommandHandlers.Register(handler))
     {
-        if (cur->Matches(*handler))
-        {
-            ChipLogError(InteractionModel, "Duplicate command handler registration failed");
-            return CHIP_ERROR_INCORRECT_STATE;
-        }
+        ChipLogError(InteractionModel, "Duplicate command handler registration failed");
+        return CHIP_ERROR_INCORRECT_STATE;
     }
 
-    handler->SetNext(mCommandHandlerList);
-    mCommandHandlerList = handler;
-
     return CHIP_NO_ERROR;
 }
 
 void InteractionModelEngine::UnregisterCommandHandlers(EndpointId endpointId)
 {
-    CommandHandlerInterface * prev = nullptr;
-
-    for (auto * cur = mCommandHandlerList; cur; cur = cur->GetNext())
-    {
-        if (cur->MatchesEndpoint(endpointId))
-        {
-            if (prev == nullptr)
-            {
-                mCommandHandlerList = cur->GetNext();
-            }
-            else
-            {
-                prev->SetNext(cur->GetNext());
-            }
-
-            cur->SetNext(nullptr);
-        }
-        else
-        {
-            prev = cur;
-        }
-    }
+    mCommandHandlers.UnregisterEndpoint(endpointId);
 }
 
 CHIP_ERROR InteractionModelEngine::UnregisterCommandHandler(CommandHandlerInterface * handler)
 {
     VerifyOrReturnError(handler != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
-    CommandHandlerInterface * prev = nullptr;
-
-    for (auto * cur = mCommandHandlerList; cur; cur = cur->GetNext())
-    {
-        if (cur->Matches(*handler))
-        {
-            if (prev == nullptr)
-            {
-                mCommandHandlerList = cur->GetNext();
-            }
-            else
-            {
-                prev->SetNext(cur->GetNext());
-            }
-
-            cur->SetNext(nullptr);
-
-            return CHIP_NO_ERROR;
-        }
-
-        prev = cur;
-    }
-
-    return CHIP_ERROR_KEY_NOT_FOUND;
+    return mCommandHandlers.Unregister(*handler) ? CHIP_NO_ERROR : CHIP_ERROR_KEY_NOT_FOUND;
 }
 
 CommandHandlerInterface * InteractionModelEngine::FindCommandHandler(EndpointId endpointId, ClusterId clusterId)
 {
-    for (auto * cur = mCommandHandlerList; cur; cur = cur->GetNext())
-    {
-        if (cur->Matches(endpointId, clusterId))
-        {
-            return cur;
-        }
-    }
-
-    return nullptr;
+    return mCommandHandlers.Find(endpointId, clusterId);
 }
 
 void InteractionModelEngine::OnTimedInteractionFailed(TimedHandler * apTimedHandler)
@@ -753,15 +711,9 @@ void InteractionModelEngine::OnTimedWrite(TimedHandler * apTimedHandler, Messagi
 
 bool InteractionModelEngine::HasActiveRead()
 {
-    for (auto & readHandler : mReadHandlers)
-    {
-        if (!readHandler.IsFree() && readHandler.IsReadType())
-        {
-            return true;
-        }
-    }
-
-    return false;
+    return mReadHandlers.ForEachActiveObject([](ReadHandler * handler) {
+        return handler->IsReadType() ? Loop::Break : Loop::Continue;
+    }) == Loop::Break;
 }
 
 } // namespace app
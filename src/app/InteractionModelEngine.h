@@ -32,6 +32,7 @@
 #include <lib/support/CodeUtils.h>
 #include <lib/support/DLLUtil.h>
 #include <lib/support/Pool.h>
+#include <lib/support/Span.h>
 #include <lib/support/logging/CHIPLogging.h>
 #include <messaging/ExchangeContext.h>
 #include <messaging/ExchangeMgr.h>
@@ -41,6 +42,7 @@
 #include <system/SystemPacketBuffer.h>
 
 #include <app/ClusterInfo.h>
+#include <app/ClusterOverrideRegistry.h>
 #include <app/CommandHandler.h>
 #include <app/CommandHandlerInterface.h>
 #include <app/CommandSender.h>
@@ -54,6 +56,7 @@
 #include <app/WriteClient.h>
 #include <app/WriteHandler.h>
 #include <app/reporting/Engine.h>
+#include <app/util/MatterCallbacks.h>
 #include <app/util/basic-types.h>
 
 namespace chip {
@@ -65,7 +68,9 @@ namespace app {
  * handlers
  *
  */
-class InteractionModelEngine : public Messaging::ExchangeDelegate, public CommandHandler::Callback
+class InteractionModelEngine : public Messaging::ExchangeDelegate,
+                               public CommandHandler::Callback,
+                               public ReadHandler::ManagementCallback
 {
 public:
     /**
@@ -120,21 +125,32 @@ public:
      * prevent user's code from leaking WriteClients.
      *
      *  @param[out]    apWriteClient    A pointer to the WriteClient object.
+     *  @param[in]     aMaxPayloadSize  Largest write request to build. Pass SessionManager::GetMaxPayloadSize() for the
+     *                                  session the request will be sent on to allow larger requests over TCP.
      *
      *  @retval #CHIP_ERROR_NO_MEMORY If there is no WriteClient available
      *  @retval #CHIP_NO_ERROR On success.
      */
     CHIP_ERROR NewWriteClient(WriteClientHandle & apWriteClient, WriteClient::Callback * callback,
-                              const Optional<uint16_t> & aTimedWriteTimeoutMs = NullOptional);
+                              const Optional<uint16_t> & aTimedWriteTimeoutMs = NullOptional,
+                              size_t aMaxPayloadSize                          = kMaxSecureSduLengthBytes);
 
     uint32_t GetNumActiveReadHandlers() const;
 
+    /**
+     * Return the number of subscriptions held by the peers of the given fabric.
+     */
+    uint32_t GetNumActiveSubscriptions(FabricIndex aFabricIndex) const;
+
+#if CONFIG_IM_BUILD_FOR_UNIT_TEST
+    void SetMaxSubscriptionsPerFabric(uint32_t aMaxSubscriptions) { mMaxSubscriptionsPerFabric = aMaxSubscriptions; }
+#endif
+
     uint32_t GetNumActiveWriteHandlers() const;
     uint32_t GetNumActiveWriteClients() const;
 
     uint16_t GetWriteClientArrayIndex(const WriteClient * const apWriteClient) const;
 
-    uint16_t GetReadHandlerArrayIndex(const ReadHandler * const apReadHandler) const;
     /**
      * The Magic number of this InteractionModelEngine, the magic number is set during Init()
      */
@@ -202,6 +218,7 @@ private:
     using Status = Protocols::InteractionModel::Status;
 
     void OnDone(CommandHandler & apCommandObj) override;
+    void OnDone(ReadHandler & apReadObj) override;
 
     /**
      * Called when Interaction Model receives a Command Request message.  Errors processing
@@ -257,21 +274,28 @@ private:
     Messaging::ExchangeManager * mpExchangeMgr = nullptr;
     InteractionModelDelegate * mpDelegate      = nullptr;
 
-    CommandHandlerInterface * mCommandHandlerList = nullptr;
+    ClusterOverrideRegistry<CommandHandlerInterface> mCommandHandlers;
 
     // TODO(#8006): investgate if we can disable some IM functions on some compact accessories.
     // TODO(#8006): investgate if we can provide more flexible object management on devices with more resources.
     BitMapObjectPool<CommandHandler, CHIP_IM_MAX_NUM_COMMAND_HANDLER> mCommandHandlerObjs;
     BitMapObjectPool<TimedHandler, CHIP_IM_MAX_NUM_TIMED_HANDLER> mTimedHandlers;
-    ReadHandler mReadHandlers[CHIP_IM_MAX_NUM_READ_HANDLER];
+    // Only holds the active handlers. Whether they are allocated from the heap or from a static pool of
+    // CHIP_IM_MAX_NUM_READ_HANDLER objects depends on CHIP_SYSTEM_CONFIG_POOL_USE_HEAP, CHIP_IM_MAX_NUM_READ_HANDLER
+    // caps the number of handlers either way.
+    ObjectPool<ReadHandler, CHIP_IM_MAX_NUM_READ_HANDLER> mReadHandlers;
     WriteClient mWriteClients[CHIP_IM_MAX_NUM_WRITE_CLIENT];
     WriteHandler mWriteHandlers[CHIP_IM_MAX_NUM_WRITE_HANDLER];
     reporting::Engine mReportingEngine;
+    // Backs the dirty path set of the reporting engine, the paths of each ReadHandler are held in its own ClusterInfoList
     ClusterInfo mClusterInfoPool[CHIP_IM_SERVER_MAX_NUM_PATH_GROUPS];
     ClusterInfo * mpNextAvailableClusterInfo = nullptr;
 
     ReadClient * mpActiveReadClientList = nullptr;
 
+    // Lets unit tests reach the quota with fewer handlers than CHIP_IM_MAX_NUM_READ_HANDLER
+    uint32_t mMaxSubscriptionsPerFabric = CHIP_IM_MAX_NUM_SUBSCRIPTIONS_PER_FABRIC;
+
     // A magic number for tracking values between stack Shutdown()-s and Init()-s.
     // An ObjectHandle is valid iff. its magic equals to this one.
     uint32_t mMagic = 0;
@@ -316,6 +340,67 @@ CHIP_ERROR ReadSingleClusterData(const Access::SubjectDescriptor & aSubjectDescr
                                  AttributeReportIBs::Builder & aAttributeReports,
                                  AttributeValueEncoder::AttributeEncodeState * apEncoderState);
 
+/**
+ *  Read a batch of attributes that all belong to the same endpoint and cluster, appending their AttributeReportIBs to
+ * aAttributeReports in order.  The cluster metadata and any AttributeAccessInterface override are resolved once for the whole
+ * batch rather than once per attribute, which is what makes this cheaper than calling ReadSingleClusterData for each path of
+ * an expanded wildcard.
+ *  MatterPreAttributeReadCallback / MatterPostAttributeReadCallback are invoked around each attribute.
+ *  If reading a path fails, its partial output is rolled back (unless apEncoderState allows partial data, in which case it
+ * describes where the chunked list should resume), aNumPathsRead is the number of paths that were completely encoded before
+ * it, and the error is returned.  On success, aNumPathsRead is the size of aPaths and apEncoderState is reset.
+ *  This function is implemented by CHIP as a part of cluster data storage & management; a default that forwards each path to
+ * ReadSingleClusterData is used when that implementation is not linked in.  Both are built on ReadClusterPaths.
+ *
+ *  @param[in]    aSubjectDescriptor    The subject descriptor for the read.
+ *  @param[in]    aPaths                The concrete paths to read; all of them must share aPaths[0]'s endpoint and cluster.
+ *  @param[in]    aAttributeReports     The TLV Builder for Cluter attribute builder.
+ *  @param[inout] apEncoderState        The encode state to resume the first path from, may be nullptr.
+ *  @param[out]   aNumPathsRead         The number of paths that were completely encoded.
+ *
+ *  @retval  CHIP_NO_ERROR on success
+ */
+CHIP_ERROR ReadClusterData(const Access::SubjectDescriptor & aSubjectDescriptor,
+                           const Span<const ConcreteReadAttributePath> & aPaths, AttributeReportIBs::Builder & aAttributeReports,
+                           AttributeValueEncoder::AttributeEncodeState * apEncoderState, size_t & aNumPathsRead);
+
+/**
+ *  The loop behind every ReadClusterData implementation: reads aPaths in order by calling aReadPath(path) for each of them,
+ * with the pre/post read callbacks, rollback and encoder state handling that ReadClusterData documents.
+ */
+template <typename ReadPathFunction>
+CHIP_ERROR ReadClusterPaths(const Span<const ConcreteReadAttributePath> & aPaths, AttributeReportIBs::Builder & aAttributeReports,
+                            AttributeValueEncoder::AttributeEncodeState * apEncoderState, size_t & aNumPathsRead,
+                            ReadPathFunction && aReadPath)
+{
+    aNumPathsRead = 0;
+    for (const auto & path : aPaths)
+    {
+        TLV::TLVWriter backup;
+        aAttributeReports.Checkpoint(backup);
+
+        MatterPreAttributeReadCallback(path);
+        CHIP_ERROR err = aReadPath(path);
+        if (err != CHIP_NO_ERROR)
+        {
+            if (apEncoderState == nullptr || !apEncoderState->AllowPartialData())
+            {
+                aAttributeReports.Rollback(backup);
+            }
+            return err;
+        }
+        MatterPostAttributeReadCallback(path);
+
+        ++aNumPathsRead;
+        if (apEncoderState != nullptr)
+        {
+            // Only the first path of a batch can be resuming a chunked list.
+            *apEncoderState = AttributeValueEncoder::AttributeEncodeState();
+        }
+    }
+    return CHIP_NO_ERROR;
+}
+
 /**
  * TODO: Document.
  */
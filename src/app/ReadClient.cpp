@@ -178,6 +178,22 @@ CHIP_ERROR ReadClient::SendReadRequest(ReadPrepareParams & aReadPrepareParams)
             }
         }
 
+        if (aReadPrepareParams.mAttributePathParamsListSize != 0 && aReadPrepareParams.mpAttributePathParamsList != nullptr)
+        {
+            TLV::TLVWriter backup;
+            bool encodedDataVersionList = false;
+
+            request.Checkpoint(backup);
+            DataVersionFilterIBs::Builder & dataVersionFilterListBuilder = request.CreateDataVersionFilters();
+            ReturnErrorOnFailure(request.GetError());
+            ReturnErrorOnFailure(
+                GenerateDataVersionFilterList(dataVersionFilterListBuilder, aReadPrepareParams, encodedDataVersionList));
+            if (!encodedDataVersionList)
+            {
+                request.Rollback(backup);
+            }
+        }
+
         ReturnErrorOnFailure(request.IsFabricFiltered(false).EndOfReadRequestMessage().GetError());
         ReturnErrorOnFailure(writer.Finalize(&msgBuf));
     }
@@ -229,6 +245,120 @@ CHIP_ERROR ReadClient::GenerateAttributePathList(AttributePathIBs::Builder & aAt
     return aAttributePathIBsBuilder.GetError();
 }
 
+CHIP_ERROR ReadClient::EncodeDataVersionFilter(DataVersionFilterIBs::Builder & aDataVersionFilterIBsBuilder,
+                                               const DataVersionFilter & aFilter)
+{
+    TLV::TLVWriter backup;
+
+    VerifyOrReturnError(aFilter.IsValidDataVersionFilter(), CHIP_ERROR_INVALID_ARGUMENT);
+
+    aDataVersionFilterIBsBuilder.Checkpoint(backup);
+
+    DataVersionFilterIB::Builder & filterIB = aDataVersionFilterIBsBuilder.CreateDataVersionFilter();
+    CHIP_ERROR err                          = aDataVersionFilterIBsBuilder.GetError();
+    if (err == CHIP_NO_ERROR)
+    {
+        ClusterPathIB::Builder & path = filterIB.CreatePath();
+        err                           = filterIB.GetError();
+        if (err == CHIP_NO_ERROR)
+        {
+            err = path.Endpoint(aFilter.mEndpointId).Cluster(aFilter.mClusterId).EndOfClusterPathIB().GetError();
+        }
+    }
+
+    if (err == CHIP_NO_ERROR)
+    {
+        err = filterIB.DataVersion(aFilter.mDataVersion.Value()).EndOfDataVersionFilterIB().GetError();
+    }
+
+    if (err == CHIP_ERROR_NO_MEMORY || err == CHIP_ERROR_BUFFER_TOO_SMALL)
+    {
+        //
+        // Out of space for this filter, so drop whatever was partially encoded for it and leave the builder
+        // ready to accept the end of the list.
+        //
+        aDataVersionFilterIBsBuilder.Rollback(backup);
+        aDataVersionFilterIBsBuilder.ResetError();
+        return CHIP_ERROR_NO_MEMORY;
+    }
+
+    return err;
+}
+
+CHIP_ERROR ReadClient::GenerateDataVersionFilterList(DataVersionFilterIBs::Builder & aDataVersionFilterIBsBuilder,
+                                                     const ReadPrepareParams & aReadPrepareParams, bool & aEncodedDataVersionList)
+{
+    //
+    // Leave enough room behind the filters for the end of the filter list as well as the remaining fields and end of
+    // the request itself, so that running out of space for filters never causes the request to fail.
+    //
+    const uint32_t kReservedSizeForEndOfDataVersionFilterIBs = 1;
+    const uint32_t kReservedSizeForIsFabricFiltered          = 1 + 1 + 1;
+    const uint32_t kReservedSizeForEndOfRequestMessage       = 1;
+    const uint32_t kReservedSize =
+        kReservedSizeForEndOfDataVersionFilterIBs + kReservedSizeForIsFabricFiltered + kReservedSizeForEndOfRequestMessage;
+
+    CHIP_ERROR err = CHIP_NO_ERROR;
+    Span<AttributePathParams> attributePaths(aReadPrepareParams.mpAttributePathParamsList,
+                                             aReadPrepareParams.mAttributePathParamsListSize);
+
+    aEncodedDataVersionList = false;
+
+    ReturnErrorOnFailure(aDataVersionFilterIBsBuilder.GetWriter()->ReserveBuffer(kReservedSize));
+
+    if (aReadPrepareParams.mDataVersionFilterListSize != 0 && aReadPrepareParams.mpDataVersionFilterList != nullptr)
+    {
+        for (size_t index = 0; index < aReadPrepareParams.mDataVersionFilterListSize; index++)
+        {
+            const DataVersionFilter & filter = aReadPrepareParams.mpDataVersionFilterList[index];
+            bool intersected                 = false;
+
+            //
+            // A filter for a cluster instance that none of the requested paths cover is meaningless, so skip it.
+            //
+            for (auto & path : attributePaths)
+            {
+                if (path.IncludesAttributesInCluster(filter))
+                {
+                    intersected = true;
+                    break;
+                }
+            }
+
+            if (!intersected)
+            {
+                continue;
+            }
+
+            err = EncodeDataVersionFilter(aDataVersionFilterIBsBuilder, filter);
+            if (err == CHIP_ERROR_NO_MEMORY)
+            {
+                err = CHIP_NO_ERROR;
+                break;
+            }
+            SuccessOrExit(err);
+
+            aEncodedDataVersionList = true;
+        }
+    }
+    else
+    {
+        err = mpCallback.OnUpdateDataVersionFilterList(aDataVersionFilterIBsBuilder, attributePaths, aEncodedDataVersionList);
+        SuccessOrExit(err);
+    }
+
+exit:
+    ReturnErrorOnFailure(aDataVersionFilterIBsBuilder.GetWriter()->UnreserveBuffer(kReservedSize));
+    ReturnErrorOnFailure(err);
+
+    if (aEncodedDataVersionList)
+    {
+        ReturnErrorOnFailure(aDataVersionFilterIBsBuilder.EndOfDataVersionFilterIBs().GetError());
+    }
+
+    return CHIP_NO_ERROR;
+}
+
 CHIP_ERROR ReadClient::OnMessageReceived(Messaging::ExchangeContext * apExchangeContext, const PayloadHeader & aPayloadHeader,
                                          System::PacketBufferHandle && aPayload)
 {
@@ -520,6 +650,17 @@ CHIP_ERROR ReadClient::ProcessAttributeReportIBs(TLV::TLVReader & aAttributeRepo
             ReturnErrorOnFailure(ProcessAttributePath(path, attributePath));
             ReturnErrorOnFailure(data.GetData(&dataReader));
 
+            DataVersion version = 0;
+            err                 = data.GetDataVersion(&version);
+            if (CHIP_NO_ERROR == err)
+            {
+                attributePath.mDataVersion.SetValue(version);
+            }
+            else if (CHIP_END_OF_TLV != err)
+            {
+                return err;
+            }
+
             // The element in an array may be another array -- so we should only set the list operation when we are handling the
             // whole list.
             if (!attributePath.IsListOperation() && dataReader.GetType() == TLV::kTLVType_Array)
@@ -694,6 +835,22 @@ CHIP_ERROR ReadClient::SendSubscribeRequest(ReadPrepareParams & aReadPreparePara
         ReturnErrorOnFailure(err = eventFilters.GetError());
     }
 
+    if (aReadPrepareParams.mAttributePathParamsListSize != 0 && aReadPrepareParams.mpAttributePathParamsList != nullptr)
+    {
+        TLV::TLVWriter backup;
+        bool encodedDataVersionList = false;
+
+        request.Checkpoint(backup);
+        DataVersionFilterIBs::Builder & dataVersionFilterListBuilder = request.CreateDataVersionFilters();
+        ReturnErrorOnFailure(err = request.GetError());
+        ReturnErrorOnFailure(
+            err = GenerateDataVersionFilterList(dataVersionFilterListBuilder, aReadPrepareParams, encodedDataVersionList));
+        if (!encodedDataVersionList)
+        {
+            request.Rollback(backup);
+        }
+    }
+
     request.IsFabricFiltered(false).EndOfSubscribeRequestMessage();
     ReturnErrorOnFailure(err = request.GetError());
 
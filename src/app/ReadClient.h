@@ -25,6 +25,7 @@
 #pragma once
 #include <app/AttributePathParams.h>
 #include <app/ConcreteAttributePath.h>
+#include <app/DataVersionFilter.h>
 #include <app/EventHeader.h>
 #include <app/EventPathParams.h>
 #include <app/InteractionModelDelegate.h>
@@ -38,6 +39,7 @@
 #include <lib/core/CHIPTLVDebug.hpp>
 #include <lib/support/CodeUtils.h>
 #include <lib/support/DLLUtil.h>
+#include <lib/support/Span.h>
 #include <lib/support/logging/CHIPLogging.h>
 #include <messaging/ExchangeContext.h>
 #include <messaging/ExchangeMgr.h>
@@ -161,6 +163,28 @@ public:
          * @param[in] apReadClient The read client object of the terminated read or subscribe interaction.
          */
         virtual void OnDone(ReadClient * apReadClient) = 0;
+
+        /**
+         * OnUpdateDataVersionFilterList will be called when constructing a Read or Subscribe request that doesn't carry an
+         * explicit set of data version filters in its ReadPrepareParams. This gives the callback (e.g. a cache of previously
+         * received attribute data) a chance to encode DataVersionFilterIBs for cluster instances it already holds a complete
+         * and up-to-date copy of, so that the server can omit their attributes from the resulting reports.
+         *
+         * Filters should only be encoded for cluster instances covered by aAttributePaths. Use
+         * ReadClient::EncodeDataVersionFilter to encode each filter; once it returns CHIP_ERROR_NO_MEMORY, no further filters
+         * will fit and encoding should stop, leaving the filters encoded so far in place.
+         *
+         * @param[in] aDataVersionFilterIBsBuilder The builder for the DataVersionFilterIBs list in the request.
+         * @param[in] aAttributePaths              The attribute paths present in the request.
+         * @param[out] aEncodedDataVersionList     Set to true if at least one filter was encoded.
+         */
+        virtual CHIP_ERROR OnUpdateDataVersionFilterList(DataVersionFilterIBs::Builder & aDataVersionFilterIBsBuilder,
+                                                         const Span<AttributePathParams> & aAttributePaths,
+                                                         bool & aEncodedDataVersionList)
+        {
+            aEncodedDataVersionList = false;
+            return CHIP_NO_ERROR;
+        }
     };
 
     enum class InteractionType : uint8_t
@@ -223,6 +247,17 @@ public:
 
     CHIP_ERROR OnUnsolicitedReportData(Messaging::ExchangeContext * apExchangeContext, System::PacketBufferHandle && aPayload);
 
+    /**
+     *  Encode a single DataVersionFilterIB into the provided builder.
+     *
+     *  If the filter does not fit in the remaining space, the builder is rolled back to its state prior to this call.
+     *
+     *  @retval #CHIP_ERROR_NO_MEMORY if the filter doesn't fit in the remaining space.
+     *  @retval #CHIP_NO_ERROR On success.
+     */
+    static CHIP_ERROR EncodeDataVersionFilter(DataVersionFilterIBs::Builder & aDataVersionFilterIBsBuilder,
+                                              const DataVersionFilter & aFilter);
+
     auto GetSubscriptionId() const
     {
         using returnType = Optional<decltype(mSubscriptionId)>;
@@ -271,6 +306,14 @@ private:
                                   size_t aEventPathParamsListSize);
     CHIP_ERROR GenerateAttributePathList(AttributePathIBs::Builder & aAttributePathIBsBuilder,
                                          AttributePathParams * apAttributePathParamsList, size_t aAttributePathParamsListSize);
+
+    /*
+     * Encode the data version filters for the request, either from the explicit list in aReadPrepareParams, or if there
+     * isn't one, as supplied by the callback. aEncodedDataVersionList is set to true if at least one filter was encoded,
+     * and the list is only terminated in that case.
+     */
+    CHIP_ERROR GenerateDataVersionFilterList(DataVersionFilterIBs::Builder & aDataVersionFilterIBsBuilder,
+                                             const ReadPrepareParams & aReadPrepareParams, bool & aEncodedDataVersionList);
     CHIP_ERROR ProcessAttributeReportIBs(TLV::TLVReader & aAttributeDataIBsReader);
     CHIP_ERROR ProcessEventReportIBs(TLV::TLVReader & aEventReportIBsReader);
 
@@ -41,15 +41,13 @@ CHIP_ERROR ReadHandler::Init(Messaging::ExchangeManager * apExchangeMgr, Interac
     // Error if already initialized.
     VerifyOrReturnError(IsFree(), err = CHIP_ERROR_INCORRECT_STATE);
     VerifyOrReturnError(mpExchangeCtx == nullptr, err = CHIP_ERROR_INCORRECT_STATE);
-    mpExchangeMgr              = apExchangeMgr;
-    mpExchangeCtx              = apExchangeContext;
-    mSuppressResponse          = true;
-    mpAttributeClusterInfoList = nullptr;
-    mpEventClusterInfoList     = nullptr;
-    mCurrentPriority           = PriorityLevel::Invalid;
-    mEventMin                  = 0;
-    mLastScheduledEventNumber  = 0;
-    mIsPrimingReports          = true;
+    mpExchangeMgr             = apExchangeMgr;
+    mpExchangeCtx             = apExchangeContext;
+    mSuppressResponse         = true;
+    mCurrentPriority          = PriorityLevel::Invalid;
+    mEventMin                 = 0;
+    mLastScheduledEventNumber = 0;
+    mIsPrimingReports         = true;
     MoveToState(HandlerState::Initialized);
     mpDelegate              = apDelegate;
     mSubscriptionId         = 0;
@@ -74,6 +72,8 @@ void ReadHandler::Shutdown(ShutdownOptions aOptions)
 {
     if (IsSubscriptionType())
     {
+        InteractionModelEngine::GetInstance()->GetExchangeManager()->GetSessionManager()->SystemLayer()->CancelTimer(
+            OnUnblockHoldReportCallback, this);
         InteractionModelEngine::GetInstance()->GetExchangeManager()->GetSessionManager()->SystemLayer()->CancelTimer(
             OnRefreshSubscribeTimerSyncCallback, this);
         if (mpDelegate != nullptr)
@@ -90,33 +90,42 @@ void ReadHandler::Shutdown(ShutdownOptions aOptions)
             mpExchangeCtx = nullptr;
         }
     }
+    else if (mpExchangeCtx != nullptr && mpExchangeCtx->GetDelegate() == this)
+    {
+        // The exchange closes on its own, it must not call back into a handler that may be released below
+        mpExchangeCtx->SetDelegate(nullptr);
+    }
 
     if (IsAwaitingReportResponse())
     {
         InteractionModelEngine::GetInstance()->GetReportingEngine().OnReportConfirm();
     }
-    InteractionModelEngine::GetInstance()->ReleaseClusterInfoList(mpAttributeClusterInfoList);
-    InteractionModelEngine::GetInstance()->ReleaseClusterInfoList(mpEventClusterInfoList);
+    InteractionModelEngine::GetInstance()->GetReportingEngine().UnscheduleReport(*this);
+    UpdateDirty(false);
+    mAttributePaths.Release();
+    mEventPaths.Release();
     mSubscriptionId            = 0;
     mMinIntervalFloorSeconds   = 0;
     mMaxIntervalCeilingSeconds = 0;
     mInteractionType           = InteractionType::Read;
     mpExchangeCtx              = nullptr;
     MoveToState(HandlerState::Uninitialized);
-    mpAttributeClusterInfoList = nullptr;
-    mpEventClusterInfoList     = nullptr;
     mCurrentPriority           = PriorityLevel::Invalid;
     mEventMin                  = 0;
     mLastScheduledEventNumber  = 0;
     mIsPrimingReports          = false;
     mpDelegate                 = nullptr;
     mHoldReport                = false;
-    mDirty                     = false;
     mActiveSubscription        = false;
     mIsChunkedReport           = false;
     mInitiatorNodeId           = kUndefinedNodeId;
     mHoldSync                  = false;
     mLastWrittenEventsBytes    = 0;
+
+    if (mpManagementCallback != nullptr)
+    {
+        mpManagementCallback->OnDone(*this);
+    }
 }
 
 CHIP_ERROR ReadHandler::OnReadInitialRequest(System::PacketBufferHandle && aPayload)
@@ -397,14 +406,15 @@ CHIP_ERROR ReadHandler::ProcessAttributePathList(AttributePathIBs::Parser & aAtt
             err = CHIP_NO_ERROR;
         }
         SuccessOrExit(err);
-        err = InteractionModelEngine::GetInstance()->PushFront(mpAttributeClusterInfoList, clusterInfo);
+        VerifyOrExit(HasRoomForPath(), err = CHIP_ERROR_NO_MEMORY);
+        err = mAttributePaths.Insert(clusterInfo);
         SuccessOrExit(err);
         mIsPrimingReports = true;
     }
     // if we have exhausted this container
     if (CHIP_END_OF_TLV == err)
     {
-        mAttributePathExpandIterator = AttributePathExpandIterator(mpAttributeClusterInfoList);
+        mAttributePathExpandIterator = AttributePathExpandIterator(mAttributePaths.Head());
         err                          = CHIP_NO_ERROR;
     }
 
@@ -458,7 +468,8 @@ CHIP_ERROR ReadHandler::ProcessEventPaths(EventPathIBs::Parser & aEventPathsPars
         }
         ReturnErrorOnFailure(err);
 
-        ReturnErrorOnFailure(InteractionModelEngine::GetInstance()->PushFront(mpEventClusterInfoList, clusterInfo));
+        VerifyOrReturnError(HasRoomForPath(), CHIP_ERROR_NO_MEMORY);
+        ReturnErrorOnFailure(mEventPaths.Insert(clusterInfo));
     }
 
     // if we have exhausted this container
@@ -515,6 +526,54 @@ void ReadHandler::MoveToState(const HandlerState aTargetState)
 {
     mState = aTargetState;
     ChipLogDetail(DataManagement, "IM RH moving to [%s]", GetStateStr());
+    if (aTargetState == HandlerState::GeneratingReports)
+    {
+        ScheduleReportIfReportable();
+    }
+}
+
+void ReadHandler::SetDirty()
+{
+    UpdateDirty(true);
+    // If the contents of the global dirty set have changed, we need to reset the iterator since the paths
+    // we've sent up till now are no longer valid and need to be invalidated.
+    mAttributePathExpandIterator = AttributePathExpandIterator(mAttributePaths.Head());
+    mAttributeEncoderState       = AttributeValueEncoder::AttributeEncodeState();
+    ScheduleReportIfReportable();
+}
+
+void ReadHandler::UnblockUrgentEventDelivery()
+{
+    mHoldReport = false;
+    UpdateDirty(true);
+    ScheduleReportIfReportable();
+}
+
+void ReadHandler::UpdateDirty(bool aDirty)
+{
+    VerifyOrReturn(mDirty != aDirty);
+    mDirty = aDirty;
+    InteractionModelEngine::GetInstance()->GetReportingEngine().OnReadHandlerDirtyChanged(aDirty);
+}
+
+void ReadHandler::ClearHoldReport()
+{
+    mHoldReport = false;
+    ScheduleReportIfReportable();
+}
+
+void ReadHandler::ClearHoldSync()
+{
+    mHoldSync = false;
+    ScheduleReportIfReportable();
+}
+
+void ReadHandler::ScheduleReportIfReportable()
+{
+    if (IsReportable())
+    {
+        InteractionModelEngine::GetInstance()->GetReportingEngine().ScheduleReport(*this);
+    }
 }
 
 bool ReadHandler::CheckEventClean(EventManagement & aEventManager)
@@ -539,13 +598,30 @@ bool ReadHandler::CheckEventClean(EventManagement & aEventManager)
     return true;
 }
 
-CHIP_ERROR ReadHandler::SendSubscribeResponse()
+size_t ReadHandler::GetMaxReportPayloadSize() const
 {
-    System::PacketBufferHandle packet = System::PacketBufferHandle::New(chip::app::kMaxSecureSduLengthBytes);
-    VerifyOrReturnLogError(!packet.IsNull(), CHIP_ERROR_NO_MEMORY);
+    if (mpExchangeMgr == nullptr || mpExchangeMgr->GetSessionManager() == nullptr)
+    {
+        return kMaxSecureSduLengthBytes;
+    }
+
+    // Reports of a subscription, except for the priming ones, are sent on a new exchange over the subscription session.
+    if (mpExchangeCtx != nullptr)
+    {
+        return mpExchangeMgr->GetSessionManager()->GetMaxPayloadSize(mpExchangeCtx->GetSessionHandle(), kMaxSecureSduLengthBytes);
+    }
+    if (mSessionHandle.HasValue())
+    {
+        return mpExchangeMgr->GetSessionManager()->GetMaxPayloadSize(mSessionHandle.Value(), kMaxSecureSduLengthBytes);
+    }
+    return kMaxSecureSduLengthBytes;
+}
 
+CHIP_ERROR ReadHandler::SendSubscribeResponse()
+{
+    System::PacketBufferHandle packet;
     System::PacketBufferTLVWriter writer;
-    writer.Init(std::move(packet));
+    ReturnLogErrorOnFailure(writer.InitChained(chip::app::kMaxSecureSduLengthBytes));
 
     SubscribeResponseMessage::Builder response;
     ReturnErrorOnFailure(response.Init(&writer));
@@ -637,7 +713,7 @@ void ReadHandler::OnUnblockHoldReportCallback(System::Layer * apSystemLayer, voi
     VerifyOrReturn(apAppState != nullptr);
     ReadHandler * readHandler = static_cast<ReadHandler *>(apAppState);
     ChipLogProgress(DataManagement, "Unblock report hold after min %d seconds", readHandler->mMinIntervalFloorSeconds);
-    readHandler->mHoldReport = false;
+    readHandler->ClearHoldReport();
     if (readHandler->mDirty)
     {
         InteractionModelEngine::GetInstance()->GetReportingEngine().ScheduleRun();
@@ -651,7 +727,7 @@ void ReadHandler::OnRefreshSubscribeTimerSyncCallback(System::Layer * apSystemLa
 {
     VerifyOrReturn(apAppState != nullptr);
     ReadHandler * readHandler = static_cast<ReadHandler *>(apAppState);
-    readHandler->mHoldSync    = false;
+    readHandler->ClearHoldSync();
     ChipLogProgress(DataManagement, "Refresh subscribe timer sync after %d seconds",
                     readHandler->mMaxIntervalCeilingSeconds - readHandler->mMinIntervalFloorSeconds);
     InteractionModelEngine::GetInstance()->GetReportingEngine().ScheduleRun();
@@ -28,6 +28,7 @@
 #include <app/AttributeAccessInterface.h>
 #include <app/AttributePathExpandIterator.h>
 #include <app/ClusterInfo.h>
+#include <app/ClusterInfoList.h>
 #include <app/EventManagement.h>
 #include <app/InteractionModelDelegate.h>
 #include <lib/core/CHIPCore.h>
@@ -39,10 +40,15 @@
 #include <messaging/ExchangeMgr.h>
 #include <messaging/Flags.h>
 #include <protocols/Protocols.h>
+#include <system/SystemClock.h>
 #include <system/SystemPacketBuffer.h>
 
 namespace chip {
 namespace app {
+namespace reporting {
+class Engine;
+} // namespace reporting
+
 /**
  *  @class ReadHandler
  *
@@ -67,6 +73,26 @@ public:
         Subscribe,
     };
 
+    class ManagementCallback
+    {
+    public:
+        virtual ~ManagementCallback() = default;
+
+        /*
+         * Method that signals to the owner of the handler that it has been shut down
+         * and is now safe for release/destruction.
+         */
+        virtual void OnDone(ReadHandler & apReadHandler) = 0;
+    };
+
+    /**
+     *  Constructor.
+     *
+     *  @param[in]    apCallback    Callback notified at the end of Shutdown(), may be null for a handler that is not
+     *                              owned by the InteractionModelEngine.
+     */
+    ReadHandler(ManagementCallback * apCallback = nullptr) : mpManagementCallback(apCallback) {}
+
     /**
      *  Initialize the ReadHandler. Within the lifetime
      *  of this instance, this method is invoked once after object
@@ -83,7 +109,8 @@ public:
 
     /**
      *  Shut down the ReadHandler. This terminates this instance
-     *  of the object and releases all held resources.
+     *  of the object and releases all held resources. The management
+     *  callback, if any, is called last and may destroy the handler.
      *
      */
     void Shutdown(ShutdownOptions aOptions = ShutdownOptions::KeepCurrentExchange);
@@ -116,8 +143,8 @@ public:
     bool IsAwaitingReportResponse() const { return mState == HandlerState::AwaitingReportResponse; }
     virtual ~ReadHandler() = default;
 
-    ClusterInfo * GetAttributeClusterInfolist() { return mpAttributeClusterInfoList; }
-    ClusterInfo * GetEventClusterInfolist() { return mpEventClusterInfoList; }
+    const ClusterInfoList & GetAttributePathList() const { return mAttributePaths; }
+    const ClusterInfoList & GetEventPathList() const { return mEventPaths; }
     EventNumber & GetEventMin() { return mEventMin; }
     PriorityLevel GetCurrentPriority() { return mCurrentPriority; }
 
@@ -126,41 +153,37 @@ public:
     // sanpshotted last event, check with latest last event number, re-setup snapshoted checkpoint, and compare again.
     bool CheckEventClean(EventManagement & aEventManager);
 
-    bool IsReadType() { return mInteractionType == InteractionType::Read; }
-    bool IsSubscriptionType() { return mInteractionType == InteractionType::Subscribe; }
+    bool IsReadType() const { return mInteractionType == InteractionType::Read; }
+    bool IsSubscriptionType() const { return mInteractionType == InteractionType::Subscribe; }
     bool IsChunkedReport() { return mIsChunkedReport; }
     bool IsPriming() { return mIsPrimingReports; }
     bool IsActiveSubscription() const { return mActiveSubscription; }
     CHIP_ERROR OnSubscribeRequest(Messaging::ExchangeContext * apExchangeContext, System::PacketBufferHandle && aPayload);
     void GetSubscriptionId(uint64_t & aSubscriptionId) { aSubscriptionId = mSubscriptionId; }
     AttributePathExpandIterator * GetAttributePathExpandIterator() { return &mAttributePathExpandIterator; }
-    void SetDirty()
-    {
-        mDirty = true;
-        // If the contents of the global dirty set have changed, we need to reset the iterator since the paths
-        // we've sent up till now are no longer valid and need to be invalidated.
-        mAttributePathExpandIterator = AttributePathExpandIterator(mpAttributeClusterInfoList);
-        mAttributeEncoderState       = AttributeValueEncoder::AttributeEncodeState();
-    }
-    void ClearDirty() { mDirty = false; }
+    void SetDirty();
+    void ClearDirty() { UpdateDirty(false); }
     bool IsDirty() { return mDirty; }
     NodeId GetInitiatorNodeId() const { return mInitiatorNodeId; }
     FabricIndex GetAccessingFabricIndex() const { return mSubjectDescriptor.fabricIndex; }
 
     const SubjectDescriptor & GetSubjectDescriptor() const { return mSubjectDescriptor; }
 
-    void UnblockUrgentEventDelivery()
-    {
-        mHoldReport = false;
-        mDirty      = true;
-    }
+    void UnblockUrgentEventDelivery();
 
     const AttributeValueEncoder::AttributeEncodeState & GetAttributeEncodeState() const { return mAttributeEncoderState; }
     void SetAttributeEncodeState(const AttributeValueEncoder::AttributeEncodeState & aState) { mAttributeEncoderState = aState; }
     uint32_t GetLastWrittenEventsBytes() { return mLastWrittenEventsBytes; }
 
+    /**
+     * Largest payload to build for the next report, see SessionManager::GetMaxPayloadSize(). Reports sent over a TCP session can
+     * be larger than kMaxSecureSduLengthBytes.
+     */
+    size_t GetMaxReportPayloadSize() const;
+
 private:
     friend class TestReadInteraction;
+    friend class reporting::Engine;
     enum class HandlerState
     {
         Uninitialized = 0,      ///< The handler has not been initialized
@@ -179,6 +202,10 @@ private:
     CHIP_ERROR ProcessAttributePathList(AttributePathIBs::Parser & aAttributePathListParser);
     CHIP_ERROR ProcessEventPaths(EventPathIBs::Parser & aEventPathsParser);
     CHIP_ERROR ProcessEventFilters(EventFilterIBs::Parser & aEventFiltersParser);
+    bool HasRoomForPath() const
+    {
+        return mAttributePaths.Size() + mEventPaths.Size() < CHIP_IM_MAX_NUM_PATHS_PER_READ_HANDLER;
+    }
     CHIP_ERROR OnStatusResponse(Messaging::ExchangeContext * apExchangeContext, System::PacketBufferHandle && aPayload);
     CHIP_ERROR OnMessageReceived(Messaging::ExchangeContext * apExchangeContext, const PayloadHeader & aPayloadHeader,
                                  System::PacketBufferHandle && aPayload) override;
@@ -187,17 +214,35 @@ private:
                                 System::PacketBufferHandle && aPayload);
     void MoveToState(const HandlerState aTargetState);
 
+    /**
+     * Set mDirty and keep the reporting engine count of dirty handlers up to date.
+     */
+    void UpdateDirty(bool aDirty);
+
+    /**
+     * Lift the min interval hold, or the max interval hold for ClearHoldSync(), and queue the handler if it can report.
+     */
+    void ClearHoldReport();
+    void ClearHoldSync();
+
+    /**
+     * Queue the handler in the reporting engine if it can send a report now. Must be called whenever the state, the dirty
+     * flag or one of the holds changes in a way that may make the handler reportable.
+     */
+    void ScheduleReportIfReportable();
+
     const char * GetStateStr() const;
 
+    ManagementCallback * mpManagementCallback  = nullptr;
     Messaging::ExchangeContext * mpExchangeCtx = nullptr;
 
     // Don't need the response for report data if true
     bool mSuppressResponse = false;
 
     // Current Handler state
-    HandlerState mState                      = HandlerState::Uninitialized;
-    ClusterInfo * mpAttributeClusterInfoList = nullptr;
-    ClusterInfo * mpEventClusterInfoList     = nullptr;
+    HandlerState mState = HandlerState::Uninitialized;
+    ClusterInfoList mAttributePaths;
+    ClusterInfoList mEventPaths;
 
     PriorityLevel mCurrentPriority = PriorityLevel::Invalid;
 
@@ -231,6 +276,11 @@ private:
     SubjectDescriptor mSubjectDescriptor;
     // The detailed encoding state for a single attribute, used by list chunking feature.
     AttributeValueEncoder::AttributeEncodeState mAttributeEncoderState;
+
+    // Link and queueing time in the reporting engine queue of handlers waiting for a report, see reporting::Engine.
+    ReadHandler * mpNextScheduledReport          = nullptr;
+    System::Clock::Timestamp mReportEligibleTime = System::Clock::kZero;
+    bool mReportScheduled                        = false;
 };
 } // namespace app
 } // namespace chip
@@ -25,11 +25,9 @@ CHIP_ERROR StatusResponse::Send(Protocols::InteractionModel::Status aStatus, Mes
                                 bool aExpectResponse)
 {
     VerifyOrReturnError(apExchangeContext != nullptr, CHIP_ERROR_INCORRECT_STATE);
-    System::PacketBufferHandle msgBuf = System::PacketBufferHandle::New(kMaxSecureSduLengthBytes);
-    VerifyOrReturnError(!msgBuf.IsNull(), CHIP_ERROR_NO_MEMORY);
-
+    System::PacketBufferHandle msgBuf;
     System::PacketBufferTLVWriter writer;
-    writer.Init(std::move(msgBuf));
+    ReturnErrorOnFailure(writer.InitChained(kMaxSecureSduLengthBytes));
 
     StatusResponseMessage::Builder response;
     ReturnErrorOnFailure(response.Init(&writer));
@@ -32,13 +32,13 @@ namespace chip {
 namespace app {
 
 CHIP_ERROR WriteClient::Init(Messaging::ExchangeManager * apExchangeMgr, Callback * apCallback,
-                             const Optional<uint16_t> & aTimedWriteTimeoutMs)
+                             const Optional<uint16_t> & aTimedWriteTimeoutMs, size_t aMaxPayloadSize)
 {
     VerifyOrReturnError(apExchangeMgr != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     VerifyOrReturnError(mpExchangeMgr == nullptr, CHIP_ERROR_INCORRECT_STATE);
     VerifyOrReturnError(mpExchangeCtx == nullptr, CHIP_ERROR_INCORRECT_STATE);
 
-    System::PacketBufferHandle packet = System::PacketBufferHandle::New(chip::app::kMaxSecureSduLengthBytes);
+    System::PacketBufferHandle packet = System::PacketBufferHandle::New(aMaxPayloadSize);
     VerifyOrReturnError(!packet.IsNull(), CHIP_ERROR_NO_MEMORY);
 
     mMessageWriter.Init(std::move(packet));
@@ -25,6 +25,7 @@
 #include <app/MessageDef/AttributeStatusIB.h>
 #include <app/MessageDef/StatusIB.h>
 #include <app/MessageDef/WriteRequestMessage.h>
+#include <app/StatusResponse.h>
 #include <app/data-model/Encode.h>
 #include <app/data-model/List.h>
 #include <lib/core/CHIPCore.h>
@@ -160,11 +161,12 @@ private:
      *  @param[in]    apExchangeMgr    A pointer to the ExchangeManager object.
      *  @param[in]    apDelegate       InteractionModelDelegate set by application.
      *  @param[in]    aTimedWriteTimeoutMs If provided, do a timed write using this timeout.
+     *  @param[in]    aMaxPayloadSize  Largest write request to build, see SessionManager::GetMaxPayloadSize().
      *  @retval #CHIP_ERROR_INCORRECT_STATE incorrect state if it is already initialized
      *  @retval #CHIP_NO_ERROR On success.
      */
     CHIP_ERROR Init(Messaging::ExchangeManager * apExchangeMgr, Callback * apDelegate,
-                    const Optional<uint16_t> & aTimedWriteTimeoutMs);
+                    const Optional<uint16_t> & aTimedWriteTimeoutMs, size_t aMaxPayloadSize = kMaxSecureSduLengthBytes);
 
     virtual ~WriteClient() = default;
 
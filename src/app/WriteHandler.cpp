@@ -34,10 +34,7 @@ CHIP_ERROR WriteHandler::Init(InteractionModelDelegate * apDelegate)
     IgnoreUnusedVariable(apDelegate);
     VerifyOrReturnError(mpExchangeCtx == nullptr, CHIP_ERROR_INCORRECT_STATE);
 
-    System::PacketBufferHandle packet = System::PacketBufferHandle::New(chip::app::kMaxSecureSduLengthBytes);
-    VerifyOrReturnError(!packet.IsNull(), CHIP_ERROR_NO_MEMORY);
-
-    mMessageWriter.Init(std::move(packet));
+    ReturnErrorOnFailure(mMessageWriter.InitChained(chip::app::kMaxSecureSduLengthBytes));
     ReturnErrorOnFailure(mWriteResponseBuilder.Init(&mMessageWriter));
 
     mWriteResponseBuilder.CreateWriteResponses();
@@ -61,8 +61,9 @@ CHIP_ERROR DescriptorAttrAccess::ReadPartsAttribute(EndpointId endpoint, Attribu
 
     if (endpoint == 0x00)
     {
-        err = aEncoder.EncodeList([](const auto & encoder) -> CHIP_ERROR {
-            for (uint16_t index = 0; index < emberAfEndpointCount(); index++)
+        // Bridges can expose many endpoints: resume from the endpoint index where the previous chunk stopped.
+        err = aEncoder.EncodeResumableList([](AttributeValueEncoder::ListCursor startIndex, const auto & encoder) -> CHIP_ERROR {
+            for (uint16_t index = static_cast<uint16_t>(startIndex); index < emberAfEndpointCount(); index++)
             {
                 if (emberAfEndpointIndexIsEnabled(index))
                 {
@@ -70,7 +71,7 @@ CHIP_ERROR DescriptorAttrAccess::ReadPartsAttribute(EndpointId endpoint, Attribu
                     if (endpointId == 0)
                         continue;
 
-                    ReturnErrorOnFailure(encoder.Encode(endpointId));
+                    ReturnErrorOnFailure(encoder.Encode(endpointId, index + 1u));
                 }
             }
 
@@ -133,6 +133,16 @@ void BDXDownloader::EndDownload(CHIP_ERROR reason)
         // Because AbortTransfer() will generate a StatusReport to send.
         PollTransferSession();
     }
+    else if (mState == State::kComplete && reason != CHIP_NO_ERROR)
+    {
+        // The whole image has been received, but could not be stored
+        ChipLogError(BDX, "download failed after transfer: %" CHIP_ERROR_FORMAT, reason.Format());
+        if (mImageProcessor != nullptr)
+        {
+            mImageProcessor->Abort();
+        }
+        mState = State::kIdle;
+    }
     else
     {
         ChipLogError(BDX, "no download in progress");
@@ -58,6 +58,7 @@ public:
 
     // Not all download protocols will be able to close gracefully from the receiver side.
     // The reason parameter should be used to indicate if this is a graceful end or a forceful abort.
+    // An error reason also fails a download whose transfer has completed, e.g. when the image could not be stored.
     void virtual EndDownload(CHIP_ERROR reason = CHIP_NO_ERROR) = 0;
 
     // Fetch the next set of data. May be a no-op for asynchronous protocols.
@@ -164,6 +164,8 @@ void OTARequestor::OnApplyUpdateResponse(void * context, const ApplyUpdateRespon
     case EMBER_ZCL_OTA_APPLY_UPDATE_ACTION_PROCEED: {
         // TODO: Call OTARequestorDriver to schedule the image application.
         VerifyOrReturn(requestorCore->mBdxDownloader != nullptr, ChipLogError(SoftwareUpdate, "Downloader is not set"));
+        VerifyOrReturn(requestorCore->mBdxDownloader->GetState() == OTADownloader::State::kComplete,
+                       ChipLogError(SoftwareUpdate, "No downloaded image to apply"));
         OTAImageProcessorInterface * imageProcessor = requestorCore->mBdxDownloader->GetImageProcessorDelegate();
         VerifyOrReturn(imageProcessor != nullptr, ChipLogError(SoftwareUpdate, "Image processor is not set"));
         imageProcessor->Apply();
@@ -21,6 +21,7 @@
 #include <app/data-model/Nullable.h>
 #include <lib/core/CHIPTLV.h>
 #include <lib/core/Optional.h>
+#include <lib/support/TypeTraits.h>
 
 namespace chip {
 namespace app {
@@ -118,6 +119,99 @@ CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag, const Nullable<X> & x)
     return Encode(writer, tag, x.Value());
 }
 
+/*
+ * @brief
+ * Set of overloaded methods that mirror the encode methods above and return the exact number of bytes
+ * they write for a cluster element, without encoding it.
+ */
+inline constexpr size_t EncodedSize(TLV::Tag tag, bool)
+{
+    return TLV::EncodedFixedSize(tag);
+}
+
+template <typename X, typename std::enable_if_t<std::is_integral<X>::value, int> = 0>
+constexpr size_t EncodedSize(TLV::Tag tag, X x)
+{
+    return std::is_signed<X>::value ? TLV::EncodedSignedIntegerSize(tag, static_cast<int64_t>(x))
+                                    : TLV::EncodedUnsignedIntegerSize(tag, static_cast<uint64_t>(x));
+}
+
+template <typename X, typename std::enable_if_t<std::is_floating_point<X>::value, int> = 0>
+constexpr size_t EncodedSize(TLV::Tag tag, X)
+{
+    return TLV::EncodedFixedSize(tag, sizeof(X));
+}
+
+template <typename X, typename std::enable_if_t<std::is_enum<X>::value, int> = 0>
+constexpr size_t EncodedSize(TLV::Tag tag, X x)
+{
+    return EncodedSize(tag, to_underlying(x));
+}
+
+template <typename X>
+constexpr size_t EncodedSize(TLV::Tag tag, BitFlags<X> x)
+{
+    return EncodedSize(tag, x.Raw());
+}
+
+inline constexpr size_t EncodedSize(TLV::Tag tag, ByteSpan x)
+{
+    return TLV::EncodedStringSize(tag, x.size());
+}
+
+inline constexpr size_t EncodedSize(TLV::Tag tag, Span<const char> x)
+{
+    return TLV::EncodedStringSize(tag, x.size());
+}
+
+/*
+ * @brief
+ *
+ * Returns the encoded size of a cluster object (like structs, commands, events), which
+ * depends on the presence of an EncodedSize method on the object. The signature of that
+ * method is as follows:
+ *
+ * size_t <Object>::EncodedSize(TLV::Tag tag) const;
+ *
+ */
+template <
+    typename X,
+    typename std::enable_if_t<
+        std::is_class<X>::value && std::is_same<decltype(std::declval<X>().EncodedSize(std::declval<TLV::Tag>())), size_t>::value,
+        X> * = nullptr>
+size_t EncodedSize(TLV::Tag tag, const X & x)
+{
+    return x.EncodedSize(tag);
+}
+
+template <typename X>
+size_t EncodedSize(TLV::Tag tag, const Optional<X> & x)
+{
+    return x.HasValue() ? EncodedSize(tag, x.Value()) : 0;
+}
+
+template <typename X>
+size_t EncodedSize(TLV::Tag tag, const Nullable<X> & x)
+{
+    return x.IsNull() ? TLV::EncodedFixedSize(tag) : EncodedSize(tag, x.Value());
+}
+
+/*
+ * @brief
+ *
+ * Whether the encoded size of an X can be computed with EncodedSize(). Objects that can only be
+ * encoded, such as hand-written command payloads without an EncodedSize method, cannot.
+ */
+template <typename X, typename = void>
+struct HasEncodedSize : std::false_type
+{
+};
+
+template <typename X>
+struct HasEncodedSize<X, decltype(void(EncodedSize(std::declval<TLV::Tag>(), std::declval<const X &>())))> : std::true_type
+{
+};
+
 } // namespace DataModel
 } // namespace app
 } // namespace chip
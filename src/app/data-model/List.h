@@ -72,6 +72,17 @@ inline CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag, List<X> list)
     return CHIP_NO_ERROR;
 }
 
+template <typename X>
+inline size_t EncodedSize(TLV::Tag tag, List<X> list)
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    for (auto & item : list)
+    {
+        size += EncodedSize(TLV::AnonymousTag, item);
+    }
+    return size;
+}
+
 } // namespace DataModel
 } // namespace app
 } // namespace chip
@@ -35,29 +35,75 @@ namespace app {
 namespace reporting {
 CHIP_ERROR Engine::Init()
 {
-    mNumReportsInFlight = 0;
-    mCurReadHandlerIdx  = 0;
+    mNumReportsInFlight    = 0;
+    mpScheduledReportsHead = nullptr;
+    mpScheduledReportsTail = nullptr;
+    mNumScheduledReports   = 0;
+    mNumDirtyReadHandlers  = 0;
     return CHIP_NO_ERROR;
 }
 
 void Engine::Shutdown()
 {
-    mNumReportsInFlight = 0;
-    mCurReadHandlerIdx  = 0;
+    mNumReportsInFlight    = 0;
+    mpScheduledReportsHead = nullptr;
+    mpScheduledReportsTail = nullptr;
+    mNumScheduledReports   = 0;
+    mNumDirtyReadHandlers  = 0;
     InteractionModelEngine::GetInstance()->ReleaseClusterInfoList(mpGlobalDirtySet);
     mpGlobalDirtySet = nullptr;
 }
 
 CHIP_ERROR
 Engine::RetrieveClusterData(const SubjectDescriptor & aSubjectDescriptor, AttributeReportIBs::Builder & aAttributeReportIBs,
-                            const ConcreteReadAttributePath & aPath, AttributeValueEncoder::AttributeEncodeState * aEncoderState)
+                            const Span<const ConcreteReadAttributePath> & aPaths,
+                            AttributeValueEncoder::AttributeEncodeState * aEncoderState, size_t & aNumPathsRead)
 {
-    ChipLogDetail(DataManagement, "<RE:Run> Cluster %" PRIx32 ", Attribute %" PRIx32 " is dirty", aPath.mClusterId,
-                  aPath.mAttributeId);
-    MatterPreAttributeReadCallback(aPath);
-    ReturnErrorOnFailure(ReadSingleClusterData(aSubjectDescriptor, aPath, aAttributeReportIBs, aEncoderState));
-    MatterPostAttributeReadCallback(aPath);
-    return CHIP_NO_ERROR;
+    ChipLogDetail(DataManagement, "<RE:Run> Cluster %" PRIx32 " on endpoint %" PRIx16 " has %u dirty attribute(s)",
+                  aPaths.data()[0].mClusterId, aPaths.data()[0].mEndpointId, static_cast<unsigned>(aPaths.size()));
+    return ReadClusterData(aSubjectDescriptor, aPaths, aAttributeReportIBs, aEncoderState, aNumPathsRead);
+}
+
+bool Engine::IsReportablePath(ReadHandler * apReadHandler, const ConcreteAttributePath & aPath) const
+{
+    // If we are processing a read request, or the initial report of a subscription, just regard all paths as dirty paths.
+    if (apReadHandler->IsPriming())
+    {
+        return true;
+    }
+
+    // TODO: Optimize this implementation by making the iterator only emit intersected paths.
+    for (auto dirtyPath = mpGlobalDirtySet; dirtyPath != nullptr; dirtyPath = dirtyPath->mpNext)
+    {
+        if (dirtyPath->IsAttributePathSupersetOf(aPath))
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+size_t Engine::CollectClusterReadBatch(ReadHandler * apReadHandler, AttributePathExpandIterator & aIterator,
+                                       ConcreteReadAttributePath * aPaths, size_t aMaxPaths) const
+{
+    // TODO: Figure out how AttributePathExpandIterator should handle read
+    // vs write paths.
+    ConcreteAttributePath readPath;
+    size_t count = 0;
+
+    for (; count < aMaxPaths && aIterator.Get(readPath); aIterator.Next())
+    {
+        if (count > 0 && (readPath.mEndpointId != aPaths[0].mEndpointId || readPath.mClusterId != aPaths[0].mClusterId))
+        {
+            break;
+        }
+
+        if (IsReportablePath(apReadHandler, readPath))
+        {
+            aPaths[count++] = ConcreteReadAttributePath(readPath);
+        }
+    }
+    return count;
 }
 
 CHIP_ERROR Engine::BuildSingleReportDataAttributeReportIBs(ReportDataMessage::Builder & aReportDataBuilder,
@@ -84,46 +130,32 @@ CHIP_ERROR Engine::BuildSingleReportDataAttributeReportIBs(ReportDataMessage::Bu
     attributeReportIBs.GetWriter()->ReserveBuffer(kReservedSizeEndOfReportIBs);
 
     {
-        // TODO: Figure out how AttributePathExpandIterator should handle read
-        // vs write paths.
-        ConcreteAttributePath readPath;
+        AttributePathExpandIterator * iterator = apReadHandler->GetAttributePathExpandIterator();
+        ConcreteReadAttributePath batch[kMaxClusterReadBatchSize];
 
-        // For each path included in the interested path of the read handler...
-        for (; apReadHandler->GetAttributePathExpandIterator()->Get(readPath);
-             apReadHandler->GetAttributePathExpandIterator()->Next())
+        // For each run of paths of a single cluster included in the interested paths of the read handler...
+        while (iterator->Valid())
         {
-            if (!apReadHandler->IsPriming())
+            // Collect on a copy of the iterator, so that if the chunk fills up part way through the batch we can resume from
+            // the first path that was not encoded.
+            AttributePathExpandIterator batchEnd = *iterator;
+            size_t batchSize = CollectClusterReadBatch(apReadHandler, batchEnd, batch, kMaxClusterReadBatchSize);
+            if (batchSize == 0)
             {
-                bool concretePathDirty = false;
-                // TODO: Optimize this implementation by making the iterator only emit intersected paths.
-                for (auto dirtyPath = mpGlobalDirtySet; dirtyPath != nullptr; dirtyPath = dirtyPath->mpNext)
-                {
-                    if (dirtyPath->IsAttributePathSupersetOf(readPath))
-                    {
-                        concretePathDirty = true;
-                        break;
-                    }
-                }
-
-                if (!concretePathDirty)
-                {
-                    // This attribute is not dirty, we just skip this one.
-                    continue;
-                }
+                *iterator = batchEnd;
+                continue;
             }
 
-            // If we are processing a read request, or the initial report of a subscription, just regard all paths as dirty paths.
-            TLV::TLVWriter attributeBackup;
-            attributeReportIBs.Checkpoint(attributeBackup);
-            ConcreteReadAttributePath pathForRetrieval(readPath);
+            size_t numPathsRead = 0;
             // Load the saved state from previous encoding session for chunking of one single attribute (list chunking).
             AttributeValueEncoder::AttributeEncodeState encodeState = apReadHandler->GetAttributeEncodeState();
-            err = RetrieveClusterData(apReadHandler->GetSubjectDescriptor(), attributeReportIBs, pathForRetrieval, &encodeState);
+            err = RetrieveClusterData(apReadHandler->GetSubjectDescriptor(), attributeReportIBs,
+                                      Span<const ConcreteReadAttributePath>(batch, batchSize), &encodeState, numPathsRead);
             if (err != CHIP_NO_ERROR)
             {
                 ChipLogError(DataManagement,
                              "Error retrieving data from clusterId: " ChipLogFormatMEI ", err = %" CHIP_ERROR_FORMAT,
-                             ChipLogValueMEI(pathForRetrieval.mClusterId), err.Format());
+                             ChipLogValueMEI(batch[0].mClusterId), err.Format());
 
                 if (encodeState.AllowPartialData())
                 {
@@ -132,15 +164,21 @@ CHIP_ERROR Engine::BuildSingleReportDataAttributeReportIBs(ReportDataMessage::Bu
                 }
                 else
                 {
-                    // We met a error during writing reports, one common case is we are running out of buffer, rollback the
-                    // attributeReportIB to avoid any partial data.
-                    attributeReportIBs.Rollback(attributeBackup);
+                    // We met a error during writing reports, one common case is we are running out of buffer. The partially
+                    // written attributeReportIB has already been rolled back by ReadClusterData to avoid any partial data.
                     apReadHandler->SetAttributeEncodeState(AttributeValueEncoder::AttributeEncodeState());
                 }
+
+                // Move past the paths of this batch that made it into the report, so the next chunk resumes at the failed one.
+                if (numPathsRead > 0)
+                {
+                    CollectClusterReadBatch(apReadHandler, *iterator, batch, numPathsRead);
+                }
             }
             SuccessOrExit(err);
-            // Successfully encoded the attribute, clear the internal state.
+            // Successfully encoded the attributes, clear the internal state.
             apReadHandler->SetAttributeEncodeState(AttributeValueEncoder::AttributeEncodeState());
+            *iterator = batchEnd;
         }
         // We just visited all paths interested by this read handler and did not abort in the middle of iteration, there are no more
         // chunks for this report.
@@ -222,7 +260,7 @@ CHIP_ERROR Engine::BuildSingleReportDataEventReports(ReportDataMessage::Builder
     size_t eventCount = 0;
     TLV::TLVWriter backup;
     bool eventClean                = true;
-    ClusterInfo * clusterInfoList  = apReadHandler->GetEventClusterInfolist();
+    ClusterInfo * clusterInfoList  = apReadHandler->GetEventPathList().Head();
     EventNumber & eventMin         = apReadHandler->GetEventMin();
     EventManagement & eventManager = EventManagement::GetInstance();
     bool hasMoreChunks             = false;
@@ -312,8 +350,9 @@ CHIP_ERROR Engine::BuildAndSendSingleReportData(ReadHandler * apReadHandler)
     CHIP_ERROR err = CHIP_NO_ERROR;
     chip::System::PacketBufferTLVWriter reportDataWriter;
     ReportDataMessage::Builder reportDataBuilder;
-    chip::System::PacketBufferHandle bufHandle = System::PacketBufferHandle::New(chip::app::kMaxSecureSduLengthBytes);
-    uint16_t reservedSize                      = 0;
+    chip::System::PacketBufferHandle bufHandle;
+    size_t maxPayloadSize = 0;
+    uint16_t reservedSize = 0;
     bool hasMoreChunks;
 
     // Reserved size for the MoreChunks boolean flag, which takes up 1 byte for the control tag and 1 byte for the context tag.
@@ -323,11 +362,15 @@ CHIP_ERROR Engine::BuildAndSendSingleReportData(ReadHandler * apReadHandler)
     const uint32_t kReservedSizeForEndOfReportMessage = 1;
 
     VerifyOrExit(apReadHandler != nullptr, err = CHIP_ERROR_INVALID_ARGUMENT);
+
+    // Over TCP, a single report may be larger than kMaxSecureSduLengthBytes.
+    maxPayloadSize = apReadHandler->GetMaxReportPayloadSize();
+    bufHandle      = System::PacketBufferHandle::New(maxPayloadSize);
     VerifyOrExit(!bufHandle.IsNull(), err = CHIP_ERROR_NO_MEMORY);
 
-    if (bufHandle->AvailableDataLength() > kMaxSecureSduLengthBytes)
+    if (bufHandle->AvailableDataLength() > maxPayloadSize)
     {
-        reservedSize = static_cast<uint16_t>(bufHandle->AvailableDataLength() - kMaxSecureSduLengthBytes);
+        reservedSize = static_cast<uint16_t>(bufHandle->AvailableDataLength() - maxPayloadSize);
     }
 
     reportDataWriter.Init(std::move(bufHandle));
@@ -336,7 +379,7 @@ CHIP_ERROR Engine::BuildAndSendSingleReportData(ReadHandler * apReadHandler)
     reportDataWriter.ReserveBuffer(mReservedSize);
 #endif
 
-    // Always limit the size of the generated packet to fit within kMaxSecureSduLengthBytes regardless of the available buffer
+    // Always limit the size of the generated packet to fit within maxPayloadSize regardless of the available buffer
     // capacity.
     // Also, we need to reserve some extra space for the MIC field.
     reportDataWriter.ReserveBuffer(static_cast<uint32_t>(reservedSize + chip::Crypto::CHIP_CRYPTO_AEAD_MIC_LENGTH_BYTES));
@@ -404,8 +447,8 @@ CHIP_ERROR Engine::BuildAndSendSingleReportData(ReadHandler * apReadHandler)
     VerifyOrExit(err == CHIP_NO_ERROR,
                  ChipLogError(DataManagement, "<RE> Error sending out report data with %" CHIP_ERROR_FORMAT "!", err.Format()));
 
-    ChipLogDetail(DataManagement, "<RE> ReportsInFlight = %" PRIu32 " with readHandler %" PRIu32 ", RE has %s", mNumReportsInFlight,
-                  mCurReadHandlerIdx, hasMoreChunks ? "more messages" : "no more messages");
+    ChipLogDetail(DataManagement, "<RE> ReportsInFlight = %" PRIu32 " with readHandler[%p], RE has %s", mNumReportsInFlight,
+                  apReadHandler, hasMoreChunks ? "more messages" : "no more messages");
 
 exit:
     if (err != CHIP_NO_ERROR)
@@ -454,40 +497,51 @@ CHIP_ERROR Engine::ScheduleRun()
 
 void Engine::Run()
 {
-    uint32_t numReadHandled = 0;
-
-    InteractionModelEngine * imEngine = InteractionModelEngine::GetInstance();
-    ReadHandler * readHandler         = imEngine->mReadHandlers + mCurReadHandlerIdx;
+    bool reportFailed = false;
 
     mRunScheduled = false;
 
-    while ((mNumReportsInFlight < CHIP_IM_MAX_REPORTS_IN_FLIGHT) && (numReadHandled < CHIP_IM_MAX_NUM_READ_HANDLER))
+    // Handlers queued while this run sends reports, e.g. the next chunk of a read, wait for the next run.
+    for (uint32_t numScheduledReports = mNumScheduledReports; numScheduledReports > 0; numScheduledReports--)
     {
-        if (readHandler->IsReportable())
+        if (mNumReportsInFlight >= CHIP_IM_MAX_REPORTS_IN_FLIGHT)
         {
-            CHIP_ERROR err = BuildAndSendSingleReportData(readHandler);
-            if (err != CHIP_NO_ERROR)
-            {
-                return;
-            }
+            break;
         }
-        numReadHandled++;
-        mCurReadHandlerIdx = (mCurReadHandlerIdx + 1) % CHIP_IM_MAX_NUM_READ_HANDLER;
-        readHandler        = imEngine->mReadHandlers + mCurReadHandlerIdx;
-    }
 
-    bool allReadClean = true;
-    for (auto & handler : InteractionModelEngine::GetInstance()->mReadHandlers)
-    {
-        UpdateReadHandlerDirty(handler);
-        if (handler.IsDirty())
+        ReadHandler * handler = PopScheduledReport();
+        if (handler == nullptr)
         {
-            allReadClean = false;
             break;
         }
+
+        // The handler may have been held again since it was queued, it is queued again when it becomes reportable.
+        if (!handler->IsReportable())
+        {
+            continue;
+        }
+
+        const System::Clock::Milliseconds64 latency = System::SystemClock().GetMonotonicTimestamp() - handler->mReportEligibleTime;
+        if (BuildAndSendSingleReportData(handler) != CHIP_NO_ERROR)
+        {
+            reportFailed = true;
+            break;
+        }
+
+        mMetrics.mNumReportsSent++;
+        mMetrics.mTotalReportLatency += latency;
+        if (latency > mMetrics.mMaxReportLatency)
+        {
+            mMetrics.mMaxReportLatency = latency;
+        }
+    }
+
+    if (reportFailed)
+    {
+        return;
     }
 
-    if (allReadClean)
+    if (mNumDirtyReadHandlers == 0)
     {
         InteractionModelEngine::GetInstance()->ReleaseClusterInfoList(mpGlobalDirtySet);
     }
@@ -495,24 +549,21 @@ void Engine::Run()
 
 CHIP_ERROR Engine::SetDirty(ClusterInfo & aClusterInfo)
 {
-    for (auto & handler : InteractionModelEngine::GetInstance()->mReadHandlers)
-    {
+    InteractionModelEngine::GetInstance()->mReadHandlers.ForEachActiveObject([this, &aClusterInfo](ReadHandler * handler) {
         // We call SetDirty for both read interactions and subscribe interactions, since we may sent inconsistent attribute data
         // between two chunks. SetDirty will be ignored automatically by read handlers which is waiting for response to last message
         // chunk for read interactions.
-        if (handler.IsGeneratingReports() || handler.IsAwaitingReportResponse())
+        if ((handler->IsGeneratingReports() || handler->IsAwaitingReportResponse()) &&
+            handler->GetAttributePathList().IntersectsAttributePath(aClusterInfo))
         {
-            for (auto clusterInfo = handler.GetAttributeClusterInfolist(); clusterInfo != nullptr;
-                 clusterInfo      = clusterInfo->mpNext)
+            if (handler->IsDirty())
             {
-                if (aClusterInfo.IsAttributePathSupersetOf(*clusterInfo) || clusterInfo->IsAttributePathSupersetOf(aClusterInfo))
-                {
-                    handler.SetDirty();
-                    break;
-                }
+                mMetrics.mNumCoalescedChanges++;
             }
+            handler->SetDirty();
         }
-    }
+        return Loop::Continue;
+    });
     if (!InteractionModelEngine::GetInstance()->MergeOverlappedAttributePath(mpGlobalDirtySet, aClusterInfo) &&
         InteractionModelEngine::GetInstance()->IsOverlappedAttributePath(aClusterInfo))
     {
@@ -521,32 +572,99 @@ CHIP_ERROR Engine::SetDirty(ClusterInfo & aClusterInfo)
     return CHIP_NO_ERROR;
 }
 
-void Engine::UpdateReadHandlerDirty(ReadHandler & aReadHandler)
+bool Engine::SetDirtyIfVersionChanged(ClusterInfo & aClusterInfo, DataVersion aVersion, DataVersion & aReportedVersion)
 {
-    if (!aReadHandler.IsDirty())
+    if (aVersion == aReportedVersion)
     {
-        return;
+        OnAttributeChangeSuppressed();
+        return false;
     }
-    if (!aReadHandler.IsSubscriptionType())
+
+    aReportedVersion = aVersion;
+    LogErrorOnFailure(SetDirty(aClusterInfo));
+    return true;
+}
+
+void Engine::ScheduleReport(ReadHandler & aReadHandler)
+{
+    VerifyOrReturn(!aReadHandler.mReportScheduled);
+
+    aReadHandler.mReportScheduled      = true;
+    aReadHandler.mReportEligibleTime   = System::SystemClock().GetMonotonicTimestamp();
+    aReadHandler.mpNextScheduledReport = nullptr;
+    if (mpScheduledReportsTail != nullptr)
     {
-        return;
+        mpScheduledReportsTail->mpNextScheduledReport = &aReadHandler;
     }
+    else
+    {
+        mpScheduledReportsHead = &aReadHandler;
+    }
+    mpScheduledReportsTail = &aReadHandler;
+    mNumScheduledReports++;
+    mMetrics.mNumReportsScheduled++;
+}
 
-    bool intersected = false;
-    for (auto clusterInfo = aReadHandler.GetAttributeClusterInfolist(); clusterInfo != nullptr; clusterInfo = clusterInfo->mpNext)
+void Engine::UnscheduleReport(ReadHandler & aReadHandler)
+{
+    VerifyOrReturn(aReadHandler.mReportScheduled);
+
+    ReadHandler * previous = nullptr;
+    for (ReadHandler * handler = mpScheduledReportsHead; handler != nullptr; handler = handler->mpNextScheduledReport)
     {
-        for (auto path = mpGlobalDirtySet; path != nullptr; path = path->mpNext)
+        if (handler != &aReadHandler)
         {
-            if (path->IsAttributePathSupersetOf(*clusterInfo) || clusterInfo->IsAttributePathSupersetOf(*path))
-            {
-                intersected = true;
-                break;
-            }
+            previous = handler;
+            continue;
+        }
+
+        if (previous != nullptr)
+        {
+            previous->mpNextScheduledReport = handler->mpNextScheduledReport;
+        }
+        else
+        {
+            mpScheduledReportsHead = handler->mpNextScheduledReport;
         }
+        if (mpScheduledReportsTail == handler)
+        {
+            mpScheduledReportsTail = previous;
+        }
+        mNumScheduledReports--;
+        break;
+    }
+
+    aReadHandler.mReportScheduled      = false;
+    aReadHandler.mpNextScheduledReport = nullptr;
+}
+
+ReadHandler * Engine::PopScheduledReport()
+{
+    ReadHandler * handler = mpScheduledReportsHead;
+    VerifyOrReturnError(handler != nullptr, nullptr);
+
+    mpScheduledReportsHead = handler->mpNextScheduledReport;
+    if (mpScheduledReportsHead == nullptr)
+    {
+        mpScheduledReportsTail = nullptr;
     }
-    if (!intersected)
+    mNumScheduledReports--;
+
+    handler->mReportScheduled      = false;
+    handler->mpNextScheduledReport = nullptr;
+    return handler;
+}
+
+void Engine::OnReadHandlerDirtyChanged(bool aDirty)
+{
+    if (aDirty)
     {
-        aReadHandler.ClearDirty();
+        mNumDirtyReadHandlers++;
+    }
+    else
+    {
+        VerifyOrDie(mNumDirtyReadHandlers > 0);
+        mNumDirtyReadHandlers--;
     }
 }
 
@@ -570,19 +688,19 @@ void Engine::OnReportConfirm()
 
 void Engine::GetMinEventLogPosition(uint32_t & aMinLogPosition)
 {
-    for (auto & handler : InteractionModelEngine::GetInstance()->mReadHandlers)
-    {
-        if (handler.IsFree() || handler.IsReadType())
+    InteractionModelEngine::GetInstance()->mReadHandlers.ForEachActiveObject([&aMinLogPosition](ReadHandler * handler) {
+        if (handler->IsReadType())
         {
-            continue;
+            return Loop::Continue;
         }
 
-        uint32_t initialWrittenEventsBytes = handler.GetLastWrittenEventsBytes();
+        uint32_t initialWrittenEventsBytes = handler->GetLastWrittenEventsBytes();
         if (initialWrittenEventsBytes < aMinLogPosition)
         {
             aMinLogPosition = initialWrittenEventsBytes;
         }
-    }
+        return Loop::Continue;
+    });
 }
 
 CHIP_ERROR Engine::ScheduleBufferPressureEventDelivery(uint32_t aBytesWritten)
@@ -600,24 +718,14 @@ CHIP_ERROR Engine::ScheduleBufferPressureEventDelivery(uint32_t aBytesWritten)
 
 CHIP_ERROR Engine::ScheduleUrgentEventDelivery(ConcreteEventPath & aPath)
 {
-    for (auto & handler : InteractionModelEngine::GetInstance()->mReadHandlers)
-    {
-        if (handler.IsFree() || handler.IsReadType())
+    InteractionModelEngine::GetInstance()->mReadHandlers.ForEachActiveObject([&aPath](ReadHandler * handler) {
+        if (handler->IsSubscriptionType() && handler->GetEventPathList().HasEventPathSupersetOf(aPath))
         {
-            continue;
+            ChipLogProgress(DataManagement, "<RE> Unblock Urgent Event Delivery for readHandler[%p]", handler);
+            handler->UnblockUrgentEventDelivery();
         }
-
-        for (auto clusterInfo = handler.GetEventClusterInfolist(); clusterInfo != nullptr; clusterInfo = clusterInfo->mpNext)
-        {
-            if (clusterInfo->IsEventPathSupersetOf(aPath))
-            {
-                ChipLogProgress(DataManagement, "<RE> Unblock Urgent Event Delivery for readHandler[%d]",
-                                InteractionModelEngine::GetInstance()->GetReadHandlerArrayIndex(&handler));
-                handler.UnblockUrgentEventDelivery();
-                break;
-            }
-        }
-    }
+        return Loop::Continue;
+    });
     return ScheduleRun();
 }
 
@@ -640,3 +748,21 @@ CHIP_ERROR Engine::ScheduleEventDelivery(ConcreteEventPath & aPath, EventOptions
 
 void __attribute__((weak)) MatterPreAttributeReadCallback(const chip::app::ConcreteAttributePath & attributePath) {}
 void __attribute__((weak)) MatterPostAttributeReadCallback(const chip::app::ConcreteAttributePath & attributePath) {}
+
+namespace chip {
+namespace app {
+
+// Default used when the ember-backed implementation in ember-compatibility-functions.cpp is not linked in (e.g. by unit tests
+// that provide their own ReadSingleClusterData): read the batch one path at a time.
+CHIP_ERROR __attribute__((weak))
+ReadClusterData(const Access::SubjectDescriptor & aSubjectDescriptor, const Span<const ConcreteReadAttributePath> & aPaths,
+                AttributeReportIBs::Builder & aAttributeReports, AttributeValueEncoder::AttributeEncodeState * apEncoderState,
+                size_t & aNumPathsRead)
+{
+    return ReadClusterPaths(aPaths, aAttributeReports, apEncoderState, aNumPathsRead, [&](const ConcreteReadAttributePath & path) {
+        return ReadSingleClusterData(aSubjectDescriptor, path, aAttributeReports, apEncoderState);
+    });
+}
+
+} // namespace app
+} // namespace chip
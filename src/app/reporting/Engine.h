@@ -34,6 +34,7 @@
 #include <messaging/ExchangeContext.h>
 #include <messaging/ExchangeMgr.h>
 #include <protocols/Protocols.h>
+#include <system/SystemClock.h>
 #include <system/SystemPacketBuffer.h>
 #include <system/TLVPacketBufferBackingStore.h>
 
@@ -53,6 +54,24 @@ namespace reporting {
 class Engine
 {
 public:
+    /**
+     * Counters describing how reports are scheduled, see GetMetrics().
+     */
+    struct Metrics
+    {
+        // Number of times a read handler was queued for its next report
+        uint32_t mNumReportsScheduled = 0;
+        // Number of report data messages sent from the queue
+        uint32_t mNumReportsSent = 0;
+        // Number of attribute changes folded into a report the handler was already dirty for
+        uint32_t mNumCoalescedChanges = 0;
+        // Number of attribute change notifications dropped because the value of the attribute did not change
+        uint32_t mNumSuppressedChanges = 0;
+        // Sum and maximum of the latencies of the reports sent
+        System::Clock::Milliseconds64 mTotalReportLatency = System::Clock::kZero;
+        System::Clock::Milliseconds64 mMaxReportLatency   = System::Clock::kZero;
+    };
+
     /**
      * Initializes the reporting engine. Should only be called once.
      *
@@ -89,6 +108,14 @@ public:
      */
     CHIP_ERROR SetDirty(ClusterInfo & aClusterInfo);
 
+    /**
+     * SetDirty for data versioned by the application: aClusterInfo is only marked dirty when aVersion differs from
+     * aReportedVersion, which is then updated to aVersion. Otherwise the change is counted as suppressed.
+     *
+     * @return whether aClusterInfo was marked dirty.
+     */
+    bool SetDirtyIfVersionChanged(ClusterInfo & aClusterInfo, DataVersion aVersion, DataVersion & aReportedVersion);
+
     /**
      * @brief
      *  Schedule the event delivery
@@ -96,8 +123,43 @@ public:
      */
     CHIP_ERROR ScheduleEventDelivery(ConcreteEventPath & aPath, EventOptions::Type aUrgent, uint32_t aBytesWritten);
 
+    /**
+     * Queue aReadHandler, which just became reportable, for the next run. Handlers already queued keep their position.
+     */
+    void ScheduleReport(ReadHandler & aReadHandler);
+
+    /**
+     * Remove aReadHandler from the queue of handlers waiting for a report, e.g. because it is shutting down.
+     */
+    void UnscheduleReport(ReadHandler & aReadHandler);
+
+    /**
+     * Should be invoked when a read handler becomes dirty or clean, so the global dirty set can be released once no
+     * handler needs it anymore.
+     */
+    void OnReadHandlerDirtyChanged(bool aDirty);
+
+    /**
+     * Should be invoked instead of SetDirty when an attribute was written with the value it already had, so the
+     * notification is only counted in the metrics.
+     */
+    void OnAttributeChangeSuppressed() { mMetrics.mNumSuppressedChanges++; }
+
+    /**
+     * Report scheduling metrics. The latency of a report is the time between its handler becoming reportable, i.e. dirty
+     * and past its min interval or at its max interval, and the run sending it.
+     */
+    const Metrics & GetMetrics() const { return mMetrics; }
+    void ResetMetrics() { mMetrics = Metrics(); }
+
 private:
     friend class TestReportingEngine;
+
+    /**
+     * The maximum number of attribute paths of one cluster that are read through a single ReadClusterData call.
+     */
+    static constexpr size_t kMaxClusterReadBatchSize = 8;
+
     /**
      * Build Single Report Data including attribute changes and event data stream, and send out
      *
@@ -110,15 +172,27 @@ private:
                                                  bool * apHasMoreChunks, bool * apHasEncodedData);
     CHIP_ERROR RetrieveClusterData(const Access::SubjectDescriptor & aSubjectDescriptor,
                                    AttributeReportIBs::Builder & aAttributeReportIBs,
-                                   const ConcreteReadAttributePath & aClusterInfo,
-                                   AttributeValueEncoder::AttributeEncodeState * apEncoderState);
+                                   const Span<const ConcreteReadAttributePath> & aPaths,
+                                   AttributeValueEncoder::AttributeEncodeState * apEncoderState, size_t & aNumPathsRead);
 
     /**
-     * Check all active subscription, if the subscription has no paths that intersect with global dirty set,
-     * it would clear dirty flag for that subscription
-     *
+     * Returns whether aPath needs to be included in the next report generated for apReadHandler, i.e. whether the
+     * handler is priming or the path intersects the global dirty set.
      */
-    void UpdateReadHandlerDirty(ReadHandler & aReadHandler);
+    bool IsReportablePath(ReadHandler * apReadHandler, const ConcreteAttributePath & aPath) const;
+
+    /**
+     * Collect the next run of reportable paths that share an endpoint and cluster, starting at aIterator, into aPaths.
+     * aIterator is left pointing at the first path that was not collected. Returns the number of paths collected.
+     */
+    size_t CollectClusterReadBatch(ReadHandler * apReadHandler, AttributePathExpandIterator & aIterator,
+                                   ConcreteReadAttributePath * aPaths, size_t aMaxPaths) const;
+
+    /**
+     * Remove and return the handler at the head of the report queue, or nullptr if the queue is empty.
+     */
+    ReadHandler * PopScheduledReport();
+
     /**
      * Send Report via ReadHandler
      *
@@ -149,16 +223,29 @@ private:
     uint32_t mNumReportsInFlight = 0;
 
     /**
-     *  Current read handler index
+     *  Read handlers waiting for a report, chained through their mpNextScheduledReport field and ordered by the time they
+     *  became reportable. That time is read from the monotonic clock when a handler is queued, so appending keeps the
+     *  queue ordered, while the min / max interval timers of each subscription decide when it is queued. A run only visits
+     *  the handlers in this queue instead of every active read handler.
      *
      */
-    uint32_t mCurReadHandlerIdx = 0;
+    ReadHandler * mpScheduledReportsHead = nullptr;
+    ReadHandler * mpScheduledReportsTail = nullptr;
+    uint32_t mNumScheduledReports        = 0;
+
+    /**
+     *  The number of read handlers currently dirty, the global dirty set is released when it drops to zero.
+     *
+     */
+    uint32_t mNumDirtyReadHandlers = 0;
+
+    Metrics mMetrics;
 
     /**
      *  mpGlobalDirtySet is used to track the dirty cluster info application modified for attributes during
      *  post-subscription via SetDirty API, and further form the report. This reporting engine acquires this global dirty
-     *  set from mClusterInfoPool managed by InteractionModelEngine, where all active read handlers also acquire the interested
-     *  cluster Info list from mClusterInfoPool.
+     *  set from mClusterInfoPool managed by InteractionModelEngine, which only backs this set: each read handler keeps the
+     *  paths it is interested in in its own ClusterInfoList.
      *
      */
     ClusterInfo * mpGlobalDirtySet = nullptr;
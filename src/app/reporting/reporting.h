@@ -61,3 +61,16 @@ void MatterReportingAttributeChangeCallback(chip::EndpointId endpoint, chip::Clu
  * Same but with a nicer attribute path.
  */
 void MatterReportingAttributeChangeCallback(const chip::app::ConcreteAttributePath & aPath);
+
+/*
+ * Same for an attribute whose data is versioned by its AttributeAccessInterface: the path is only marked dirty when
+ * aVersion differs from aReportedVersion, which is then updated to aVersion.
+ */
+void MatterReportingAttributeChangeCallback(const chip::app::ConcreteAttributePath & aPath, chip::DataVersion aVersion,
+                                            chip::DataVersion & aReportedVersion);
+
+/*
+ * Called instead of MatterReportingAttributeChangeCallback when a write left the value of the attribute unchanged. The path
+ * is not marked dirty, the notification is only counted as suppressed.
+ */
+void MatterReportingAttributeUnchangedCallback(const chip::app::ConcreteAttributePath & aPath);
@@ -29,7 +29,9 @@
 #include <app/tests/AppTestContext.h>
 #include <lib/support/UnitTestRegistration.h>
 #include <nlunit-test.h>
+#include <set>
 #include <string.h>
+#include <tuple>
 #include <vector>
 
 using TestContext = chip::Test::AppContext;
@@ -527,12 +529,170 @@ void TestCache(nlTestSuite * apSuite, void * apContext)
                              AttributeInstruction(AttributeInstruction::kAttributeB, 0, AttributeInstruction::kData),
                              AttributeInstruction(AttributeInstruction::kAttributeA, 0, AttributeInstruction::kData),
                              AttributeInstruction(AttributeInstruction::kAttributeB, 0, AttributeInstruction::kData) });
+
+    //
+    // Validate that values of differing sizes replacing each other (both in place and out of place) across
+    // interleaved endpoints leave the cache consistent.
+    //
+    ChipLogProgress(DataManagement, "E1:D1 E0:A2 E1:A3s E1:C4 E0:D5 E1:D6s E1:D7 --> E0:A2 E0:D5 E1:A3s E1:C4 E1:D7");
+    RunAndValidateSequence({ AttributeInstruction(AttributeInstruction::kAttributeD, 1, AttributeInstruction::kData),
+                             AttributeInstruction(AttributeInstruction::kAttributeA, 0, AttributeInstruction::kData),
+                             AttributeInstruction(AttributeInstruction::kAttributeA, 1, AttributeInstruction::kStatus),
+                             AttributeInstruction(AttributeInstruction::kAttributeC, 1, AttributeInstruction::kData),
+                             AttributeInstruction(AttributeInstruction::kAttributeD, 0, AttributeInstruction::kData),
+                             AttributeInstruction(AttributeInstruction::kAttributeD, 1, AttributeInstruction::kStatus),
+                             AttributeInstruction(AttributeInstruction::kAttributeD, 1, AttributeInstruction::kData) });
+}
+
+class NullCallback : public AttributeCache::Callback
+{
+    void OnDone(ReadClient * apReadClient) override {}
+};
+
+void DeliverInt16uValue(ReadClient::Callback & callback, const ConcreteDataAttributePath & path, uint16_t value)
+{
+    uint8_t buf[16];
+    TLV::TLVWriter writer;
+    TLV::TLVReader reader;
+
+    writer.Init(buf);
+    NL_TEST_ASSERT(gSuite, DataModel::Encode(writer, TLV::AnonymousTag, value) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(gSuite, writer.Finalize() == CHIP_NO_ERROR);
+
+    reader.Init(buf, writer.GetLengthWritten());
+    NL_TEST_ASSERT(gSuite, reader.Next() == CHIP_NO_ERROR);
+    callback.OnAttributeData(nullptr, path, &reader, StatusIB());
+}
+
+/*
+ * This validates that cluster data versions conveyed alongside attribute data are only committed
+ * once the report that carried them completes.
+ */
+void TestDataVersion(nlTestSuite * apSuite, void * apContext)
+{
+    NullCallback callback;
+    AttributeCache cache(callback);
+    ReadClient::Callback & readCallback = cache.GetBufferedCallback();
+    Optional<DataVersion> version;
+
+    ConcreteDataAttributePath path(1, Clusters::TestCluster::Id, Clusters::TestCluster::Attributes::Int16u::Id);
+
+    NL_TEST_ASSERT(apSuite, cache.GetVersion(1, Clusters::TestCluster::Id, version) == CHIP_ERROR_KEY_NOT_FOUND);
+
+    path.mDataVersion.SetValue(7);
+    readCallback.OnReportBegin(nullptr);
+    DeliverInt16uValue(readCallback, path, 1);
+
+    NL_TEST_ASSERT(apSuite, cache.GetVersion(1, Clusters::TestCluster::Id, version) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(apSuite, !version.HasValue());
+
+    readCallback.OnReportEnd(nullptr);
+
+    NL_TEST_ASSERT(apSuite, cache.GetVersion(1, Clusters::TestCluster::Id, version) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(apSuite, version.HasValue() && version.Value() == 7);
+
+    //
+    // A report that never completes shouldn't have its version committed.
+    //
+    path.mDataVersion.SetValue(8);
+    readCallback.OnReportBegin(nullptr);
+    DeliverInt16uValue(readCallback, path, 2);
+
+    readCallback.OnReportBegin(nullptr);
+    readCallback.OnReportEnd(nullptr);
+
+    NL_TEST_ASSERT(apSuite, cache.GetVersion(1, Clusters::TestCluster::Id, version) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(apSuite, version.HasValue() && version.Value() == 7);
+
+    path.mDataVersion.SetValue(9);
+    readCallback.OnReportBegin(nullptr);
+    DeliverInt16uValue(readCallback, path, 3);
+    readCallback.OnReportEnd(nullptr);
+
+    NL_TEST_ASSERT(apSuite, cache.GetVersion(1, Clusters::TestCluster::Id, version) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(apSuite, version.HasValue() && version.Value() == 9);
+}
+
+bool EncodesDataVersionFilter(ReadClient::Callback & callback, AttributePathParams path)
+{
+    uint8_t buf[128];
+    TLV::TLVWriter writer;
+    DataVersionFilterIBs::Builder builder;
+    bool encoded = false;
+
+    writer.Init(buf);
+    NL_TEST_ASSERT(gSuite, builder.Init(&writer) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(gSuite,
+                   callback.OnUpdateDataVersionFilterList(builder, Span<AttributePathParams>(&path, 1), encoded) == CHIP_NO_ERROR);
+    return encoded;
+}
+
+/*
+ * This validates that a data version filter is only sent for a cluster once the cache holds all of its attributes,
+ * so that a wildcard read following the read of a single attribute still pulls down the rest of the cluster.
+ */
+void TestDataVersionFilterCompleteness(nlTestSuite * apSuite, void * apContext)
+{
+    NullCallback callback;
+    AttributeCache cache(callback);
+    ReadClient::Callback & readCallback = cache.GetBufferedCallback();
+    TLV::TLVReader reader;
+
+    ConcreteDataAttributePath int16uPath(1, Clusters::TestCluster::Id, Clusters::TestCluster::Attributes::Int16u::Id);
+    ConcreteDataAttributePath int8uPath(1, Clusters::TestCluster::Id, Clusters::TestCluster::Attributes::Int8u::Id);
+    AttributePathParams int16uAttribute(int16uPath.mEndpointId, int16uPath.mClusterId, int16uPath.mAttributeId);
+    AttributePathParams clusterWildcard(int16uPath.mEndpointId, int16uPath.mClusterId);
+
+    int16uPath.mDataVersion.SetValue(5);
+    int8uPath.mDataVersion.SetValue(5);
+
+    //
+    // Read a single attribute.
+    //
+    NL_TEST_ASSERT(apSuite, !EncodesDataVersionFilter(readCallback, int16uAttribute));
+    readCallback.OnReportBegin(nullptr);
+    DeliverInt16uValue(readCallback, int16uPath, 1);
+    readCallback.OnReportEnd(nullptr);
+    readCallback.OnDone(nullptr);
+
+    //
+    // A wildcard read of the cluster must not filter it out, since the cache only holds one of its attributes.
+    //
+    NL_TEST_ASSERT(apSuite, !EncodesDataVersionFilter(readCallback, clusterWildcard));
+    readCallback.OnReportBegin(nullptr);
+    DeliverInt16uValue(readCallback, int16uPath, 1);
+    DeliverInt16uValue(readCallback, int8uPath, 2);
+    readCallback.OnReportEnd(nullptr);
+    readCallback.OnDone(nullptr);
+
+    NL_TEST_ASSERT(apSuite, cache.Get(int16uPath, reader) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(apSuite, cache.Get(int8uPath, reader) == CHIP_NO_ERROR);
+
+    //
+    // Now that the cluster is complete, later reads of it can be filtered.
+    //
+    NL_TEST_ASSERT(apSuite, EncodesDataVersionFilter(readCallback, clusterWildcard));
+    readCallback.OnDone(nullptr);
+
+    //
+    // A single attribute arriving at a newer version leaves the others behind, so the cluster is incomplete again.
+    //
+    int16uPath.mDataVersion.SetValue(6);
+    NL_TEST_ASSERT(apSuite, EncodesDataVersionFilter(readCallback, int16uAttribute));
+    readCallback.OnReportBegin(nullptr);
+    DeliverInt16uValue(readCallback, int16uPath, 3);
+    readCallback.OnReportEnd(nullptr);
+    readCallback.OnDone(nullptr);
+
+    NL_TEST_ASSERT(apSuite, !EncodesDataVersionFilter(readCallback, clusterWildcard));
 }
 
 // clang-format off
 const nlTest sTests[] =
 {
     NL_TEST_DEF("TestCache", TestCache),
+    NL_TEST_DEF("TestDataVersion", TestDataVersion),
+    NL_TEST_DEF("TestDataVersionFilterCompleteness", TestDataVersionFilterCompleteness),
     NL_TEST_SENTINEL()
 };
 
@@ -0,0 +1,134 @@
+/*
+ *
+ *    Copyright (c) 2021 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This file implements unit tests for the comparison of attribute values written to the ember attribute store with
+ *      the values it already holds, which decides whether a write is reported.
+ */
+
+#include <app/util/attribute-value-compare.h>
+#include <lib/support/UnitTestRegistration.h>
+
+#include <nlunit-test.h>
+
+using namespace chip;
+using namespace chip::app;
+
+namespace {
+
+void TestScalar(nlTestSuite * inSuite, void * inContext)
+{
+    constexpr uint8_t kType  = ZCL_INT16U_ATTRIBUTE_TYPE;
+    constexpr uint16_t kSize = 2;
+    const uint8_t stored[]   = { 0x34, 0x12 };
+    const uint8_t same[]     = { 0x34, 0x12 };
+    const uint8_t other[]    = { 0x35, 0x12 };
+
+    NL_TEST_ASSERT(inSuite, IsStoredAttributeValueUnchanged(kType, kSize, stored, same));
+    NL_TEST_ASSERT(inSuite, !IsStoredAttributeValueUnchanged(kType, kSize, stored, other));
+    NL_TEST_ASSERT(inSuite, !IsStoredAttributeValueUnchanged(kType, kSize, stored, nullptr));
+}
+
+void TestString(nlTestSuite * inSuite, void * inContext)
+{
+    // Room for 3 characters after the length byte
+    constexpr uint8_t kType   = ZCL_CHAR_STRING_ATTRIBUTE_TYPE;
+    constexpr uint16_t kSize  = 4;
+    const uint8_t stored[]    = { 3, 'a', 'b', 'c' };
+    const uint8_t same[]      = { 3, 'a', 'b', 'c' };
+    const uint8_t shorter[]   = { 2, 'a', 'b' };
+    const uint8_t different[] = { 3, 'a', 'b', 'd' };
+    // Stored truncated to its first 3 characters, which are the stored ones
+    const uint8_t truncatedSame[]      = { 5, 'a', 'b', 'c', 'd', 'e' };
+    const uint8_t truncatedDifferent[] = { 5, 'a', 'b', 'x', 'd', 'e' };
+    const uint8_t null[]               = { 0xFF };
+    const uint8_t empty[]              = { 0 };
+
+    NL_TEST_ASSERT(inSuite, IsStoredAttributeValueUnchanged(kType, kSize, stored, same));
+    NL_TEST_ASSERT(inSuite, !IsStoredAttributeValueUnchanged(kType, kSize, stored, shorter));
+    NL_TEST_ASSERT(inSuite, !IsStoredAttributeValueUnchanged(kType, kSize, stored, different));
+    NL_TEST_ASSERT(inSuite, IsStoredAttributeValueUnchanged(kType, kSize, stored, truncatedSame));
+    NL_TEST_ASSERT(inSuite, !IsStoredAttributeValueUnchanged(kType, kSize, stored, truncatedDifferent));
+    NL_TEST_ASSERT(inSuite, !IsStoredAttributeValueUnchanged(kType, kSize, stored, null));
+
+    // Null and empty strings are different values
+    NL_TEST_ASSERT(inSuite, IsStoredAttributeValueUnchanged(kType, kSize, null, null));
+    NL_TEST_ASSERT(inSuite, !IsStoredAttributeValueUnchanged(kType, kSize, null, empty));
+    NL_TEST_ASSERT(inSuite, !IsStoredAttributeValueUnchanged(kType, kSize, empty, null));
+}
+
+void TestLongString(nlTestSuite * inSuite, void * inContext)
+{
+    // Room for 2 octets after the length bytes
+    constexpr uint8_t kType            = ZCL_LONG_OCTET_STRING_ATTRIBUTE_TYPE;
+    constexpr uint16_t kSize           = 4;
+    const uint8_t stored[]             = { 2, 0, 0x01, 0x02 };
+    const uint8_t same[]               = { 2, 0, 0x01, 0x02 };
+    const uint8_t truncatedSame[]      = { 3, 0, 0x01, 0x02, 0x03 };
+    const uint8_t truncatedDifferent[] = { 3, 0, 0x01, 0x04, 0x03 };
+    const uint8_t null[]               = { 0xFF, 0xFF };
+
+    NL_TEST_ASSERT(inSuite, IsStoredAttributeValueUnchanged(kType, kSize, stored, same));
+    NL_TEST_ASSERT(inSuite, IsStoredAttributeValueUnchanged(kType, kSize, stored, truncatedSame));
+    NL_TEST_ASSERT(inSuite, !IsStoredAttributeValueUnchanged(kType, kSize, stored, truncatedDifferent));
+    NL_TEST_ASSERT(inSuite, !IsStoredAttributeValueUnchanged(kType, kSize, stored, null));
+    NL_TEST_ASSERT(inSuite, IsStoredAttributeValueUnchanged(kType, kSize, null, null));
+}
+
+void TestNotStoredByEmber(nlTestSuite * inSuite, void * inContext)
+{
+    const uint8_t value[] = { 0x34, 0x12 };
+
+    // External attributes have no storage location in ember and report their own changes
+    NL_TEST_ASSERT(inSuite, !IsStoredAttributeValueUnchanged(ZCL_INT16U_ATTRIBUTE_TYPE, 2, nullptr, value));
+
+    // Only the length of a list is stored
+    NL_TEST_ASSERT(inSuite, !IsStoredAttributeValueUnchanged(ZCL_ARRAY_ATTRIBUTE_TYPE, 2, value, value));
+}
+
+// clang-format off
+const nlTest sTests[] =
+{
+    NL_TEST_DEF("TestScalar", TestScalar),
+    NL_TEST_DEF("TestString", TestString),
+    NL_TEST_DEF("TestLongString", TestLongString),
+    NL_TEST_DEF("TestNotStoredByEmber", TestNotStoredByEmber),
+    NL_TEST_SENTINEL()
+};
+// clang-format on
+
+// clang-format off
+nlTestSuite theSuite =
+{
+    "TestAttributeValueCompare",
+    &sTests[0],
+    nullptr,
+    nullptr
+};
+// clang-format on
+
+} // namespace
+
+int TestAttributeValueCompare()
+{
+    nlTestRunner(&theSuite, nullptr);
+    return (nlTestRunnerStats(&theSuite));
+}
+
+CHIP_REGISTER_TEST_SUITE(TestAttributeValueCompare)
@@ -29,6 +29,8 @@
 #include <lib/support/UnitTestRegistration.h>
 #include <nlunit-test.h>
 
+#include <string.h>
+
 using namespace chip;
 using namespace chip::app;
 using namespace chip::TLV;
@@ -385,6 +387,154 @@ void TestEncodeListChunking(nlTestSuite * aSuite, void * aContext)
 }
 
 #undef VERIFY_BUFFER_STATE
+void TestEncodeResumableListChunking(nlTestSuite * aSuite, void * aContext)
+{
+    AttributeValueEncoder::AttributeEncodeState state;
+    AttributeValueEncoder::AttributeEncodeState resumableState;
+
+    AttributeValueEncoder::ListCursor lastStart = 0;
+
+    bool list[]      = { true, false };
+    auto listEncoder = [&list](const auto & encoder) -> CHIP_ERROR {
+        for (auto & item : list)
+        {
+            ReturnErrorOnFailure(encoder.Encode(item));
+        }
+        return CHIP_NO_ERROR;
+    };
+    auto resumableListEncoder = [&list, &lastStart](AttributeValueEncoder::ListCursor aStart, const auto & encoder) -> CHIP_ERROR {
+        lastStart = aStart;
+        for (size_t i = static_cast<size_t>(aStart); i < ArraySize(list); i++)
+        {
+            ReturnErrorOnFailure(encoder.Encode(list[i], i + 1));
+        }
+        return CHIP_NO_ERROR;
+    };
+
+    // Both encoders must produce the same chunks, the resumable one without generating the first item again.
+    {
+        LimitedTestSetup<60> test1(aSuite);
+        LimitedTestSetup<60> resumableTest1(aSuite);
+        CHIP_ERROR err = test1.encoder.EncodeList(listEncoder);
+        NL_TEST_ASSERT(aSuite, err == CHIP_ERROR_NO_MEMORY || err == CHIP_ERROR_BUFFER_TOO_SMALL);
+        err = resumableTest1.encoder.EncodeResumableList(resumableListEncoder);
+        NL_TEST_ASSERT(aSuite, err == CHIP_ERROR_NO_MEMORY || err == CHIP_ERROR_BUFFER_TOO_SMALL);
+        NL_TEST_ASSERT(aSuite, lastStart == 0);
+        NL_TEST_ASSERT(aSuite, resumableTest1.encoder.GetState().AllowPartialData());
+
+        NL_TEST_ASSERT(aSuite, test1.writer.GetLengthWritten() == resumableTest1.writer.GetLengthWritten());
+        NL_TEST_ASSERT(aSuite, memcmp(test1.buf, resumableTest1.buf, test1.writer.GetLengthWritten()) == 0);
+        state          = test1.encoder.GetState();
+        resumableState = resumableTest1.encoder.GetState();
+    }
+    {
+        LimitedTestSetup<60> test2(aSuite, 0, state);
+        LimitedTestSetup<60> resumableTest2(aSuite, 0, resumableState);
+        NL_TEST_ASSERT(aSuite, test2.encoder.EncodeList(listEncoder) == CHIP_NO_ERROR);
+        NL_TEST_ASSERT(aSuite, resumableTest2.encoder.EncodeResumableList(resumableListEncoder) == CHIP_NO_ERROR);
+        NL_TEST_ASSERT(aSuite, lastStart == 1);
+
+        NL_TEST_ASSERT(aSuite, test2.writer.GetLengthWritten() == resumableTest2.writer.GetLengthWritten());
+        NL_TEST_ASSERT(aSuite, memcmp(test2.buf, resumableTest2.buf, test2.writer.GetLengthWritten()) == 0);
+    }
+}
+
+void TestEncodeResumableFabricScoped(nlTestSuite * aSuite, void * aContext)
+{
+    Clusters::AccessControl::Structs::ExtensionEntry::Type items[3];
+    items[0].fabricIndex = 0;
+    items[1].fabricIndex = 1;
+    items[2].fabricIndex = 2;
+
+    // The items of other fabrics are skipped as they are with EncodeList.
+    TestSetup test(aSuite, kTestFabricIndex);
+    CHIP_ERROR err = test.encoder.EncodeList([items](const auto & encoder) -> CHIP_ERROR {
+        for (auto & item : items)
+        {
+            ReturnErrorOnFailure(encoder.Encode(item));
+        }
+        return CHIP_NO_ERROR;
+    });
+    NL_TEST_ASSERT(aSuite, err == CHIP_NO_ERROR);
+
+    TestSetup resumableTest(aSuite, kTestFabricIndex);
+    err = resumableTest.encoder.EncodeResumableList(
+        [items](AttributeValueEncoder::ListCursor aStart, const auto & encoder) -> CHIP_ERROR {
+            for (size_t i = static_cast<size_t>(aStart); i < ArraySize(items); i++)
+            {
+                ReturnErrorOnFailure(encoder.Encode(items[i], i + 1));
+            }
+            return CHIP_NO_ERROR;
+        });
+    NL_TEST_ASSERT(aSuite, err == CHIP_NO_ERROR);
+
+    NL_TEST_ASSERT(aSuite, test.writer.GetLengthWritten() == resumableTest.writer.GetLengthWritten());
+    NL_TEST_ASSERT(aSuite, memcmp(test.buf, resumableTest.buf, test.writer.GetLengthWritten()) == 0);
+}
+
+struct LargeListStats
+{
+    size_t chunks         = 0;
+    size_t generatedItems = 0;
+};
+
+/**
+ * Encode a list of aItemCount integers in chunks of 1 kB, the way a report spanning several messages does, and count how many
+ * items the list generator had to produce.
+ */
+LargeListStats EncodeLargeList(nlTestSuite * aSuite, uint32_t aItemCount, bool aResumable)
+{
+    AttributeValueEncoder::AttributeEncodeState state;
+    LargeListStats stats;
+    CHIP_ERROR err = CHIP_ERROR_NO_MEMORY;
+
+    while ((err == CHIP_ERROR_NO_MEMORY || err == CHIP_ERROR_BUFFER_TOO_SMALL) && stats.chunks <= aItemCount)
+    {
+        LimitedTestSetup<1024> test(aSuite, 0, state);
+        if (aResumable)
+        {
+            err = test.encoder.EncodeResumableList(
+                [aItemCount, &stats](AttributeValueEncoder::ListCursor aStart, const auto & encoder) -> CHIP_ERROR {
+                    for (uint32_t i = static_cast<uint32_t>(aStart); i < aItemCount; i++)
+                    {
+                        stats.generatedItems++;
+                        ReturnErrorOnFailure(encoder.Encode(i, i + 1u));
+                    }
+                    return CHIP_NO_ERROR;
+                });
+        }
+        else
+        {
+            err = test.encoder.EncodeList([aItemCount, &stats](const auto & encoder) -> CHIP_ERROR {
+                for (uint32_t i = 0; i < aItemCount; i++)
+                {
+                    stats.generatedItems++;
+                    ReturnErrorOnFailure(encoder.Encode(i));
+                }
+                return CHIP_NO_ERROR;
+            });
+        }
+        state = test.encoder.GetState();
+        stats.chunks++;
+    }
+
+    NL_TEST_ASSERT(aSuite, err == CHIP_NO_ERROR);
+    return stats;
+}
+
+void TestEncodeLargeListChunking(nlTestSuite * aSuite, void * aContext)
+{
+    for (uint32_t itemCount : { 1000u, 10000u })
+    {
+        LargeListStats stats          = EncodeLargeList(aSuite, itemCount, false);
+        LargeListStats resumableStats = EncodeLargeList(aSuite, itemCount, true);
+
+        // Every chunk but the last stops at an item that does not fit, and the resumable list only generates that item again.
+        NL_TEST_ASSERT(aSuite, resumableStats.chunks == stats.chunks);
+        NL_TEST_ASSERT(aSuite, resumableStats.generatedItems == itemCount + resumableStats.chunks - 1);
+        NL_TEST_ASSERT(aSuite, stats.generatedItems > resumableStats.generatedItems * (stats.chunks / 4));
+    }
+}
 
 } // anonymous namespace
 
@@ -397,6 +547,9 @@ const nlTest sTests[] = { NL_TEST_DEF("TestEncodeNothing", TestEncodeNothing),
                           NL_TEST_DEF("TestEncodeListOfBools2", TestEncodeListOfBools2),
                           NL_TEST_DEF("TestEncodeListChunking", TestEncodeListChunking),
                           NL_TEST_DEF("TestEncodeFabricScoped", TestEncodeFabricScoped),
+                          NL_TEST_DEF("TestEncodeResumableListChunking", TestEncodeResumableListChunking),
+                          NL_TEST_DEF("TestEncodeResumableFabricScoped", TestEncodeResumableFabricScoped),
+                          NL_TEST_DEF("TestEncodeLargeListChunking", TestEncodeLargeListChunking),
                           NL_TEST_SENTINEL() };
 }
 
@@ -599,10 +599,72 @@ void TestBufferedSequences(nlTestSuite * apSuite, void * apContext)
     });
 }
 
+class StreamingValidator : public BufferedReadCallback::Callback
+{
+public:
+    void OnAttributeData(const ReadClient * apReadClient, const ConcreteDataAttributePath & aPath, TLV::TLVReader * apData,
+                         const StatusIB & aStatus) override
+    {
+        NL_TEST_ASSERT(gSuite,
+                       aPath.mEndpointId == 0 && aPath.mClusterId == Clusters::TestCluster::Id &&
+                           aPath.mAttributeId == Clusters::TestCluster::Attributes::ListInt8u::Id);
+
+        if (aPath.mListOp == ConcreteDataAttributePath::ListOperation::ReplaceAll)
+        {
+            Clusters::TestCluster::Attributes::ListInt8u::TypeInfo::DecodableType value;
+            size_t len;
+
+            NL_TEST_ASSERT(gSuite, DataModel::Decode(*apData, value) == CHIP_NO_ERROR);
+            NL_TEST_ASSERT(gSuite, value.ComputeSize(&len) == CHIP_NO_ERROR);
+            NL_TEST_ASSERT(gSuite, len == 0);
+
+            mListStarts++;
+            mNextItem = 0;
+        }
+        else
+        {
+            uint8_t item;
+
+            NL_TEST_ASSERT(gSuite, aPath.mListOp == ConcreteDataAttributePath::ListOperation::AppendItem);
+            NL_TEST_ASSERT(gSuite, DataModel::Decode(*apData, item) == CHIP_NO_ERROR);
+            NL_TEST_ASSERT(gSuite, item == mNextItem);
+
+            mNextItem++;
+            mItems++;
+        }
+    }
+
+    void OnDone(ReadClient * apClient) override {}
+
+    uint32_t mListStarts = 0;
+    uint32_t mItems      = 0;
+    uint8_t mNextItem    = 0;
+};
+
+/*
+ * This validates that in streaming mode, lists are delivered item-by-item as they arrive
+ * regardless of how they were chunked.
+ */
+void TestStreamedSequences(nlTestSuite * apSuite, void * apContext)
+{
+    ChipLogProgress(DataManagement, "D[2] D[] D0..D512 --> D[] D0 D1 D[] D0..D512");
+
+    std::vector<ValidationInstruction> instructionList = { { ValidationInstruction::kListAttributeD_NotEmpty },
+                                                           { ValidationInstruction::kListAttributeD_NotEmpty_Chunked } };
+    StreamingValidator validator;
+    BufferedReadCallback bufferedCallback(validator, BufferedReadCallback::ListDeliveryMode::kStreaming);
+    DataSeriesGenerator generator(bufferedCallback, instructionList);
+    generator.Generate();
+
+    NL_TEST_ASSERT(apSuite, validator.mListStarts == 2);
+    NL_TEST_ASSERT(apSuite, validator.mItems == 2 + 512);
+}
+
 // clang-format off
 const nlTest sTests[] =
 {
     NL_TEST_DEF("TestBufferedSequences", TestBufferedSequences),
+    NL_TEST_DEF("TestStreamedSequences", TestStreamedSequences),
     NL_TEST_SENTINEL()
 };
 
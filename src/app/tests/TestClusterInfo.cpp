@@ -23,7 +23,9 @@
  */
 
 #include <app/ClusterInfo.h>
+#include <app/ClusterInfoList.h>
 #include <app/util/mock/Constants.h>
+#include <lib/support/CHIPMem.h>
 #include <lib/support/UnitTestRegistration.h>
 #include <nlunit-test.h>
 
@@ -163,6 +165,96 @@ void TestEventPathDifferentEndpointId(nlTestSuite * apSuite, void * apContext)
     NL_TEST_ASSERT(apSuite, !validEventpaths[5].IsEventPathSupersetOf(testPath));
 }
 
+ClusterInfo MakeAttributePath(EndpointId aEndpointId, ClusterId aClusterId, AttributeId aAttributeId)
+{
+    ClusterInfo path;
+    path.mEndpointId  = aEndpointId;
+    path.mClusterId   = aClusterId;
+    path.mAttributeId = aAttributeId;
+    return path;
+}
+
+void TestClusterInfoListSorted(nlTestSuite * apSuite, void * apContext)
+{
+    ClusterInfoList list;
+    NL_TEST_ASSERT(apSuite, list.IsEmpty() && list.Head() == nullptr);
+
+    // More paths than the initial capacity, in no particular order
+    for (uint16_t i = 0; i < 10; i++)
+    {
+        const uint16_t id = static_cast<uint16_t>((i * 7) % 10);
+        NL_TEST_ASSERT(apSuite,
+                       list.Insert(MakeAttributePath(static_cast<EndpointId>(id % 3), MockClusterId(id), MockAttributeId(id))) ==
+                           CHIP_NO_ERROR);
+    }
+    NL_TEST_ASSERT(apSuite,
+                   list.Insert(MakeAttributePath(kInvalidEndpointId, MockClusterId(1), kInvalidAttributeId)) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(apSuite, list.Insert(MakeAttributePath(1, kInvalidClusterId, kInvalidAttributeId)) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(apSuite, list.Size() == 12);
+
+    // Entries are sorted and chained in the same order
+    const ClusterInfo * previous = nullptr;
+    for (const auto & path : list)
+    {
+        if (previous != nullptr)
+        {
+            NL_TEST_ASSERT(apSuite, previous->mpNext == &path);
+            NL_TEST_ASSERT(apSuite,
+                           previous->mEndpointId < path.mEndpointId ||
+                               (previous->mEndpointId == path.mEndpointId && previous->mClusterId <= path.mClusterId));
+        }
+        previous = &path;
+    }
+    NL_TEST_ASSERT(apSuite, list.Head() == list.begin());
+    NL_TEST_ASSERT(apSuite, previous != nullptr && previous->mpNext == nullptr && previous->HasWildcardEndpointId());
+
+    list.Release();
+    NL_TEST_ASSERT(apSuite, list.IsEmpty() && list.Head() == nullptr);
+}
+
+void TestClusterInfoListIntersectsAttributePath(nlTestSuite * apSuite, void * apContext)
+{
+    ClusterInfoList list;
+    NL_TEST_ASSERT(apSuite, !list.IntersectsAttributePath(ClusterInfo()));
+
+    NL_TEST_ASSERT(apSuite, list.Insert(MakeAttributePath(kMockEndpoint1, MockClusterId(1), MockAttributeId(1))) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(apSuite,
+                   list.Insert(MakeAttributePath(kMockEndpoint2, kInvalidClusterId, kInvalidAttributeId)) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(apSuite,
+                   list.Insert(MakeAttributePath(kInvalidEndpointId, MockClusterId(2), MockAttributeId(3))) == CHIP_NO_ERROR);
+
+    // Concrete paths
+    NL_TEST_ASSERT(apSuite, list.IntersectsAttributePath(MakeAttributePath(kMockEndpoint1, MockClusterId(1), MockAttributeId(1))));
+    NL_TEST_ASSERT(apSuite, !list.IntersectsAttributePath(MakeAttributePath(kMockEndpoint1, MockClusterId(1), MockAttributeId(2))));
+    NL_TEST_ASSERT(apSuite, list.IntersectsAttributePath(MakeAttributePath(kMockEndpoint2, MockClusterId(4), MockAttributeId(4))));
+    NL_TEST_ASSERT(apSuite, list.IntersectsAttributePath(MakeAttributePath(kMockEndpoint3, MockClusterId(2), MockAttributeId(3))));
+    NL_TEST_ASSERT(apSuite, !list.IntersectsAttributePath(MakeAttributePath(kMockEndpoint3, MockClusterId(2), MockAttributeId(1))));
+    NL_TEST_ASSERT(apSuite, !list.IntersectsAttributePath(MakeAttributePath(kMockEndpoint3, MockClusterId(1), MockAttributeId(1))));
+
+    // Paths with wildcards
+    NL_TEST_ASSERT(apSuite, list.IntersectsAttributePath(MakeAttributePath(kMockEndpoint1, MockClusterId(1), kInvalidAttributeId)));
+    NL_TEST_ASSERT(apSuite,
+                   list.IntersectsAttributePath(MakeAttributePath(kMockEndpoint1, kInvalidClusterId, kInvalidAttributeId)));
+    NL_TEST_ASSERT(apSuite,
+                   !list.IntersectsAttributePath(MakeAttributePath(kMockEndpoint3, kInvalidClusterId, kInvalidAttributeId)));
+    NL_TEST_ASSERT(apSuite,
+                   list.IntersectsAttributePath(MakeAttributePath(kInvalidEndpointId, MockClusterId(1), MockAttributeId(1))));
+    NL_TEST_ASSERT(apSuite,
+                   !list.IntersectsAttributePath(MakeAttributePath(kInvalidEndpointId, MockClusterId(3), MockAttributeId(1))));
+}
+
+void TestClusterInfoListHasEventPathSupersetOf(nlTestSuite * apSuite, void * apContext)
+{
+    ClusterInfoList list;
+    NL_TEST_ASSERT(apSuite, list.Insert(validEventpaths[2]) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(apSuite, list.Insert(validEventpaths[4]) == CHIP_NO_ERROR);
+
+    NL_TEST_ASSERT(apSuite, list.HasEventPathSupersetOf(ConcreteEventPath(kMockEndpoint1, MockClusterId(1), MockEventId(2))));
+    NL_TEST_ASSERT(apSuite, list.HasEventPathSupersetOf(ConcreteEventPath(kMockEndpoint2, MockClusterId(1), MockEventId(1))));
+    NL_TEST_ASSERT(apSuite, !list.HasEventPathSupersetOf(ConcreteEventPath(kMockEndpoint2, MockClusterId(1), MockEventId(2))));
+    NL_TEST_ASSERT(apSuite, !list.HasEventPathSupersetOf(ConcreteEventPath(kMockEndpoint1, MockClusterId(2), MockEventId(1))));
+}
+
 } // namespace TestClusterInfo
 } // namespace app
 } // namespace chip
@@ -179,13 +271,29 @@ const nlTest sTests[] = {
     NL_TEST_DEF("TestEventPathDifferentEventId", chip::app::TestClusterInfo::TestEventPathDifferentEventId),
     NL_TEST_DEF("TestEventPathDifferentClusterId", chip::app::TestClusterInfo::TestEventPathDifferentClusterId),
     NL_TEST_DEF("TestEventPathDifferentEndpointId", chip::app::TestClusterInfo::TestEventPathDifferentEndpointId),
+    NL_TEST_DEF("TestClusterInfoListSorted", chip::app::TestClusterInfo::TestClusterInfoListSorted),
+    NL_TEST_DEF("TestClusterInfoListIntersectsAttributePath",
+                chip::app::TestClusterInfo::TestClusterInfoListIntersectsAttributePath),
+    NL_TEST_DEF("TestClusterInfoListHasEventPathSupersetOf", chip::app::TestClusterInfo::TestClusterInfoListHasEventPathSupersetOf),
     NL_TEST_SENTINEL()
 };
+
+int Initialize(void * apSuite)
+{
+    VerifyOrReturnError(chip::Platform::MemoryInit() == CHIP_NO_ERROR, FAILURE);
+    return SUCCESS;
+}
+
+int Finalize(void * aContext)
+{
+    chip::Platform::MemoryShutdown();
+    return SUCCESS;
+}
 }
 
 int TestClusterInfo()
 {
-    nlTestSuite theSuite = { "ClusterInfo", &sTests[0], nullptr, nullptr };
+    nlTestSuite theSuite = { "ClusterInfo", &sTests[0], Initialize, Finalize };
     chip::app::TestClusterInfo::InitEventPaths();
     nlTestRunner(&theSuite, nullptr);
 
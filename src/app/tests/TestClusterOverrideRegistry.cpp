@@ -0,0 +1,147 @@
+/*
+ *
+ *    Copyright (c) 2022 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This file implements unit tests for ClusterOverrideRegistry
+ *
+ */
+
+#include <app/ClusterOverrideRegistry.h>
+#include <app/CommandHandlerInterface.h>
+#include <lib/support/UnitTestRegistration.h>
+#include <nlunit-test.h>
+
+namespace chip {
+namespace app {
+namespace TestClusterOverrideRegistry {
+
+class TestHandler : public CommandHandlerInterface
+{
+public:
+    TestHandler(Optional<EndpointId> aEndpointId, ClusterId aClusterId) : CommandHandlerInterface(aEndpointId, aClusterId) {}
+
+    void InvokeCommand(HandlerContext & handlerContext) override {}
+};
+
+// Use few buckets so that entries of different endpoints and clusters share chains.
+using Registry = ClusterOverrideRegistry<CommandHandlerInterface, 2>;
+
+void TestFindConcreteAndWildcard(nlTestSuite * apSuite, void * apContext)
+{
+    Registry registry;
+    TestHandler endpoint1Cluster6(MakeOptional<EndpointId>(1), 6);
+    TestHandler endpoint2Cluster6(MakeOptional<EndpointId>(2), 6);
+    TestHandler allEndpointsCluster8(NullOptional, 8);
+
+    NL_TEST_ASSERT(apSuite, registry.Register(&endpoint1Cluster6));
+    NL_TEST_ASSERT(apSuite, registry.Register(&endpoint2Cluster6));
+    NL_TEST_ASSERT(apSuite, registry.Register(&allEndpointsCluster8));
+
+    NL_TEST_ASSERT(apSuite, registry.Find(1, 6) == &endpoint1Cluster6);
+    NL_TEST_ASSERT(apSuite, registry.Find(2, 6) == &endpoint2Cluster6);
+    NL_TEST_ASSERT(apSuite, registry.Find(3, 6) == nullptr);
+    NL_TEST_ASSERT(apSuite, registry.Find(1, 8) == &allEndpointsCluster8);
+    NL_TEST_ASSERT(apSuite, registry.Find(0xFFFE, 8) == &allEndpointsCluster8);
+    NL_TEST_ASSERT(apSuite, registry.Find(1, 7) == nullptr);
+
+    registry.Clear();
+    NL_TEST_ASSERT(apSuite, registry.Find(1, 6) == nullptr);
+    NL_TEST_ASSERT(apSuite, registry.Find(1, 8) == nullptr);
+}
+
+void TestRejectDuplicates(nlTestSuite * apSuite, void * apContext)
+{
+    Registry registry;
+    TestHandler endpoint1Cluster6(MakeOptional<EndpointId>(1), 6);
+    TestHandler otherEndpoint1Cluster6(MakeOptional<EndpointId>(1), 6);
+    TestHandler allEndpointsCluster6(NullOptional, 6);
+    TestHandler allEndpointsCluster8(NullOptional, 8);
+    TestHandler endpoint1Cluster8(MakeOptional<EndpointId>(1), 8);
+
+    NL_TEST_ASSERT(apSuite, registry.Register(&endpoint1Cluster6));
+    NL_TEST_ASSERT(apSuite, !registry.Register(&otherEndpoint1Cluster6));
+    // A wildcard registration would overlap with the endpoint 1 one.
+    NL_TEST_ASSERT(apSuite, !registry.Register(&allEndpointsCluster6));
+
+    NL_TEST_ASSERT(apSuite, registry.Register(&allEndpointsCluster8));
+    // And so would a concrete one under an existing wildcard.
+    NL_TEST_ASSERT(apSuite, !registry.Register(&endpoint1Cluster8));
+
+    NL_TEST_ASSERT(apSuite, registry.Find(1, 6) == &endpoint1Cluster6);
+    NL_TEST_ASSERT(apSuite, registry.Find(1, 8) == &allEndpointsCluster8);
+
+    registry.Clear();
+}
+
+void TestUnregister(nlTestSuite * apSuite, void * apContext)
+{
+    Registry registry;
+    TestHandler endpoint1Cluster6(MakeOptional<EndpointId>(1), 6);
+    TestHandler endpoint1Cluster7(MakeOptional<EndpointId>(1), 7);
+    TestHandler endpoint2Cluster6(MakeOptional<EndpointId>(2), 6);
+    TestHandler allEndpointsCluster8(NullOptional, 8);
+
+    NL_TEST_ASSERT(apSuite, registry.Register(&endpoint1Cluster6));
+    NL_TEST_ASSERT(apSuite, registry.Register(&endpoint1Cluster7));
+    NL_TEST_ASSERT(apSuite, registry.Register(&endpoint2Cluster6));
+    NL_TEST_ASSERT(apSuite, registry.Register(&allEndpointsCluster8));
+
+    NL_TEST_ASSERT(apSuite, registry.Unregister(endpoint2Cluster6));
+    NL_TEST_ASSERT(apSuite, !registry.Unregister(endpoint2Cluster6));
+    NL_TEST_ASSERT(apSuite, registry.Find(2, 6) == nullptr);
+    NL_TEST_ASSERT(apSuite, registry.Find(1, 6) == &endpoint1Cluster6);
+
+    registry.UnregisterEndpoint(1);
+    NL_TEST_ASSERT(apSuite, registry.Find(1, 6) == nullptr);
+    NL_TEST_ASSERT(apSuite, registry.Find(1, 7) == nullptr);
+    NL_TEST_ASSERT(apSuite, endpoint1Cluster6.GetNext() == nullptr);
+    NL_TEST_ASSERT(apSuite, endpoint1Cluster7.GetNext() == nullptr);
+
+    // Overrides for all endpoints survive the removal of one endpoint.
+    NL_TEST_ASSERT(apSuite, registry.Find(1, 8) == &allEndpointsCluster8);
+
+    // Unregistered overrides can be registered again.
+    NL_TEST_ASSERT(apSuite, registry.Register(&endpoint2Cluster6));
+    NL_TEST_ASSERT(apSuite, registry.Find(2, 6) == &endpoint2Cluster6);
+
+    registry.Clear();
+}
+
+} // namespace TestClusterOverrideRegistry
+} // namespace app
+} // namespace chip
+
+namespace {
+const nlTest sTests[] = {
+    NL_TEST_DEF("TestFindConcreteAndWildcard", chip::app::TestClusterOverrideRegistry::TestFindConcreteAndWildcard),
+    NL_TEST_DEF("TestRejectDuplicates", chip::app::TestClusterOverrideRegistry::TestRejectDuplicates),
+    NL_TEST_DEF("TestUnregister", chip::app::TestClusterOverrideRegistry::TestUnregister),
+    NL_TEST_SENTINEL()
+};
+}
+
+int TestClusterOverrideRegistry()
+{
+    nlTestSuite theSuite = { "ClusterOverrideRegistry", &sTests[0], nullptr, nullptr };
+    nlTestRunner(&theSuite, nullptr);
+
+    return (nlTestRunnerStats(&theSuite));
+}
+
+CHIP_REGISTER_TEST_SUITE(TestClusterOverrideRegistry)
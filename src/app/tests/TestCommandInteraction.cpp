@@ -24,6 +24,7 @@
 
 #include <cinttypes>
 
+#include <app-common/zap-generated/cluster-objects.h>
 #include <app/AppBuildConfig.h>
 #include <app/InteractionModelEngine.h>
 #include <app/tests/AppTestContext.h>
@@ -168,7 +169,9 @@ public:
     static void TestCommandHandlerWithProcessReceivedNotExistCommand(nlTestSuite * apSuite, void * apContext);
     static void TestCommandHandlerWithSendSimpleCommandData(nlTestSuite * apSuite, void * apContext);
     static void TestCommandHandlerCommandDataEncoding(nlTestSuite * apSuite, void * apContext);
+    static void TestCommandHandlerCommandEncodeFailure(nlTestSuite * apSuite, void * apContext);
     static void TestCommandHandlerWithSendSimpleStatusCode(nlTestSuite * apSuite, void * apContext);
+    static void TestCommandHandlerWithSendMultipleResponses(nlTestSuite * apSuite, void * apContext);
     static void TestCommandHandlerWithSendEmptyResponse(nlTestSuite * apSuite, void * apContext);
     static void TestCommandHandlerWithProcessReceivedMsg(nlTestSuite * apSuite, void * apContext);
     static void TestCommandHandlerWithProcessReceivedEmptyDataMsg(nlTestSuite * apSuite, void * apContext);
@@ -177,6 +180,8 @@ public:
     static void TestCommandSenderCommandAsyncSuccessResponseFlow(nlTestSuite * apSuite, void * apContext);
     static void TestCommandSenderCommandFailureResponseFlow(nlTestSuite * apSuite, void * apContext);
     static void TestCommandSenderCommandSpecificResponseFlow(nlTestSuite * apSuite, void * apContext);
+    static void TestCommandSenderMultipleCommandsResponseFlow(nlTestSuite * apSuite, void * apContext);
+    static void TestCommandSenderRequestDataTooLarge(nlTestSuite * apSuite, void * apContext);
 
     static void TestCommandSenderAbruptDestruction(nlTestSuite * apSuite, void * apContext);
 
@@ -534,12 +539,119 @@ void TestCommandInteraction::TestCommandHandlerCommandDataEncoding(nlTestSuite *
 #endif
 }
 
+struct BadFields
+{
+    static constexpr chip::CommandId GetCommandId() { return 4; }
+    CHIP_ERROR Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
+    {
+        TLV::TLVType outerContainerType;
+        ReturnErrorOnFailure(aWriter.StartContainer(aTag, TLV::kTLVType_Structure, outerContainerType));
+        ReturnErrorOnFailure(aWriter.PutBoolean(TLV::ContextTag(1), true));
+        return CHIP_ERROR_INTERNAL;
+    }
+};
+
+void TestCommandInteraction::TestCommandHandlerCommandEncodeFailure(nlTestSuite * apSuite, void * apContext)
+{
+    TestContext & ctx = *static_cast<TestContext *>(apContext);
+    CHIP_ERROR err    = CHIP_NO_ERROR;
+    app::CommandHandler commandHandler(nullptr);
+    System::PacketBufferHandle commandPacket;
+    chip::System::PacketBufferTLVReader reader;
+    InvokeResponseMessage::Parser invokeResponseMessageParser;
+    InvokeResponseIBs::Parser invokeResponses;
+    TLV::TLVReader invokeResponsesReader;
+    size_t numResponses = 0;
+
+    TestExchangeDelegate delegate;
+    commandHandler.mpExchangeCtx = ctx.NewExchangeToAlice(&delegate);
+
+    auto path = MakeTestCommandPath();
+    ConcreteCommandPath concretePath(path.mEndpointId, path.mClusterId, path.mCommandId);
+
+    // The partly encoded response is dropped, so that the command can still get a status response
+    err = commandHandler.AddResponseData(concretePath, BadFields());
+    NL_TEST_ASSERT(apSuite, err == CHIP_ERROR_INTERNAL);
+    err = commandHandler.AddStatus(concretePath, Protocols::InteractionModel::Status::Failure);
+    NL_TEST_ASSERT(apSuite, err == CHIP_NO_ERROR);
+    err = commandHandler.Finalize(commandPacket);
+    NL_TEST_ASSERT(apSuite, err == CHIP_NO_ERROR);
+
+    reader.Init(std::move(commandPacket));
+    err = reader.Next();
+    NL_TEST_ASSERT(apSuite, err == CHIP_NO_ERROR);
+    err = invokeResponseMessageParser.Init(reader);
+    NL_TEST_ASSERT(apSuite, err == CHIP_NO_ERROR);
+#if CHIP_CONFIG_IM_ENABLE_SCHEMA_CHECK
+    err = invokeResponseMessageParser.CheckSchemaValidity();
+    NL_TEST_ASSERT(apSuite, err == CHIP_NO_ERROR);
+#endif
+    err = invokeResponseMessageParser.GetInvokeResponses(&invokeResponses);
+    NL_TEST_ASSERT(apSuite, err == CHIP_NO_ERROR);
+
+    invokeResponses.GetReader(&invokeResponsesReader);
+    while ((err = invokeResponsesReader.Next()) == CHIP_NO_ERROR)
+    {
+        InvokeResponseIB::Parser invokeResponse;
+        CommandStatusIB::Parser commandStatus;
+        NL_TEST_ASSERT(apSuite, invokeResponse.Init(invokeResponsesReader) == CHIP_NO_ERROR);
+        NL_TEST_ASSERT(apSuite, invokeResponse.GetStatus(&commandStatus) == CHIP_NO_ERROR);
+        numResponses++;
+    }
+    NL_TEST_ASSERT(apSuite, err == CHIP_END_OF_TLV);
+    NL_TEST_ASSERT(apSuite, numResponses == 1);
+}
+
 void TestCommandInteraction::TestCommandHandlerWithSendSimpleStatusCode(nlTestSuite * apSuite, void * apContext)
 {
     // Send response which has simple status code and command path
     ValidateCommandHandlerWithSendCommand(apSuite, apContext, true /*aNeedStatusCode=true*/);
 }
 
+void TestCommandInteraction::TestCommandHandlerWithSendMultipleResponses(nlTestSuite * apSuite, void * apContext)
+{
+    TestContext & ctx = *static_cast<TestContext *>(apContext);
+    CHIP_ERROR err    = CHIP_NO_ERROR;
+    app::CommandHandler commandHandler(&mockCommandHandlerDelegate);
+    System::PacketBufferHandle commandPacket;
+    chip::System::PacketBufferTLVReader reader;
+    InvokeResponseMessage::Parser invokeResponseMessageParser;
+    InvokeResponseIBs::Parser invokeResponses;
+    TLV::TLVReader invokeResponsesReader;
+    size_t numResponses = 0;
+
+    TestExchangeDelegate delegate;
+    commandHandler.mpExchangeCtx = ctx.NewExchangeToAlice(&delegate);
+
+    // The responses to the commands of a request are all sent in one message
+    AddInvokeResponseData(apSuite, apContext, &commandHandler, false /*aNeedStatusCode=false*/);
+    AddInvokeResponseData(apSuite, apContext, &commandHandler, true /*aNeedStatusCode=true*/);
+    AddInvokeResponseData(apSuite, apContext, &commandHandler, false /*aNeedStatusCode=false*/,
+                          kTestCommandIdCommandSpecificResponse);
+    err = commandHandler.Finalize(commandPacket);
+    NL_TEST_ASSERT(apSuite, err == CHIP_NO_ERROR);
+
+    reader.Init(std::move(commandPacket));
+    err = reader.Next();
+    NL_TEST_ASSERT(apSuite, err == CHIP_NO_ERROR);
+    err = invokeResponseMessageParser.Init(reader);
+    NL_TEST_ASSERT(apSuite, err == CHIP_NO_ERROR);
+#if CHIP_CONFIG_IM_ENABLE_SCHEMA_CHECK
+    err = invokeResponseMessageParser.CheckSchemaValidity();
+    NL_TEST_ASSERT(apSuite, err == CHIP_NO_ERROR);
+#endif
+    err = invokeResponseMessageParser.GetInvokeResponses(&invokeResponses);
+    NL_TEST_ASSERT(apSuite, err == CHIP_NO_ERROR);
+
+    invokeResponses.GetReader(&invokeResponsesReader);
+    while ((err = invokeResponsesReader.Next()) == CHIP_NO_ERROR)
+    {
+        numResponses++;
+    }
+    NL_TEST_ASSERT(apSuite, err == CHIP_END_OF_TLV);
+    NL_TEST_ASSERT(apSuite, numResponses == 3);
+}
+
 void TestCommandInteraction::TestCommandHandlerWithProcessReceivedMsg(nlTestSuite * apSuite, void * apContext)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -666,6 +778,54 @@ void TestCommandInteraction::TestCommandSenderCommandSpecificResponseFlow(nlTest
     NL_TEST_ASSERT(apSuite, ctx.GetExchangeManager().GetNumActiveExchanges() == 0);
 }
 
+void TestCommandInteraction::TestCommandSenderMultipleCommandsResponseFlow(nlTestSuite * apSuite, void * apContext)
+{
+    TestContext & ctx = *static_cast<TestContext *>(apContext);
+    CHIP_ERROR err    = CHIP_NO_ERROR;
+
+    mockCommandSenderDelegate.ResetCounter();
+    app::CommandSender commandSender(&mockCommandSenderDelegate, &ctx.GetExchangeManager());
+
+    AddInvokeRequestData(apSuite, apContext, &commandSender);
+    AddInvokeRequestData(apSuite, apContext, &commandSender, kTestCommandIdCommandSpecificResponse);
+    AddInvokeRequestData(apSuite, apContext, &commandSender, kTestNonExistCommandId);
+    err = commandSender.SendCommandRequest(ctx.GetSessionBobToAlice());
+
+    NL_TEST_ASSERT(apSuite, err == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(apSuite,
+                   mockCommandSenderDelegate.onResponseCalledTimes == 2 && mockCommandSenderDelegate.onFinalCalledTimes == 1 &&
+                       mockCommandSenderDelegate.onErrorCalledTimes == 1);
+
+    NL_TEST_ASSERT(apSuite, GetNumActiveHandlerObjects() == 0);
+    NL_TEST_ASSERT(apSuite, ctx.GetExchangeManager().GetNumActiveExchanges() == 0);
+}
+
+void TestCommandInteraction::TestCommandSenderRequestDataTooLarge(nlTestSuite * apSuite, void * apContext)
+{
+    TestContext & ctx = *static_cast<TestContext *>(apContext);
+    CHIP_ERROR err    = CHIP_NO_ERROR;
+    uint8_t certificate[400];
+    size_t numRequests = 0;
+    Clusters::OperationalCredentials::Commands::AddTrustedRootCertificate::Type request;
+    System::PacketBufferHandle commandPacket;
+
+    app::CommandSender commandSender(&mockCommandSenderDelegate, &ctx.GetExchangeManager());
+
+    memset(certificate, 0xAB, sizeof(certificate));
+    request.rootCertificate = ByteSpan(certificate);
+
+    // Requests are added until the message is full, leaving the ones already added intact
+    while ((err = commandSender.AddRequestData(MakeTestCommandPath(), request)) == CHIP_NO_ERROR)
+    {
+        numRequests++;
+    }
+    NL_TEST_ASSERT(apSuite, err == CHIP_ERROR_BUFFER_TOO_SMALL);
+    NL_TEST_ASSERT(apSuite, numRequests == 2);
+
+    err = commandSender.Finalize(commandPacket);
+    NL_TEST_ASSERT(apSuite, err == CHIP_NO_ERROR);
+}
+
 void TestCommandInteraction::TestCommandSenderCommandFailureResponseFlow(nlTestSuite * apSuite, void * apContext)
 {
     TestContext & ctx = *static_cast<TestContext *>(apContext);
@@ -739,7 +899,9 @@ const nlTest sTests[] =
     NL_TEST_DEF("TestCommandSenderWithProcessReceivedMsg", chip::app::TestCommandInteraction::TestCommandSenderWithProcessReceivedMsg),
     NL_TEST_DEF("TestCommandHandlerWithSendSimpleCommandData", chip::app::TestCommandInteraction::TestCommandHandlerWithSendSimpleCommandData),
     NL_TEST_DEF("TestCommandHandlerCommandDataEncoding", chip::app::TestCommandInteraction::TestCommandHandlerCommandDataEncoding),
+    NL_TEST_DEF("TestCommandHandlerCommandEncodeFailure", chip::app::TestCommandInteraction::TestCommandHandlerCommandEncodeFailure),
     NL_TEST_DEF("TestCommandHandlerWithSendSimpleStatusCode", chip::app::TestCommandInteraction::TestCommandHandlerWithSendSimpleStatusCode),
+    NL_TEST_DEF("TestCommandHandlerWithSendMultipleResponses", chip::app::TestCommandInteraction::TestCommandHandlerWithSendMultipleResponses),
     NL_TEST_DEF("TestCommandHandlerWithProcessReceivedMsg", chip::app::TestCommandInteraction::TestCommandHandlerWithProcessReceivedMsg),
     NL_TEST_DEF("TestCommandHandlerWithProcessReceivedNotExistCommand", chip::app::TestCommandInteraction::TestCommandHandlerWithProcessReceivedNotExistCommand),
     NL_TEST_DEF("TestCommandHandlerWithProcessReceivedEmptyDataMsg", chip::app::TestCommandInteraction::TestCommandHandlerWithProcessReceivedEmptyDataMsg),
@@ -747,6 +909,8 @@ const nlTest sTests[] =
     NL_TEST_DEF("TestCommandSenderCommandSuccessResponseFlow", chip::app::TestCommandInteraction::TestCommandSenderCommandSuccessResponseFlow),
     NL_TEST_DEF("TestCommandSenderCommandAsyncSuccessResponseFlow", chip::app::TestCommandInteraction::TestCommandSenderCommandAsyncSuccessResponseFlow),
     NL_TEST_DEF("TestCommandSenderCommandSpecificResponseFlow", chip::app::TestCommandInteraction::TestCommandSenderCommandSpecificResponseFlow),
+    NL_TEST_DEF("TestCommandSenderMultipleCommandsResponseFlow", chip::app::TestCommandInteraction::TestCommandSenderMultipleCommandsResponseFlow),
+    NL_TEST_DEF("TestCommandSenderRequestDataTooLarge", chip::app::TestCommandInteraction::TestCommandSenderRequestDataTooLarge),
     NL_TEST_DEF("TestCommandSenderCommandFailureResponseFlow", chip::app::TestCommandInteraction::TestCommandSenderCommandFailureResponseFlow),
     NL_TEST_DEF("TestCommandSenderAbruptDestruction", chip::app::TestCommandInteraction::TestCommandSenderAbruptDestruction),
     NL_TEST_SENTINEL()
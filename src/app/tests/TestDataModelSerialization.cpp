@@ -55,6 +55,8 @@ public:
     static void NullablesOptionalsStruct(nlTestSuite * apSuite, void * apContext);
     static void NullablesOptionalsCommand(nlTestSuite * apSuite, void * apContext);
 
+    static void TestDataModelSerialization_EncodedSize(nlTestSuite * apSuite, void * apContext);
+
     void Shutdown();
 
 protected:
@@ -187,6 +189,7 @@ void TestDataModelSerialization::TestDataModelSerialization_EncAndDecSimpleStruc
 
         err = DataModel::Encode(_this->mWriter, TLV::AnonymousTag, t);
         NL_TEST_ASSERT(apSuite, err == CHIP_NO_ERROR);
+        NL_TEST_ASSERT(apSuite, DataModel::EncodedSize(TLV::AnonymousTag, t) == _this->mWriter.GetLengthWritten());
 
         err = _this->mWriter.Finalize();
         NL_TEST_ASSERT(apSuite, err == CHIP_NO_ERROR);
@@ -248,6 +251,7 @@ void TestDataModelSerialization::TestDataModelSerialization_EncAndDecNestedStruc
 
         err = DataModel::Encode(_this->mWriter, TLV::AnonymousTag, t);
         NL_TEST_ASSERT(apSuite, err == CHIP_NO_ERROR);
+        NL_TEST_ASSERT(apSuite, DataModel::EncodedSize(TLV::AnonymousTag, t) == _this->mWriter.GetLengthWritten());
 
         err = _this->mWriter.Finalize();
         NL_TEST_ASSERT(apSuite, err == CHIP_NO_ERROR);
@@ -333,6 +337,7 @@ void TestDataModelSerialization::TestDataModelSerialization_EncAndDecDecodableNe
 
         err = DataModel::Encode(_this->mWriter, TLV::AnonymousTag, t);
         NL_TEST_ASSERT(apSuite, err == CHIP_NO_ERROR);
+        NL_TEST_ASSERT(apSuite, DataModel::EncodedSize(TLV::AnonymousTag, t) == _this->mWriter.GetLengthWritten());
 
         err = _this->mWriter.Finalize();
         NL_TEST_ASSERT(apSuite, err == CHIP_NO_ERROR);
@@ -462,6 +467,7 @@ void TestDataModelSerialization::TestDataModelSerialization_EncAndDecDecodableDo
 
         err = DataModel::Encode(_this->mWriter, TLV::AnonymousTag, t);
         NL_TEST_ASSERT(apSuite, err == CHIP_NO_ERROR);
+        NL_TEST_ASSERT(apSuite, DataModel::EncodedSize(TLV::AnonymousTag, t) == _this->mWriter.GetLengthWritten());
 
         err = _this->mWriter.Finalize();
         NL_TEST_ASSERT(apSuite, err == CHIP_NO_ERROR);
@@ -924,6 +930,7 @@ void TestDataModelSerialization::NullablesOptionalsEncodeDecodeCheck(nlTestSuite
 
         CHIP_ERROR err = DataModel::Encode(_this->mWriter, TLV::AnonymousTag, encodable);
         NL_TEST_ASSERT(apSuite, err == CHIP_NO_ERROR);
+        NL_TEST_ASSERT(apSuite, DataModel::EncodedSize(TLV::AnonymousTag, encodable) == _this->mWriter.GetLengthWritten());
         err = _this->mWriter.Finalize();
         NL_TEST_ASSERT(apSuite, err == CHIP_NO_ERROR);
     }
@@ -1038,6 +1045,100 @@ void TestDataModelSerialization::NullablesOptionalsCommand(nlTestSuite * apSuite
     NullablesOptionalsEncodeDecodeCheck<EncType, DecType>(apSuite, apContext);
 }
 
+constexpr size_t kLargeStringLength = 70000;
+
+/*
+ * Returns whether DataModel::EncodedSize() matches the number of bytes DataModel::Encode() writes for value.
+ */
+template <typename T>
+bool EncodedSizeMatches(TLV::Tag tag, const T & value)
+{
+    static uint8_t sBuf[kLargeStringLength + 64];
+    TLV::TLVWriter writer;
+    TLV::TLVType outer;
+
+    // Lists accept every kind of tag
+    writer.Init(sBuf);
+    VerifyOrReturnError(writer.StartContainer(TLV::AnonymousTag, TLV::kTLVType_List, outer) == CHIP_NO_ERROR, false);
+
+    const uint32_t startLength = writer.GetLengthWritten();
+    VerifyOrReturnError(DataModel::Encode(writer, tag, value) == CHIP_NO_ERROR, false);
+    return DataModel::EncodedSize(tag, value) == writer.GetLengthWritten() - startLength;
+}
+
+template <typename T>
+bool EncodedSizeMatchesForAllTags(const T & value)
+{
+    const TLV::Tag tags[] = { TLV::AnonymousTag, TLV::ContextTag(1),           TLV::ContextTag(255),
+                              TLV::CommonTag(1), TLV::CommonTag(70000),        TLV::ProfileTag(0xFFF1, 1, 1),
+                              TLV::ProfileTag(0xFFF1, 1, 70000) };
+
+    for (auto tag : tags)
+    {
+        VerifyOrReturnError(EncodedSizeMatches(tag, value), false);
+    }
+    return true;
+}
+
+void TestDataModelSerialization::TestDataModelSerialization_EncodedSize(nlTestSuite * apSuite, void * apContext)
+{
+    static char sLargeString[kLargeStringLength];
+    memset(sLargeString, 'x', sizeof(sLargeString));
+
+    // Integers are encoded in the fewest bytes that hold them
+    const uint64_t unsignedValues[] = { 0, UINT8_MAX, UINT8_MAX + 1, UINT16_MAX, UINT16_MAX + 1, UINT32_MAX, UINT64_MAX };
+    for (auto value : unsignedValues)
+    {
+        NL_TEST_ASSERT(apSuite, EncodedSizeMatchesForAllTags(value));
+    }
+
+    const int64_t signedValues[] = { 0,         -1,        INT8_MIN,  INT8_MAX + 1,    INT16_MIN,
+                                     INT16_MAX, INT32_MIN, INT32_MAX, INT32_MIN - 1LL, INT64_MIN };
+    for (auto value : signedValues)
+    {
+        NL_TEST_ASSERT(apSuite, EncodedSizeMatchesForAllTags(value));
+    }
+
+    NL_TEST_ASSERT(apSuite, EncodedSizeMatchesForAllTags(static_cast<int8_t>(-100)));
+    NL_TEST_ASSERT(apSuite, EncodedSizeMatchesForAllTags(static_cast<uint16_t>(300)));
+    NL_TEST_ASSERT(apSuite, EncodedSizeMatchesForAllTags(true));
+    NL_TEST_ASSERT(apSuite, EncodedSizeMatchesForAllTags(1.5f));
+    NL_TEST_ASSERT(apSuite, EncodedSizeMatchesForAllTags(1.5));
+    NL_TEST_ASSERT(apSuite, EncodedSizeMatchesForAllTags(TestCluster::SimpleEnum::kValueC));
+    NL_TEST_ASSERT(apSuite, EncodedSizeMatchesForAllTags(BitFlags<TestCluster::SimpleBitmap>(TestCluster::SimpleBitmap::kValueC)));
+
+    // Strings have a length field of 1, 2 or 4 bytes
+    const size_t stringLengths[] = { 0, UINT8_MAX, UINT8_MAX + 1, UINT16_MAX, UINT16_MAX + 1 };
+    for (auto length : stringLengths)
+    {
+        NL_TEST_ASSERT(apSuite, EncodedSizeMatchesForAllTags(CharSpan(sLargeString, length)));
+        NL_TEST_ASSERT(apSuite, EncodedSizeMatchesForAllTags(ByteSpan(Uint8::from_const_char(sLargeString), length)));
+    }
+
+    DataModel::Nullable<uint32_t> nullable;
+    NL_TEST_ASSERT(apSuite, EncodedSizeMatchesForAllTags(nullable));
+    nullable.SetNonNull(70000);
+    NL_TEST_ASSERT(apSuite, EncodedSizeMatchesForAllTags(nullable));
+
+    Optional<CharSpan> optional;
+    NL_TEST_ASSERT(apSuite, EncodedSizeMatchesForAllTags(optional));
+    optional.SetValue(CharSpan(sLargeString, 300));
+    NL_TEST_ASSERT(apSuite, EncodedSizeMatchesForAllTags(optional));
+
+    uint16_t listValues[] = { 1, 300, 70 };
+    NL_TEST_ASSERT(apSuite, EncodedSizeMatchesForAllTags(DataModel::List<uint16_t>()));
+    NL_TEST_ASSERT(apSuite, EncodedSizeMatchesForAllTags(DataModel::List<uint16_t>(listValues)));
+
+    TestCluster::Events::TestEvent::Type event;
+    event.arg1 = 200;
+    event.arg2 = TestCluster::SimpleEnum::kValueA;
+    event.arg3 = true;
+    event.arg4.e = CharSpan(sLargeString, 1000);
+    TestCluster::SimpleEnum enumValues[] = { TestCluster::SimpleEnum::kValueA, TestCluster::SimpleEnum::kValueB };
+    event.arg6                           = enumValues;
+    NL_TEST_ASSERT(apSuite, EncodedSizeMatchesForAllTags(event));
+}
+
 int Initialize(void * apSuite)
 {
     VerifyOrReturnError(chip::Platform::MemoryInit() == CHIP_NO_ERROR, FAILURE);
@@ -1066,6 +1167,7 @@ const nlTest sTests[] =
     NL_TEST_DEF("TestDataModelSerialization_InvalidListType", TestDataModelSerialization::TestDataModelSerialization_InvalidListType),
     NL_TEST_DEF("TestDataModelSerialization_NullablesOptionalsStruct", TestDataModelSerialization::NullablesOptionalsStruct),
     NL_TEST_DEF("TestDataModelSerialization_NullablesOptionalsCommand", TestDataModelSerialization::NullablesOptionalsCommand),
+    NL_TEST_DEF("TestDataModelSerialization_EncodedSize", TestDataModelSerialization::TestDataModelSerialization_EncodedSize),
     NL_TEST_SENTINEL()
 };
 // clang-format on
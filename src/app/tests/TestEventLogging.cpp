@@ -168,10 +168,22 @@ public:
 
     void SetStatus(int32_t aStatus) { mStatus = aStatus; }
 
-private:
+protected:
     int32_t mStatus;
 };
 
+class TestSizedEventGenerator : public TestEventGenerator
+{
+public:
+    CHIP_ERROR GetEventDataSize(size_t & aSize) override
+    {
+        chip::TLV::Tag dataTag = chip::TLV::ContextTag(chip::to_underlying(chip::app::EventDataIB::Tag::kData));
+
+        aSize = chip::TLV::EncodedContainerOverhead(dataTag) + chip::TLV::EncodedSignedIntegerSize(kLivenessDeviceStatus, mStatus);
+        return CHIP_NO_ERROR;
+    }
+};
+
 static void CheckLogEventWithEvictToNextBuffer(nlTestSuite * apSuite, void * apContext)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -280,12 +292,34 @@ static void CheckLogEventWithDiscardLowEvent(nlTestSuite * apSuite, void * apCon
     NL_TEST_ASSERT(apSuite, err == CHIP_NO_ERROR);
     CheckLogState(apSuite, logMgmt, 3, chip::app::PriorityLevel::Debug);
 }
+static void CheckLogEventWithPrecomputedSize(nlTestSuite * apSuite, void * apContext)
+{
+    CHIP_ERROR err = CHIP_NO_ERROR;
+    chip::EventNumber eid;
+    chip::app::EventOptions options;
+    options.mPath     = { kTestEndpointId1, kLivenessClusterId, kLivenessChangeEvent };
+    options.mPriority = chip::app::PriorityLevel::Debug;
+    TestSizedEventGenerator testEventGenerator;
+
+    // The event size reported by the delegate replaces writing the event to measure it, so events evict the same events
+    chip::app::EventManagement & logMgmt = chip::app::EventManagement::GetInstance();
+    for (int32_t status : { 0, 1, -1000, 100000 })
+    {
+        testEventGenerator.SetStatus(status);
+        err = logMgmt.LogEvent(&testEventGenerator, options, eid);
+        NL_TEST_ASSERT(apSuite, err == CHIP_NO_ERROR);
+        CheckLogState(apSuite, logMgmt, 3, chip::app::PriorityLevel::Debug);
+        CheckLogState(apSuite, logMgmt, 6, chip::app::PriorityLevel::Info);
+    }
+}
+
 /**
  *   Test Suite. It lists all the test functions.
  */
 
 const nlTest sTests[] = { NL_TEST_DEF("CheckLogEventWithEvictToNextBuffer", CheckLogEventWithEvictToNextBuffer),
-                          NL_TEST_DEF("CheckLogEventWithDiscardLowEvent", CheckLogEventWithDiscardLowEvent), NL_TEST_SENTINEL() };
+                          NL_TEST_DEF("CheckLogEventWithDiscardLowEvent", CheckLogEventWithDiscardLowEvent),
+                          NL_TEST_DEF("CheckLogEventWithPrecomputedSize", CheckLogEventWithPrecomputedSize), NL_TEST_SENTINEL() };
 
 // clang-format off
 nlTestSuite sSuite =
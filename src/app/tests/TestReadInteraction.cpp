@@ -153,7 +153,11 @@ public:
         }
     }
 
-    void OnError(const chip::app::ReadClient * apReadClient, CHIP_ERROR aError) override { mReadError = true; }
+    void OnError(const chip::app::ReadClient * apReadClient, CHIP_ERROR aError) override
+    {
+        mReadError = true;
+        mError     = aError;
+    }
 
     void OnDone(chip::app::ReadClient * apReadClient) override {}
 
@@ -178,6 +182,7 @@ public:
     int mNumAttributeResponse              = 0;
     bool mGotReport                        = false;
     bool mReadError                        = false;
+    CHIP_ERROR mError                      = CHIP_NO_ERROR;
     uint32_t mNumSubscriptions             = 0;
     chip::app::ReadHandler * mpReadHandler = nullptr;
 };
@@ -242,6 +247,9 @@ public:
     static void TestReadInvalidAttributePathRoundtrip(nlTestSuite * apSuite, void * apContext);
     static void TestSubscribeInvalidIterval(nlTestSuite * apSuite, void * apContext);
     static void TestReadShutdown(nlTestSuite * apSuite, void * apContext);
+    static void TestReadTooManyPaths(nlTestSuite * apSuite, void * apContext);
+    static void TestSubscribeFabricQuota(nlTestSuite * apSuite, void * apContext);
+    static void TestReadHandlerRelease(nlTestSuite * apSuite, void * apContext);
 
 private:
     static void GenerateReportData(nlTestSuite * apSuite, void * apContext, System::PacketBufferHandle & aPayload,
@@ -1069,9 +1077,9 @@ void TestReadInteraction::TestSubscribeRoundtrip(nlTestSuite * apSuite, void * a
         dirtyPath5.mAttributeId = 4;
 
         // Test report with 2 different path
-        delegate.mpReadHandler->mHoldReport = false;
-        delegate.mGotReport                 = false;
-        delegate.mNumAttributeResponse      = 0;
+        delegate.mpReadHandler->ClearHoldReport();
+        delegate.mGotReport            = false;
+        delegate.mNumAttributeResponse = 0;
 
         printf("HereHere\n");
 
@@ -1084,10 +1092,10 @@ void TestReadInteraction::TestSubscribeRoundtrip(nlTestSuite * apSuite, void * a
         NL_TEST_ASSERT(apSuite, delegate.mNumAttributeResponse == 2);
 
         // Test report with 2 different path, and 1 same path
-        delegate.mpReadHandler->mHoldReport = false;
-        delegate.mGotReport                 = false;
-        delegate.mNumAttributeResponse      = 0;
-        err                                 = engine->GetReportingEngine().SetDirty(dirtyPath1);
+        delegate.mpReadHandler->ClearHoldReport();
+        delegate.mGotReport            = false;
+        delegate.mNumAttributeResponse = 0;
+        err                            = engine->GetReportingEngine().SetDirty(dirtyPath1);
         NL_TEST_ASSERT(apSuite, err == CHIP_NO_ERROR);
         err = engine->GetReportingEngine().SetDirty(dirtyPath2);
         NL_TEST_ASSERT(apSuite, err == CHIP_NO_ERROR);
@@ -1098,10 +1106,10 @@ void TestReadInteraction::TestSubscribeRoundtrip(nlTestSuite * apSuite, void * a
         NL_TEST_ASSERT(apSuite, delegate.mNumAttributeResponse == 2);
 
         // Test report with 3 different path, and one path is overlapped with another
-        delegate.mpReadHandler->mHoldReport = false;
-        delegate.mGotReport                 = false;
-        delegate.mNumAttributeResponse      = 0;
-        err                                 = engine->GetReportingEngine().SetDirty(dirtyPath1);
+        delegate.mpReadHandler->ClearHoldReport();
+        delegate.mGotReport            = false;
+        delegate.mNumAttributeResponse = 0;
+        err                            = engine->GetReportingEngine().SetDirty(dirtyPath1);
         NL_TEST_ASSERT(apSuite, err == CHIP_NO_ERROR);
         err = engine->GetReportingEngine().SetDirty(dirtyPath2);
         NL_TEST_ASSERT(apSuite, err == CHIP_NO_ERROR);
@@ -1112,10 +1120,10 @@ void TestReadInteraction::TestSubscribeRoundtrip(nlTestSuite * apSuite, void * a
         NL_TEST_ASSERT(apSuite, delegate.mNumAttributeResponse == 2);
 
         // Test report with 3 different path, all are not overlapped, one path is not interested for current subscription
-        delegate.mpReadHandler->mHoldReport = false;
-        delegate.mGotReport                 = false;
-        delegate.mNumAttributeResponse      = 0;
-        err                                 = engine->GetReportingEngine().SetDirty(dirtyPath1);
+        delegate.mpReadHandler->ClearHoldReport();
+        delegate.mGotReport            = false;
+        delegate.mNumAttributeResponse = 0;
+        err                            = engine->GetReportingEngine().SetDirty(dirtyPath1);
         NL_TEST_ASSERT(apSuite, err == CHIP_NO_ERROR);
         err = engine->GetReportingEngine().SetDirty(dirtyPath2);
         NL_TEST_ASSERT(apSuite, err == CHIP_NO_ERROR);
@@ -1126,10 +1134,10 @@ void TestReadInteraction::TestSubscribeRoundtrip(nlTestSuite * apSuite, void * a
         NL_TEST_ASSERT(apSuite, delegate.mNumAttributeResponse == 2);
 
         // Test empty report
-        delegate.mpReadHandler->mHoldReport = false;
-        delegate.mpReadHandler->mHoldSync   = false;
-        delegate.mGotReport                 = false;
-        delegate.mNumAttributeResponse      = 0;
+        delegate.mpReadHandler->ClearHoldReport();
+        delegate.mpReadHandler->ClearHoldSync();
+        delegate.mGotReport            = false;
+        delegate.mNumAttributeResponse = 0;
         engine->GetReportingEngine().Run();
         NL_TEST_ASSERT(apSuite, delegate.mNumAttributeResponse == 0);
     }
@@ -1195,9 +1203,9 @@ void TestReadInteraction::TestSubscribeWildcard(nlTestSuite * apSuite, void * ap
 
         // Set a concrete path dirty
         {
-            delegate.mpReadHandler->mHoldReport = false;
-            delegate.mGotReport                 = false;
-            delegate.mNumAttributeResponse      = 0;
+            delegate.mpReadHandler->ClearHoldReport();
+            delegate.mGotReport            = false;
+            delegate.mNumAttributeResponse = 0;
 
             ClusterInfo dirtyPath;
             dirtyPath.mEndpointId  = Test::kMockEndpoint2;
@@ -1214,9 +1222,9 @@ void TestReadInteraction::TestSubscribeWildcard(nlTestSuite * apSuite, void * ap
 
         // Set a endpoint dirty
         {
-            delegate.mpReadHandler->mHoldReport = false;
-            delegate.mGotReport                 = false;
-            delegate.mNumAttributeResponse      = 0;
+            delegate.mpReadHandler->ClearHoldReport();
+            delegate.mGotReport            = false;
+            delegate.mNumAttributeResponse = 0;
 
             ClusterInfo dirtyPath;
             dirtyPath.mEndpointId = Test::kMockEndpoint3;
@@ -1226,7 +1234,7 @@ void TestReadInteraction::TestSubscribeWildcard(nlTestSuite * apSuite, void * ap
 
             for (int i = 0; i < 10 && delegate.mNumAttributeResponse < 38; i++)
             {
-                delegate.mpReadHandler->mHoldReport = false;
+                delegate.mpReadHandler->ClearHoldReport();
                 // 10 is a magic number, we assume the report will use no more than 10 chunks.
                 engine->GetReportingEngine().Run();
             }
@@ -1333,7 +1341,7 @@ void TestReadInteraction::TestSubscribeInvalidAttributePathRoundtrip(nlTestSuite
         delegate.mNumAttributeResponse = 0;
         InteractionModelEngine::GetInstance()->GetReportingEngine().Run();
         NL_TEST_ASSERT(apSuite, delegate.mNumAttributeResponse == 0);
-        delegate.mpReadHandler->mHoldReport = false;
+        delegate.mpReadHandler->ClearHoldReport();
         InteractionModelEngine::GetInstance()->GetReportingEngine().Run();
         NL_TEST_ASSERT(apSuite, delegate.mNumAttributeResponse == 0);
     }
@@ -1423,6 +1431,199 @@ void TestReadInteraction::TestSubscribeInvalidIterval(nlTestSuite * apSuite, voi
     engine->Shutdown();
 }
 
+void TestReadInteraction::TestReadTooManyPaths(nlTestSuite * apSuite, void * apContext)
+{
+    TestContext & ctx = *static_cast<TestContext *>(apContext);
+    CHIP_ERROR err    = CHIP_NO_ERROR;
+
+    Messaging::ReliableMessageMgr * rm = ctx.GetExchangeManager().GetReliableMessageMgr();
+    // Shouldn't have anything in the retransmit table when starting the test.
+    NL_TEST_ASSERT(apSuite, rm->TestGetCountRetransTable() == 0);
+
+    MockInteractionModelApp delegate;
+    auto * engine = chip::app::InteractionModelEngine::GetInstance();
+    err           = engine->Init(&ctx.GetExchangeManager(), &delegate);
+    NL_TEST_ASSERT(apSuite, err == CHIP_NO_ERROR);
+
+    chip::app::AttributePathParams attributePathParams[CHIP_IM_MAX_NUM_PATHS_PER_READ_HANDLER + 1];
+    for (uint32_t i = 0; i < ArraySize(attributePathParams); i++)
+    {
+        attributePathParams[i].mEndpointId  = kTestEndpointId;
+        attributePathParams[i].mClusterId   = kTestClusterId;
+        attributePathParams[i].mAttributeId = i + 1;
+    }
+
+    ReadPrepareParams readPrepareParams(ctx.GetSessionBobToAlice());
+    readPrepareParams.mpAttributePathParamsList = attributePathParams;
+
+    // A request with as many paths as a read handler holds is served
+    readPrepareParams.mAttributePathParamsListSize = CHIP_IM_MAX_NUM_PATHS_PER_READ_HANDLER;
+    {
+        app::ReadClient readClient(chip::app::InteractionModelEngine::GetInstance(), &ctx.GetExchangeManager(), delegate,
+                                   chip::app::ReadClient::InteractionType::Read);
+
+        err = readClient.SendRequest(readPrepareParams);
+        NL_TEST_ASSERT(apSuite, err == CHIP_NO_ERROR);
+
+        InteractionModelEngine::GetInstance()->GetReportingEngine().Run();
+        NL_TEST_ASSERT(apSuite, delegate.mNumAttributeResponse == CHIP_IM_MAX_NUM_PATHS_PER_READ_HANDLER);
+        NL_TEST_ASSERT(apSuite, !delegate.mReadError);
+    }
+
+    // One more path is rejected with ResourceExhausted, which the client reports as CHIP_ERROR_NO_MEMORY. The status
+    // response is delivered asynchronously so that it reaches the client after it started waiting for the report.
+    delegate.mNumAttributeResponse                 = 0;
+    readPrepareParams.mAttributePathParamsListSize = CHIP_IM_MAX_NUM_PATHS_PER_READ_HANDLER + 1;
+    ctx.EnableAsyncDispatch();
+    {
+        app::ReadClient readClient(chip::app::InteractionModelEngine::GetInstance(), &ctx.GetExchangeManager(), delegate,
+                                   chip::app::ReadClient::InteractionType::Read);
+
+        err = readClient.SendRequest(readPrepareParams);
+        NL_TEST_ASSERT(apSuite, err == CHIP_NO_ERROR);
+
+        ctx.DrainAndServiceIO();
+        NL_TEST_ASSERT(apSuite, delegate.mNumAttributeResponse == 0);
+        NL_TEST_ASSERT(apSuite, delegate.mReadError);
+        NL_TEST_ASSERT(apSuite, delegate.mError == CHIP_ERROR_NO_MEMORY);
+        NL_TEST_ASSERT(apSuite, engine->GetNumActiveReadHandlers() == 0);
+    }
+    ctx.GetLoopback().mAsyncMessageDispatch = false;
+
+    NL_TEST_ASSERT(apSuite, engine->GetNumActiveReadClients() == 0);
+    NL_TEST_ASSERT(apSuite, rm->TestGetCountRetransTable() == 0);
+    engine->Shutdown();
+}
+
+void TestReadInteraction::TestSubscribeFabricQuota(nlTestSuite * apSuite, void * apContext)
+{
+    TestContext & ctx = *static_cast<TestContext *>(apContext);
+    CHIP_ERROR err    = CHIP_NO_ERROR;
+
+    Messaging::ReliableMessageMgr * rm = ctx.GetExchangeManager().GetReliableMessageMgr();
+    // Shouldn't have anything in the retransmit table when starting the test.
+    NL_TEST_ASSERT(apSuite, rm->TestGetCountRetransTable() == 0);
+
+    MockInteractionModelApp delegate;
+    auto * engine = chip::app::InteractionModelEngine::GetInstance();
+    err           = engine->Init(&ctx.GetExchangeManager(), &delegate);
+    NL_TEST_ASSERT(apSuite, err == CHIP_NO_ERROR);
+
+    // The default quota is only reached after the handler reserved for reads, so lower it
+    engine->SetMaxSubscriptionsPerFabric(1);
+
+    chip::app::AttributePathParams attributePathParams;
+    attributePathParams.mEndpointId  = kTestEndpointId;
+    attributePathParams.mClusterId   = kTestClusterId;
+    attributePathParams.mAttributeId = 1;
+
+    ReadPrepareParams readPrepareParams(ctx.GetSessionBobToAlice());
+    readPrepareParams.mpAttributePathParamsList    = &attributePathParams;
+    readPrepareParams.mAttributePathParamsListSize = 1;
+    readPrepareParams.mMinIntervalFloorSeconds     = 2;
+    readPrepareParams.mMaxIntervalCeilingSeconds   = 5;
+    readPrepareParams.mKeepSubscriptions           = true;
+
+    {
+        app::ReadClient readClient(chip::app::InteractionModelEngine::GetInstance(), &ctx.GetExchangeManager(), delegate,
+                                   chip::app::ReadClient::InteractionType::Subscribe);
+
+        err = readClient.SendRequest(readPrepareParams);
+        NL_TEST_ASSERT(apSuite, err == CHIP_NO_ERROR);
+
+        engine->GetReportingEngine().Run();
+        NL_TEST_ASSERT(apSuite, delegate.mNumSubscriptions == 1);
+        NL_TEST_ASSERT(apSuite, engine->GetNumActiveSubscriptions(ctx.GetFabricIndex()) == 1);
+
+        // A second subscription of the same fabric is rejected with ResourceExhausted, which the client reports as
+        // CHIP_ERROR_NO_MEMORY. The status response is delivered asynchronously so that it reaches the client after it
+        // started waiting for the report.
+        ctx.EnableAsyncDispatch();
+        {
+            app::ReadClient overQuotaClient(chip::app::InteractionModelEngine::GetInstance(), &ctx.GetExchangeManager(),
+                                            delegate, chip::app::ReadClient::InteractionType::Subscribe);
+
+            err = overQuotaClient.SendRequest(readPrepareParams);
+            NL_TEST_ASSERT(apSuite, err == CHIP_NO_ERROR);
+
+            ctx.DrainAndServiceIO();
+            NL_TEST_ASSERT(apSuite, delegate.mReadError);
+            NL_TEST_ASSERT(apSuite, delegate.mError == CHIP_ERROR_NO_MEMORY);
+            NL_TEST_ASSERT(apSuite, delegate.mNumSubscriptions == 1);
+            NL_TEST_ASSERT(apSuite, engine->GetNumActiveReadHandlers() == 1);
+        }
+        ctx.GetLoopback().mAsyncMessageDispatch = false;
+    }
+
+    engine->SetMaxSubscriptionsPerFabric(CHIP_IM_MAX_NUM_SUBSCRIPTIONS_PER_FABRIC);
+    NL_TEST_ASSERT(apSuite, engine->GetNumActiveReadClients() == 0);
+    NL_TEST_ASSERT(apSuite, rm->TestGetCountRetransTable() == 0);
+    engine->Shutdown();
+}
+
+void TestReadInteraction::TestReadHandlerRelease(nlTestSuite * apSuite, void * apContext)
+{
+    TestContext & ctx = *static_cast<TestContext *>(apContext);
+    CHIP_ERROR err    = CHIP_NO_ERROR;
+
+    Messaging::ReliableMessageMgr * rm = ctx.GetExchangeManager().GetReliableMessageMgr();
+    // Shouldn't have anything in the retransmit table when starting the test.
+    NL_TEST_ASSERT(apSuite, rm->TestGetCountRetransTable() == 0);
+
+    MockInteractionModelApp delegate;
+    auto * engine = chip::app::InteractionModelEngine::GetInstance();
+    err           = engine->Init(&ctx.GetExchangeManager(), &delegate);
+    NL_TEST_ASSERT(apSuite, err == CHIP_NO_ERROR);
+
+    chip::app::AttributePathParams attributePathParams;
+    attributePathParams.mEndpointId  = kTestEndpointId;
+    attributePathParams.mClusterId   = kTestClusterId;
+    attributePathParams.mAttributeId = 1;
+
+    ReadPrepareParams readPrepareParams(ctx.GetSessionBobToAlice());
+    readPrepareParams.mpAttributePathParamsList    = &attributePathParams;
+    readPrepareParams.mAttributePathParamsListSize = 1;
+
+    // A read handler goes back to the pool once its report is acknowledged
+    {
+        app::ReadClient readClient(chip::app::InteractionModelEngine::GetInstance(), &ctx.GetExchangeManager(), delegate,
+                                   chip::app::ReadClient::InteractionType::Read);
+
+        err = readClient.SendRequest(readPrepareParams);
+        NL_TEST_ASSERT(apSuite, err == CHIP_NO_ERROR);
+        NL_TEST_ASSERT(apSuite, engine->GetNumActiveReadHandlers() == 1);
+
+        engine->GetReportingEngine().Run();
+        NL_TEST_ASSERT(apSuite, delegate.mNumAttributeResponse == 1);
+        NL_TEST_ASSERT(apSuite, engine->GetNumActiveReadHandlers() == 0);
+    }
+
+    readPrepareParams.mMinIntervalFloorSeconds   = 2;
+    readPrepareParams.mMaxIntervalCeilingSeconds = 5;
+    readPrepareParams.mKeepSubscriptions         = true;
+
+    app::ReadClient subscribeClient1(chip::app::InteractionModelEngine::GetInstance(), &ctx.GetExchangeManager(), delegate,
+                                     chip::app::ReadClient::InteractionType::Subscribe);
+    app::ReadClient subscribeClient2(chip::app::InteractionModelEngine::GetInstance(), &ctx.GetExchangeManager(), delegate,
+                                     chip::app::ReadClient::InteractionType::Subscribe);
+
+    err = subscribeClient1.SendRequest(readPrepareParams);
+    NL_TEST_ASSERT(apSuite, err == CHIP_NO_ERROR);
+    err = subscribeClient2.SendRequest(readPrepareParams);
+    NL_TEST_ASSERT(apSuite, err == CHIP_NO_ERROR);
+
+    engine->GetReportingEngine().Run();
+    NL_TEST_ASSERT(apSuite, delegate.mNumSubscriptions == 2);
+    NL_TEST_ASSERT(apSuite, engine->GetNumActiveReadHandlers() == 2);
+
+    // Shutting the engine down shuts each subscription down from within ForEachActiveObject, and each handler releases
+    // itself to the pool from there
+    NL_TEST_ASSERT(apSuite, rm->TestGetCountRetransTable() == 0);
+    engine->Shutdown();
+    NL_TEST_ASSERT(apSuite, delegate.mNumSubscriptions == 0);
+    NL_TEST_ASSERT(apSuite, engine->GetNumActiveReadHandlers() == 0);
+}
+
 } // namespace app
 } // namespace chip
 
@@ -1455,6 +1656,9 @@ const nlTest sTests[] =
     NL_TEST_DEF("TestReadInvalidAttributePathRoundtrip", chip::app::TestReadInteraction::TestReadInvalidAttributePathRoundtrip),
     NL_TEST_DEF("TestSubscribeInvalidIterval", chip::app::TestReadInteraction::TestSubscribeInvalidIterval),
     NL_TEST_DEF("TestReadShutdown", chip::app::TestReadInteraction::TestReadShutdown),
+    NL_TEST_DEF("TestReadTooManyPaths", chip::app::TestReadInteraction::TestReadTooManyPaths),
+    NL_TEST_DEF("TestSubscribeFabricQuota", chip::app::TestReadInteraction::TestSubscribeFabricQuota),
+    NL_TEST_DEF("TestReadHandlerRelease", chip::app::TestReadInteraction::TestReadHandlerRelease),
     NL_TEST_SENTINEL()
 };
 // clang-format on
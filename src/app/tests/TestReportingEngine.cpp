@@ -52,6 +52,8 @@ class TestReportingEngine
 {
 public:
     static void TestBuildAndSendSingleReportData(nlTestSuite * apSuite, void * apContext);
+    static void TestScheduleReport(nlTestSuite * apSuite, void * apContext);
+    static void TestSetDirtyIfVersionChanged(nlTestSuite * apSuite, void * apContext);
 };
 
 class TestExchangeDelegate : public Messaging::ExchangeDelegate
@@ -107,6 +109,70 @@ void TestReportingEngine::TestBuildAndSendSingleReportData(nlTestSuite * apSuite
     NL_TEST_ASSERT(apSuite, err == CHIP_ERROR_NOT_CONNECTED);
 }
 
+void TestReportingEngine::TestScheduleReport(nlTestSuite * apSuite, void * apContext)
+{
+    Engine engine;
+    app::ReadHandler readHandler1;
+    app::ReadHandler readHandler2;
+    app::ReadHandler readHandler3;
+
+    NL_TEST_ASSERT(apSuite, engine.Init() == CHIP_NO_ERROR);
+
+    engine.ScheduleReport(readHandler1);
+    engine.ScheduleReport(readHandler2);
+    engine.ScheduleReport(readHandler3);
+    // A handler already queued keeps its position
+    engine.ScheduleReport(readHandler1);
+    NL_TEST_ASSERT(apSuite, engine.mNumScheduledReports == 3);
+    NL_TEST_ASSERT(apSuite, engine.GetMetrics().mNumReportsScheduled == 3);
+
+    engine.UnscheduleReport(readHandler2);
+    engine.UnscheduleReport(readHandler2);
+    NL_TEST_ASSERT(apSuite, engine.mNumScheduledReports == 2);
+    NL_TEST_ASSERT(apSuite, engine.PopScheduledReport() == &readHandler1);
+    NL_TEST_ASSERT(apSuite, engine.PopScheduledReport() == &readHandler3);
+    NL_TEST_ASSERT(apSuite, engine.PopScheduledReport() == nullptr);
+    NL_TEST_ASSERT(apSuite, engine.mpScheduledReportsTail == nullptr);
+
+    // Handlers that cannot report anymore are dropped from the queue without sending anything
+    engine.ScheduleReport(readHandler3);
+    engine.ScheduleReport(readHandler1);
+    engine.UnscheduleReport(readHandler1);
+    engine.ScheduleReport(readHandler2);
+    engine.Run();
+    NL_TEST_ASSERT(apSuite, engine.mNumScheduledReports == 0);
+    NL_TEST_ASSERT(apSuite, engine.mpScheduledReportsHead == nullptr);
+    NL_TEST_ASSERT(apSuite, engine.GetMetrics().mNumReportsScheduled == 6);
+    NL_TEST_ASSERT(apSuite, engine.GetMetrics().mNumReportsSent == 0);
+
+    engine.ResetMetrics();
+    NL_TEST_ASSERT(apSuite, engine.GetMetrics().mNumReportsScheduled == 0);
+}
+
+void TestReportingEngine::TestSetDirtyIfVersionChanged(nlTestSuite * apSuite, void * apContext)
+{
+    Engine & engine = InteractionModelEngine::GetInstance()->GetReportingEngine();
+    ClusterInfo clusterInfo;
+    clusterInfo.mEndpointId  = kTestEndpointId;
+    clusterInfo.mClusterId   = kTestClusterId;
+    clusterInfo.mAttributeId = kTestFieldId1;
+
+    DataVersion reportedVersion = 3;
+    engine.ResetMetrics();
+
+    // The version already reported is not reported again
+    NL_TEST_ASSERT(apSuite, !engine.SetDirtyIfVersionChanged(clusterInfo, 3, reportedVersion));
+    NL_TEST_ASSERT(apSuite, reportedVersion == 3);
+    NL_TEST_ASSERT(apSuite, engine.GetMetrics().mNumSuppressedChanges == 1);
+
+    NL_TEST_ASSERT(apSuite, engine.SetDirtyIfVersionChanged(clusterInfo, 4, reportedVersion));
+    NL_TEST_ASSERT(apSuite, reportedVersion == 4);
+    NL_TEST_ASSERT(apSuite, engine.GetMetrics().mNumSuppressedChanges == 1);
+
+    NL_TEST_ASSERT(apSuite, !engine.SetDirtyIfVersionChanged(clusterInfo, 4, reportedVersion));
+    NL_TEST_ASSERT(apSuite, engine.GetMetrics().mNumSuppressedChanges == 2);
+}
+
 } // namespace reporting
 } // namespace app
 } // namespace chip
@@ -116,6 +182,8 @@ namespace {
 const nlTest sTests[] =
 {
     NL_TEST_DEF("CheckBuildAndSendSingleReportData", chip::app::reporting::TestReportingEngine::TestBuildAndSendSingleReportData),
+    NL_TEST_DEF("CheckScheduleReport", chip::app::reporting::TestReportingEngine::TestScheduleReport),
+    NL_TEST_DEF("CheckSetDirtyIfVersionChanged", chip::app::reporting::TestReportingEngine::TestSetDirtyIfVersionChanged),
     NL_TEST_SENTINEL()
 };
 // clang-format on
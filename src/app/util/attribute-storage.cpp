@@ -40,6 +40,7 @@
  ******************************************************************************/
 
 #include "app/util/common.h"
+#include <app/ClusterOverrideRegistry.h>
 #include <app/InteractionModelEngine.h>
 #include <app/reporting/reporting.h>
 #include <app/util/af.h>
@@ -106,7 +107,7 @@ constexpr const EmberAfEndpointType generatedEmberAfEndpointTypes[] = GENERATED_
 #define endpointNetworkIndex(x) fixedNetworks[x]
 #endif
 
-app::AttributeAccessInterface * gAttributeAccessOverrides = nullptr;
+app::ClusterOverrideRegistry<app::AttributeAccessInterface> gAttributeAccessOverrides;
 } // anonymous namespace
 
 //------------------------------------------------------------------------------
@@ -512,6 +513,73 @@ bool emAfMatchAttribute(EmberAfCluster * cluster, EmberAfAttributeMetadata * am,
     return (am->attributeId == attRecord->attributeId);
 }
 
+// Finds the attribute of attRecord and where ember stores its value.  *location is set to NULL when ember does not store
+// the value: the attribute is externally stored or belongs to a dynamic endpoint.
+static EmberAfStatus findAttributeLocation(EmberAfAttributeSearchRecord * attRecord, EmberAfAttributeMetadata ** metadata,
+                                           uint8_t ** location)
+{
+    uint16_t attributeOffsetIndex = 0;
+
+    for (uint8_t ep = 0; ep < emberAfEndpointCount(); ep++)
+    {
+        // Is this a dynamic endpoint?
+        bool isDynamicEndpoint = (ep >= emberAfFixedEndpointCount());
+
+        if (emAfEndpoints[ep].endpoint != attRecord->endpoint)
+        { // Not the endpoint we are looking for
+            // Dynamic endpoints are external and don't factor into storage size
+            if (!isDynamicEndpoint)
+            {
+                attributeOffsetIndex = static_cast<uint16_t>(attributeOffsetIndex + emAfEndpoints[ep].endpointType->endpointSize);
+            }
+            continue;
+        }
+
+        if (!emberAfEndpointIndexIsEnabled(ep))
+        {
+            continue;
+        }
+
+        EmberAfEndpointType * endpointType = emAfEndpoints[ep].endpointType;
+        for (uint8_t clusterIndex = 0; clusterIndex < endpointType->clusterCount; clusterIndex++)
+        {
+            EmberAfCluster * cluster = &(endpointType->cluster[clusterIndex]);
+            if (!emAfMatchCluster(cluster, attRecord))
+            { // Not the cluster we are looking for
+                attributeOffsetIndex = static_cast<uint16_t>(attributeOffsetIndex + cluster->clusterSize);
+                continue;
+            }
+
+            for (uint16_t attrIndex = 0; attrIndex < cluster->attributeCount; attrIndex++)
+            {
+                EmberAfAttributeMetadata * am = &(cluster->attributes[attrIndex]);
+                if (emAfMatchAttribute(cluster, am, attRecord))
+                { // Got the attribute
+                    *metadata = am;
+                    if ((am->mask & ATTRIBUTE_MASK_EXTERNAL_STORAGE) || isDynamicEndpoint)
+                    {
+                        *location = NULL;
+                    }
+                    else
+                    {
+                        *location = (am->mask & ATTRIBUTE_MASK_SINGLETON ? singletonAttributeLocation(am)
+                                                                         : attributeData + attributeOffsetIndex);
+                    }
+                    return EMBER_ZCL_STATUS_SUCCESS;
+                }
+
+                // Not the attribute we are looking for
+                // Increase the index if attribute is not externally stored
+                if (!(am->mask & ATTRIBUTE_MASK_EXTERNAL_STORAGE) && !(am->mask & ATTRIBUTE_MASK_SINGLETON))
+                {
+                    attributeOffsetIndex = static_cast<uint16_t>(attributeOffsetIndex + emberAfAttributeSize(am));
+                }
+            }
+        }
+    }
+    return EMBER_ZCL_STATUS_UNSUPPORTED_ATTRIBUTE; // Sorry, attribute was not found.
+}
+
 // When reading non-string attributes, this function returns an error when destination
 // buffer isn't large enough to accommodate the attribute type.  For strings, the
 // function will copy at most readLength bytes.  This means the resulting string
@@ -528,119 +596,69 @@ bool emAfMatchAttribute(EmberAfCluster * cluster, EmberAfAttributeMetadata * am,
 EmberAfStatus emAfReadOrWriteAttribute(EmberAfAttributeSearchRecord * attRecord, EmberAfAttributeMetadata ** metadata,
                                        uint8_t * buffer, uint16_t readLength, bool write)
 {
-    uint16_t attributeOffsetIndex = 0;
+    EmberAfAttributeMetadata * am;
+    uint8_t * attributeLocation;
+    EmberAfStatus status = findAttributeLocation(attRecord, &am, &attributeLocation);
+    if (status != EMBER_ZCL_STATUS_SUCCESS)
+    {
+        return status;
+    }
 
-    for (uint8_t ep = 0; ep < emberAfEndpointCount(); ep++)
+    // If passed metadata location is not null, populate
+    if (metadata != NULL)
     {
-        // Is this a dynamic endpoint?
-        bool isDynamicEndpoint = (ep >= emberAfFixedEndpointCount());
+        *metadata = am;
+    }
 
-        if (emAfEndpoints[ep].endpoint == attRecord->endpoint)
+    uint8_t *src, *dst;
+    if (write)
+    {
+        src = buffer;
+        dst = attributeLocation;
+        if (!emberAfAttributeWriteAccessCallback(attRecord->endpoint, attRecord->clusterId, EMBER_AF_NULL_MANUFACTURER_CODE,
+                                                 am->attributeId))
         {
-            EmberAfEndpointType * endpointType = emAfEndpoints[ep].endpointType;
-            uint8_t clusterIndex;
-            if (!emberAfEndpointIndexIsEnabled(ep))
-            {
-                continue;
-            }
-            for (clusterIndex = 0; clusterIndex < endpointType->clusterCount; clusterIndex++)
-            {
-                EmberAfCluster * cluster = &(endpointType->cluster[clusterIndex]);
-                if (emAfMatchCluster(cluster, attRecord))
-                { // Got the cluster
-                    uint16_t attrIndex;
-                    for (attrIndex = 0; attrIndex < cluster->attributeCount; attrIndex++)
-                    {
-                        EmberAfAttributeMetadata * am = &(cluster->attributes[attrIndex]);
-                        if (emAfMatchAttribute(cluster, am, attRecord))
-                        { // Got the attribute
-                            // If passed metadata location is not null, populate
-                            if (metadata != NULL)
-                            {
-                                *metadata = am;
-                            }
-
-                            {
-                                uint8_t * attributeLocation =
-                                    (am->mask & ATTRIBUTE_MASK_SINGLETON ? singletonAttributeLocation(am)
-                                                                         : attributeData + attributeOffsetIndex);
-                                uint8_t *src, *dst;
-                                if (write)
-                                {
-                                    src = buffer;
-                                    dst = attributeLocation;
-                                    if (!emberAfAttributeWriteAccessCallback(attRecord->endpoint, attRecord->clusterId,
-                                                                             EMBER_AF_NULL_MANUFACTURER_CODE, am->attributeId))
-                                    {
-                                        return EMBER_ZCL_STATUS_NOT_AUTHORIZED;
-                                    }
-                                }
-                                else
-                                {
-                                    if (buffer == NULL)
-                                    {
-                                        return EMBER_ZCL_STATUS_SUCCESS;
-                                    }
-
-                                    src = attributeLocation;
-                                    dst = buffer;
-                                    if (!emberAfAttributeReadAccessCallback(attRecord->endpoint, attRecord->clusterId,
-                                                                            EMBER_AF_NULL_MANUFACTURER_CODE, am->attributeId))
-                                    {
-                                        return EMBER_ZCL_STATUS_NOT_AUTHORIZED;
-                                    }
-                                }
-
-                                // Is the attribute externally stored?
-                                if (am->mask & ATTRIBUTE_MASK_EXTERNAL_STORAGE)
-                                {
-                                    return (write
-                                                ? emberAfExternalAttributeWriteCallback(attRecord->endpoint, attRecord->clusterId,
-                                                                                        am, EMBER_AF_NULL_MANUFACTURER_CODE, buffer)
-                                                : emberAfExternalAttributeReadCallback(attRecord->endpoint, attRecord->clusterId,
-                                                                                       am, EMBER_AF_NULL_MANUFACTURER_CODE, buffer,
-                                                                                       emberAfAttributeSize(am)));
-                                }
-                                else
-                                {
-                                    // Internal storage is only supported for fixed endpoints
-                                    if (!isDynamicEndpoint)
-                                    {
-                                        return typeSensitiveMemCopy(attRecord->clusterId, dst, src, am, write, readLength);
-                                    }
-                                    else
-                                    {
-                                        return EMBER_ZCL_STATUS_FAILURE;
-                                    }
-                                }
-                            }
-                        }
-                        else
-                        { // Not the attribute we are looking for
-                            // Increase the index if attribute is not externally stored
-                            if (!(am->mask & ATTRIBUTE_MASK_EXTERNAL_STORAGE) && !(am->mask & ATTRIBUTE_MASK_SINGLETON))
-                            {
-                                attributeOffsetIndex = static_cast<uint16_t>(attributeOffsetIndex + emberAfAttributeSize(am));
-                            }
-                        }
-                    }
-                }
-                else
-                { // Not the cluster we are looking for
-                    attributeOffsetIndex = static_cast<uint16_t>(attributeOffsetIndex + cluster->clusterSize);
-                }
-            }
+            return EMBER_ZCL_STATUS_NOT_AUTHORIZED;
         }
-        else
-        { // Not the endpoint we are looking for
-            // Dynamic endpoints are external and don't factor into storage size
-            if (!isDynamicEndpoint)
-            {
-                attributeOffsetIndex = static_cast<uint16_t>(attributeOffsetIndex + emAfEndpoints[ep].endpointType->endpointSize);
-            }
+    }
+    else
+    {
+        if (buffer == NULL)
+        {
+            return EMBER_ZCL_STATUS_SUCCESS;
+        }
+
+        src = attributeLocation;
+        dst = buffer;
+        if (!emberAfAttributeReadAccessCallback(attRecord->endpoint, attRecord->clusterId, EMBER_AF_NULL_MANUFACTURER_CODE,
+                                                am->attributeId))
+        {
+            return EMBER_ZCL_STATUS_NOT_AUTHORIZED;
         }
     }
-    return EMBER_ZCL_STATUS_UNSUPPORTED_ATTRIBUTE; // Sorry, attribute was not found.
+
+    // Is the attribute externally stored?
+    if (am->mask & ATTRIBUTE_MASK_EXTERNAL_STORAGE)
+    {
+        return (write ? emberAfExternalAttributeWriteCallback(attRecord->endpoint, attRecord->clusterId, am,
+                                                              EMBER_AF_NULL_MANUFACTURER_CODE, buffer)
+                      : emberAfExternalAttributeReadCallback(attRecord->endpoint, attRecord->clusterId, am,
+                                                             EMBER_AF_NULL_MANUFACTURER_CODE, buffer, emberAfAttributeSize(am)));
+    }
+
+    // Internal storage is only supported for fixed endpoints
+    if (attributeLocation == NULL)
+    {
+        return EMBER_ZCL_STATUS_FAILURE;
+    }
+    return typeSensitiveMemCopy(attRecord->clusterId, dst, src, am, write, readLength);
+}
+
+const uint8_t * emAfGetAttributeStorageLocation(EmberAfAttributeSearchRecord * attRecord)
+{
+    EmberAfAttributeMetadata * am;
+    uint8_t * attributeLocation;
+    return (findAttributeLocation(attRecord, &am, &attributeLocation) == EMBER_ZCL_STATUS_SUCCESS) ? attributeLocation : NULL;
 }
 
 EmberAfCluster * emberAfFindClusterInTypeWithMfgCode(EmberAfEndpointType * endpointType, ClusterId clusterId,
@@ -985,33 +1003,7 @@ bool emberAfEndpointEnableDisable(EndpointId endpoint, bool enable)
 
             // Clear out any attribute access overrides registered for this
             // endpoint.
-            app::AttributeAccessInterface * prev = nullptr;
-            app::AttributeAccessInterface * cur  = gAttributeAccessOverrides;
-            while (cur)
-            {
-                app::AttributeAccessInterface * next = cur->GetNext();
-                if (cur->MatchesEndpoint(endpoint))
-                {
-                    // Remove it from the list
-                    if (prev)
-                    {
-                        prev->SetNext(next);
-                    }
-                    else
-                    {
-                        gAttributeAccessOverrides = next;
-                    }
-
-                    cur->SetNext(nullptr);
-
-                    // Do not change prev in this case.
-                }
-                else
-                {
-                    prev = cur;
-                }
-                cur = next;
-            }
+            gAttributeAccessOverrides.UnregisterEndpoint(endpoint);
         }
 
         // TODO: We should notify about the fact that all the attributes for
@@ -1361,30 +1353,17 @@ EmberAfGenericClusterFunction emberAfFindClusterFunction(EmberAfCluster * cluste
 
 bool registerAttributeAccessOverride(app::AttributeAccessInterface * attrOverride)
 {
-    for (auto * cur = gAttributeAccessOverrides; cur; cur = cur->GetNext())
+    if (!gAttributeAccessOverrides.Register(attrOverride))
     {
-        if (cur->Matches(*attrOverride))
-        {
-            ChipLogError(Zcl, "Duplicate attribute override registration failed");
-            return false;
-        }
+        ChipLogError(Zcl, "Duplicate attribute override registration failed");
+        return false;
     }
-    attrOverride->SetNext(gAttributeAccessOverrides);
-    gAttributeAccessOverrides = attrOverride;
     return true;
 }
 
 app::AttributeAccessInterface * findAttributeAccessOverride(EndpointId endpointId, ClusterId clusterId)
 {
-    for (app::AttributeAccessInterface * cur = gAttributeAccessOverrides; cur; cur = cur->GetNext())
-    {
-        if (cur->Matches(endpointId, clusterId))
-        {
-            return cur;
-        }
-    }
-
-    return nullptr;
+    return gAttributeAccessOverrides.Find(endpointId, clusterId);
 }
 
 uint16_t emberAfGetServerAttributeCount(chip::EndpointId endpoint, chip::ClusterId cluster)
@@ -124,6 +124,10 @@ void emberAfEndpointConfigure(void);
 EmberAfStatus emAfReadOrWriteAttribute(EmberAfAttributeSearchRecord * attRecord, EmberAfAttributeMetadata ** metadata,
                                        uint8_t * buffer, uint16_t readLength, bool write);
 
+// Returns where ember stores the value of the attribute found by attRecord, or NULL if it is not stored by ember: the
+// attribute is unknown, externally stored or on a dynamic endpoint.
+const uint8_t * emAfGetAttributeStorageLocation(EmberAfAttributeSearchRecord * attRecord);
+
 bool emAfMatchCluster(EmberAfCluster * cluster, EmberAfAttributeSearchRecord * attRecord);
 bool emAfMatchAttribute(EmberAfCluster * cluster, EmberAfAttributeMetadata * am, EmberAfAttributeSearchRecord * attRecord);
 
@@ -44,6 +44,7 @@
 // this file contains all the common includes for clusters in the zcl-util
 
 #include <app/util/attribute-storage.h>
+#include <app/util/attribute-value-compare.h>
 
 // for pulling in defines dealing with EITHER server or client
 #include "app/util/common.h"
@@ -642,6 +643,14 @@ EmberAfStatus emAfWriteAttribute(EndpointId endpoint, ClusterId cluster, Attribu
             return status;
         }
 
+#if CHIP_IM_SUPPRESS_UNCHANGED_ATTRIBUTE_REPORTS
+        // External attributes have no storage location, the application reports their changes itself
+        bool valueChanged = !app::IsStoredAttributeValueUnchanged(metadata->attributeType, emberAfAttributeSize(metadata),
+                                                                   emAfGetAttributeStorageLocation(&record), data);
+#else
+        bool valueChanged = true;
+#endif // CHIP_IM_SUPPRESS_UNCHANGED_ATTRIBUTE_REPORTS
+
         // write the attribute
         status = emAfReadOrWriteAttribute(&record,
                                           NULL, // metadata
@@ -654,11 +663,18 @@ EmberAfStatus emAfWriteAttribute(EndpointId endpoint, ClusterId cluster, Attribu
             return status;
         }
 
-        // Save the attribute to persistent storage if needed
-        // The callee will weed out attributes that do not need to be stored.
-        emAfSaveAttributeToStorageIfNeeded(data, endpoint, cluster, metadata);
+        if (valueChanged)
+        {
+            // Save the attribute to persistent storage if needed
+            // The callee will weed out attributes that do not need to be stored.
+            emAfSaveAttributeToStorageIfNeeded(data, endpoint, cluster, metadata);
 
-        MatterReportingAttributeChangeCallback(endpoint, cluster, attributeID, mask, manufacturerCode, dataType, data);
+            MatterReportingAttributeChangeCallback(endpoint, cluster, attributeID, mask, manufacturerCode, dataType, data);
+        }
+        else
+        {
+            MatterReportingAttributeUnchangedCallback(attributePath);
+        }
 
         // Post write attribute callback for all attributes changes, regardless
         // of cluster.
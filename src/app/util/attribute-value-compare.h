@@ -0,0 +1,81 @@
+/*
+ *
+ *    Copyright (c) 2021 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#pragma once
+
+#include <app-common/zap-generated/attribute-type.h>
+#include <lib/core/CHIPEncoding.h>
+
+#include <algorithm>
+#include <string.h>
+
+namespace chip {
+namespace app {
+
+/**
+ * Returns whether writing data to an attribute of the given type and size would leave the value ember stores for it at
+ * storedValue unchanged, comparing in place.
+ *
+ * Strings are compared as ember would store them, after truncation to the size of the attribute. Attributes that ember does
+ * not store, for which storedValue is null, and list attributes, of which only the length is stored, always compare as
+ * changed.
+ */
+inline bool IsStoredAttributeValueUnchanged(uint8_t attributeType, uint16_t size, const uint8_t * storedValue,
+                                            const uint8_t * data)
+{
+    if (storedValue == nullptr || data == nullptr)
+    {
+        return false;
+    }
+
+    switch (attributeType)
+    {
+    case ZCL_OCTET_STRING_ATTRIBUTE_TYPE:
+    case ZCL_CHAR_STRING_ATTRIBUTE_TYPE: {
+        // A length of 0xFF is a null string, without character data
+        if (size < 1 || data[0] == 0xFF || storedValue[0] == 0xFF)
+        {
+            return size >= 1 && data[0] == storedValue[0];
+        }
+        const size_t length = std::min<size_t>(data[0], size - 1u);
+        return storedValue[0] == length && memcmp(storedValue + 1, data + 1, length) == 0;
+    }
+    case ZCL_LONG_OCTET_STRING_ATTRIBUTE_TYPE:
+    case ZCL_LONG_CHAR_STRING_ATTRIBUTE_TYPE: {
+        if (size < 2)
+        {
+            return false;
+        }
+        const uint16_t newLength    = Encoding::LittleEndian::Get16(data);
+        const uint16_t storedLength = Encoding::LittleEndian::Get16(storedValue);
+        // A length of 0xFFFF is a null string, without character data
+        if (newLength == 0xFFFF || storedLength == 0xFFFF)
+        {
+            return newLength == storedLength;
+        }
+        const size_t length = std::min<size_t>(newLength, size - 2u);
+        return storedLength == length && memcmp(storedValue + 2, data + 2, length) == 0;
+    }
+    case ZCL_ARRAY_ATTRIBUTE_TYPE:
+        return false;
+    default:
+        return memcmp(storedValue, data, size) == 0;
+    }
+}
+
+} // namespace app
+} // namespace chip
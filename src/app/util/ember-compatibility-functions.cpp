@@ -31,6 +31,7 @@
 #include <app/util/attribute-storage-null-handling.h>
 #include <app/util/attribute-storage.h>
 #include <app/util/attribute-table.h>
+#include <app/util/MatterCallbacks.h>
 #include <app/util/ember-compatibility-functions.h>
 #include <app/util/error-mapping.h>
 #include <app/util/odd-sized-integers.h>
@@ -358,11 +359,30 @@ CHIP_ERROR ReadViaAccessInterface(FabricIndex aAccessingFabricIndex, const Concr
     return CHIP_NO_ERROR;
 }
 
-} // anonymous namespace
+// Finds the metadata for aAttributeId in an already-resolved cluster, without walking the endpoint table again.
+EmberAfAttributeMetadata * FindAttributeMetadata(EmberAfCluster * aCluster, AttributeId aAttributeId)
+{
+    if (aCluster == nullptr)
+    {
+        return nullptr;
+    }
 
-CHIP_ERROR ReadSingleClusterData(const SubjectDescriptor & aSubjectDescriptor, const ConcreteReadAttributePath & aPath,
-                                 AttributeReportIBs::Builder & aAttributeReports,
-                                 AttributeValueEncoder::AttributeEncodeState * apEncoderState)
+    for (uint16_t i = 0; i < aCluster->attributeCount; ++i)
+    {
+        if (aCluster->attributes[i].attributeId == aAttributeId)
+        {
+            return &aCluster->attributes[i];
+        }
+    }
+    return nullptr;
+}
+
+// Reads a single attribute of a cluster whose ember metadata and AttributeAccessInterface override have already been resolved
+// by the caller.  aCluster is null if the server does not have the cluster on the endpoint.
+CHIP_ERROR ReadClusterAttribute(const SubjectDescriptor & aSubjectDescriptor, EmberAfCluster * aCluster,
+                                AttributeAccessInterface * aAttributeOverride, const ConcreteReadAttributePath & aPath,
+                                AttributeReportIBs::Builder & aAttributeReports,
+                                AttributeValueEncoder::AttributeEncodeState * apEncoderState)
 {
     ChipLogDetail(DataManagement,
                   "Reading attribute: Cluster=" ChipLogFormatMEI " Endpoint=%" PRIx16 " AttributeId=" ChipLogFormatMEI
@@ -373,10 +393,9 @@ CHIP_ERROR ReadSingleClusterData(const SubjectDescriptor & aSubjectDescriptor, c
     {
         // This is not in our attribute metadata, so we just check for this
         // endpoint+cluster existing.
-        EmberAfCluster * cluster = emberAfFindCluster(aPath.mEndpointId, aPath.mClusterId, CLUSTER_MASK_SERVER);
-        if (cluster)
+        if (aCluster)
         {
-            AttributeListReader reader(cluster);
+            AttributeListReader reader(aCluster);
             bool ignored; // Our reader always tries to encode
             return ReadViaAccessInterface(aSubjectDescriptor.fabricIndex, aPath, aAttributeReports, apEncoderState, &reader,
                                           &ignored);
@@ -386,8 +405,7 @@ CHIP_ERROR ReadSingleClusterData(const SubjectDescriptor & aSubjectDescriptor, c
         // (which we know will fail and error out);
     }
 
-    EmberAfAttributeMetadata * attributeMetadata =
-        emberAfLocateAttributeMetadata(aPath.mEndpointId, aPath.mClusterId, aPath.mAttributeId, CLUSTER_MASK_SERVER, 0);
+    EmberAfAttributeMetadata * attributeMetadata = FindAttributeMetadata(aCluster, aPath.mAttributeId);
 
     if (attributeMetadata == nullptr)
     {
@@ -421,11 +439,11 @@ CHIP_ERROR ReadSingleClusterData(const SubjectDescriptor & aSubjectDescriptor, c
 
     // Value encoder will encode the whole AttributeReport, including the path, value and the version.
     // The AttributeValueEncoder may encode more than one AttributeReportIB for the list chunking feature.
-    if (auto * attrOverride = findAttributeAccessOverride(aPath.mEndpointId, aPath.mClusterId))
+    if (aAttributeOverride != nullptr)
     {
         bool triedEncode;
         ReturnErrorOnFailure(ReadViaAccessInterface(aSubjectDescriptor.fabricIndex, aPath, aAttributeReports, apEncoderState,
-                                                    attrOverride, &triedEncode));
+                                                    aAttributeOverride, &triedEncode));
 
         if (triedEncode)
         {
@@ -689,6 +707,37 @@ CHIP_ERROR ReadSingleClusterData(const SubjectDescriptor & aSubjectDescriptor, c
     return SendFailureStatus(aPath, attributeReport, imStatus, &backup);
 }
 
+} // anonymous namespace
+
+CHIP_ERROR ReadSingleClusterData(const SubjectDescriptor & aSubjectDescriptor, const ConcreteReadAttributePath & aPath,
+                                 AttributeReportIBs::Builder & aAttributeReports,
+                                 AttributeValueEncoder::AttributeEncodeState * apEncoderState)
+{
+    return ReadClusterAttribute(aSubjectDescriptor, emberAfFindCluster(aPath.mEndpointId, aPath.mClusterId, CLUSTER_MASK_SERVER),
+                                findAttributeAccessOverride(aPath.mEndpointId, aPath.mClusterId), aPath, aAttributeReports,
+                                apEncoderState);
+}
+
+CHIP_ERROR ReadClusterData(const SubjectDescriptor & aSubjectDescriptor,
+                           const Span<const ConcreteReadAttributePath> & aPaths, AttributeReportIBs::Builder & aAttributeReports,
+                           AttributeValueEncoder::AttributeEncodeState * apEncoderState, size_t & aNumPathsRead)
+{
+    aNumPathsRead = 0;
+    VerifyOrReturnError(!aPaths.empty(), CHIP_NO_ERROR);
+
+    const EndpointId endpointId = aPaths.data()[0].mEndpointId;
+    const ClusterId clusterId   = aPaths.data()[0].mClusterId;
+
+    // Resolve the cluster metadata and the access interface override once for the whole batch.
+    EmberAfCluster * cluster                     = emberAfFindCluster(endpointId, clusterId, CLUSTER_MASK_SERVER);
+    AttributeAccessInterface * attributeOverride = findAttributeAccessOverride(endpointId, clusterId);
+
+    return ReadClusterPaths(aPaths, aAttributeReports, apEncoderState, aNumPathsRead, [&](const ConcreteReadAttributePath & path) {
+        VerifyOrReturnError(path.mEndpointId == endpointId && path.mClusterId == clusterId, CHIP_ERROR_INVALID_ARGUMENT);
+        return ReadClusterAttribute(aSubjectDescriptor, cluster, attributeOverride, path, aAttributeReports, apEncoderState);
+    });
+}
+
 namespace {
 
 template <typename T>
@@ -931,3 +980,25 @@ void MatterReportingAttributeChangeCallback(const ConcreteAttributePath & aPath)
 {
     return MatterReportingAttributeChangeCallback(aPath.mEndpointId, aPath.mClusterId, aPath.mAttributeId);
 }
+
+void MatterReportingAttributeChangeCallback(const ConcreteAttributePath & aPath, DataVersion aVersion,
+                                            DataVersion & aReportedVersion)
+{
+    ClusterInfo info;
+    info.mClusterId   = aPath.mClusterId;
+    info.mAttributeId = aPath.mAttributeId;
+    info.mEndpointId  = aPath.mEndpointId;
+
+    reporting::Engine & engine = InteractionModelEngine::GetInstance()->GetReportingEngine();
+    if (engine.SetDirtyIfVersionChanged(info, aVersion, aReportedVersion))
+    {
+        engine.ScheduleRun();
+    }
+}
+
+void MatterReportingAttributeUnchangedCallback(const ConcreteAttributePath & aPath)
+{
+    IgnoreUnusedVariable(aPath);
+
+    InteractionModelEngine::GetInstance()->GetReportingEngine().OnAttributeChangeSuppressed();
+}
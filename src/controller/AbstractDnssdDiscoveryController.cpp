@@ -20,44 +20,155 @@
 #include <controller/AbstractDnssdDiscoveryController.h>
 
 #include <lib/core/CHIPEncoding.h>
+#include <lib/support/CHIPMemString.h>
+#include <lib/support/CodeUtils.h>
 #include <lib/support/logging/CHIPLogging.h>
 
 namespace chip {
 namespace Controller {
 
-void AbstractDnssdDiscoveryController::OnNodeDiscoveryComplete(const chip::Dnssd::DiscoveredNodeData & nodeData)
+bool AbstractDnssdDiscoveryController::ActiveDiscovery::Matches(const Dnssd::DiscoveredNodeData & nodeData) const
 {
-    auto discoveredNodes = GetDiscoveredNodes();
-    for (auto & discoveredNode : discoveredNodes)
+    switch (type)
     {
-        if (!discoveredNode.IsValid())
+    case Dnssd::DiscoveryFilterType::kShortDiscriminator:
+        return ((nodeData.longDiscriminator >> 8) & 0x0F) == code;
+    case Dnssd::DiscoveryFilterType::kLongDiscriminator:
+        return nodeData.longDiscriminator == code;
+    case Dnssd::DiscoveryFilterType::kVendorId:
+        return nodeData.vendorId == code;
+    case Dnssd::DiscoveryFilterType::kDeviceType:
+        return nodeData.deviceType == code;
+    case Dnssd::DiscoveryFilterType::kCommissioningMode:
+        return nodeData.commissioningMode != 0;
+    case Dnssd::DiscoveryFilterType::kInstanceName:
+        return nodeData.IsInstanceName(instanceName);
+    case Dnssd::DiscoveryFilterType::kNone:
+    case Dnssd::DiscoveryFilterType::kCommissioner:
+    case Dnssd::DiscoveryFilterType::kCompressedFabricId:
+    default:
+        // Nothing in the TXT record to check against, the browsed service type already did the filtering.
+        return true;
+    }
+}
+
+bool AbstractDnssdDiscoveryController::IsSameNode(const Dnssd::DiscoveredNodeData & a, const Dnssd::DiscoveredNodeData & b)
+{
+    // A device may advertise from several hosts (or change host) but keeps its instance name; only records that somehow
+    // lack one are matched by host name.
+    if (!a.IsInstanceName("") && !b.IsInstanceName(""))
+    {
+        return a.IsInstanceName(b.instanceName);
+    }
+    return strcmp(a.hostName, b.hostName) == 0;
+}
+
+bool AbstractDnssdDiscoveryController::HasActiveDiscoveries() const
+{
+    for (const auto & discovery : mDiscoveries)
+    {
+        if (discovery.inUse)
         {
-            continue;
+            return true;
         }
-        if (strcmp(discoveredNode.hostName, nodeData.hostName) == 0)
+    }
+    return false;
+}
+
+AbstractDnssdDiscoveryController::DiscoveryMask
+AbstractDnssdDiscoveryController::MatchingDiscoveries(const Dnssd::DiscoveredNodeData & nodeData) const
+{
+    DiscoveryMask mask = 0;
+    for (size_t i = 0; i < kMaxDiscoveryFilters; ++i)
+    {
+        if (mDiscoveries[i].inUse && mDiscoveries[i].Matches(nodeData))
         {
-            discoveredNode = nodeData;
-            if (mDeviceDiscoveryDelegate != nullptr)
-            {
-                mDeviceDiscoveryDelegate->OnDiscoveredDevice(nodeData);
-            }
-            return;
+            mask |= static_cast<DiscoveryMask>(1u << i);
         }
     }
-    // Node not yet in the list
-    for (auto & discoveredNode : discoveredNodes)
+    return mask;
+}
+
+int AbstractDnssdDiscoveryController::FindSlotForNode(DiscoveredNodeList & discoveredNodes,
+                                                      const Dnssd::DiscoveredNodeData & nodeData) const
+{
+    int freeSlot  = -1;
+    int staleSlot = -1;
+    for (int i = 0; i < CHIP_DEVICE_CONFIG_MAX_DISCOVERED_NODES; ++i)
     {
+        const Dnssd::DiscoveredNodeData & discoveredNode = discoveredNodes.data()[i];
         if (!discoveredNode.IsValid())
         {
-            discoveredNode = nodeData;
-            if (mDeviceDiscoveryDelegate != nullptr)
+            if (freeSlot < 0)
             {
-                mDeviceDiscoveryDelegate->OnDiscoveredDevice(nodeData);
+                freeSlot = i;
             }
-            return;
+            continue;
+        }
+
+        if (IsSameNode(discoveredNode, nodeData))
+        {
+            return i;
+        }
+
+        if (staleSlot < 0 && mNodeDiscoveries[i] == 0)
+        {
+            staleSlot = i;
+        }
+    }
+
+    if (freeSlot >= 0)
+    {
+        return freeSlot;
+    }
+
+    // Out of space: reuse the entry of a node that no discovery in flight is interested in anymore.
+    return HasActiveDiscoveries() ? staleSlot : -1;
+}
+
+void AbstractDnssdDiscoveryController::OnNodeDiscoveryComplete(const chip::Dnssd::DiscoveredNodeData & nodeData)
+{
+    const DiscoveryMask matching = MatchingDiscoveries(nodeData);
+    if (matching == 0 && HasActiveDiscoveries())
+    {
+        ChipLogDetail(Discovery, "Ignoring discovered node with hostname %s - No matching discovery", nodeData.hostName);
+        return;
+    }
+
+    auto discoveredNodes = GetDiscoveredNodes();
+    int slot             = FindSlotForNode(discoveredNodes, nodeData);
+    if (slot < 0)
+    {
+        ChipLogError(Discovery, "Failed to add discovered node with hostname %s- Insufficient space", nodeData.hostName);
+        return;
+    }
+
+    discoveredNodes.data()[slot] = nodeData;
+    mNodeDiscoveries[slot]       = matching;
+
+    if (mDeviceDiscoveryDelegate != nullptr)
+    {
+        mDeviceDiscoveryDelegate->OnDiscoveredDevice(nodeData);
+    }
+
+    for (size_t i = 0; i < kMaxDiscoveryFilters; ++i)
+    {
+        // A delegate shared by several discoveries is only told once about each record.
+        DeviceDiscoveryDelegate * delegate = mDiscoveries[i].delegate;
+        if ((matching & (1u << i)) == 0 || delegate == nullptr || delegate == mDeviceDiscoveryDelegate)
+        {
+            continue;
+        }
+        bool alreadyNotified = false;
+        for (size_t j = 0; j < i; ++j)
+        {
+            alreadyNotified = alreadyNotified || ((matching & (1u << j)) != 0 && mDiscoveries[j].delegate == delegate);
+        }
+        if (!alreadyNotified)
+        {
+            delegate->OnDiscoveredDevice(nodeData);
         }
     }
-    ChipLogError(Discovery, "Failed to add discovered node with hostname %s- Insufficient space", nodeData.hostName);
 }
 
 CHIP_ERROR AbstractDnssdDiscoveryController::SetUpNodeDiscovery()
@@ -67,9 +178,77 @@ CHIP_ERROR AbstractDnssdDiscoveryController::SetUpNodeDiscovery()
     {
         discoveredNode.Reset();
     }
+    for (auto & discoveryMask : mNodeDiscoveries)
+    {
+        discoveryMask = 0;
+    }
+    for (auto & discovery : mDiscoveries)
+    {
+        discovery = ActiveDiscovery();
+    }
     return CHIP_NO_ERROR;
 }
 
+CHIP_ERROR AbstractDnssdDiscoveryController::AddDiscoveryFilter(const Dnssd::DiscoveryFilter & filter,
+                                                                DeviceDiscoveryDelegate * delegate, DiscoveryId & discoveryId)
+{
+    VerifyOrReturnError(filter.type != Dnssd::DiscoveryFilterType::kInstanceName || filter.instanceName != nullptr,
+                        CHIP_ERROR_INVALID_ARGUMENT);
+
+    for (size_t i = 0; i < kMaxDiscoveryFilters; ++i)
+    {
+        ActiveDiscovery & discovery = mDiscoveries[i];
+        if (discovery.inUse)
+        {
+            continue;
+        }
+
+        discovery          = ActiveDiscovery();
+        discovery.inUse    = true;
+        discovery.type     = filter.type;
+        discovery.delegate = delegate;
+        // The filter constructors leave the member they do not take uninitialized.
+        if (filter.type == Dnssd::DiscoveryFilterType::kInstanceName)
+        {
+            Platform::CopyString(discovery.instanceName, filter.instanceName);
+        }
+        else if (filter.type != Dnssd::DiscoveryFilterType::kNone && filter.type != Dnssd::DiscoveryFilterType::kCommissioningMode)
+        {
+            discovery.code = filter.code;
+        }
+
+        // Nodes found earlier by other discoveries are part of this one's results too.
+        auto discoveredNodes = GetDiscoveredNodes();
+        for (size_t j = 0; j < CHIP_DEVICE_CONFIG_MAX_DISCOVERED_NODES; ++j)
+        {
+            if (discoveredNodes.data()[j].IsValid() && discovery.Matches(discoveredNodes.data()[j]))
+            {
+                mNodeDiscoveries[j] |= static_cast<DiscoveryMask>(1u << i);
+            }
+        }
+
+        discoveryId = static_cast<DiscoveryId>(i);
+        return CHIP_NO_ERROR;
+    }
+
+    ChipLogError(Discovery, "Failed to add discovery filter - Insufficient space");
+    return CHIP_ERROR_NO_MEMORY;
+}
+
+void AbstractDnssdDiscoveryController::StopDiscovery(DiscoveryId discoveryId)
+{
+    if (discoveryId >= kMaxDiscoveryFilters)
+    {
+        return;
+    }
+
+    mDiscoveries[discoveryId] = ActiveDiscovery();
+    for (auto & discoveryMask : mNodeDiscoveries)
+    {
+        discoveryMask &= static_cast<DiscoveryMask>(~(1u << discoveryId));
+    }
+}
+
 const Dnssd::DiscoveredNodeData * AbstractDnssdDiscoveryController::GetDiscoveredNode(int idx)
 {
     // TODO(cecille): Add assertion about main loop.
@@ -81,5 +260,27 @@ const Dnssd::DiscoveredNodeData * AbstractDnssdDiscoveryController::GetDiscovere
     return nullptr;
 }
 
+const Dnssd::DiscoveredNodeData * AbstractDnssdDiscoveryController::GetDiscoveredNode(DiscoveryId discoveryId, int idx)
+{
+    if (discoveryId >= kMaxDiscoveryFilters || !mDiscoveries[discoveryId].inUse || idx < 0)
+    {
+        return nullptr;
+    }
+
+    auto discoveredNodes = GetDiscoveredNodes();
+    for (int i = 0; i < CHIP_DEVICE_CONFIG_MAX_DISCOVERED_NODES; ++i)
+    {
+        if (!discoveredNodes.data()[i].IsValid() || (mNodeDiscoveries[i] & (1u << discoveryId)) == 0)
+        {
+            continue;
+        }
+        if (idx-- == 0)
+        {
+            return discoveredNodes.data() + i;
+        }
+    }
+    return nullptr;
+}
+
 } // namespace Controller
 } // namespace chip
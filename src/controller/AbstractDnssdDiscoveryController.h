@@ -35,22 +35,83 @@ namespace Controller {
  *   handling of received DiscoveredNodeData, etc. while expecting child classes
  *   to maintain a list of DiscoveredNodes and providing the implementation
  *   of the template GetDiscoveredNodes() function.
+ *
+ *   Several discoveries, each with its own filter, can be in flight at the same
+ *   time. Discovered nodes are kept once in the shared list, deduplicated by
+ *   instance name, and each node remembers which discoveries it matched so the
+ *   results of every discovery can be listed separately. Each discovery may
+ *   have its own delegate, which is notified as soon as a matching record
+ *   arrives.
  */
 class DLL_EXPORT AbstractDnssdDiscoveryController : public Dnssd::ResolverDelegate
 {
 public:
+    /// Identifies a discovery started with AddDiscoveryFilter().
+    using DiscoveryId = uint8_t;
+
+    static constexpr DiscoveryId kInvalidDiscoveryId = UINT8_MAX;
+    static constexpr size_t kMaxDiscoveryFilters     = CHIP_DEVICE_CONFIG_MAX_DISCOVERY_FILTERS;
+
     AbstractDnssdDiscoveryController() {}
     virtual ~AbstractDnssdDiscoveryController() {}
 
     void OnNodeDiscoveryComplete(const chip::Dnssd::DiscoveredNodeData & nodeData) override;
 
+    /**
+     * Stop reporting results for the given discovery. The nodes it found stay in the list, and may be replaced by
+     * results of the discoveries that are still in flight once the list is full.
+     */
+    void StopDiscovery(DiscoveryId discoveryId);
+
 protected:
     using DiscoveredNodeList = FixedSpan<Dnssd::DiscoveredNodeData, CHIP_DEVICE_CONFIG_MAX_DISCOVERED_NODES>;
+
+    /// Forget all the discovered nodes and stop all the discoveries in flight.
     CHIP_ERROR SetUpNodeDiscovery();
+
+    /**
+     * Start tracking results for one more discovery. Only the nodes matching at least one tracked filter are kept while
+     * discoveries are in flight. The delegate, if any, is called for every matching node as it is discovered.
+     *
+     * @return CHIP_ERROR_NO_MEMORY if CHIP_DEVICE_CONFIG_MAX_DISCOVERY_FILTERS discoveries are already in flight.
+     */
+    CHIP_ERROR AddDiscoveryFilter(const Dnssd::DiscoveryFilter & filter, DeviceDiscoveryDelegate * delegate,
+                                  DiscoveryId & discoveryId);
+
     const Dnssd::DiscoveredNodeData * GetDiscoveredNode(int idx);
+
+    /// Returns the idx-th valid node matching the given discovery, or nullptr.
+    const Dnssd::DiscoveredNodeData * GetDiscoveredNode(DiscoveryId discoveryId, int idx);
+
     virtual DiscoveredNodeList GetDiscoveredNodes()    = 0;
     DeviceDiscoveryDelegate * mDeviceDiscoveryDelegate = nullptr;
     Dnssd::ResolverProxy mDNSResolver;
+
+private:
+    using DiscoveryMask = uint32_t;
+    static_assert(kMaxDiscoveryFilters <= sizeof(DiscoveryMask) * 8, "Too many discovery filters for DiscoveryMask");
+    static_assert(kMaxDiscoveryFilters < kInvalidDiscoveryId, "Too many discovery filters for DiscoveryId");
+
+    struct ActiveDiscovery
+    {
+        bool inUse                                                       = false;
+        Dnssd::DiscoveryFilterType type                                  = Dnssd::DiscoveryFilterType::kNone;
+        uint64_t code                                                    = 0;
+        char instanceName[Dnssd::Commission::kInstanceNameMaxLength + 1] = {};
+        DeviceDiscoveryDelegate * delegate                               = nullptr;
+
+        bool Matches(const Dnssd::DiscoveredNodeData & nodeData) const;
+    };
+
+    static bool IsSameNode(const Dnssd::DiscoveredNodeData & a, const Dnssd::DiscoveredNodeData & b);
+
+    bool HasActiveDiscoveries() const;
+    DiscoveryMask MatchingDiscoveries(const Dnssd::DiscoveredNodeData & nodeData) const;
+    int FindSlotForNode(DiscoveredNodeList & discoveredNodes, const Dnssd::DiscoveredNodeData & nodeData) const;
+
+    ActiveDiscovery mDiscoveries[kMaxDiscoveryFilters];
+    // Discoveries (bit i for mDiscoveries[i]) matched by each entry of GetDiscoveredNodes().
+    DiscoveryMask mNodeDiscoveries[CHIP_DEVICE_CONFIG_MAX_DISCOVERED_NODES] = {};
 };
 
 } // namespace Controller
@@ -30,8 +30,27 @@ namespace Controller {
 
 CHIP_ERROR CommissionableNodeController::DiscoverCommissioners(Dnssd::DiscoveryFilter discoveryFilter)
 {
+    DiscoveryId discoveryId;
     ReturnErrorOnFailure(SetUpNodeDiscovery());
+    ReturnErrorOnFailure(AddDiscoveryFilter(discoveryFilter, nullptr, discoveryId));
+    return FindCommissioners(discoveryFilter);
+}
+
+CHIP_ERROR CommissionableNodeController::AddCommissionerDiscovery(Dnssd::DiscoveryFilter discoveryFilter,
+                                                                  DeviceDiscoveryDelegate * delegate, DiscoveryId & discoveryId)
+{
+    ReturnErrorOnFailure(AddDiscoveryFilter(discoveryFilter, delegate, discoveryId));
 
+    CHIP_ERROR err = FindCommissioners(discoveryFilter);
+    if (err != CHIP_NO_ERROR)
+    {
+        StopDiscovery(discoveryId);
+    }
+    return err;
+}
+
+CHIP_ERROR CommissionableNodeController::FindCommissioners(Dnssd::DiscoveryFilter discoveryFilter)
+{
     if (mResolver == nullptr)
     {
 #if CONFIG_DEVICE_LAYER
@@ -54,5 +73,10 @@ const Dnssd::DiscoveredNodeData * CommissionableNodeController::GetDiscoveredCom
     return GetDiscoveredNode(idx);
 }
 
+const Dnssd::DiscoveredNodeData * CommissionableNodeController::GetDiscoveredCommissioner(DiscoveryId discoveryId, int idx)
+{
+    return GetDiscoveredNode(discoveryId, idx);
+}
+
 } // namespace Controller
 } // namespace chip
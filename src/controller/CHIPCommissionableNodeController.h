@@ -39,8 +39,20 @@ public:
     CommissionableNodeController(chip::Dnssd::Resolver * resolver = nullptr) : mResolver(resolver) {}
     virtual ~CommissionableNodeController() {}
 
+    /**
+     * Forget the commissioners discovered so far, stop the discoveries in flight, and start browsing for commissioners
+     * matching discoveryFilter.
+     */
     CHIP_ERROR DiscoverCommissioners(Dnssd::DiscoveryFilter discoveryFilter = Dnssd::DiscoveryFilter());
 
+    /**
+     * Start browsing for commissioners matching discoveryFilter alongside the discoveries already in flight, keeping the
+     * commissioners discovered so far. The delegate, if not null, is called as soon as each matching commissioner is
+     * discovered. The results can be listed with GetDiscoveredCommissioner(discoveryId, idx) until StopDiscovery() is called.
+     */
+    CHIP_ERROR AddCommissionerDiscovery(Dnssd::DiscoveryFilter discoveryFilter, DeviceDiscoveryDelegate * delegate,
+                                        DiscoveryId & discoveryId);
+
     /**
      * @return
      *   Pointer to DiscoveredNodeData at index idx in the list of commissioners discovered
@@ -50,6 +62,12 @@ public:
      */
     const Dnssd::DiscoveredNodeData * GetDiscoveredCommissioner(int idx);
 
+    /**
+     * @return
+     *   Pointer to the idx-th valid commissioner found by the discovery discoveryId, or nullptr.
+     */
+    const Dnssd::DiscoveredNodeData * GetDiscoveredCommissioner(DiscoveryId discoveryId, int idx);
+
     void OnNodeIdResolved(const chip::Dnssd::ResolvedNodeData & nodeData) override
     {
         ChipLogError(Controller, "Unsupported operation CommissionableNodeController::OnNodeIdResolved");
@@ -64,6 +82,8 @@ protected:
     DiscoveredNodeList GetDiscoveredNodes() override { return DiscoveredNodeList(mDiscoveredCommissioners); }
 
 private:
+    CHIP_ERROR FindCommissioners(Dnssd::DiscoveryFilter discoveryFilter);
+
     Dnssd::Resolver * mResolver = nullptr;
     Dnssd::DiscoveredNodeData mDiscoveredCommissioners[CHIP_DEVICE_CONFIG_MAX_DISCOVERED_NODES];
 };
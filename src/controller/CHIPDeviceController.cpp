@@ -1541,7 +1541,9 @@ void DeviceCommissioner::OnSessionEstablishmentTimeoutCallback(System::Layer * a
 #if CHIP_DEVICE_CONFIG_ENABLE_DNSSD
 CHIP_ERROR DeviceCommissioner::DiscoverCommissionableNodes(Dnssd::DiscoveryFilter filter)
 {
+    DiscoveryId discoveryId;
     ReturnErrorOnFailure(SetUpNodeDiscovery());
+    ReturnErrorOnFailure(AddDiscoveryFilter(filter, nullptr, discoveryId));
     return mDNSResolver.FindCommissionableNodes(filter);
 }
 
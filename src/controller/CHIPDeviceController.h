@@ -355,8 +355,7 @@ protected:
     Transport::PeerAddress ToPeerAddress(const chip::Dnssd::ResolvedNodeData & nodeData) const;
 
     DeviceAddressUpdateDelegate * mDeviceAddressUpdateDelegate = nullptr;
-    // TODO(cecille): Make this configuarable.
-    static constexpr int kMaxCommissionableNodes = 10;
+    static constexpr int kMaxCommissionableNodes = CHIP_DEVICE_CONFIG_MAX_DISCOVERED_NODES;
     Dnssd::DiscoveredNodeData mCommissionableNodes[kMaxCommissionableNodes];
 #endif
     DeviceControllerSystemState * mSystemState = nullptr;
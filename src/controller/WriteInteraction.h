@@ -105,7 +105,14 @@ CHIP_ERROR WriteAttribute(const SessionHandle & sessionHandle, chip::EndpointId
     auto callback = Platform::MakeUnique<WriteCallback>(onSuccessCb, onErrorCb, onDoneCb);
     VerifyOrReturnError(callback != nullptr, CHIP_ERROR_NO_MEMORY);
 
-    ReturnErrorOnFailure(app::InteractionModelEngine::GetInstance()->NewWriteClient(handle, callback.get(), aTimedWriteTimeoutMs));
+    app::InteractionModelEngine * engine = app::InteractionModelEngine::GetInstance();
+    size_t maxPayloadSize                = app::kMaxSecureSduLengthBytes;
+    if (engine->GetExchangeManager() != nullptr && engine->GetExchangeManager()->GetSessionManager() != nullptr)
+    {
+        maxPayloadSize =
+            engine->GetExchangeManager()->GetSessionManager()->GetMaxPayloadSize(sessionHandle, app::kMaxSecureSduLengthBytes);
+    }
+    ReturnErrorOnFailure(engine->NewWriteClient(handle, callback.get(), aTimedWriteTimeoutMs, maxPayloadSize));
 
     // At this point the handle will ensure our callback's OnDone is always
     // called.
@@ -116,8 +116,108 @@ void TestGetDiscoveredCommissioner_HappyCase_OneValidOneInvalidNode(nlTestSuite
     NL_TEST_ASSERT(inSuite, controller.GetDiscoveredCommissioner(1) == nullptr);
 }
 
+class CountingDiscoveryDelegate : public DeviceDiscoveryDelegate
+{
+public:
+    void OnDiscoveredDevice(const chip::Dnssd::DiscoveredNodeData & nodeData) override { mDiscoveredCount++; }
+
+    int mDiscoveredCount = 0;
+};
+
+void MakeNodeData(chip::Dnssd::DiscoveredNodeData & nodeData, const char * instanceName, const char * hostName, uint16_t vendorId)
+{
+    nodeData.Reset();
+    strncpy(nodeData.instanceName, instanceName, sizeof nodeData.instanceName);
+    strncpy(nodeData.hostName, hostName, sizeof nodeData.hostName);
+    Inet::IPAddress::FromString("192.168.1.10", nodeData.ipAddress[0]);
+    nodeData.numIPs   = 1;
+    nodeData.port     = 5540;
+    nodeData.vendorId = vendorId;
+}
+
+void TestConcurrentDiscoveries_PerFilterResults(nlTestSuite * inSuite, void * inContext)
+{
+    MockResolver resolver;
+    CommissionableNodeController controller(&resolver);
+    CountingDiscoveryDelegate delegate1, delegate2;
+    CommissionableNodeController::DiscoveryId discovery1, discovery2;
+
+    NL_TEST_ASSERT(inSuite,
+                   controller.AddCommissionerDiscovery(Dnssd::DiscoveryFilter(Dnssd::DiscoveryFilterType::kVendorId, 1), &delegate1,
+                                                       discovery1) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite,
+                   controller.AddCommissionerDiscovery(Dnssd::DiscoveryFilter(Dnssd::DiscoveryFilterType::kVendorId, 2), &delegate2,
+                                                       discovery2) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, discovery1 != discovery2);
+
+    chip::Dnssd::DiscoveredNodeData vendor1Node, vendor2Node, vendor3Node;
+    MakeNodeData(vendor1Node, "0123456789ABCDEF", "host1", 1);
+    MakeNodeData(vendor2Node, "FEDCBA9876543210", "host2", 2);
+    MakeNodeData(vendor3Node, "00000000000000AA", "host3", 3);
+
+    controller.OnNodeDiscoveryComplete(vendor1Node);
+    controller.OnNodeDiscoveryComplete(vendor2Node);
+    controller.OnNodeDiscoveryComplete(vendor3Node);
+
+    // Results are streamed to the delegate of the matching discovery only.
+    NL_TEST_ASSERT(inSuite, delegate1.mDiscoveredCount == 1);
+    NL_TEST_ASSERT(inSuite, delegate2.mDiscoveredCount == 1);
+
+    NL_TEST_ASSERT(inSuite, controller.GetDiscoveredCommissioner(discovery1, 0) != nullptr);
+    NL_TEST_ASSERT(inSuite, controller.GetDiscoveredCommissioner(discovery1, 0)->IsInstanceName("0123456789ABCDEF"));
+    NL_TEST_ASSERT(inSuite, controller.GetDiscoveredCommissioner(discovery1, 1) == nullptr);
+    NL_TEST_ASSERT(inSuite, controller.GetDiscoveredCommissioner(discovery2, 0) != nullptr);
+    NL_TEST_ASSERT(inSuite, controller.GetDiscoveredCommissioner(discovery2, 0)->IsInstanceName("FEDCBA9876543210"));
+    NL_TEST_ASSERT(inSuite, controller.GetDiscoveredCommissioner(discovery2, 1) == nullptr);
+
+    // A node matching none of the discoveries in flight is not kept.
+    NL_TEST_ASSERT(inSuite, controller.GetDiscoveredCommissioner(2) == nullptr);
+
+    // The same instance announced from another host replaces the earlier record.
+    MakeNodeData(vendor1Node, "0123456789ABCDEF", "host1-renamed", 1);
+    controller.OnNodeDiscoveryComplete(vendor1Node);
+    NL_TEST_ASSERT(inSuite, delegate1.mDiscoveredCount == 2);
+    NL_TEST_ASSERT(inSuite, controller.GetDiscoveredCommissioner(discovery1, 0) != nullptr);
+    NL_TEST_ASSERT(inSuite, controller.GetDiscoveredCommissioner(discovery1, 0)->IsHost("host1-renamed"));
+    NL_TEST_ASSERT(inSuite, controller.GetDiscoveredCommissioner(discovery1, 1) == nullptr);
+    NL_TEST_ASSERT(inSuite, controller.GetDiscoveredCommissioner(2) == nullptr);
+
+    // Once stopped, a discovery has no more results and its delegate is not called anymore.
+    controller.StopDiscovery(discovery1);
+    controller.OnNodeDiscoveryComplete(vendor1Node);
+    NL_TEST_ASSERT(inSuite, delegate1.mDiscoveredCount == 2);
+    NL_TEST_ASSERT(inSuite, controller.GetDiscoveredCommissioner(discovery1, 0) == nullptr);
+    NL_TEST_ASSERT(inSuite, controller.GetDiscoveredCommissioner(discovery2, 0) != nullptr);
+}
+
 #endif // INET_CONFIG_ENABLE_IPV4
 
+void TestConcurrentDiscoveries_TooManyFilters_ReturnsError(nlTestSuite * inSuite, void * inContext)
+{
+    MockResolver resolver;
+    CommissionableNodeController controller(&resolver);
+    CommissionableNodeController::DiscoveryId discoveryId;
+
+    for (size_t i = 0; i < CommissionableNodeController::kMaxDiscoveryFilters; i++)
+    {
+        NL_TEST_ASSERT(inSuite,
+                       controller.AddCommissionerDiscovery(Dnssd::DiscoveryFilter(), nullptr, discoveryId) == CHIP_NO_ERROR);
+    }
+    NL_TEST_ASSERT(inSuite,
+                   controller.AddCommissionerDiscovery(Dnssd::DiscoveryFilter(), nullptr, discoveryId) == CHIP_ERROR_NO_MEMORY);
+
+    // Stopping a discovery makes room for another one.
+    controller.StopDiscovery(0);
+    NL_TEST_ASSERT(inSuite, controller.AddCommissionerDiscovery(Dnssd::DiscoveryFilter(), nullptr, discoveryId) == CHIP_NO_ERROR);
+
+    // A failed browse does not hold on to its filter.
+    controller.StopDiscovery(discoveryId);
+    resolver.FindCommissionersStatus = CHIP_ERROR_INTERNAL;
+    NL_TEST_ASSERT(inSuite, controller.AddCommissionerDiscovery(Dnssd::DiscoveryFilter(), nullptr, discoveryId) != CHIP_NO_ERROR);
+    resolver.FindCommissionersStatus = CHIP_NO_ERROR;
+    NL_TEST_ASSERT(inSuite, controller.AddCommissionerDiscovery(Dnssd::DiscoveryFilter(), nullptr, discoveryId) == CHIP_NO_ERROR);
+}
+
 void TestGetDiscoveredCommissioner_NoNodesDiscovered_ReturnsNullptr(nlTestSuite * inSuite, void * inContext)
 {
     MockResolver resolver;
@@ -168,12 +268,14 @@ const nlTest sTests[] =
     NL_TEST_DEF("TestGetDiscoveredCommissioner_HappyCase", TestGetDiscoveredCommissioner_HappyCase),
     NL_TEST_DEF("TestGetDiscoveredCommissioner_HappyCase_OneValidOneInvalidNode", TestGetDiscoveredCommissioner_HappyCase_OneValidOneInvalidNode),
     NL_TEST_DEF("TestGetDiscoveredCommissioner_InvalidNodeDiscovered_ReturnsNullptr", TestGetDiscoveredCommissioner_InvalidNodeDiscovered_ReturnsNullptr),
+    NL_TEST_DEF("TestConcurrentDiscoveries_PerFilterResults", TestConcurrentDiscoveries_PerFilterResults),
 #endif // INET_CONFIG_ENABLE_IPV4
     NL_TEST_DEF("TestGetDiscoveredCommissioner_NoNodesDiscovered_ReturnsNullptr", TestGetDiscoveredCommissioner_NoNodesDiscovered_ReturnsNullptr),
     NL_TEST_DEF("TestDiscoverCommissioners_HappyCase", TestDiscoverCommissioners_HappyCase),
     NL_TEST_DEF("TestDiscoverCommissioners_HappyCaseWithDiscoveryFilter", TestDiscoverCommissioners_HappyCaseWithDiscoveryFilter),
     NL_TEST_DEF("TestDiscoverCommissioners_InitError_ReturnsError", TestDiscoverCommissioners_InitError_ReturnsError),
     NL_TEST_DEF("TestDiscoverCommissioners_FindCommissionersError_ReturnsError", TestDiscoverCommissioners_FindCommissionersError_ReturnsError),
+    NL_TEST_DEF("TestConcurrentDiscoveries_TooManyFilters_ReturnsError", TestConcurrentDiscoveries_TooManyFilters_ReturnsError),
     NL_TEST_SENTINEL()
 };
 // clang-format on
@@ -1082,6 +1082,16 @@
 #define CHIP_DEVICE_CONFIG_MAX_DISCOVERED_NODES 10
 #endif
 
+/**
+ * CHIP_DEVICE_CONFIG_MAX_DISCOVERY_FILTERS
+ *
+ * Maximum number of discoveries, each with its own filter and result set, that a discovery controller can have in flight
+ * at the same time.
+ */
+#ifndef CHIP_DEVICE_CONFIG_MAX_DISCOVERY_FILTERS
+#define CHIP_DEVICE_CONFIG_MAX_DISCOVERY_FILTERS 4
+#endif
+
 /**
  * CHIP_DEVICE_CONFIG_ENABLE_COMMISSIONER_DISCOVERY
  *
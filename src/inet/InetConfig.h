@@ -213,6 +213,24 @@
 #define INET_CONFIG_TCP_SEND_QUEUE_POLL_INTERVAL_MSEC      500
 #endif // INET_CONFIG_TCP_SEND_QUEUE_POLL_INTERVAL_MSEC
 
+/**
+ *  @def INET_CONFIG_TCP_SEND_MAX_IOV
+ *
+ *  @brief
+ *    The maximum number of queued packet buffers a sockets
+ *    based TCP endpoint hands to the kernel in a single
+ *    sendmsg() call.
+ *
+ *  @details
+ *    Messages queued while the socket is not writable are
+ *    written out together once it becomes writable again,
+ *    rather than with one system call (and, with Nagle
+ *    disabled, one segment) per message.
+ */
+#ifndef INET_CONFIG_TCP_SEND_MAX_IOV
+#define INET_CONFIG_TCP_SEND_MAX_IOV                       16
+#endif // INET_CONFIG_TCP_SEND_MAX_IOV
+
 /**
  *  @def INET_CONFIG_DEFAULT_TCP_USER_TIMEOUT_MSEC
  *
@@ -30,6 +30,7 @@
 #include <lib/support/logging/CHIPLogging.h>
 #include <system/SystemFaultInjection.h>
 
+#include <algorithm>
 #include <stdio.h>
 #include <string.h>
 #include <utility>
@@ -41,6 +42,7 @@
 #include <sys/ioctl.h>
 #include <sys/select.h>
 #include <sys/socket.h>
+#include <sys/uio.h>
 #include <unistd.h>
 
 // SOCK_CLOEXEC not defined on all platforms, e.g. iOS/macOS:
@@ -508,9 +510,25 @@ CHIP_ERROR TCPEndPointImplSockets::DriveSendingImpl()
 
     while (!mSendQueue.IsNull())
     {
-        uint16_t bufLen = mSendQueue->DataLength();
+        // Gather as much of the queue as possible, so that messages queued while the socket was not writable go out
+        // in a single system call.
+        struct iovec sendIOV[INET_CONFIG_TCP_SEND_MAX_IOV];
+        size_t iovCount = 0;
+        size_t bufLen   = 0;
+        for (System::PacketBufferHandle buf = mSendQueue.Retain(); !buf.IsNull() && iovCount < ArraySize(sendIOV); buf.Advance())
+        {
+            sendIOV[iovCount].iov_base = buf->Start();
+            sendIOV[iovCount].iov_len  = buf->DataLength();
+            bufLen += buf->DataLength();
+            ++iovCount;
+        }
 
-        ssize_t lenSentRaw = send(mSocket, mSendQueue->Start(), bufLen, sendFlags);
+        struct msghdr msgHeader;
+        memset(&msgHeader, 0, sizeof(msgHeader));
+        msgHeader.msg_iov    = sendIOV;
+        msgHeader.msg_iovlen = static_cast<decltype(msgHeader.msg_iovlen)>(iovCount);
+
+        ssize_t lenSentRaw = sendmsg(mSocket, &msgHeader, sendFlags);
 
         if (lenSentRaw == -1)
         {
@@ -521,43 +539,52 @@ CHIP_ERROR TCPEndPointImplSockets::DriveSendingImpl()
             break;
         }
 
-        if (lenSentRaw < 0 || lenSentRaw > bufLen)
+        if (lenSentRaw < 0 || static_cast<size_t>(lenSentRaw) > bufLen)
         {
             err = CHIP_ERROR_INCORRECT_STATE;
             break;
         }
 
-        // Cast is safe because bufLen is uint16_t.
-        uint16_t lenSent = static_cast<uint16_t>(lenSentRaw);
+        size_t lenSent = static_cast<size_t>(lenSentRaw);
 
         // Mark the connection as being active.
         MarkActive();
 
-        if (lenSent < bufLen)
+        // Release the buffers that were fully sent, and the sent part of the first one that was not.
+        size_t lenRemaining = lenSent;
+        while (!mSendQueue.IsNull() && lenRemaining >= mSendQueue->DataLength())
         {
-            mSendQueue->ConsumeHead(lenSent);
+            lenRemaining -= mSendQueue->DataLength();
+            mSendQueue.FreeHead();
         }
-        else
+        if (lenRemaining > 0)
         {
-            mSendQueue.FreeHead();
-            if (mSendQueue.IsNull())
+            // Cast is safe because lenRemaining is smaller than the DataLength() of the head buffer.
+            mSendQueue->ConsumeHead(static_cast<uint16_t>(lenRemaining));
+        }
+
+        if (mSendQueue.IsNull())
+        {
+            // Do not wait for ability to write on this endpoint.
+            err = static_cast<System::LayerSockets &>(GetSystemLayer()).ClearCallbackOnPendingWrite(mWatch);
+            if (err != CHIP_NO_ERROR)
             {
-                // Do not wait for ability to write on this endpoint.
-                err = static_cast<System::LayerSockets &>(GetSystemLayer()).ClearCallbackOnPendingWrite(mWatch);
-                if (err != CHIP_NO_ERROR)
-                {
-                    break;
-                }
+                break;
             }
         }
 
         if (OnDataSent != nullptr)
         {
-            OnDataSent(this, lenSent);
+            for (size_t lenReported = 0; lenReported < lenSent;)
+            {
+                uint16_t lenChunk = static_cast<uint16_t>(std::min<size_t>(lenSent - lenReported, UINT16_MAX));
+                OnDataSent(this, lenChunk);
+                lenReported += lenChunk;
+            }
         }
 
 #if INET_CONFIG_OVERRIDE_SYSTEM_TCP_USER_TIMEOUT
-        mBytesWrittenSinceLastProbe += lenSent;
+        mBytesWrittenSinceLastProbe += static_cast<uint32_t>(lenSent);
 
         bool isProgressing = false;
 
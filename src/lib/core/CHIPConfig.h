@@ -1025,6 +1025,19 @@
 #define CHIP_CONFIG_MAX_INCOMING_TCP_CON_FROM_SINGLE_IP 2
 #endif // CHIP_CONFIG_MAX_INCOMING_TCP_CON_FROM_SINGLE_IP
 
+/**
+ *  @def CHIP_CONFIG_TCP_SEND_QUEUE_HIGH_WATERMARK
+ *
+ *  @brief
+ *    Number of bytes that may be waiting to be written to a single TCP
+ *    connection (including a connection still being established) before
+ *    the TCP transport refuses further messages for it with
+ *    #CHIP_ERROR_SENDING_BLOCKED, until the peer catches up.
+ */
+#ifndef CHIP_CONFIG_TCP_SEND_QUEUE_HIGH_WATERMARK
+#define CHIP_CONFIG_TCP_SEND_QUEUE_HIGH_WATERMARK (16 * 1024)
+#endif // CHIP_CONFIG_TCP_SEND_QUEUE_HIGH_WATERMARK
+
 /**
  *  @def CHIP_CONFIG_MAX_SESSION_KEYS
  *
@@ -2414,6 +2427,63 @@ extern const char CHIP_NON_PRODUCTION_MARKER[];
 #ifndef CHIP_CONFIG_MDNS_CACHE_SIZE
 #define CHIP_CONFIG_MDNS_CACHE_SIZE 20
 #endif
+
+/**
+ * @def CHIP_CONFIG_MDNS_NEGATIVE_CACHE_TTL_SECONDS
+ *
+ * @brief
+ *      How long, in seconds, the MDNS cache remembers that an operational node withdrew its records (a "goodbye"
+ *      announcement with a TTL of 0).  Cache lookups for such a node fail without querying the network until then, or
+ *      until the node announces itself again.
+ *
+ */
+#ifndef CHIP_CONFIG_MDNS_NEGATIVE_CACHE_TTL_SECONDS
+#define CHIP_CONFIG_MDNS_NEGATIVE_CACHE_TTL_SECONDS 10
+#endif
+
+/**
+ * @def CHIP_CONFIG_MDNS_RESOLVER_PASSIVE_LISTENING
+ *
+ * @brief
+ *      When enabled, the minimal mDNS resolver processes every operational (_matter._tcp) response it receives,
+ *      including unsolicited announcements that nodes multicast on boot or address changes, and uses them to keep the
+ *      MDNS cache up to date.  When disabled, only responses received while resolving a node are looked at.
+ *
+ *      Has no effect if CHIP_CONFIG_MDNS_CACHE_SIZE is 0.
+ *
+ */
+#ifndef CHIP_CONFIG_MDNS_RESOLVER_PASSIVE_LISTENING
+#define CHIP_CONFIG_MDNS_RESOLVER_PASSIVE_LISTENING 1
+#endif
+
+/**
+ * @def CHIP_CONFIG_MDNS_RESOLVER_MAX_PENDING_RESOLVES
+ *
+ * @brief
+ *      Number of operational node resolutions the minimal mDNS resolver keeps track of (and retries) at the same time.
+ *      Pending resolutions are sent together, as multiple questions of the same query packets. The default is the number
+ *      of operational questions that fit in one 1024 byte query packet: the first one takes 58 bytes after the 12 byte
+ *      header, and each following one 40 bytes, since the service, protocol and domain labels are compressed.
+ *
+ */
+#ifndef CHIP_CONFIG_MDNS_RESOLVER_MAX_PENDING_RESOLVES
+#define CHIP_CONFIG_MDNS_RESOLVER_MAX_PENDING_RESOLVES 24
+#endif
+
+/**
+ * @def CHIP_CONFIG_MDNS_RESPONSE_CACHE_SIZE
+ *
+ * @brief
+ *      Number of distinct questions for which the minimal mDNS responder remembers its serialized unicast reply, to
+ *      answer the same question again without walking all its responders.  Each cached reply holds a packet buffer for
+ *      up to 5 seconds, so this is best left disabled on devices with a small packet buffer pool.
+ *
+ *      If CHIP_CONFIG_MDNS_RESPONSE_CACHE_SIZE is 0, replies are not cached.
+ *
+ */
+#ifndef CHIP_CONFIG_MDNS_RESPONSE_CACHE_SIZE
+#define CHIP_CONFIG_MDNS_RESPONSE_CACHE_SIZE 0
+#endif
 /**
  *  @name Interaction Model object pool configuration.
  *
@@ -2422,9 +2492,11 @@ extern const char CHIP_NON_PRODUCTION_MARKER[];
  *
  *      * #CHIP_IM_MAX_NUM_COMMAND_HANDLER
  *      * #CHIP_IM_MAX_NUM_READ_HANDLER
+ *      * #CHIP_IM_MAX_NUM_SUBSCRIPTIONS_PER_FABRIC
  *      * #CHIP_IM_MAX_NUM_READ_CLIENT
  *      * #CHIP_IM_MAX_REPORTS_IN_FLIGHT
  *      * #CHIP_IM_SERVER_MAX_NUM_PATH_GROUPS
+ *      * #CHIP_IM_MAX_NUM_PATHS_PER_READ_HANDLER
  *      * #CHIP_IM_MAX_NUM_WRITE_HANDLER
  *      * #CHIP_IM_MAX_NUM_WRITE_CLIENT
  *      * #CHIP_IM_MAX_NUM_TIMED_HANDLER
@@ -2445,11 +2517,23 @@ extern const char CHIP_NON_PRODUCTION_MARKER[];
  * @def CHIP_IM_MAX_NUM_READ_HANDLER
  *
  * @brief Defines the maximum number of ReadHandler, limits the number of active read transactions on server.
+ *        ReadHandlers are allocated from the heap when CHIP_SYSTEM_CONFIG_POOL_USE_HEAP is enabled, and from a static pool of
+ *        this size otherwise.
  */
 #ifndef CHIP_IM_MAX_NUM_READ_HANDLER
 #define CHIP_IM_MAX_NUM_READ_HANDLER 4
 #endif
 
+/**
+ * @def CHIP_IM_MAX_NUM_SUBSCRIPTIONS_PER_FABRIC
+ *
+ * @brief Defines the maximum number of subscriptions that the peers of a single fabric can hold on the server at the same time,
+ *        so that one fabric cannot use up all the ReadHandlers.
+ */
+#ifndef CHIP_IM_MAX_NUM_SUBSCRIPTIONS_PER_FABRIC
+#define CHIP_IM_MAX_NUM_SUBSCRIPTIONS_PER_FABRIC CHIP_IM_MAX_NUM_READ_HANDLER
+#endif
+
 /**
  * @def CHIP_IM_MAX_NUM_READ_CLIENT
  *
@@ -2471,12 +2555,65 @@ extern const char CHIP_NON_PRODUCTION_MARKER[];
 /**
  * @def CHIP_IM_SERVER_MAX_NUM_PATH_GROUPS
  *
- * @brief Defines the maximum number of path objects, limits the number of attributes being read or subscribed at the same time.
+ * @brief Defines the maximum number of path objects in the set of dirty attribute paths waiting to be reported to subscribers.
+ *        The paths requested by each read or subscribe interaction are allocated separately, as the request is processed.
  */
 #ifndef CHIP_IM_SERVER_MAX_NUM_PATH_GROUPS
 #define CHIP_IM_SERVER_MAX_NUM_PATH_GROUPS 8
 #endif
 
+/**
+ * @def CHIP_IM_MAX_NUM_PATHS_PER_READ_HANDLER
+ *
+ * @brief Defines the maximum number of attribute and event paths a single read or subscribe request can hold. The paths are
+ *        allocated from the heap as the request is processed, and a request with more paths is rejected with a
+ *        ResourceExhausted status.
+ */
+#ifndef CHIP_IM_MAX_NUM_PATHS_PER_READ_HANDLER
+#define CHIP_IM_MAX_NUM_PATHS_PER_READ_HANDLER 32
+#endif
+
+/**
+ * @def CHIP_IM_OVERRIDE_REGISTRY_BUCKETS
+ *
+ * @brief Defines the number of hash buckets used to index registered AttributeAccessInterface and CommandHandlerInterface
+ * overrides by endpoint and cluster. Devices registering many per-endpoint overrides (e.g. bridges) may want to raise this.
+ */
+#ifndef CHIP_IM_OVERRIDE_REGISTRY_BUCKETS
+#define CHIP_IM_OVERRIDE_REGISTRY_BUCKETS 16
+#endif
+
+/**
+ * @def CHIP_CONFIG_MAX_TCP_APP_MESSAGE_LEN
+ *
+ * @brief Largest application message sent over a TCP session, which is not bound by the IPv6 MTU like messages over UDP and
+ * BLE. Nothing is negotiated with the peer, so peers are expected to share the same value.
+ *
+ * A message is sent from a single packet buffer, so this cannot be more than what a packet buffer holds after the header
+ * reserve and the MIC, which the default is set to. With the default packet buffer size that is only a few hundred bytes more
+ * than the 1200 bytes of a UDP message; raise CHIP_SYSTEM_CONFIG_PACKETBUFFER_CAPACITY_MAX to send larger messages. On LwIP
+ * platforms, where the packet buffer size comes from the PBUF size, the default keeps the UDP limit.
+ */
+#ifndef CHIP_CONFIG_MAX_TCP_APP_MESSAGE_LEN
+#if CHIP_SYSTEM_CONFIG_USE_LWIP
+#define CHIP_CONFIG_MAX_TCP_APP_MESSAGE_LEN 1200
+#else
+#define CHIP_CONFIG_MAX_TCP_APP_MESSAGE_LEN                                                                                        \
+    (CHIP_SYSTEM_CONFIG_PACKETBUFFER_CAPACITY_MAX - CHIP_SYSTEM_CONFIG_HEADER_RESERVE_SIZE - 16)
+#endif
+#endif
+
+/**
+ * @def CHIP_IM_SUPPRESS_UNCHANGED_ATTRIBUTE_REPORTS
+ *
+ * @brief When enabled, a write to an attribute stored by ember compares the new value with the stored one and only marks the
+ * attribute dirty for subscribers, and persists it, if the value actually changed. Applications that write the same values
+ * over and over again, such as bridges re-publishing the state of their devices, then do not generate report traffic.
+ */
+#ifndef CHIP_IM_SUPPRESS_UNCHANGED_ATTRIBUTE_REPORTS
+#define CHIP_IM_SUPPRESS_UNCHANGED_ATTRIBUTE_REPORTS 0
+#endif
+
 /**
  * @def CHIP_IM_MAX_NUM_WRITE_HANDLER
  *
@@ -2778,6 +2915,32 @@ extern const char CHIP_NON_PRODUCTION_MARKER[];
 #ifndef CHIP_CONFIG_ENABLE_SERVER_IM_EVENT
 #define CHIP_CONFIG_ENABLE_SERVER_IM_EVENT 1
 #endif
+
+/**
+ * @def CHIP_CONFIG_BDX_MAX_WINDOW_SIZE
+ *
+ * @brief The largest number of Blocks a BDX TransferSession keeps in flight in a windowed transfer. Each slot holds a copy of
+ *   an unacknowledged Block on the sending side and an out of order Block on the receiving side. Limited to 32 by the width of
+ *   the selective acknowledgement mask.
+ *
+ *   Windowed transfers are an extension that is not part of the BDX specification: they are negotiated with a reserved
+ *   Transfer Control bit followed by an extra byte, which peers without the extension parse as metadata. A TransferSession
+ *   therefore only proposes or accepts a window when its owner passes a non-zero maxWindowSize, which should only be done
+ *   when both ends of a transfer support the extension. Set to 0 to remove windowed transfers from the build.
+ */
+#ifndef CHIP_CONFIG_BDX_MAX_WINDOW_SIZE
+#define CHIP_CONFIG_BDX_MAX_WINDOW_SIZE 8
+#endif
+
+/**
+ * @def CHIP_CONFIG_BDX_WINDOW_RETRANSMIT_TIMEOUT_MS
+ *
+ * @brief The time a BDX sender in a windowed transfer waits for an acknowledgement before sending its unacknowledged Blocks
+ *   again.
+ */
+#ifndef CHIP_CONFIG_BDX_WINDOW_RETRANSMIT_TIMEOUT_MS
+#define CHIP_CONFIG_BDX_WINDOW_RETRANSMIT_TIMEOUT_MS 2000
+#endif
 /**
  * @}
  */
@@ -935,8 +935,10 @@ protected:
     void ClearElementState();
     CHIP_ERROR SkipData();
     CHIP_ERROR SkipToEndOfContainer();
+    bool ScanToEndOfContainer(uint32_t & nestLevel, TLVType outerContainerType);
     CHIP_ERROR VerifyElement();
-    Tag ReadTag(TLVTagControl tagControl, const uint8_t *& p);
+    static CHIP_ERROR VerifyElementTag(TLVElementType elemType, Tag tag, TLVType containerType);
+    Tag ReadTag(TLVTagControl tagControl, const uint8_t *& p) const;
     CHIP_ERROR EnsureData(CHIP_ERROR noDataErr);
     CHIP_ERROR ReadData(uint8_t * buf, uint32_t len);
     CHIP_ERROR GetElementHeadLength(uint8_t & elemHeadBytes) const;
@@ -2156,6 +2158,17 @@ public:
      * @return the total remaining number of bytes.
      */
     uint32_t GetRemainingFreeLength() const { return mRemainingLen; }
+
+    /**
+     * Returns the number of bytes that can still be written before reaching the maximum length the writer was initialized
+     * with, once the end of the containers currently open has been accounted for.
+     *
+     * Unlike GetRemainingFreeLength(), this includes the buffers a backing store may provide after the current one.
+     *
+     * @return the number of bytes that can still be written.
+     */
+    uint32_t GetTotalRemainingFreeLength() const { return mMaxLen - mLenWritten; }
+
     /**
      * The profile id of tags that should be encoded in implicit form.
      *
@@ -2742,5 +2755,73 @@ constexpr size_t EstimateStructOverhead(size_t firstFieldSize, FieldSizes... oth
     return firstFieldSize + 4u + EstimateStructOverhead(otherFields...);
 }
 
+/**
+ * The number of bytes a TLVWriter uses for the control byte and the tag of an element with the given tag.
+ *
+ * Profile-specific tags are counted in their fully-qualified form; a writer whose ImplicitProfileId matches the profile of the tag
+ * encodes them in 4 fewer bytes.
+ */
+constexpr size_t EncodedHeadSize(Tag tag)
+{
+    if ((tag & kProfileIdMask) == kSpecialTagMarker)
+    {
+        // Context-specific tags take one byte, anonymous tags none.
+        return ((tag & kTagNumMask) <= kContextTagMaxNum) ? 2u : 1u;
+    }
+
+    const size_t tagNumSize = ((tag & kTagNumMask) < 65536) ? 2u : 4u;
+    return 1u + tagNumSize + (((tag & kProfileIdMask) == 0) ? 0u : 4u);
+}
+
+/**
+ * The number of bytes a TLVWriter uses to encode an element of fixed size: a boolean or a null (no value bytes), or a
+ * floating point number (valueSize of 4 or 8).
+ */
+constexpr size_t EncodedFixedSize(Tag tag, size_t valueSize = 0)
+{
+    return EncodedHeadSize(tag) + valueSize;
+}
+
+/**
+ * The number of bytes a TLVWriter uses to encode an unsigned integer, which is written in the fewest bytes that can hold it.
+ */
+constexpr size_t EncodedUnsignedIntegerSize(Tag tag, uint64_t v)
+{
+    return EncodedHeadSize(tag) + ((v <= UINT8_MAX) ? 1u : (v <= UINT16_MAX) ? 2u : (v <= UINT32_MAX) ? 4u : 8u);
+}
+
+/**
+ * The number of bytes a TLVWriter uses to encode a signed integer, which is written in the fewest bytes that can hold it.
+ */
+constexpr size_t EncodedSignedIntegerSize(Tag tag, int64_t v)
+{
+    if (v >= INT8_MIN && v <= INT8_MAX)
+    {
+        return EncodedHeadSize(tag) + 1u;
+    }
+    if (v >= INT16_MIN && v <= INT16_MAX)
+    {
+        return EncodedHeadSize(tag) + 2u;
+    }
+    return EncodedHeadSize(tag) + ((v >= INT32_MIN && v <= INT32_MAX) ? 4u : 8u);
+}
+
+/**
+ * The number of bytes a TLVWriter uses to encode a UTF-8 or an octet string of the given length.
+ */
+constexpr size_t EncodedStringSize(Tag tag, size_t len)
+{
+    return EncodedHeadSize(tag) + ((len <= UINT8_MAX) ? 1u : (len <= UINT16_MAX) ? 2u : 4u) + len;
+}
+
+/**
+ * The number of bytes a TLVWriter uses to start and end a container, not counting its members.
+ */
+constexpr size_t EncodedContainerOverhead(Tag tag)
+{
+    // The end-of-container marker is a single anonymous control byte.
+    return EncodedHeadSize(tag) + 1u;
+}
+
 } // namespace TLV
 } // namespace chip
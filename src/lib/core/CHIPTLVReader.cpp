@@ -37,7 +37,72 @@ namespace TLV {
 
 using namespace chip::Encoding;
 
-static const uint8_t sTagSizes[] = { 0, 1, 2, 4, 2, 4, 6, 8 };
+static constexpr uint8_t sTagSizes[] = { 0, 1, 2, 4, 2, 4, 6, 8 };
+
+namespace {
+
+// Layout of an element head, as found in the element head table: the number of bytes in the head (control byte, tag and
+// length/value field) in the low bits and the size of the length/value field, as a TLVFieldSize plus one, in the high bits.
+// Invalid element types have a head of 0 bytes.
+constexpr uint8_t kElementHeadBytesMask  = 0x1F;
+constexpr uint8_t kElementFieldSizeShift = 5;
+
+constexpr uint8_t ElementHead(uint8_t controlByte)
+{
+    const TLVElementType elemType = static_cast<TLVElementType>(controlByte & kTLVTypeMask);
+    if (!IsValidTLVType(elemType))
+        return 0;
+
+    const TLVFieldSize fieldSize = GetTLVFieldSize(elemType);
+    const uint8_t tagBytes       = sTagSizes[controlByte >> kTLVTagControlShift];
+    const uint8_t headBytes      = static_cast<uint8_t>(1 + tagBytes + TLVFieldSizeToBytes(fieldSize));
+    return static_cast<uint8_t>(((fieldSize + 1) << kElementFieldSizeShift) | headBytes);
+}
+
+/**
+ * Head layout of every control byte, so that a head can be decoded with a single lookup instead of a series of tests on
+ * the element type and tag control.
+ */
+class ElementHeadTable
+{
+public:
+    constexpr ElementHeadTable() : mHeads()
+    {
+        for (uint16_t i = 0; i < kNumControlBytes; i++)
+        {
+            mHeads[i] = ElementHead(static_cast<uint8_t>(i));
+        }
+    }
+
+    uint8_t operator[](uint8_t controlByte) const { return mHeads[controlByte]; }
+
+private:
+    static constexpr uint16_t kNumControlBytes = UINT8_MAX + 1;
+
+    uint8_t mHeads[kNumControlBytes];
+};
+
+constexpr ElementHeadTable sElementHeads;
+
+uint64_t ReadElementField(uint8_t elemHead, const uint8_t * p)
+{
+    switch (static_cast<TLVFieldSize>((elemHead >> kElementFieldSizeShift) - 1))
+    {
+    case kTLVFieldSize_1Byte:
+        return Get8(p);
+    case kTLVFieldSize_2Byte:
+        return LittleEndian::Get16(p);
+    case kTLVFieldSize_4Byte:
+        return LittleEndian::Get32(p);
+    case kTLVFieldSize_8Byte:
+        return LittleEndian::Get64(p);
+    case kTLVFieldSize_0Byte:
+    default:
+        return 0;
+    }
+}
+
+} // namespace
 
 void TLVReader::Init(const uint8_t * data, size_t dataLen)
 {
@@ -640,18 +705,122 @@ CHIP_ERROR TLVReader::SkipToEndOfContainer()
         if (err != CHIP_NO_ERROR)
             return err;
 
+        if (ScanToEndOfContainer(nestLevel, outerContainerType))
+            return CHIP_NO_ERROR;
+
         err = ReadElement();
         if (err != CHIP_NO_ERROR)
             return err;
     }
 }
 
+/**
+ * Structural scan used by SkipToEndOfContainer() to skip the elements that lie in the current buffer in place.
+ *
+ * Each element is checked as ReadElement() and SkipData() would, but its head is decoded with a single table lookup and
+ * the tag is only decoded in full when its form requires it. The scan stops at the end of the buffer and at any element that
+ * would fail those checks, leaving the reader in the same state as the element-by-element loop so that it can carry on and
+ * report the same error.
+ *
+ * @param[in,out] nestLevel             The nesting level of the current element, relative to the container being skipped.
+ * @param[in]     outerContainerType    The type of the container being skipped.
+ *
+ * @return true if the end of the container has been reached, false if the loop must read the next element.
+ */
+bool TLVReader::ScanToEndOfContainer(uint32_t & nestLevel, TLVType outerContainerType)
+{
+    const uint8_t * p          = mReadPoint;
+    TLVType containerType      = mContainerType;
+    uint16_t controlByte       = mControlByte;
+    Tag elemTag                = mElemTag;
+    uint64_t elemLenOrVal      = mElemLenOrVal;
+    bool reachedEndOfContainer = false;
+
+    while (p != nullptr && p < mBufEnd)
+    {
+        const uint8_t elemHead      = sElementHeads[*p];
+        const uint8_t elemHeadBytes = elemHead & kElementHeadBytesMask;
+
+        // Invalid elements and heads that straddle the end of the buffer are left to ReadElement()
+        if (elemHead == 0 || elemHeadBytes > mBufEnd - p)
+            break;
+
+        const TLVElementType elemType  = static_cast<TLVElementType>(*p & kTLVTypeMask);
+        const TLVTagControl tagControl = static_cast<TLVTagControl>(*p & kTLVTagControlMask);
+        const uint8_t * field          = p + 1;
+        Tag tag;
+
+        // Anonymous and context-specific tags are by far the most common, build them without going through ReadTag()
+        if (tagControl == TLVTagControl::Anonymous)
+        {
+            tag = AnonymousTag;
+        }
+        else if (tagControl == TLVTagControl::ContextSpecific)
+        {
+            tag = ContextTag(*field++);
+        }
+        else
+        {
+            tag = ReadTag(tagControl, field);
+        }
+
+        if (VerifyElementTag(elemType, tag, containerType) != CHIP_NO_ERROR)
+            break;
+
+        const uint64_t lenOrVal = ReadElementField(elemHead, field);
+        const uint8_t * next    = p + elemHeadBytes;
+
+        if (TLVTypeHasLength(elemType))
+        {
+            // Same length check as VerifyElement(), and the data must also be in the current buffer to be skipped in place
+            const uint32_t dataLen      = static_cast<uint32_t>(lenOrVal);
+            const uint32_t lenRead      = mLenRead + static_cast<uint32_t>(next - mReadPoint);
+            const uint32_t bufRemaining = static_cast<uint32_t>(mBufEnd - next);
+            if (mMaxLen - lenRead < dataLen || bufRemaining < dataLen)
+                break;
+            next += dataLen;
+        }
+
+        controlByte  = *p;
+        elemTag      = tag;
+        elemLenOrVal = lenOrVal;
+        p            = next;
+
+        if (elemType == TLVElementType::EndOfContainer)
+        {
+            if (nestLevel == 0)
+            {
+                reachedEndOfContainer = true;
+                break;
+            }
+
+            nestLevel--;
+            containerType = (nestLevel == 0) ? outerContainerType : kTLVType_UnknownContainer;
+        }
+
+        else if (TLVTypeIsContainer(elemType))
+        {
+            nestLevel++;
+            containerType = static_cast<TLVType>(elemType);
+        }
+    }
+
+    mLenRead += static_cast<uint32_t>(p - mReadPoint);
+    mReadPoint = p;
+
+    mControlByte   = controlByte;
+    mElemTag       = elemTag;
+    mElemLenOrVal  = elemLenOrVal;
+    mContainerType = containerType;
+
+    return reachedEndOfContainer;
+}
+
 CHIP_ERROR TLVReader::ReadElement()
 {
     CHIP_ERROR err;
     uint8_t stagingBuf[17]; // 17 = 1 control byte + 8 tag bytes + 8 length/value bytes
     const uint8_t * p;
-    TLVElementType elemType;
 
     // Make sure we have input data. Return CHIP_END_OF_TLV if no more data is available.
     err = EnsureData(CHIP_END_OF_TLV);
@@ -665,26 +834,17 @@ CHIP_ERROR TLVReader::ReadElement()
     // Get the element's control byte.
     mControlByte = *mReadPoint;
 
-    // Extract the element type from the control byte. Fail if it's invalid.
-    elemType = ElementType();
-    if (!IsValidTLVType(elemType))
+    // Look up the layout of the element's head. Fail if the element type is invalid.
+    uint8_t elemHead = sElementHeads[*mReadPoint];
+    if (elemHead == 0)
         return CHIP_ERROR_INVALID_TLV_ELEMENT;
 
     // Extract the tag control from the control byte.
     TLVTagControl tagControl = static_cast<TLVTagControl>(mControlByte & kTLVTagControlMask);
 
-    // Determine the number of bytes in the element's tag, if any.
-    uint8_t tagBytes = sTagSizes[tagControl >> kTLVTagControlShift];
-
-    // Extract the size of length/value field from the control byte.
-    TLVFieldSize lenOrValFieldSize = GetTLVFieldSize(elemType);
-
-    // Determine the number of bytes in the length/value field.
-    uint8_t valOrLenBytes = TLVFieldSizeToBytes(lenOrValFieldSize);
-
     // Determine the number of bytes in the element's 'head'. This includes: the control byte, the tag bytes (if present), the
     // length bytes (if present), and for elements that don't have a length (e.g. integers), the value bytes.
-    uint8_t elemHeadBytes = static_cast<uint8_t>(1 + tagBytes + valOrLenBytes);
+    uint8_t elemHeadBytes = elemHead & kElementHeadBytesMask;
 
     // If the head of the element overlaps the end of the input buffer, read the bytes into the staging buffer
     // and arrange to parse them from there. Otherwise read them directly from the input buffer.
@@ -709,53 +869,60 @@ CHIP_ERROR TLVReader::ReadElement()
     mElemTag = ReadTag(tagControl, p);
 
     // Read the length/value field, if present.
-    switch (lenOrValFieldSize)
-    {
-    case kTLVFieldSize_0Byte:
-        mElemLenOrVal = 0;
-        break;
-    case kTLVFieldSize_1Byte:
-        mElemLenOrVal = Read8(p);
-        break;
-    case kTLVFieldSize_2Byte:
-        mElemLenOrVal = LittleEndian::Read16(p);
-        break;
-    case kTLVFieldSize_4Byte:
-        mElemLenOrVal = LittleEndian::Read32(p);
-        break;
-    case kTLVFieldSize_8Byte:
-        mElemLenOrVal = LittleEndian::Read64(p);
-        break;
-    }
+    mElemLenOrVal = ReadElementField(elemHead, p);
 
     return VerifyElement();
 }
 
 CHIP_ERROR TLVReader::VerifyElement()
 {
-    if (ElementType() == TLVElementType::EndOfContainer)
+    CHIP_ERROR err = VerifyElementTag(ElementType(), mElemTag, mContainerType);
+    if (err != CHIP_NO_ERROR)
+        return err;
+
+    // If the current element encodes a specific length (e.g. a UTF8 string or a byte string), verify
+    // that the purported length fits within the remaining bytes of the encoding (as delineated by mMaxLen).
+    //
+    // Note that this check is not strictly necessary to prevent runtime errors, as any attempt to access
+    // the data of an element with an invalid length will result in an error.  However checking the length
+    // here catches the error earlier, and ensures that the application will never see the erroneous length
+    // value.
+    //
+    if (TLVTypeHasLength(ElementType()))
     {
-        if (mContainerType == kTLVType_NotSpecified)
+        uint32_t overallLenRemaining = mMaxLen - mLenRead;
+        if (overallLenRemaining < static_cast<uint32_t>(mElemLenOrVal))
+            return CHIP_ERROR_TLV_UNDERRUN;
+    }
+
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR TLVReader::VerifyElementTag(TLVElementType elemType, Tag tag, TLVType containerType)
+{
+    if (elemType == TLVElementType::EndOfContainer)
+    {
+        if (containerType == kTLVType_NotSpecified)
             return CHIP_ERROR_INVALID_TLV_ELEMENT;
-        if (mElemTag != AnonymousTag)
+        if (tag != AnonymousTag)
             return CHIP_ERROR_INVALID_TLV_TAG;
     }
     else
     {
-        if (mElemTag == UnknownImplicitTag)
+        if (tag == UnknownImplicitTag)
             return CHIP_ERROR_UNKNOWN_IMPLICIT_TLV_TAG;
-        switch (mContainerType)
+        switch (containerType)
         {
         case kTLVType_NotSpecified:
-            if (IsContextTag(mElemTag))
+            if (IsContextTag(tag))
                 return CHIP_ERROR_INVALID_TLV_TAG;
             break;
         case kTLVType_Structure:
-            if (mElemTag == AnonymousTag)
+            if (tag == AnonymousTag)
                 return CHIP_ERROR_INVALID_TLV_TAG;
             break;
         case kTLVType_Array:
-            if (mElemTag != AnonymousTag)
+            if (tag != AnonymousTag)
                 return CHIP_ERROR_INVALID_TLV_TAG;
             break;
         case kTLVType_UnknownContainer:
@@ -766,25 +933,10 @@ CHIP_ERROR TLVReader::VerifyElement()
         }
     }
 
-    // If the current element encodes a specific length (e.g. a UTF8 string or a byte string), verify
-    // that the purported length fits within the remaining bytes of the encoding (as delineated by mMaxLen).
-    //
-    // Note that this check is not strictly necessary to prevent runtime errors, as any attempt to access
-    // the data of an element with an invalid length will result in an error.  However checking the length
-    // here catches the error earlier, and ensures that the application will never see the erroneous length
-    // value.
-    //
-    if (TLVTypeHasLength(ElementType()))
-    {
-        uint32_t overallLenRemaining = mMaxLen - mLenRead;
-        if (overallLenRemaining < static_cast<uint32_t>(mElemLenOrVal))
-            return CHIP_ERROR_TLV_UNDERRUN;
-    }
-
     return CHIP_NO_ERROR;
 }
 
-Tag TLVReader::ReadTag(TLVTagControl tagControl, const uint8_t *& p)
+Tag TLVReader::ReadTag(TLVTagControl tagControl, const uint8_t *& p) const
 {
     uint16_t vendorId;
     uint16_t profileNum;
@@ -120,7 +120,7 @@ enum
  *
  * @return @p true if the specified TLV type is valid; otherwise @p false.
  */
-inline bool IsValidTLVType(TLVElementType type)
+inline constexpr bool IsValidTLVType(TLVElementType type)
 {
     return type <= TLVElementType::EndOfContainer;
 }
@@ -130,7 +130,7 @@ inline bool IsValidTLVType(TLVElementType type)
  *
  * @return @p true if the specified TLV type implies the presence of an associated value field; otherwise @p false.
  */
-inline bool TLVTypeHasValue(TLVElementType type)
+inline constexpr bool TLVTypeHasValue(TLVElementType type)
 {
     return (type <= TLVElementType::UInt64 ||
             (type >= TLVElementType::FloatingPointNumber32 && type <= TLVElementType::ByteString_8ByteLength));
@@ -192,7 +192,7 @@ inline bool TLVTypeIsByteString(TLVElementType type)
 }
 
 // TODO: move to private namespace
-inline TLVFieldSize GetTLVFieldSize(TLVElementType type)
+inline constexpr TLVFieldSize GetTLVFieldSize(TLVElementType type)
 {
     if (TLVTypeHasValue(type))
         return static_cast<TLVFieldSize>(static_cast<uint8_t>(type) & kTLVTypeSizeMask);
@@ -200,7 +200,7 @@ inline TLVFieldSize GetTLVFieldSize(TLVElementType type)
 }
 
 // TODO: move to private namespace
-inline uint8_t TLVFieldSizeToBytes(TLVFieldSize fieldSize)
+inline constexpr uint8_t TLVFieldSizeToBytes(TLVFieldSize fieldSize)
 {
     // We would like to assert fieldSize < 7, but that gives us fatal
     // -Wtautological-constant-out-of-range-compare warnings...
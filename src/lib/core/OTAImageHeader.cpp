@@ -0,0 +1,193 @@
+/*
+ *
+ *    Copyright (c) 2022 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include "OTAImageHeader.h"
+
+#include <lib/core/CHIPTLV.h>
+#include <lib/support/BufferReader.h>
+#include <lib/support/CHIPMem.h>
+#include <lib/support/CodeUtils.h>
+#include <lib/support/TypeTraits.h>
+
+#include <string.h>
+
+namespace chip {
+
+namespace {
+
+enum class HeaderTag : uint8_t
+{
+    kVendorId              = 0,
+    kProductId             = 1,
+    kSoftwareVersion       = 2,
+    kSoftwareVersionString = 3,
+    kPayloadSize           = 4,
+    kMinApplicableVersion  = 5,
+    kMaxApplicableVersion  = 6,
+    kReleaseNotesURL       = 7,
+    kImageDigestType       = 8,
+    kImageDigest           = 9,
+};
+
+TLV::Tag ContextTag(HeaderTag tag)
+{
+    return TLV::ContextTag(to_underlying(tag));
+}
+
+} // namespace
+
+CHIP_ERROR OTAImageHeaderParser::Init()
+{
+    Clear();
+
+    mBuffer = static_cast<uint8_t *>(Platform::MemoryAlloc(kFixedHeaderSize));
+    VerifyOrReturnError(mBuffer != nullptr, CHIP_ERROR_NO_MEMORY);
+
+    mState = State::kFixed;
+    return CHIP_NO_ERROR;
+}
+
+void OTAImageHeaderParser::Clear()
+{
+    if (mBuffer != nullptr)
+    {
+        Platform::MemoryFree(mBuffer);
+    }
+
+    mState         = State::kNotInitialized;
+    mTotalSize     = 0;
+    mHeaderTlvSize = 0;
+    mBufferOffset  = 0;
+    mBuffer        = nullptr;
+}
+
+CHIP_ERROR OTAImageHeaderParser::AccumulateAndDecode(ByteSpan & buffer, OTAImageHeader & header)
+{
+    if (mState == State::kFixed)
+    {
+        VerifyOrReturnError(Accumulate(buffer, kFixedHeaderSize), CHIP_ERROR_BUFFER_TOO_SMALL);
+        ReturnErrorOnFailure(DecodeFixed());
+    }
+
+    if (mState == State::kTLV)
+    {
+        VerifyOrReturnError(Accumulate(buffer, mHeaderTlvSize), CHIP_ERROR_BUFFER_TOO_SMALL);
+        return DecodeTLV(header);
+    }
+
+    return CHIP_ERROR_INCORRECT_STATE;
+}
+
+bool OTAImageHeaderParser::Accumulate(ByteSpan & buffer, size_t length)
+{
+    const size_t numBytes = chip::min(length - mBufferOffset, buffer.size());
+
+    if (numBytes > 0)
+    {
+        memcpy(&mBuffer[mBufferOffset], buffer.data(), numBytes);
+        mBufferOffset += numBytes;
+        buffer = buffer.SubSpan(numBytes);
+    }
+
+    return mBufferOffset == length;
+}
+
+CHIP_ERROR OTAImageHeaderParser::DecodeFixed()
+{
+    Encoding::LittleEndian::Reader reader(mBuffer, kFixedHeaderSize);
+    uint32_t fileIdentifier;
+
+    ReturnErrorOnFailure(reader.Read32(&fileIdentifier).Read64(&mTotalSize).Read32(&mHeaderTlvSize).StatusCode());
+    VerifyOrReturnError(fileIdentifier == kFileIdentifier, CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(mHeaderTlvSize > 0, CHIP_ERROR_INVALID_MESSAGE_LENGTH);
+    VerifyOrReturnError(mHeaderTlvSize <= kMaxHeaderSize, CHIP_ERROR_NO_MEMORY);
+
+    // The fixed fields have been decoded: reuse the memory for the header TLV
+    Platform::MemoryFree(mBuffer);
+    mBuffer       = static_cast<uint8_t *>(Platform::MemoryAlloc(mHeaderTlvSize));
+    mBufferOffset = 0;
+    VerifyOrReturnError(mBuffer != nullptr, CHIP_ERROR_NO_MEMORY);
+
+    mState = State::kTLV;
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR OTAImageHeaderParser::DecodeTLV(OTAImageHeader & header)
+{
+    TLV::TLVReader reader;
+    TLV::TLVType outerType;
+    uint8_t digestType;
+
+    reader.Init(mBuffer, mHeaderTlvSize);
+    ReturnErrorOnFailure(reader.Next(TLV::kTLVType_Structure, TLV::AnonymousTag));
+    ReturnErrorOnFailure(reader.EnterContainer(outerType));
+
+    ReturnErrorOnFailure(reader.Next(ContextTag(HeaderTag::kVendorId)));
+    ReturnErrorOnFailure(reader.Get(header.mVendorId));
+    ReturnErrorOnFailure(reader.Next(ContextTag(HeaderTag::kProductId)));
+    ReturnErrorOnFailure(reader.Get(header.mProductId));
+    ReturnErrorOnFailure(reader.Next(ContextTag(HeaderTag::kSoftwareVersion)));
+    ReturnErrorOnFailure(reader.Get(header.mSoftwareVersion));
+    ReturnErrorOnFailure(reader.Next(ContextTag(HeaderTag::kSoftwareVersionString)));
+    ReturnErrorOnFailure(reader.Get(header.mSoftwareVersionString));
+    ReturnErrorOnFailure(reader.Next(ContextTag(HeaderTag::kPayloadSize)));
+    ReturnErrorOnFailure(reader.Get(header.mPayloadSize));
+    ReturnErrorOnFailure(reader.Next());
+
+    header.mMinApplicableVersion.ClearValue();
+    if (reader.GetTag() == ContextTag(HeaderTag::kMinApplicableVersion))
+    {
+        uint32_t version;
+        ReturnErrorOnFailure(reader.Get(version));
+        header.mMinApplicableVersion.SetValue(version);
+        ReturnErrorOnFailure(reader.Next());
+    }
+
+    header.mMaxApplicableVersion.ClearValue();
+    if (reader.GetTag() == ContextTag(HeaderTag::kMaxApplicableVersion))
+    {
+        uint32_t version;
+        ReturnErrorOnFailure(reader.Get(version));
+        header.mMaxApplicableVersion.SetValue(version);
+        ReturnErrorOnFailure(reader.Next());
+    }
+
+    header.mReleaseNotesURL = CharSpan();
+    if (reader.GetTag() == ContextTag(HeaderTag::kReleaseNotesURL))
+    {
+        ReturnErrorOnFailure(reader.Get(header.mReleaseNotesURL));
+        ReturnErrorOnFailure(reader.Next());
+    }
+
+    VerifyOrReturnError(reader.GetTag() == ContextTag(HeaderTag::kImageDigestType), CHIP_ERROR_INVALID_TLV_TAG);
+    ReturnErrorOnFailure(reader.Get(digestType));
+    header.mImageDigestType = static_cast<OTAImageDigestType>(digestType);
+    ReturnErrorOnFailure(reader.Next(ContextTag(HeaderTag::kImageDigest)));
+    ReturnErrorOnFailure(reader.Get(header.mImageDigest));
+
+    // Skips any field added by a later revision of the format
+    ReturnErrorOnFailure(reader.ExitContainer(outerType));
+
+    const uint64_t headerSize = kFixedHeaderSize + mHeaderTlvSize;
+    VerifyOrReturnError(mTotalSize >= headerSize && mTotalSize - headerSize == header.mPayloadSize,
+                        CHIP_ERROR_INVALID_MESSAGE_LENGTH);
+
+    mState = State::kDecoded;
+    return CHIP_NO_ERROR;
+}
+
+} // namespace chip
@@ -0,0 +1,137 @@
+/*
+ *
+ *    Copyright (c) 2022 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This file defines the header of Matter OTA image files and a parser that decodes it from a stream of blocks.
+ */
+
+#pragma once
+
+#include <lib/core/CHIPError.h>
+#include <lib/core/Optional.h>
+#include <lib/support/Span.h>
+
+#include <stdint.h>
+
+namespace chip {
+
+/**
+ * Digest algorithms an OTA image may use, as registered in the IANA Named Information Hash Algorithm Registry.
+ */
+enum class OTAImageDigestType : uint8_t
+{
+    kSha256     = 1,
+    kSha256_128 = 2,
+    kSha256_120 = 3,
+    kSha256_96  = 4,
+    kSha256_64  = 5,
+    kSha256_32  = 6,
+    kSha384     = 7,
+    kSha512     = 8,
+    kSha3_224   = 9,
+    kSha3_256   = 10,
+    kSha3_384   = 11,
+    kSha3_512   = 12,
+};
+
+/**
+ * Decoded header of an OTA image.
+ *
+ * The spans point into the parser that decoded the header and remain valid until the parser is cleared.
+ */
+struct OTAImageHeader
+{
+    uint16_t mVendorId;
+    uint16_t mProductId;
+    uint32_t mSoftwareVersion;
+    CharSpan mSoftwareVersionString;
+    uint64_t mPayloadSize;
+    Optional<uint32_t> mMinApplicableVersion;
+    Optional<uint32_t> mMaxApplicableVersion;
+    CharSpan mReleaseNotesURL;
+    OTAImageDigestType mImageDigestType;
+    ByteSpan mImageDigest;
+};
+
+/**
+ * Decodes the header of an OTA image as its blocks arrive.
+ *
+ * Blocks are passed to AccumulateAndDecode() in order until it stops returning CHIP_ERROR_BUFFER_TOO_SMALL. Only the bytes that
+ * belong to the header are consumed, so the caller can keep processing the rest of the block as payload.
+ */
+class OTAImageHeaderParser
+{
+public:
+    static constexpr uint32_t kFileIdentifier = 0x1BEEF11E;
+
+    // File Identifier, Total Size and Header Size
+    static constexpr size_t kFixedHeaderSize = 16;
+
+    // Largest header TLV accepted, bounding the memory used to decode it
+    static constexpr size_t kMaxHeaderSize = 1024;
+
+    ~OTAImageHeaderParser() { Clear(); }
+
+    /**
+     * Prepare the parser for a new image, allocating the buffer used to accumulate the fixed part of the header.
+     */
+    CHIP_ERROR Init();
+
+    /**
+     * Release the memory held by the parser. Spans of a header decoded by the parser are no longer valid after this call.
+     */
+    void Clear();
+
+    bool IsInitialized() const { return mState != State::kNotInitialized; }
+
+    /**
+     * Consume the header bytes at the beginning of buffer and decode the header once all of it has been received.
+     *
+     * @param[in,out] buffer The next block of the image. On return it only holds the bytes that follow the header, if any.
+     * @param[out]    header The decoded header, set when CHIP_NO_ERROR is returned.
+     *
+     * @retval CHIP_NO_ERROR                 The header has been decoded.
+     * @retval CHIP_ERROR_BUFFER_TOO_SMALL   All of buffer belongs to the header and more data is needed.
+     * @retval CHIP_ERROR_INVALID_ARGUMENT   The image does not start with the OTA image file identifier.
+     * @retval CHIP_ERROR_NO_MEMORY          The header is larger than kMaxHeaderSize or cannot be allocated.
+     * @retval CHIP_ERROR_INCORRECT_STATE    The parser has not been initialized or the header has been decoded already.
+     * @retval other                         The header is malformed.
+     */
+    CHIP_ERROR AccumulateAndDecode(ByteSpan & buffer, OTAImageHeader & header);
+
+private:
+    enum class State : uint8_t
+    {
+        kNotInitialized,
+        kFixed,
+        kTLV,
+        kDecoded,
+    };
+
+    bool Accumulate(ByteSpan & buffer, size_t length);
+    CHIP_ERROR DecodeFixed();
+    CHIP_ERROR DecodeTLV(OTAImageHeader & header);
+
+    State mState            = State::kNotInitialized;
+    uint64_t mTotalSize     = 0;
+    uint32_t mHeaderTlvSize = 0;
+    size_t mBufferOffset    = 0;
+    uint8_t * mBuffer       = nullptr;
+};
+
+} // namespace chip
@@ -2805,6 +2805,101 @@ void CheckBufferOverflow(nlTestSuite * inSuite, void * inContext)
     }
 }
 
+/**
+ *  Test writing to a chain of PacketBuffers grown on demand
+ */
+void CheckPacketBufferChainedWriter(nlTestSuite * inSuite, void * inContext)
+{
+    constexpr uint16_t kBlockSize = 8;
+    System::PacketBufferHandle buf;
+    System::PacketBufferTLVReader reader;
+
+    // Small blocks force the encoding to be spread over a chain of buffers allocated as it grows.
+    {
+        System::PacketBufferTLVWriter writer;
+        NL_TEST_ASSERT(inSuite, writer.InitChained(sizeof(Encoding1), kBlockSize) == CHIP_NO_ERROR);
+        writer.ImplicitProfileId = TestProfile_2;
+
+        WriteEncoding1(inSuite, writer);
+
+        NL_TEST_ASSERT(inSuite, writer.Finalize(&buf) == CHIP_NO_ERROR);
+    }
+
+#if CHIP_SYSTEM_PACKETBUFFER_STORE == CHIP_SYSTEM_PACKETBUFFER_STORE_CHIP_HEAP
+    NL_TEST_ASSERT(inSuite, buf->HasChainedBuffer());
+#else
+    // Buffers from a fixed pool are never chained.
+    NL_TEST_ASSERT(inSuite, !buf->HasChainedBuffer());
+#endif
+    NL_TEST_ASSERT(inSuite, buf->TotalLength() == sizeof(Encoding1));
+    NL_TEST_ASSERT(inSuite, buf->ReservedSize() >= System::PacketBuffer::kDefaultHeaderReserve);
+    TestBufferContents(inSuite, buf, Encoding1, sizeof(Encoding1));
+
+    // The chain is gathered into a single buffer before it is read or sent.
+    NL_TEST_ASSERT(inSuite, buf.Coalesce());
+    NL_TEST_ASSERT(inSuite, !buf->HasChainedBuffer());
+
+    reader.Init(std::move(buf));
+    reader.ImplicitProfileId = TestProfile_2;
+
+    ReadEncoding1(inSuite, reader);
+
+    // The maximum length bounds the whole chain, not just a single buffer.
+    {
+        System::PacketBufferTLVWriter writer;
+        NL_TEST_ASSERT(inSuite, writer.InitChained(sizeof(Encoding1) - 1, kBlockSize) == CHIP_NO_ERROR);
+        NL_TEST_ASSERT(inSuite, writer.PutBytes(AnonymousTag, Encoding1, sizeof(Encoding1)) == CHIP_ERROR_BUFFER_TOO_SMALL);
+    }
+
+    // Rolling a writer back to a checkpoint taken in an earlier buffer of the chain drops what was written since.
+    {
+        System::PacketBufferTLVWriter writer;
+        NL_TEST_ASSERT(inSuite, writer.InitChained(sizeof(Encoding1), kBlockSize) == CHIP_NO_ERROR);
+        writer.ImplicitProfileId = TestProfile_2;
+
+        TLVWriter checkpoint = writer;
+        NL_TEST_ASSERT(inSuite, writer.PutBytes(AnonymousTag, Encoding1, 4 * kBlockSize) == CHIP_NO_ERROR);
+        static_cast<TLVWriter &>(writer) = checkpoint;
+        NL_TEST_ASSERT(inSuite, writer.PutBoolean(AnonymousTag, true) == CHIP_NO_ERROR);
+
+        NL_TEST_ASSERT(inSuite, writer.Finalize(&buf) == CHIP_NO_ERROR);
+    }
+
+    NL_TEST_ASSERT(inSuite, buf->TotalLength() == 1);
+    NL_TEST_ASSERT(inSuite, buf->Start()[0] == 0x09);
+
+    // The buffers left behind by a rollback are reused as the encoding grows again.
+    {
+        System::PacketBufferTLVWriter writer;
+        NL_TEST_ASSERT(inSuite, writer.InitChained(sizeof(Encoding1), kBlockSize) == CHIP_NO_ERROR);
+        writer.ImplicitProfileId = TestProfile_2;
+
+        TLVWriter checkpoint = writer;
+        NL_TEST_ASSERT(inSuite, writer.PutBytes(AnonymousTag, Encoding1, 4 * kBlockSize) == CHIP_NO_ERROR);
+        static_cast<TLVWriter &>(writer) = checkpoint;
+        WriteEncoding1(inSuite, writer);
+
+        NL_TEST_ASSERT(inSuite, writer.Finalize(&buf) == CHIP_NO_ERROR);
+    }
+
+    NL_TEST_ASSERT(inSuite, buf->TotalLength() == sizeof(Encoding1));
+    TestBufferContents(inSuite, buf, Encoding1, sizeof(Encoding1));
+
+    // A block size of 0 writes to a single buffer of the maximum length.
+    {
+        System::PacketBufferTLVWriter writer;
+        NL_TEST_ASSERT(inSuite, writer.InitChained(sizeof(Encoding1), 0) == CHIP_NO_ERROR);
+        writer.ImplicitProfileId = TestProfile_2;
+
+        WriteEncoding1(inSuite, writer);
+
+        NL_TEST_ASSERT(inSuite, writer.Finalize(&buf) == CHIP_NO_ERROR);
+    }
+
+    NL_TEST_ASSERT(inSuite, !buf->HasChainedBuffer());
+    TestBufferContents(inSuite, buf, Encoding1, sizeof(Encoding1));
+}
+
 /**
  * Test case to verify the correctness of TLVReader::GetTag()
  *
@@ -4339,6 +4434,367 @@ static void CheckCHIPTLVScopedBuffer(nlTestSuite * inSuite, void * inContext)
     }
 }
 
+/**
+ * Backing store that hands out an encoding a few bytes at a time, so that the reader can only scan the elements that fit
+ * in each piece in place and has to read the others element by element.
+ */
+class ChunkedBackingStore : public TLVBackingStore
+{
+public:
+    ChunkedBackingStore(const uint8_t * data, uint32_t dataLen, uint32_t chunkSize) :
+        mData(data), mDataLen(dataLen), mChunkSize(chunkSize)
+    {}
+
+    CHIP_ERROR OnInit(TLVReader & reader, const uint8_t *& bufStart, uint32_t & bufLen) override
+    {
+        bufStart = mData;
+        bufLen   = chip::min(mChunkSize, mDataLen);
+        return CHIP_NO_ERROR;
+    }
+
+    CHIP_ERROR GetNextBuffer(TLVReader & reader, const uint8_t *& bufStart, uint32_t & bufLen) override
+    {
+        // Copies of the reader share the store, so the next piece is the one that follows the reader's position
+        const uint32_t offset = static_cast<uint32_t>(reader.GetReadPoint() - mData);
+
+        bufStart = reader.GetReadPoint();
+        bufLen   = chip::min(mChunkSize, mDataLen - offset);
+        return CHIP_NO_ERROR;
+    }
+
+    CHIP_ERROR OnInit(TLVWriter & writer, uint8_t *& bufStart, uint32_t & bufLen) override { return CHIP_ERROR_NOT_IMPLEMENTED; }
+    CHIP_ERROR GetNewBuffer(TLVWriter & writer, uint8_t *& bufStart, uint32_t & bufLen) override
+    {
+        return CHIP_ERROR_NOT_IMPLEMENTED;
+    }
+    CHIP_ERROR FinalizeBuffer(TLVWriter & writer, uint8_t * bufStart, uint32_t bufLen) override
+    {
+        return CHIP_ERROR_NOT_IMPLEMENTED;
+    }
+
+private:
+    const uint8_t * mData;
+    uint32_t mDataLen;
+    uint32_t mChunkSize;
+};
+
+/**
+ * Record of the results of the operations that use the structural scan, compared between readers of the same encoding.
+ */
+struct ScanTrace
+{
+    static constexpr size_t kMaxEntries = 512;
+
+    void Add(uint64_t value)
+    {
+        if (mCount < kMaxEntries)
+            mEntries[mCount++] = value;
+    }
+    void Add(CHIP_ERROR err) { Add(static_cast<uint64_t>(err.AsInteger())); }
+
+    bool operator==(const ScanTrace & other) const
+    {
+        return mCount == other.mCount && memcmp(mEntries, other.mEntries, mCount * sizeof(mEntries[0])) == 0;
+    }
+
+    uint64_t mEntries[kMaxEntries];
+    size_t mCount = 0;
+};
+
+static Tag RandomTag(TLVType containerType)
+{
+    if (containerType == kTLVType_Array || (containerType == kTLVType_List && rand() % 2 == 0))
+        return AnonymousTag;
+
+    switch (rand() % 5)
+    {
+    case 0:
+        return CommonTag(static_cast<uint32_t>(rand()) % 0x20000);
+    case 1:
+        return ProfileTag(TestProfile_1, static_cast<uint32_t>(rand()));
+    case 2:
+        // Written in implicit form
+        return ProfileTag(TestProfile_2, static_cast<uint32_t>(rand()) % 0x20000);
+    default:
+        return ContextTag(static_cast<uint8_t>(rand() % 4));
+    }
+}
+
+static CHIP_ERROR WriteRandomElement(TLVWriter & writer, Tag tag, uint32_t depth)
+{
+    static const uint8_t sData[300] = { 0 };
+
+    switch (rand() % (depth < 4 ? 10 : 7))
+    {
+    case 0:
+        return writer.Put(tag, static_cast<int64_t>(rand()) * (rand() % 2 == 0 ? -1 : 1));
+    case 1:
+        return writer.Put(tag, static_cast<uint64_t>(rand()) << (rand() % 40));
+    case 2:
+        return writer.PutBoolean(tag, rand() % 2 == 0);
+    case 3:
+        return writer.PutNull(tag);
+    case 4:
+        return writer.Put(tag, 1.5f);
+    case 5:
+        return writer.PutString(tag, reinterpret_cast<const char *>(sData), static_cast<uint32_t>(rand() % 20));
+    case 6:
+        return writer.PutBytes(tag, sData, static_cast<uint32_t>(rand() % 4 == 0 ? sizeof(sData) : rand() % 20));
+    default: {
+        const TLVType types[]       = { kTLVType_Structure, kTLVType_Array, kTLVType_List };
+        const TLVType containerType = types[rand() % 3];
+        const int numElements       = rand() % 6;
+        TLVType outerContainerType;
+
+        ReturnErrorOnFailure(writer.StartContainer(tag, containerType, outerContainerType));
+        for (int i = 0; i < numElements; i++)
+        {
+            ReturnErrorOnFailure(WriteRandomElement(writer, RandomTag(containerType), depth + 1));
+        }
+        return writer.EndContainer(outerContainerType);
+    }
+    }
+}
+
+static void WalkForScanTrace(TLVReader & reader, ScanTrace & trace, uint32_t depth, size_t maxElements)
+{
+    CHIP_ERROR err       = CHIP_NO_ERROR;
+    size_t numElements   = 0;
+    size_t numContainers = 0;
+
+    while (numElements < maxElements && (err = reader.Next()) == CHIP_NO_ERROR)
+    {
+        numElements++;
+        trace.Add(reader.GetLengthRead());
+        trace.Add(reader.GetTag());
+
+        // Every other container is entered, the others are skipped by the next call to Next()
+        if (TLVTypeIsContainer(reader.GetType()) && (numContainers++ % 2) == 0)
+        {
+            TLVType outerContainerType;
+            TLVReader found;
+            size_t count = 0;
+
+            trace.Add(reader.EnterContainer(outerContainerType));
+            trace.Add(reader.CountRemainingInContainer(&count));
+            trace.Add(count);
+
+            err = reader.FindElementWithTag(ContextTag(1), found);
+            trace.Add(err);
+            trace.Add(err == CHIP_NO_ERROR ? found.GetLengthRead() : 0);
+
+            // Only read the first elements so that ExitContainer() has to skip the rest
+            WalkForScanTrace(reader, trace, depth + 1, depth % 3);
+
+            trace.Add(reader.ExitContainer(outerContainerType));
+            trace.Add(reader.GetLengthRead());
+        }
+    }
+
+    if (numElements < maxElements)
+        trace.Add(err);
+}
+
+static void TraceScan(TLVReader & reader, ScanTrace & trace)
+{
+    WalkForScanTrace(reader, trace, 0, SIZE_MAX);
+}
+
+/**
+ *  Check that skipping, counting and finding elements give the same results whether the encoding is scanned in place or
+ *  read element by element, for random encodings and mutations of them.
+ */
+static void CheckTLVScanEquivalence(nlTestSuite * inSuite, void * inContext)
+{
+    static constexpr uint32_t kChunkSizes[] = { 1, 2, 5, 16 };
+    uint8_t buf[4096];
+
+    srand(42);
+
+    for (int iteration = 0; iteration < 2000; iteration++)
+    {
+        TLVWriter writer;
+        TLVType outerContainerType;
+        const int numElements = rand() % 8;
+
+        writer.Init(buf);
+        writer.ImplicitProfileId = TestProfile_2;
+
+        CHIP_ERROR err = writer.StartContainer(AnonymousTag, kTLVType_Structure, outerContainerType);
+        for (int i = 0; i < numElements && err == CHIP_NO_ERROR; i++)
+        {
+            err = WriteRandomElement(writer, RandomTag(kTLVType_Structure), 0);
+        }
+        if (err == CHIP_NO_ERROR)
+            err = writer.EndContainer(outerContainerType);
+        if (err == CHIP_NO_ERROR)
+            err = writer.Finalize();
+        if (err == CHIP_ERROR_BUFFER_TOO_SMALL)
+            continue;
+        NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+
+        const uint32_t encodingLen = writer.GetLengthWritten();
+
+        // The unmutated encoding is read through, and its structure has as many elements as were written
+        {
+            ContiguousBufferTLVReader reader;
+            TLVType containerType;
+            size_t count = 0;
+
+            reader.Init(buf, encodingLen);
+            reader.ImplicitProfileId = TestProfile_2;
+            NL_TEST_ASSERT(inSuite, reader.Next() == CHIP_NO_ERROR);
+            NL_TEST_ASSERT(inSuite, reader.EnterContainer(containerType) == CHIP_NO_ERROR);
+            NL_TEST_ASSERT(inSuite, reader.CountRemainingInContainer(&count) == CHIP_NO_ERROR);
+            NL_TEST_ASSERT(inSuite, count == static_cast<size_t>(numElements));
+            NL_TEST_ASSERT(inSuite, reader.ExitContainer(containerType) == CHIP_NO_ERROR);
+            NL_TEST_ASSERT(inSuite, reader.GetLengthRead() == encodingLen);
+            NL_TEST_ASSERT(inSuite, reader.Next() == CHIP_END_OF_TLV);
+        }
+
+        for (int mutation = 0; mutation < 4; mutation++)
+        {
+            const uint32_t offset = static_cast<uint32_t>(rand()) % encodingLen;
+            const uint8_t origVal = buf[offset];
+
+            // The first pass reads the unmutated encoding
+            if (mutation > 0)
+                buf[offset] = static_cast<uint8_t>(rand());
+
+            // Readers without an implicit profile fail on implicit tags
+            const uint32_t implicitProfileId = (mutation == 3) ? kProfileIdNotSpecified : TestProfile_2;
+            ScanTrace expected;
+            {
+                ContiguousBufferTLVReader reader;
+                reader.Init(buf, encodingLen);
+                reader.ImplicitProfileId = implicitProfileId;
+                TraceScan(reader, expected);
+            }
+
+            for (uint32_t chunkSize : kChunkSizes)
+            {
+                ChunkedBackingStore store(buf, encodingLen, chunkSize);
+                TLVReader reader;
+                ScanTrace trace;
+
+                NL_TEST_ASSERT(inSuite, reader.Init(store, encodingLen) == CHIP_NO_ERROR);
+                reader.ImplicitProfileId = implicitProfileId;
+                TraceScan(reader, trace);
+                NL_TEST_ASSERT(inSuite, trace == expected);
+            }
+
+            buf[offset] = origVal;
+        }
+    }
+}
+
+/**
+ *  Skip the rest of the current container element by element, entering every nested container instead of skipping it.
+ */
+static CHIP_ERROR SkipElementByElement(TLVReader & reader, size_t & count)
+{
+    CHIP_ERROR err;
+
+    count = 0;
+    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    {
+        count++;
+        if (TLVTypeIsContainer(reader.GetType()))
+        {
+            TLVType outerContainerType;
+            size_t nestedCount;
+
+            ReturnErrorOnFailure(reader.EnterContainer(outerContainerType));
+            ReturnErrorOnFailure(SkipElementByElement(reader, nestedCount));
+            ReturnErrorOnFailure(reader.ExitContainer(outerContainerType));
+        }
+    }
+
+    return err == CHIP_END_OF_TLV ? CHIP_NO_ERROR : err;
+}
+
+/**
+ *  Check that skipping, counting and finding elements of a large encoding that is scanned in place give the same results as
+ *  reading it element by element.
+ */
+static void CheckTLVScanLargeEncoding(nlTestSuite * inSuite, void * inContext)
+{
+    static constexpr uint32_t kNumRecords = 2000;
+    const char kName[]                    = "0123456789abcdef";
+
+    Platform::ScopedMemoryBuffer<uint8_t> buf;
+    const size_t bufLen = 128 * 1024;
+    NL_TEST_ASSERT(inSuite, buf.Alloc(bufLen));
+
+    TLVWriter writer;
+    TLVType outerContainerType;
+    writer.Init(buf.Get(), bufLen);
+
+    // A structure of records, each with a few fields, a short array and a nested structure
+    CHIP_ERROR err = writer.StartContainer(AnonymousTag, kTLVType_Structure, outerContainerType);
+    for (uint32_t i = 0; i < kNumRecords && err == CHIP_NO_ERROR; i++)
+    {
+        TLVType recordType;
+        TLVType fieldType;
+
+        SuccessOrExit(err = writer.StartContainer(CommonTag(i), kTLVType_Structure, recordType));
+        SuccessOrExit(err = writer.Put(ContextTag(0), i));
+        SuccessOrExit(err = writer.PutString(ContextTag(1), kName));
+        SuccessOrExit(err = writer.PutBoolean(ContextTag(2), (i % 2) == 0));
+        SuccessOrExit(err = writer.StartContainer(ContextTag(3), kTLVType_Array, fieldType));
+        for (uint8_t j = 0; j < 4; j++)
+        {
+            SuccessOrExit(err = writer.Put(AnonymousTag, j));
+        }
+        SuccessOrExit(err = writer.EndContainer(fieldType));
+        SuccessOrExit(err = writer.StartContainer(ContextTag(4), kTLVType_Structure, fieldType));
+        SuccessOrExit(err = writer.Put(ContextTag(0), static_cast<int64_t>(i) << 32));
+        SuccessOrExit(err = writer.PutBytes(ContextTag(1), reinterpret_cast<const uint8_t *>(kName), 8));
+        SuccessOrExit(err = writer.EndContainer(fieldType));
+        SuccessOrExit(err = writer.EndContainer(recordType));
+    }
+    SuccessOrExit(err = writer.EndContainer(outerContainerType));
+    SuccessOrExit(err = writer.Finalize());
+
+    {
+        const uint32_t encodingLen = writer.GetLengthWritten();
+        ContiguousBufferTLVReader reader;
+        TLVReader found;
+        TLVType containerType;
+        size_t count = 0;
+
+        reader.Init(buf.Get(), encodingLen);
+        NL_TEST_ASSERT(inSuite, reader.Next() == CHIP_NO_ERROR);
+        NL_TEST_ASSERT(inSuite, reader.EnterContainer(containerType) == CHIP_NO_ERROR);
+
+        {
+            TLVReader scalarReader;
+            scalarReader.Init(reader);
+            NL_TEST_ASSERT(inSuite, SkipElementByElement(scalarReader, count) == CHIP_NO_ERROR);
+            NL_TEST_ASSERT(inSuite, count == kNumRecords);
+            NL_TEST_ASSERT(inSuite, scalarReader.GetLengthRead() == encodingLen);
+        }
+
+        count = 0;
+        NL_TEST_ASSERT(inSuite, reader.CountRemainingInContainer(&count) == CHIP_NO_ERROR);
+        NL_TEST_ASSERT(inSuite, count == kNumRecords);
+
+        TLVType recordType;
+        uint32_t lastRecord = 0;
+        NL_TEST_ASSERT(inSuite, reader.FindElementWithTag(CommonTag(kNumRecords - 1), found) == CHIP_NO_ERROR);
+        NL_TEST_ASSERT(inSuite, found.EnterContainer(recordType) == CHIP_NO_ERROR);
+        NL_TEST_ASSERT(inSuite, found.Next(ContextTag(0)) == CHIP_NO_ERROR);
+        NL_TEST_ASSERT(inSuite, found.Get(lastRecord) == CHIP_NO_ERROR);
+        NL_TEST_ASSERT(inSuite, lastRecord == kNumRecords - 1);
+
+        NL_TEST_ASSERT(inSuite, reader.ExitContainer(containerType) == CHIP_NO_ERROR);
+        NL_TEST_ASSERT(inSuite, reader.GetLengthRead() == encodingLen);
+    }
+
+exit:
+    NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+}
+
 // Test Suite
 
 /**
@@ -4350,6 +4806,7 @@ static const nlTest sTests[] =
     NL_TEST_DEF("Simple Write Read Test",              CheckSimpleWriteRead),
     NL_TEST_DEF("Inet Buffer Test",                    CheckPacketBuffer),
     NL_TEST_DEF("Buffer Overflow Test",                CheckBufferOverflow),
+    NL_TEST_DEF("Chained Writer Test",                 CheckPacketBufferChainedWriter),
     NL_TEST_DEF("Pretty Print Test",                   CheckPrettyPrinter),
     NL_TEST_DEF("Data Macro Test",                     CheckDataMacro),
     NL_TEST_DEF("Strict Aliasing Test",                CheckStrictAliasing),
@@ -4374,6 +4831,8 @@ static const nlTest sTests[] =
     NL_TEST_DEF("CHIP TLV GetStringView Test",         CheckGetStringView),
     NL_TEST_DEF("CHIP TLV GetByteView Test",           CheckGetByteView),
     NL_TEST_DEF("Int Min/Max Test",                    TestIntMinMax),
+    NL_TEST_DEF("CHIP TLV Scan Equivalence",           CheckTLVScanEquivalence),
+    NL_TEST_DEF("CHIP TLV Scan Large Encoding",        CheckTLVScanLargeEncoding),
 
     NL_TEST_SENTINEL()
 };
@@ -0,0 +1,253 @@
+/*
+ *
+ *    Copyright (c) 2022 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This file implements unit tests for the OTA image header parser.
+ *
+ */
+
+#include <lib/core/CHIPEncoding.h>
+#include <lib/core/CHIPTLV.h>
+#include <lib/core/OTAImageHeader.h>
+#include <lib/support/BufferWriter.h>
+#include <lib/support/CHIPMem.h>
+#include <lib/support/CodeUtils.h>
+#include <lib/support/UnitTestRegistration.h>
+
+#include <nlunit-test.h>
+
+#include <string.h>
+
+using namespace chip;
+
+namespace {
+
+constexpr uint8_t kDigest[] = { 0xb7, 0x8f, 0x65, 0x95, 0x30, 0x8b, 0x39, 0x8d, 0x1e, 0x58, 0x62, 0x79, 0x72, 0x1d, 0x2b, 0x4c,
+                                0x9c, 0x48, 0x26, 0x6c, 0x1e, 0x0a, 0x7e, 0x0c, 0x3c, 0x23, 0x62, 0xa1, 0x19, 0x5c, 0x39, 0x5e };
+constexpr char kVersionString[] = "1.2.3";
+constexpr char kReleaseNotes[]  = "https://example.com/release-notes";
+constexpr char kPayload[]       = "OTA image payload";
+
+/**
+ * Encode an OTA image holding kPayload into buffer and return its size, or 0 if it does not fit.
+ */
+size_t EncodeImage(uint8_t * buffer, size_t bufferSize, bool withOptionalFields,
+                   uint32_t fileIdentifier = OTAImageHeaderParser::kFileIdentifier)
+{
+    uint8_t tlv[128];
+    TLV::TLVWriter writer;
+    TLV::TLVType outerType;
+
+    writer.Init(tlv);
+    VerifyOrReturnError(writer.StartContainer(TLV::AnonymousTag, TLV::kTLVType_Structure, outerType) == CHIP_NO_ERROR, 0);
+    VerifyOrReturnError(writer.Put(TLV::ContextTag(0), static_cast<uint16_t>(0xFFF1)) == CHIP_NO_ERROR, 0);
+    VerifyOrReturnError(writer.Put(TLV::ContextTag(1), static_cast<uint16_t>(0x8001)) == CHIP_NO_ERROR, 0);
+    VerifyOrReturnError(writer.Put(TLV::ContextTag(2), static_cast<uint32_t>(10)) == CHIP_NO_ERROR, 0);
+    VerifyOrReturnError(writer.PutString(TLV::ContextTag(3), kVersionString) == CHIP_NO_ERROR, 0);
+    VerifyOrReturnError(writer.Put(TLV::ContextTag(4), static_cast<uint64_t>(sizeof(kPayload))) == CHIP_NO_ERROR, 0);
+    if (withOptionalFields)
+    {
+        VerifyOrReturnError(writer.Put(TLV::ContextTag(5), static_cast<uint32_t>(5)) == CHIP_NO_ERROR, 0);
+        VerifyOrReturnError(writer.Put(TLV::ContextTag(6), static_cast<uint32_t>(9)) == CHIP_NO_ERROR, 0);
+        VerifyOrReturnError(writer.PutString(TLV::ContextTag(7), kReleaseNotes) == CHIP_NO_ERROR, 0);
+    }
+    VerifyOrReturnError(writer.Put(TLV::ContextTag(8), static_cast<uint8_t>(OTAImageDigestType::kSha256)) == CHIP_NO_ERROR, 0);
+    VerifyOrReturnError(writer.Put(TLV::ContextTag(9), ByteSpan(kDigest)) == CHIP_NO_ERROR, 0);
+    VerifyOrReturnError(writer.EndContainer(outerType) == CHIP_NO_ERROR, 0);
+    VerifyOrReturnError(writer.Finalize() == CHIP_NO_ERROR, 0);
+
+    const uint32_t tlvLength = writer.GetLengthWritten();
+    Encoding::LittleEndian::BufferWriter imageWriter(buffer, bufferSize);
+    imageWriter.Put32(fileIdentifier)
+        .Put64(OTAImageHeaderParser::kFixedHeaderSize + tlvLength + sizeof(kPayload))
+        .Put32(tlvLength)
+        .Put(tlv, tlvLength)
+        .Put(kPayload, sizeof(kPayload));
+    VerifyOrReturnError(imageWriter.Fit(), 0);
+
+    return imageWriter.Needed();
+}
+
+/**
+ * Feed the image to the parser in blocks of blockSize bytes and check the header and the payload that follows it.
+ */
+void DecodeInBlocks(nlTestSuite * inSuite, const uint8_t * image, size_t imageSize, size_t blockSize, bool withOptionalFields)
+{
+    OTAImageHeaderParser parser;
+    OTAImageHeader header;
+    CHIP_ERROR err = CHIP_ERROR_BUFFER_TOO_SMALL;
+    size_t offset  = 0;
+    ByteSpan block;
+
+    NL_TEST_ASSERT(inSuite, parser.Init() == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, parser.IsInitialized());
+
+    while (err == CHIP_ERROR_BUFFER_TOO_SMALL && offset < imageSize)
+    {
+        block = ByteSpan(image + offset, chip::min(blockSize, imageSize - offset));
+        offset += block.size();
+        err = parser.AccumulateAndDecode(block, header);
+    }
+
+    NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, header.mVendorId == 0xFFF1);
+    NL_TEST_ASSERT(inSuite, header.mProductId == 0x8001);
+    NL_TEST_ASSERT(inSuite, header.mSoftwareVersion == 10);
+    NL_TEST_ASSERT(inSuite, header.mSoftwareVersionString.data_equal(CharSpan(kVersionString, strlen(kVersionString))));
+    NL_TEST_ASSERT(inSuite, header.mPayloadSize == sizeof(kPayload));
+    NL_TEST_ASSERT(inSuite, header.mImageDigestType == OTAImageDigestType::kSha256);
+    NL_TEST_ASSERT(inSuite, header.mImageDigest.data_equal(ByteSpan(kDigest)));
+
+    if (withOptionalFields)
+    {
+        NL_TEST_ASSERT(inSuite, header.mMinApplicableVersion.HasValue() && header.mMinApplicableVersion.Value() == 5);
+        NL_TEST_ASSERT(inSuite, header.mMaxApplicableVersion.HasValue() && header.mMaxApplicableVersion.Value() == 9);
+        NL_TEST_ASSERT(inSuite, header.mReleaseNotesURL.data_equal(CharSpan(kReleaseNotes, strlen(kReleaseNotes))));
+    }
+    else
+    {
+        NL_TEST_ASSERT(inSuite, !header.mMinApplicableVersion.HasValue());
+        NL_TEST_ASSERT(inSuite, !header.mMaxApplicableVersion.HasValue());
+        NL_TEST_ASSERT(inSuite, header.mReleaseNotesURL.empty());
+    }
+
+    // The rest of the last block and the blocks after it are the payload
+    const size_t payloadOffset = offset - block.size();
+    NL_TEST_ASSERT(inSuite, payloadOffset + sizeof(kPayload) == imageSize);
+    NL_TEST_ASSERT(inSuite, block.empty() || block.data() == image + payloadOffset);
+    NL_TEST_ASSERT(inSuite, memcmp(image + payloadOffset, kPayload, sizeof(kPayload)) == 0);
+
+    // Nothing left to decode
+    NL_TEST_ASSERT(inSuite, parser.AccumulateAndDecode(block, header) == CHIP_ERROR_INCORRECT_STATE);
+
+    parser.Clear();
+    NL_TEST_ASSERT(inSuite, !parser.IsInitialized());
+}
+
+void TestDecodeWholeImage(nlTestSuite * inSuite, void * inContext)
+{
+    uint8_t image[256];
+    const size_t imageSize = EncodeImage(image, sizeof(image), true);
+    NL_TEST_ASSERT(inSuite, imageSize > 0);
+
+    DecodeInBlocks(inSuite, image, imageSize, imageSize, true);
+}
+
+void TestDecodeInSmallBlocks(nlTestSuite * inSuite, void * inContext)
+{
+    uint8_t image[256];
+    size_t imageSize = EncodeImage(image, sizeof(image), true);
+    NL_TEST_ASSERT(inSuite, imageSize > 0);
+
+    // Blocks that split the fixed fields, the TLV and the payload at different offsets
+    for (size_t blockSize : { 1, 3, 7, 16, 17, 64 })
+    {
+        DecodeInBlocks(inSuite, image, imageSize, blockSize, true);
+    }
+
+    imageSize = EncodeImage(image, sizeof(image), false);
+    NL_TEST_ASSERT(inSuite, imageSize > 0);
+
+    for (size_t blockSize : { 1, 5, 32 })
+    {
+        DecodeInBlocks(inSuite, image, imageSize, blockSize, false);
+    }
+}
+
+void TestInvalidImage(nlTestSuite * inSuite, void * inContext)
+{
+    uint8_t image[256];
+    OTAImageHeaderParser parser;
+    OTAImageHeader header;
+    ByteSpan block;
+
+    // Not initialized
+    NL_TEST_ASSERT(inSuite, parser.AccumulateAndDecode(block, header) == CHIP_ERROR_INCORRECT_STATE);
+
+    // Wrong file identifier
+    size_t imageSize = EncodeImage(image, sizeof(image), false, 0x12345678);
+    NL_TEST_ASSERT(inSuite, imageSize > 0);
+    block = ByteSpan(image, imageSize);
+    NL_TEST_ASSERT(inSuite, parser.Init() == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, parser.AccumulateAndDecode(block, header) == CHIP_ERROR_INVALID_ARGUMENT);
+
+    // Header larger than the parser accepts
+    imageSize = EncodeImage(image, sizeof(image), false);
+    NL_TEST_ASSERT(inSuite, imageSize > 0);
+    Encoding::LittleEndian::Put32(&image[12], static_cast<uint32_t>(OTAImageHeaderParser::kMaxHeaderSize + 1));
+    block = ByteSpan(image, imageSize);
+    NL_TEST_ASSERT(inSuite, parser.Init() == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, parser.AccumulateAndDecode(block, header) == CHIP_ERROR_NO_MEMORY);
+
+    // Total size inconsistent with the header
+    imageSize = EncodeImage(image, sizeof(image), false);
+    NL_TEST_ASSERT(inSuite, imageSize > 0);
+    Encoding::LittleEndian::Put64(&image[4], imageSize + 1);
+    block = ByteSpan(image, imageSize);
+    NL_TEST_ASSERT(inSuite, parser.Init() == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, parser.AccumulateAndDecode(block, header) == CHIP_ERROR_INVALID_MESSAGE_LENGTH);
+
+    parser.Clear();
+}
+
+/**
+ *   Test Suite. It lists all the test functions.
+ */
+
+// clang-format off
+const nlTest sTests[] =
+{
+    NL_TEST_DEF("TestDecodeWholeImage", TestDecodeWholeImage),
+    NL_TEST_DEF("TestDecodeInSmallBlocks", TestDecodeInSmallBlocks),
+    NL_TEST_DEF("TestInvalidImage", TestInvalidImage),
+
+    NL_TEST_SENTINEL()
+};
+// clang-format on
+
+int TestOTAImageHeader_Setup(void * inContext)
+{
+    CHIP_ERROR error = chip::Platform::MemoryInit();
+    return (error == CHIP_NO_ERROR) ? SUCCESS : FAILURE;
+}
+
+int TestOTAImageHeader_Teardown(void * inContext)
+{
+    chip::Platform::MemoryShutdown();
+    return SUCCESS;
+}
+
+} // namespace
+
+int TestOTAImageHeader()
+{
+    // clang-format off
+    nlTestSuite theSuite =
+    {
+        "OTAImageHeader",
+        &sTests[0],
+        TestOTAImageHeader_Setup,
+        TestOTAImageHeader_Teardown
+    };
+    // clang-format on
+
+    nlTestRunner(&theSuite, nullptr);
+    return (nlTestRunnerStats(&theSuite));
+}
+
+CHIP_REGISTER_TEST_SUITE(TestOTAImageHeader)
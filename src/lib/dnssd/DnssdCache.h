@@ -18,6 +18,7 @@
 #pragma once
 
 #include <cstdint>
+#include <cstring>
 
 #include <inet/IPAddress.h>
 #include <inet/InetInterface.h>
@@ -36,147 +37,350 @@
 namespace chip {
 namespace Dnssd {
 
+/**
+ * Cache of resolved operational nodes, keyed by PeerId.
+ *
+ * Entries live in a fixed array indexed by a hash of the PeerId, so lookups do not depend on the number of cached nodes.
+ * Every entry carries the expiry time derived from the TTL of the records it was built from and is dropped once that passes.
+ * When the cache is full, the least recently used entry is evicted to make room.
+ *
+ * Besides resolved nodes, the cache can hold negative entries: peers that are known not to be reachable (e.g. they
+ * withdrew their records) until the entry expires, so callers can avoid querying the network for them again.
+ */
 template <size_t CACHE_SIZE>
 class DnssdCache
 {
 public:
-    DnssdCache() : elementsUsed(CACHE_SIZE)
+    struct Statistics
     {
-        for (ResolvedNodeData & e : mLookupTable)
-        {
-            // each unused entry decrements the count
-            MarkEntryUnused(e);
-        }
+        uint32_t mHits         = 0; // Lookups answered by a resolved node
+        uint32_t mNegativeHits = 0; // Lookups answered by a negative entry
+        uint32_t mMisses       = 0; // Lookups that found nothing usable
+        uint32_t mInsertions   = 0; // Entries added or refreshed
+        uint32_t mEvictions    = 0; // Live entries dropped to make room for new ones
+        uint32_t mExpirations  = 0; // Entries dropped because their TTL ran out
+    };
+
+    DnssdCache()
+    {
+        Clear();
         MdnsLogProgress(Discovery, "construct mdns cache of size %ld", CACHE_SIZE);
     }
 
-    // insert this entry into the cache.
-    // return error if cache is full
-    // TODO:   have an eviction policy so if the cache is full, an entry may be deleted.
-    //         One policy may be Least-time-to-live
-    CHIP_ERROR Insert(const ResolvedNodeData & nodeData)
-    {
-        const System::Clock::Timestamp currentTime = System::SystemClock().GetMonotonicTimestamp();
+    // insert this entry into the cache, replacing any entry for the same peer.
+    // An entry that is already expired (e.g. built from records with a TTL of 0, which withdraw them) removes the peer
+    // instead.  If the cache is full, the least recently used entry is evicted.
+    CHIP_ERROR Insert(const ResolvedNodeData & nodeData) { return Store(nodeData.mPeerId, &nodeData, nodeData.mExpiryTime); }
 
-        ResolvedNodeData * entry;
+    // remember that peerId cannot currently be resolved, until expiryTime.
+    // A resolved entry for the peer, if any, is replaced.
+    CHIP_ERROR InsertNegative(PeerId peerId, System::Clock::Timestamp expiryTime) { return Store(peerId, nullptr, expiryTime); }
 
-        entry = FindPeerId(nodeData.mPeerId, currentTime);
-        if (entry)
+    // update the addresses of every resolved node served by hostName, e.g. after the host announced an address change.
+    // The entries keep their own expiry time unless the new addresses expire first.  Returns the number of updated entries.
+    size_t UpdateHostAddresses(const char * hostName, const ResolvedNodeData & addresses)
+    {
+        size_t updated = 0;
+        for (EntryIndex i = mLruHead; i != kNoEntry; i = mEntries[i].mLruNext)
         {
-            *entry = nodeData;
-            return CHIP_NO_ERROR;
-        }
-
-        VerifyOrReturnError(entry = findSlot(currentTime), CHIP_ERROR_TOO_MANY_KEYS);
-
-        // have a free slot for this entry
-        *entry = nodeData;
-        elementsUsed++;
+            ResolvedNodeData & e = mEntries[i].mData;
+            if (mEntries[i].mNegative || strcmp(e.mHostName, hostName) != 0)
+            {
+                continue;
+            }
 
-        return CHIP_NO_ERROR;
+            for (size_t j = 0; j < addresses.mNumIPs; ++j)
+            {
+                e.mAddress[j] = addresses.mAddress[j];
+            }
+            e.mNumIPs      = addresses.mNumIPs;
+            e.mInterfaceId = addresses.mInterfaceId;
+            if (addresses.mExpiryTime < e.mExpiryTime)
+            {
+                e.mExpiryTime = addresses.mExpiryTime;
+            }
+            ++updated;
+        }
+        return updated;
     }
 
     CHIP_ERROR Delete(PeerId peerId)
     {
-        ResolvedNodeData * pentry;
         const System::Clock::Timestamp currentTime = System::SystemClock().GetMonotonicTimestamp();
 
-        VerifyOrReturnError(pentry = FindPeerId(peerId, currentTime), CHIP_ERROR_KEY_NOT_FOUND);
+        EntryIndex index = FindLive(peerId, currentTime);
+        VerifyOrReturnError(index != kNoEntry, CHIP_ERROR_KEY_NOT_FOUND);
 
-        MarkEntryUnused(*pentry);
+        Remove(index);
         return CHIP_NO_ERROR;
     }
 
-    // given a peerId, find the parameters if its in the cache, or return error
+    // given a peerId, find the parameters if its in the cache, or return error:
+    // CHIP_ERROR_NOT_FOUND if the peer is negatively cached, CHIP_ERROR_KEY_NOT_FOUND if nothing is known about it.
     CHIP_ERROR Lookup(PeerId peerId, ResolvedNodeData & nodeData)
     {
-        ResolvedNodeData * pentry;
         const System::Clock::Timestamp currentTime = System::SystemClock().GetMonotonicTimestamp();
 
-        VerifyOrReturnError(pentry = FindPeerId(peerId, currentTime), CHIP_ERROR_KEY_NOT_FOUND);
+        EntryIndex index = FindLive(peerId, currentTime);
+        if (index == kNoEntry)
+        {
+            mStatistics.mMisses++;
+            return CHIP_ERROR_KEY_NOT_FOUND;
+        }
 
-        nodeData = *pentry;
+        Touch(index);
+        if (mEntries[index].mNegative)
+        {
+            mStatistics.mNegativeHits++;
+            return CHIP_ERROR_NOT_FOUND;
+        }
 
+        mStatistics.mHits++;
+        nodeData = mEntries[index].mData;
         return CHIP_NO_ERROR;
     }
 
+    void Clear()
+    {
+        for (size_t i = 0; i < kStorageSize; ++i)
+        {
+            mBuckets[i]           = kNoEntry;
+            mEntries[i].mHashNext = static_cast<EntryIndex>(i + 1 < CACHE_SIZE ? i + 1 : kNoEntry);
+            mEntries[i].mLruPrev  = kNoEntry;
+            mEntries[i].mLruNext  = kNoEntry;
+        }
+        mFreeList     = (CACHE_SIZE > 0) ? 0 : kNoEntry;
+        mLruHead      = kNoEntry;
+        mLruTail      = kNoEntry;
+        mElementsUsed = 0;
+    }
+
+    size_t Size() const { return mElementsUsed; }
+
+    const Statistics & GetStatistics() const { return mStatistics; }
+    void ResetStatistics() { mStatistics = Statistics(); }
+
     // only useful if MDNS_LOGGING is set.   If not used, should be optimized out
     void DumpCache()
     {
-        int i = 0;
-
-        MdnsLogProgress(Discovery, "cache size = %d", elementsUsed);
-        for (ResolvedNodeData & e : mLookupTable)
+        MdnsLogProgress(Discovery, "cache size = %d", static_cast<int>(mElementsUsed));
+        // Walk from the most to the least recently used entry.
+        for (EntryIndex i = mLruHead; i != kNoEntry; i = mEntries[i].mLruNext)
         {
-            if (e.mPeerId == nullPeerId)
+            const ResolvedNodeData & e = mEntries[i].mData;
+            if (mEntries[i].mNegative)
             {
-                MdnsLogProgress(Discovery, "Entry %d unused", i);
+                MdnsLogProgress(Discovery, "Entry %d: node %lx fabric %lx unreachable", i, e.mPeerId.GetNodeId(),
+                                e.mPeerId.GetCompressedFabricId());
+                continue;
             }
-            else
+
+            MdnsLogProgress(Discovery, "Entry %d: node %lx fabric %lx, port = %d", i, e.mPeerId.GetNodeId(),
+                            e.mPeerId.GetCompressedFabricId(), e.mPort);
+            for (size_t j = 0; j < e.mNumIPs; ++j)
             {
-                MdnsLogProgress(Discovery, "Entry %d: node %lx fabric %lx, port = %d", i, e.mPeerId.GetNodeId(),
-                                e.peerId.GetFabricId(), e.port);
-                for (size_t j = 0; j < e.mNumIPs; ++j)
-                {
-                    char address[Inet::IPAddress::kMaxStringLength];
-                    e.mAddress[i].ToString(address);
-                    MdnsLogProgress(Discovery, "    address %d: %s", j, address);
-                }
+                char address[Inet::IPAddress::kMaxStringLength];
+                e.mAddress[j].ToString(address);
+                MdnsLogProgress(Discovery, "    address %d: %s", static_cast<int>(j), address);
             }
-            i++;
         }
     }
 
 private:
-    PeerId nullPeerId; // indicates a cache entry is unused
-    int elementsUsed;  // running count of how many entries are used -- for a sanity check
+    using EntryIndex                     = uint16_t;
+    static constexpr EntryIndex kNoEntry = UINT16_MAX;
+    // A cache of size 0 still needs valid arrays; it simply never hands out an entry.
+    static constexpr size_t kStorageSize = (CACHE_SIZE > 0) ? CACHE_SIZE : 1;
+    static_assert(CACHE_SIZE < kNoEntry, "DnssdCache entries are indexed with 16 bits");
+
+    struct Entry
+    {
+        ResolvedNodeData mData; // Only mPeerId and mExpiryTime are meaningful for negative entries
+        bool mNegative       = false;
+        EntryIndex mHashNext = kNoEntry; // Next entry in the same bucket, or next free entry
+        EntryIndex mLruPrev  = kNoEntry; // More recently used neighbour
+        EntryIndex mLruNext  = kNoEntry; // Less recently used neighbour
+    };
 
-    ResolvedNodeData mLookupTable[CACHE_SIZE];
+    Entry mEntries[kStorageSize];
+    EntryIndex mBuckets[kStorageSize];
+    EntryIndex mFreeList;
+    EntryIndex mLruHead;
+    EntryIndex mLruTail;
+    size_t mElementsUsed;
+    Statistics mStatistics;
 
-    ResolvedNodeData * findSlot(System::Clock::Timestamp currentTime)
+    static size_t BucketOf(PeerId peerId)
     {
-        for (ResolvedNodeData & entry : mLookupTable)
+        uint64_t hash = peerId.GetNodeId() ^ (peerId.GetCompressedFabricId() * UINT64_C(0x9E3779B97F4A7C15));
+        hash ^= hash >> 32;
+        return static_cast<size_t>(hash % kStorageSize);
+    }
+
+    EntryIndex Find(PeerId peerId) const
+    {
+        EntryIndex index = mBuckets[BucketOf(peerId)];
+        while (index != kNoEntry && !(mEntries[index].mData.mPeerId == peerId))
+        {
+            index = mEntries[index].mHashNext;
+        }
+        return index;
+    }
+
+    // Like Find, but drops the entry and reports it missing if it has expired.
+    EntryIndex FindLive(PeerId peerId, System::Clock::Timestamp currentTime)
+    {
+        EntryIndex index = Find(peerId);
+        if (index != kNoEntry && mEntries[index].mData.mExpiryTime <= currentTime)
         {
-            if (entry.mPeerId == nullPeerId)
-                return &entry;
+            mStatistics.mExpirations++;
+            Remove(index);
+            index = kNoEntry;
+        }
+        return index;
+    }
+
+    CHIP_ERROR Store(PeerId peerId, const ResolvedNodeData * nodeData, System::Clock::Timestamp expiryTime)
+    {
+        const System::Clock::Timestamp currentTime = System::SystemClock().GetMonotonicTimestamp();
 
-            if (entry.mExpiryTime <= currentTime)
+        EntryIndex index = Find(peerId);
+        if (expiryTime <= currentTime)
+        {
+            // Nothing to keep: this is a withdrawal (or stale data), so just forget what we had.
+            if (index != kNoEntry)
             {
-                MarkEntryUnused(entry);
-                return &entry;
+                Remove(index);
             }
+            return CHIP_NO_ERROR;
+        }
+
+        if (index == kNoEntry)
+        {
+            index = Allocate(currentTime);
+            VerifyOrReturnError(index != kNoEntry, CHIP_ERROR_TOO_MANY_KEYS);
+            Link(index, peerId);
+        }
+        else
+        {
+            Touch(index);
+        }
+
+        Entry & entry = mEntries[index];
+        if (nodeData != nullptr)
+        {
+            entry.mData = *nodeData;
+        }
+        else
+        {
+            entry.mData         = ResolvedNodeData();
+            entry.mData.mPeerId = peerId;
         }
-        return nullptr;
+        entry.mData.mExpiryTime = expiryTime;
+        entry.mNegative         = (nodeData == nullptr);
+        mStatistics.mInsertions++;
+
+        return CHIP_NO_ERROR;
     }
 
-    ResolvedNodeData * FindPeerId(PeerId peerId, System::Clock::Timestamp current_time)
+    EntryIndex Allocate(System::Clock::Timestamp currentTime)
     {
-        for (ResolvedNodeData & entry : mLookupTable)
+        if (mFreeList == kNoEntry && mLruTail != kNoEntry)
         {
-            if (entry.mPeerId == peerId)
+            if (mEntries[mLruTail].mData.mExpiryTime <= currentTime)
+            {
+                mStatistics.mExpirations++;
+            }
+            else
             {
-                if (entry.mExpiryTime < current_time)
-                {
-                    MarkEntryUnused(entry);
-                    break; // return nullptr
-                }
-                else
-                    return &entry;
+                mStatistics.mEvictions++;
             }
-            if (entry.mPeerId != nullPeerId && entry.mExpiryTime < current_time)
+            Remove(mLruTail);
+        }
+
+        EntryIndex index = mFreeList;
+        if (index != kNoEntry)
+        {
+            mFreeList = mEntries[index].mHashNext;
+        }
+        return index;
+    }
+
+    // Add a free entry to the bucket of peerId, as the most recently used entry.
+    void Link(EntryIndex index, PeerId peerId)
+    {
+        EntryIndex & bucket           = mBuckets[BucketOf(peerId)];
+        mEntries[index].mData.mPeerId = peerId;
+        mEntries[index].mHashNext     = bucket;
+        bucket                        = index;
+        PushLruHead(index);
+        mElementsUsed++;
+    }
+
+    void Remove(EntryIndex index)
+    {
+        Entry & entry = mEntries[index];
+
+        for (EntryIndex * link = &mBuckets[BucketOf(entry.mData.mPeerId)]; *link != kNoEntry; link = &mEntries[*link].mHashNext)
+        {
+            if (*link == index)
             {
-                MarkEntryUnused(entry);
+                *link = entry.mHashNext;
+                break;
             }
         }
 
-        return nullptr;
+        UnlinkLru(index);
+        entry.mHashNext = mFreeList;
+        mFreeList       = index;
+        mElementsUsed--;
     }
 
-    // have a method to mark ununused --  so its easy to change
-    void MarkEntryUnused(ResolvedNodeData & pentry)
+    void Touch(EntryIndex index)
     {
-        pentry.mPeerId = nullPeerId;
-        elementsUsed--;
+        if (mLruHead != index)
+        {
+            UnlinkLru(index);
+            PushLruHead(index);
+        }
+    }
+
+    void PushLruHead(EntryIndex index)
+    {
+        mEntries[index].mLruPrev = kNoEntry;
+        mEntries[index].mLruNext = mLruHead;
+        if (mLruHead != kNoEntry)
+        {
+            mEntries[mLruHead].mLruPrev = index;
+        }
+        mLruHead = index;
+        if (mLruTail == kNoEntry)
+        {
+            mLruTail = index;
+        }
+    }
+
+    void UnlinkLru(EntryIndex index)
+    {
+        Entry & entry = mEntries[index];
+        if (entry.mLruPrev != kNoEntry)
+        {
+            mEntries[entry.mLruPrev].mLruNext = entry.mLruNext;
+        }
+        else
+        {
+            mLruHead = entry.mLruNext;
+        }
+        if (entry.mLruNext != kNoEntry)
+        {
+            mEntries[entry.mLruNext].mLruPrev = entry.mLruPrev;
+        }
+        else
+        {
+            mLruTail = entry.mLruPrev;
+        }
+        entry.mLruPrev = kNoEntry;
+        entry.mLruNext = kNoEntry;
     }
 };
 
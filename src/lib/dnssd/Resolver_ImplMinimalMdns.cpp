@@ -67,13 +67,16 @@ constexpr uint16_t kMdnsPort        = 5353;
 using namespace mdns::Minimal;
 using DnssdCacheType = Dnssd::DnssdCache<CHIP_CONFIG_MDNS_CACHE_SIZE>;
 
+// Whether operational responses are processed even when no node is being resolved, to keep the cache fresh.
+constexpr bool kPassiveListening = (CHIP_CONFIG_MDNS_RESOLVER_PASSIVE_LISTENING != 0) && (CHIP_CONFIG_MDNS_CACHE_SIZE > 0);
+
 class PacketDataReporter : public ParserDelegate
 {
 public:
     PacketDataReporter(ResolverDelegate * delegate, chip::Inet::InterfaceId interfaceId, DiscoveryType discoveryType,
                        const BytesRange & packet, DnssdCacheType & mdnsCache) :
         mDelegate(delegate),
-        mDiscoveryType(discoveryType), mPacketRange(packet)
+        mDiscoveryType(discoveryType), mPacketRange(packet), mCache(mdnsCache)
     {
         mInterfaceId = interfaceId;
     }
@@ -95,10 +98,22 @@ private:
     DiscoveredNodeData mDiscoveredNodeData;
     chip::Inet::InterfaceId mInterfaceId;
     BytesRange mPacketRange;
+    DnssdCacheType & mCache;
 
     bool mValid       = false;
     bool mHasNodePort = false;
     bool mHasIP       = false;
+    bool mSrvGoodbye  = false; // The operational SRV record was withdrawn (TTL 0)
+
+    // Smallest TTL of the records the operational node data was built from; the cache entry expires with it.
+    uint32_t mOperationalTtlSeconds = std::numeric_limits<uint32_t>::max();
+
+    // Host the A/AAAA records belong to, used to refresh cached nodes when a packet only announces addresses.
+    char mAddressHostName[kHostNameMaxLength + 1] = {};
+
+    void UpdateOperationalTtl(const ResourceData & data);
+    bool IsOperationalRecord(const ResourceData & data) const;
+    void OnAddressRecord(const ResourceData & data, const chip::Inet::IPAddress & addr);
 
     void OnCommissionableNodeSrvRecord(SerializedQNameIterator name, const SrvRecord & srv);
     void OnOperationalSrvRecord(SerializedQNameIterator name, const SrvRecord & srv);
@@ -107,6 +122,18 @@ private:
     void OnOperationalIPAddress(const chip::Inet::IPAddress & addr);
 };
 
+bool HasQNamePart(SerializedQNameIterator qname, QNamePart part)
+{
+    while (qname.Next())
+    {
+        if (strcmp(qname.Value(), part) == 0)
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
 void PacketDataReporter::OnQuery(const QueryData & data)
 {
     // Ignore queries:
@@ -127,6 +154,42 @@ void PacketDataReporter::OnHeader(ConstHeaderRef & header)
     }
 }
 
+void PacketDataReporter::UpdateOperationalTtl(const ResourceData & data)
+{
+    if (data.GetTtlSeconds() < mOperationalTtlSeconds)
+    {
+        mOperationalTtlSeconds = static_cast<uint32_t>(data.GetTtlSeconds());
+    }
+}
+
+bool PacketDataReporter::IsOperationalRecord(const ResourceData & data) const
+{
+    // TODO: Fix this comparison which is too loose.
+    return (kPassiveListening || mDiscoveryType == DiscoveryType::kOperational) &&
+        HasQNamePart(data.GetName(), kOperationalServiceName);
+}
+
+void PacketDataReporter::OnAddressRecord(const ResourceData & data, const chip::Inet::IPAddress & addr)
+{
+    // A TTL of 0 withdraws the address: it must not be used anymore.
+    if (data.GetTtlSeconds() > 0)
+    {
+        SerializedQNameIterator hostName = data.GetName();
+        if (mAddressHostName[0] == '\0' && hostName.Next())
+        {
+            Platform::CopyString(mAddressHostName, hostName.Value());
+        }
+
+        UpdateOperationalTtl(data);
+        OnOperationalIPAddress(addr);
+    }
+
+    if (mDiscoveryType == DiscoveryType::kCommissionableNode || mDiscoveryType == DiscoveryType::kCommissionerNode)
+    {
+        OnDiscoveredNodeIPAddress(addr);
+    }
+}
+
 void PacketDataReporter::OnOperationalSrvRecord(SerializedQNameIterator name, const SrvRecord & srv)
 {
     mdns::Minimal::SerializedQNameIterator it = srv.GetName();
@@ -198,18 +261,6 @@ void PacketDataReporter::OnDiscoveredNodeIPAddress(const chip::Inet::IPAddress &
     mDiscoveredNodeData.numIPs++;
 }
 
-bool HasQNamePart(SerializedQNameIterator qname, QNamePart part)
-{
-    while (qname.Next())
-    {
-        if (strcmp(qname.Value(), part) == 0)
-        {
-            return true;
-        }
-    }
-    return false;
-}
-
 void PacketDataReporter::OnResource(ResourceType type, const ResourceData & data)
 {
     if (!mValid)
@@ -231,14 +282,13 @@ void PacketDataReporter::OnResource(ResourceType type, const ResourceData & data
             ChipLogError(Discovery, "Packet data reporter failed to parse SRV record");
             mHasNodePort = false;
         }
-        else if (mDiscoveryType == DiscoveryType::kOperational)
+        else if (IsOperationalRecord(data))
         {
-            // Ensure this is our record.
-            // TODO: Fix this comparison which is too loose.
-            if (HasQNamePart(data.GetName(), kOperationalServiceName))
-            {
-                OnOperationalSrvRecord(data.GetName(), srv);
-            }
+            // With passive listening, operational records are processed whatever we are currently looking for, so
+            // that every response we see keeps the cache up to date.
+            mSrvGoodbye = (data.GetTtlSeconds() == 0);
+            UpdateOperationalTtl(data);
+            OnOperationalSrvRecord(data.GetName(), srv);
         }
         else if (mDiscoveryType == DiscoveryType::kCommissionableNode || mDiscoveryType == DiscoveryType::kCommissionerNode)
         {
@@ -263,14 +313,14 @@ void PacketDataReporter::OnResource(ResourceType type, const ResourceData & data
         break;
     }
     case QType::TXT:
-        if (mDiscoveryType == DiscoveryType::kCommissionableNode || mDiscoveryType == DiscoveryType::kCommissionerNode)
+        if (IsOperationalRecord(data))
         {
-            TxtRecordDelegateImpl<DiscoveredNodeData> textRecordDelegate(mDiscoveredNodeData);
+            TxtRecordDelegateImpl<ResolvedNodeData> textRecordDelegate(mNodeData);
             ParseTxtRecord(data.GetData(), &textRecordDelegate);
         }
-        else if (mDiscoveryType == DiscoveryType::kOperational)
+        else if (mDiscoveryType == DiscoveryType::kCommissionableNode || mDiscoveryType == DiscoveryType::kCommissionerNode)
         {
-            TxtRecordDelegateImpl<ResolvedNodeData> textRecordDelegate(mNodeData);
+            TxtRecordDelegateImpl<DiscoveredNodeData> textRecordDelegate(mDiscoveredNodeData);
             ParseTxtRecord(data.GetData(), &textRecordDelegate);
         }
         break;
@@ -283,14 +333,7 @@ void PacketDataReporter::OnResource(ResourceType type, const ResourceData & data
         }
         else
         {
-            if (mDiscoveryType == DiscoveryType::kOperational)
-            {
-                OnOperationalIPAddress(addr);
-            }
-            else if (mDiscoveryType == DiscoveryType::kCommissionableNode || mDiscoveryType == DiscoveryType::kCommissionerNode)
-            {
-                OnDiscoveredNodeIPAddress(addr);
-            }
+            OnAddressRecord(data, addr);
         }
         break;
     }
@@ -303,14 +346,7 @@ void PacketDataReporter::OnResource(ResourceType type, const ResourceData & data
         }
         else
         {
-            if (mDiscoveryType == DiscoveryType::kOperational)
-            {
-                OnOperationalIPAddress(addr);
-            }
-            else if (mDiscoveryType == DiscoveryType::kCommissionableNode || mDiscoveryType == DiscoveryType::kCommissionerNode)
-            {
-                OnDiscoveredNodeIPAddress(addr);
-            }
+            OnAddressRecord(data, addr);
         }
         break;
     }
@@ -324,14 +360,44 @@ void PacketDataReporter::OnComplete(ActiveResolveAttempts & activeAttempts)
     if ((mDiscoveryType == DiscoveryType::kCommissionableNode || mDiscoveryType == DiscoveryType::kCommissionerNode) &&
         mDiscoveredNodeData.IsValid())
     {
-        mDelegate->OnNodeDiscoveryComplete(mDiscoveredNodeData);
+        if (mDelegate != nullptr)
+        {
+            mDelegate->OnNodeDiscoveryComplete(mDiscoveredNodeData);
+        }
+    }
+    else if (mHasNodePort && mSrvGoodbye)
+    {
+        // The node withdrew its operational records: remember that it is gone rather than keep serving stale data.
+        mCache.InsertNegative(mNodeData.mPeerId,
+                              System::SystemClock().GetMonotonicTimestamp() +
+                                  System::Clock::Seconds16(CHIP_CONFIG_MDNS_NEGATIVE_CACHE_TTL_SECONDS));
     }
-    else if (mDiscoveryType == DiscoveryType::kOperational && mHasIP && mHasNodePort)
+    else if (mHasIP && mHasNodePort)
     {
-        activeAttempts.Complete(mNodeData.mPeerId);
+        mNodeData.mExpiryTime = System::SystemClock().GetMonotonicTimestamp() + System::Clock::Seconds32(mOperationalTtlSeconds);
+        LogErrorOnFailure(mCache.Insert(mNodeData));
+
+        // Any response answers a pending resolution, whatever we were looking for when it arrived: this keeps the
+        // question out of the next query packets.
+        const bool wasPending = activeAttempts.Complete(mNodeData.mPeerId);
+        if ((wasPending || mDiscoveryType == DiscoveryType::kOperational) && mDelegate != nullptr)
+        {
+            if (!wasPending)
+            {
+                // This may happen during boot time adverisements: nodes come online
+                // and advertise their IP without any explicit queries for them
+                ChipLogProgress(Discovery, "Discovered node without a pending query");
+            }
 
-        mNodeData.LogNodeIdResolved();
-        mDelegate->OnNodeIdResolved(mNodeData);
+            mNodeData.LogNodeIdResolved();
+            mDelegate->OnNodeIdResolved(mNodeData);
+        }
+    }
+    else if (kPassiveListening && mHasIP && !mHasNodePort && mAddressHostName[0] != '\0')
+    {
+        // Address-only announcement, typically sent when a host changes addresses: refresh the nodes it serves.
+        mNodeData.mExpiryTime = System::SystemClock().GetMonotonicTimestamp() + System::Clock::Seconds32(mOperationalTtlSeconds);
+        mCache.UpdateHostAddresses(mAddressHostName, mNodeData);
     }
 }
 
@@ -379,19 +445,18 @@ private:
     }
     static constexpr int kMaxQnameSize = 100;
     char qnameStorage[kMaxQnameSize];
-    // should this be static?
-    // original version had:    static Dnssd::IPCache<CHIP_CONFIG_IPCACHE_SIZE, CHIP_CONFIG_TTL_MS> sIPCache;
-    DnssdCacheType sDnssdCache;
+    DnssdCacheType mDnssdCache;
 };
 
 void MinMdnsResolver::OnMdnsPacketData(const BytesRange & data, const chip::Inet::IPPacketInfo * info)
 {
-    if (mDelegate == nullptr)
+    // Without a delegate, there is nobody to report results to, but passive listening still keeps the cache fresh.
+    if (mDelegate == nullptr && !kPassiveListening)
     {
         return;
     }
 
-    PacketDataReporter reporter(mDelegate, info->Interface, mDiscoveryType, data, sDnssdCache);
+    PacketDataReporter reporter(mDelegate, info->Interface, mDiscoveryType, data, mDnssdCache);
 
     if (!ParsePacket(data, &reporter))
     {
@@ -508,9 +573,43 @@ CHIP_ERROR MinMdnsResolver::BrowseNodes(DiscoveryType type, DiscoveryFilter filt
 CHIP_ERROR MinMdnsResolver::ResolveNodeId(const PeerId & peerId, Inet::IPAddressType type, Resolver::CacheBypass dnssdCacheBypass)
 {
     mDiscoveryType = DiscoveryType::kOperational;
-    mActiveResolves.MarkPending(peerId);
 
-    return SendPendingResolveQueries();
+    if (dnssdCacheBypass == Resolver::CacheBypass::Off && mDelegate != nullptr)
+    {
+        /* see if the entry is cached and use it.... */
+        ResolvedNodeData nodeData;
+        CHIP_ERROR err = mDnssdCache.Lookup(peerId, nodeData);
+        if (err == CHIP_NO_ERROR)
+        {
+            mDelegate->OnNodeIdResolved(nodeData);
+            return CHIP_NO_ERROR;
+        }
+        if (err == CHIP_ERROR_NOT_FOUND)
+        {
+            // The node recently announced that it is going away.
+            mDelegate->OnNodeIdResolutionFailed(peerId, err);
+            return CHIP_NO_ERROR;
+        }
+    }
+
+    if (mActiveResolves.IsFull() && !mActiveResolves.IsPending(peerId))
+    {
+        // Send what is pending before an entry gets reused, so that no resolution is dropped before being queried once.
+        LogErrorOnFailure(SendPendingResolveQueries());
+    }
+
+    // The peer whose entry gets reused was queried at least once above: it is no longer retried, but its reply is still
+    // reported through OnNodeIdResolved like any other operational announcement.
+    Optional<PeerId> evicted = mActiveResolves.MarkPending(peerId);
+    if (evicted.HasValue())
+    {
+        ChipLogProgress(Discovery, "Resolve table full, no longer retrying " ChipLogFormatX64 "-" ChipLogFormatX64,
+                        ChipLogValueX64(evicted.Value().GetCompressedFabricId()), ChipLogValueX64(evicted.Value().GetNodeId()));
+    }
+
+    // Queries are sent from the retry timer rather than right away, so that resolutions requested together (e.g. when
+    // reconnecting to all known nodes) go out as questions of the same packets.
+    return ScheduleResolveRetries();
 }
 
 CHIP_ERROR MinMdnsResolver::ScheduleResolveRetries()
@@ -535,6 +634,8 @@ void MinMdnsResolver::ResolveRetryCallback(System::Layer *, void * self)
 
 CHIP_ERROR MinMdnsResolver::SendPendingResolveQueries()
 {
+    QueryBuilder builder;
+
     while (true)
     {
         Optional<PeerId> peerId = mActiveResolves.NextScheduledPeer();
@@ -544,45 +645,55 @@ CHIP_ERROR MinMdnsResolver::SendPendingResolveQueries()
             break;
         }
 
-        System::PacketBufferHandle buffer = System::PacketBufferHandle::New(kMdnsMaxPacketSize);
-        ReturnErrorCodeIf(buffer.IsNull(), CHIP_ERROR_NO_MEMORY);
+        char nameBuffer[kMaxOperationalServiceNameSize] = "";
+
+        // Node and fabricid are encoded in server names.
+        ReturnErrorOnFailure(MakeInstanceName(nameBuffer, sizeof(nameBuffer), peerId.Value()));
+
+        const char * instanceQName[] = { nameBuffer, kOperationalServiceName, kOperationalProtocol, kLocalDomain };
+        Query query(instanceQName);
+
+        query
+            .SetClass(QClass::IN)      //
+            .SetType(QType::ANY)       //
+            .SetAnswerViaUnicast(true) //
+            ;
+
+        // NOTE: type above is NOT A or AAAA because the name searched for is
+        // a SRV record. The layout is:
+        //    SRV -> hostname
+        //    Hostname -> A
+        //    Hostname -> AAAA
+        //
+        // Query is sent for ANY and expectation is to receive A/AAAA records
+        // in the additional section of the reply.
+        //
+        // Sending a A/AAAA query will return no results
+        // Sending a SRV query will return the srv only and an additional query
+        // would be needed to resolve the host name to an IP address
+
+        // All the due resolutions are asked for in as few packets as possible: they share the
+        // retry schedule and the service/protocol/domain part of their names is only sent once.
+        if (!builder.CanFit(query))
+        {
+            if (builder.QueryCount() > 0)
+            {
+                ReturnErrorOnFailure(GlobalMinimalMdnsServer::Server().BroadcastUnicastQuery(builder.ReleasePacket(), kMdnsPort));
+            }
 
-        QueryBuilder builder(std::move(buffer));
-        builder.Header().SetMessageId(0);
+            System::PacketBufferHandle buffer = System::PacketBufferHandle::New(kMdnsMaxPacketSize);
+            ReturnErrorCodeIf(buffer.IsNull(), CHIP_ERROR_NO_MEMORY);
 
-        {
-            char nameBuffer[kMaxOperationalServiceNameSize] = "";
-
-            // Node and fabricid are encoded in server names.
-            ReturnErrorOnFailure(MakeInstanceName(nameBuffer, sizeof(nameBuffer), peerId.Value()));
-
-            const char * instanceQName[] = { nameBuffer, kOperationalServiceName, kOperationalProtocol, kLocalDomain };
-            Query query(instanceQName);
-
-            query
-                .SetClass(QClass::IN)      //
-                .SetType(QType::ANY)       //
-                .SetAnswerViaUnicast(true) //
-                ;
-
-            // NOTE: type above is NOT A or AAAA because the name searched for is
-            // a SRV record. The layout is:
-            //    SRV -> hostname
-            //    Hostname -> A
-            //    Hostname -> AAAA
-            //
-            // Query is sent for ANY and expectation is to receive A/AAAA records
-            // in the additional section of the reply.
-            //
-            // Sending a A/AAAA query will return no results
-            // Sending a SRV query will return the srv only and an additional query
-            // would be needed to resolve the host name to an IP address
-
-            builder.AddQuery(query);
+            builder.Reset(std::move(buffer));
+            builder.Header().SetMessageId(0);
         }
 
+        builder.AddQuery(query);
         ReturnErrorCodeIf(!builder.Ok(), CHIP_ERROR_INTERNAL);
+    }
 
+    if (builder.QueryCount() > 0)
+    {
         ReturnErrorOnFailure(GlobalMinimalMdnsServer::Server().BroadcastUnicastQuery(builder.ReleasePacket(), kMdnsPort));
     }
 
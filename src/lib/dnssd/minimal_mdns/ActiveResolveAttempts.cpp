@@ -37,23 +37,47 @@ void ActiveResolveAttempts::Reset()
     }
 }
 
-void ActiveResolveAttempts::Complete(const PeerId & peerId)
+bool ActiveResolveAttempts::Complete(const PeerId & peerId)
 {
     for (auto & item : mRetryQueue)
     {
         if (item.peerId == peerId)
         {
             item.peerId.SetNodeId(kUndefinedNodeId);
-            return;
+            return true;
         }
     }
 
     // This may happen during boot time adverisements: nodes come online
     // and advertise their IP without any explicit queries for them
-    ChipLogProgress(Discovery, "Discovered node without a pending query");
+    return false;
 }
 
-void ActiveResolveAttempts::MarkPending(const PeerId & peerId)
+bool ActiveResolveAttempts::IsPending(const PeerId & peerId) const
+{
+    for (auto & item : mRetryQueue)
+    {
+        if (item.peerId == peerId)
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+bool ActiveResolveAttempts::IsFull() const
+{
+    for (auto & item : mRetryQueue)
+    {
+        if (item.peerId.GetNodeId() == kUndefinedNodeId)
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+Optional<PeerId> ActiveResolveAttempts::MarkPending(const PeerId & peerId)
 {
     // Strategy when picking the peer id to use:
     //   1 if a matching peer id is already found, use that one
@@ -106,21 +130,22 @@ void ActiveResolveAttempts::MarkPending(const PeerId & peerId)
         }
     }
 
+    Optional<PeerId> evicted;
     if ((entryToUse->peerId.GetNodeId() != kUndefinedNodeId) && (entryToUse->peerId != peerId))
     {
-        // TODO: node was evicted here, if/when resolution failures are
-        // supported this could be a place for error callbacks
-        //
-        // Note however that this is NOT an actual 'timeout' it is showing
+        // Note that this is NOT an actual 'timeout' it is showing
         // a burst of lookups for which we cannot maintain state. A reply may
         // still be received for this peer id (query was already sent on the
         // network)
         ChipLogError(Discovery, "Re-using pending resolve entry before reply was received.");
+        evicted.SetValue(entryToUse->peerId);
     }
 
     entryToUse->peerId         = peerId;
     entryToUse->queryDueTime   = mClock->GetMonotonicTimestamp();
     entryToUse->nextRetryDelay = System::Clock::Seconds16(1);
+
+    return evicted;
 }
 
 Optional<System::Clock::Timeout> ActiveResolveAttempts::GetTimeUntilNextExpectedResponse() const
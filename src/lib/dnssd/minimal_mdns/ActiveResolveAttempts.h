@@ -20,6 +20,7 @@
 #include <cstddef>
 #include <cstdint>
 
+#include <lib/core/CHIPConfig.h>
 #include <lib/core/Optional.h>
 #include <lib/core/PeerId.h>
 #include <system/SystemClock.h>
@@ -38,7 +39,7 @@ namespace Minimal {
 class ActiveResolveAttempts
 {
 public:
-    static constexpr size_t kRetryQueueSize                      = 4;
+    static constexpr size_t kRetryQueueSize                      = CHIP_CONFIG_MDNS_RESOLVER_MAX_PENDING_RESOLVES;
     static constexpr chip::System::Clock::Timeout kMaxRetryDelay = chip::System::Clock::Seconds16(16);
 
     ActiveResolveAttempts(chip::System::Clock::ClockBase * clock) : mClock(clock) { Reset(); }
@@ -47,13 +48,25 @@ public:
     void Reset();
 
     /// Mark a resolution as a success, removing it from the internal list
-    void Complete(const chip::PeerId & peerId);
+    ///
+    /// Returns false if no resolution was pending for peerId.
+    bool Complete(const chip::PeerId & peerId);
 
     /// Mark that a resolution is pending, adding it to the internal list
     ///
     /// Once this complete, this peer id will be returned immediately
     /// by NextScheduledPeer (potentially with others as well)
-    void MarkPending(const chip::PeerId & peerId);
+    ///
+    /// Returns the peer whose pending resolution was replaced to make room,
+    /// if the internal list was full.
+    chip::Optional<chip::PeerId> MarkPending(const chip::PeerId & peerId);
+
+    /// Whether a resolution is pending for peerId.
+    bool IsPending(const chip::PeerId & peerId) const;
+
+    /// Whether every entry of the internal list is in use, so that the next
+    /// MarkPending for a new peer will replace a pending resolution.
+    bool IsFull() const;
 
     // Get minimum time until the next pending reply is required.
     //
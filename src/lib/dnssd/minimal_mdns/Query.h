@@ -19,6 +19,8 @@
 
 #include <lib/support/BufferWriter.h>
 
+#include <cstring>
+
 #include <lib/dnssd/minimal_mdns/core/Constants.h>
 #include <lib/dnssd/minimal_mdns/core/QName.h>
 #include <lib/dnssd/minimal_mdns/core/RecordWriter.h>
@@ -53,6 +55,17 @@ public:
         return *this;
     }
 
+    /// Number of bytes Append needs when no part of the name can be compressed
+    size_t MaxSerializedSize() const
+    {
+        size_t size = 1 + 2 * sizeof(uint16_t); // name terminator, type and class
+        for (uint16_t i = 0; i < mQName.nameCount; i++)
+        {
+            size += 1 + strlen(mQName.names[i]);
+        }
+        return size;
+    }
+
     /// Append the query to the specified buffer
     ///
     /// @param hdr will be updated with a query count
@@ -25,11 +25,23 @@
 namespace mdns {
 namespace Minimal {
 
+/// Builds a query packet.
+///
+/// Several queries can be added to the same packet: they share the name
+/// compression state, so the common suffixes of their names (service,
+/// protocol and domain) are only written once.
 class QueryBuilder
 {
 public:
-    QueryBuilder() : mHeader(nullptr) {}
-    QueryBuilder(chip::System::PacketBufferHandle && packet) : mHeader(nullptr) { Reset(std::move(packet)); }
+    QueryBuilder() : mHeader(nullptr), mEndianOutput(nullptr, 0), mWriter(&mEndianOutput) {}
+    QueryBuilder(chip::System::PacketBufferHandle && packet) : mHeader(nullptr), mEndianOutput(nullptr, 0), mWriter(&mEndianOutput)
+    {
+        Reset(std::move(packet));
+    }
+
+    // mWriter points to mEndianOutput, so a copy would write through the original's output.
+    QueryBuilder(const QueryBuilder &) = delete;
+    QueryBuilder & operator=(const QueryBuilder &) = delete;
 
     QueryBuilder & Reset(chip::System::PacketBufferHandle && packet)
     {
@@ -40,6 +52,7 @@ public:
         {
             mPacket->SetDataLength(HeaderRef::kSizeBytes);
             mHeader.Clear();
+            mQueryBuildOk = true;
         }
         else
         {
@@ -47,6 +60,13 @@ public:
         }
 
         mHeader.SetFlags(mHeader.GetFlags().SetQuery());
+
+        mEndianOutput =
+            chip::Encoding::BigEndian::BufferWriter(mPacket->Start(), mPacket->DataLength() + mPacket->AvailableDataLength());
+        mEndianOutput.Skip(mPacket->DataLength());
+
+        mWriter.Reset();
+
         return *this;
     }
 
@@ -60,6 +80,19 @@ public:
 
     HeaderRef & Header() { return mHeader; }
 
+    /// Whether the packet still has room for the given query, even if
+    /// none of its name can be compressed.
+    ///
+    /// Adding a query that does not fit fails the whole build, so callers
+    /// packing several queries in one packet should check this first.
+    bool CanFit(const Query & query) const
+    {
+        return mQueryBuildOk && (mEndianOutput.Available() >= query.MaxSerializedSize());
+    }
+
+    /// Number of queries added so far to the packet being built
+    uint16_t QueryCount() const { return mQueryBuildOk ? mHeader.GetQueryCount() : 0; }
+
     QueryBuilder & AddQuery(const Query & query)
     {
         if (!mQueryBuildOk)
@@ -67,16 +100,13 @@ public:
             return *this;
         }
 
-        chip::Encoding::BigEndian::BufferWriter out(mPacket->Start() + mPacket->DataLength(), mPacket->AvailableDataLength());
-        RecordWriter writer(&out);
-
-        if (!query.Append(mHeader, writer))
+        if (!query.Append(mHeader, mWriter))
         {
             mQueryBuildOk = false;
         }
         else
         {
-            mPacket->SetDataLength(static_cast<uint16_t>(mPacket->DataLength() + out.Needed()));
+            mPacket->SetDataLength(static_cast<uint16_t>(mEndianOutput.Needed()));
         }
         return *this;
     }
@@ -86,7 +116,9 @@ public:
 private:
     chip::System::PacketBufferHandle mPacket;
     HeaderRef mHeader;
-    bool mQueryBuildOk = true;
+    chip::Encoding::BigEndian::BufferWriter mEndianOutput;
+    RecordWriter mWriter;
+    bool mQueryBuildOk = false;
 };
 
 } // namespace Minimal
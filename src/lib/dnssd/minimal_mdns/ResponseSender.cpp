@@ -21,6 +21,10 @@
 
 #include <system/SystemClock.h>
 
+#include <algorithm>
+#include <cstring>
+#include <strings.h>
+
 #define RETURN_IF_ERROR(err)                                                                                                       \
     do                                                                                                                             \
     {                                                                                                                              \
@@ -44,6 +48,27 @@ constexpr uint16_t kMdnsStandardPort = 5353;
 //    the header.
 constexpr uint16_t kPacketSizeBytes = 512;
 
+#if CHIP_CONFIG_MDNS_RESPONSE_CACHE_SIZE > 0
+/// Writes the labels of `name` as a dotted string. Returns false if it does not fit.
+bool FlattenQName(SerializedQNameIterator name, char * out, size_t outSize)
+{
+    size_t used = 0;
+    while (name.Next())
+    {
+        const size_t labelLength = strlen(name.Value());
+        if (used + labelLength + 1 >= outSize)
+        {
+            return false;
+        }
+        memcpy(out + used, name.Value(), labelLength);
+        out[used + labelLength] = '.';
+        used += labelLength + 1;
+    }
+    out[used] = '\0';
+    return name.IsValid();
+}
+#endif // CHIP_CONFIG_MDNS_RESPONSE_CACHE_SIZE > 0
+
 } // namespace
 namespace Internal {
 
@@ -75,6 +100,26 @@ CHIP_ERROR ResponseSender::AddQueryResponder(QueryResponderBase * queryResponder
 CHIP_ERROR ResponseSender::Respond(uint32_t messageId, const QueryData & query, const chip::Inet::IPPacketInfo * querySource)
 {
     mSendState.Reset(messageId, query, querySource);
+    mRepliesSent = 0;
+    mRateLimited = false;
+
+    const chip::System::Clock::Timestamp kTimeNow = chip::System::SystemClock().GetMonotonicTimestamp();
+
+#if CHIP_CONFIG_MDNS_RESPONSE_CACHE_SIZE > 0
+    mReplyToCache = nullptr;
+
+    // Multicast replies depend on what was multicast recently, so only unicast ones are cached.
+    CachedResponse cacheKey;
+    const bool cacheable = mSendState.SendUnicast() && !query.IsBootAdvertising() && MakeCacheKey(cacheKey);
+    if (cacheable)
+    {
+        CachedResponse * cached = FindCachedResponse(cacheKey, kTimeNow);
+        if (cached != nullptr)
+        {
+            return SendCachedResponse(*cached);
+        }
+    }
+#endif // CHIP_CONFIG_MDNS_RESPONSE_CACHE_SIZE > 0
 
     // Responder has a stateful 'additional replies required' that is used within the response
     // loop. 'no additionals required' is set at the start and additionals are marked as the query
@@ -89,8 +134,6 @@ CHIP_ERROR ResponseSender::Respond(uint32_t messageId, const QueryData & query,
 
     // send all 'Answer' replies
     {
-        const chip::System::Clock::Timestamp kTimeNow = chip::System::SystemClock().GetMonotonicTimestamp();
-
         QueryReplyFilter queryReplyFilter(query);
         QueryResponderRecordFilter responseFilter;
 
@@ -151,7 +194,176 @@ CHIP_ERROR ResponseSender::Respond(uint32_t messageId, const QueryData & query,
         }
     }
 
-    return FlushReply();
+    ReturnErrorOnFailure(FlushReply());
+
+#if CHIP_CONFIG_MDNS_RESPONSE_CACHE_SIZE > 0
+    // Replies split over several packets are rare and not worth caching.
+    if (cacheable && ((mRepliesSent == 0) || (mRepliesSent == 1 && !mReplyToCache.IsNull())))
+    {
+        StoreCachedResponse(cacheKey, kTimeNow);
+    }
+    mReplyToCache = nullptr;
+#endif // CHIP_CONFIG_MDNS_RESPONSE_CACHE_SIZE > 0
+
+    return CHIP_NO_ERROR;
+}
+
+void ResponseSender::InvalidateResponseCache()
+{
+#if CHIP_CONFIG_MDNS_RESPONSE_CACHE_SIZE > 0
+    for (auto & entry : mResponseCache)
+    {
+        entry.name[0] = '\0';
+        entry.reply   = nullptr;
+    }
+#endif // CHIP_CONFIG_MDNS_RESPONSE_CACHE_SIZE > 0
+}
+
+#if CHIP_CONFIG_MDNS_RESPONSE_CACHE_SIZE > 0
+
+bool ResponseSender::MakeCacheKey(CachedResponse & entry) const
+{
+    const QueryData & query = *mSendState.GetQuery();
+
+    if (!FlattenQName(query.GetName(), entry.name, sizeof(entry.name)))
+    {
+        return false;
+    }
+    entry.type             = query.GetType();
+    entry.klass            = query.GetClass();
+    entry.unicastRequested = query.RequestedUnicastAnswer();
+    entry.includeQuery     = mSendState.IncludeQuery();
+    // Address records in the reply depend on the interface and IP version the query came from.
+    entry.interfaceId = mSendState.GetSourceInterfaceId();
+    entry.addressType = mSendState.GetSourceAddress().Type();
+    return true;
+}
+
+ResponseSender::CachedResponse * ResponseSender::FindCachedResponse(const CachedResponse & key,
+                                                                    chip::System::Clock::Timestamp now)
+{
+    for (auto & entry : mResponseCache)
+    {
+        if (entry.name[0] == '\0')
+        {
+            continue;
+        }
+
+        if (entry.expiryTime <= now)
+        {
+            entry.name[0] = '\0';
+            entry.reply   = nullptr;
+            continue;
+        }
+
+        // DNS names are case insensitive
+        if ((strcasecmp(entry.name, key.name) == 0) && (entry.type == key.type) && (entry.klass == key.klass) &&
+            (entry.unicastRequested == key.unicastRequested) && (entry.includeQuery == key.includeQuery) &&
+            (entry.interfaceId == key.interfaceId) && (entry.addressType == key.addressType))
+        {
+            return &entry;
+        }
+    }
+    return nullptr;
+}
+
+void ResponseSender::StoreCachedResponse(CachedResponse & key, chip::System::Clock::Timestamp now)
+{
+    // Use a free entry if any, otherwise the one closest to expiring.
+    CachedResponse * slot = &mResponseCache[0];
+    for (auto & entry : mResponseCache)
+    {
+        if (entry.name[0] == '\0')
+        {
+            slot = &entry;
+            break;
+        }
+        if (entry.expiryTime < slot->expiryTime)
+        {
+            slot = &entry;
+        }
+    }
+
+    memcpy(slot->name, key.name, sizeof(slot->name));
+    slot->type             = key.type;
+    slot->klass            = key.klass;
+    slot->unicastRequested = key.unicastRequested;
+    slot->includeQuery     = key.includeQuery;
+    slot->interfaceId      = key.interfaceId;
+    slot->addressType      = key.addressType;
+    slot->expiryTime       = now + kResponseCacheLifetime;
+    slot->reply            = std::move(mReplyToCache);
+}
+
+CHIP_ERROR ResponseSender::SendCachedResponse(const CachedResponse & entry)
+{
+    if (entry.reply.IsNull())
+    {
+        return CHIP_NO_ERROR; // we know we have nothing to say
+    }
+
+    if (!ConsumeQuerierToken(chip::System::SystemClock().GetMonotonicTimestamp()))
+    {
+        return CHIP_NO_ERROR;
+    }
+
+    chip::System::PacketBufferHandle reply = entry.reply.CloneData();
+    ReturnErrorCodeIf(reply.IsNull(), CHIP_ERROR_NO_MEMORY);
+    HeaderRef(reply->Start()).SetMessageId(static_cast<uint16_t>(mSendState.GetMessageId()));
+
+    return mServer->DirectSend(std::move(reply), mSendState.GetSourceAddress(), mSendState.GetSourcePort(),
+                               mSendState.GetSourceInterfaceId());
+}
+#endif // CHIP_CONFIG_MDNS_RESPONSE_CACHE_SIZE > 0
+
+bool ResponseSender::ConsumeQuerierToken(chip::System::Clock::Timestamp now)
+{
+    const chip::Inet::IPAddress & address     = mSendState.GetSourceAddress();
+    const chip::Inet::InterfaceId interfaceId = mSendState.GetSourceInterfaceId();
+
+    QuerierState * state  = nullptr;
+    QuerierState * oldest = &mQueriers[0];
+    for (auto & querier : mQueriers)
+    {
+        if (querier.inUse && (querier.address == address) && (querier.interfaceId == interfaceId))
+        {
+            state = &querier;
+            break;
+        }
+        if (!querier.inUse || (oldest->inUse && (querier.lastRefill < oldest->lastRefill)))
+        {
+            oldest = &querier;
+        }
+    }
+
+    if (state == nullptr)
+    {
+        // Start tracking this querier instead of the one we have not heard from for the longest time.
+        state              = oldest;
+        state->inUse       = true;
+        state->address     = address;
+        state->interfaceId = interfaceId;
+        state->tokens      = kQuerierReplyBurst;
+        state->lastRefill  = now;
+    }
+    else
+    {
+        const uint64_t refill = (now - state->lastRefill).count() * kQuerierRepliesPerSecond / 1000;
+        if (refill > 0)
+        {
+            state->tokens = static_cast<uint16_t>(std::min<uint64_t>(kQuerierReplyBurst, state->tokens + refill));
+            // Only account for the time the refilled replies correspond to, so frequent queries still refill.
+            state->lastRefill += chip::System::Clock::Milliseconds64(refill * 1000 / kQuerierRepliesPerSecond);
+        }
+    }
+
+    if (state->tokens == 0)
+    {
+        ChipLogDetail(Discovery, "Not replying to mDNS query: querier is over its reply rate");
+        return false;
+    }
+    state->tokens--;
+    return true;
 }
 
 CHIP_ERROR ResponseSender::FlushReply()
@@ -165,10 +377,21 @@ CHIP_ERROR ResponseSender::FlushReply()
 
         if (mSendState.SendUnicast())
         {
+            chip::System::PacketBufferHandle reply = mResponseBuilder.ReleasePacket();
+            if (mRepliesSent++ == 0)
+            {
+#if CHIP_CONFIG_MDNS_RESPONSE_CACHE_SIZE > 0
+                // Keep a copy for the reply cache: Respond decides whether it gets used.
+                mReplyToCache = reply.CloneData();
+#endif // CHIP_CONFIG_MDNS_RESPONSE_CACHE_SIZE > 0
+                mRateLimited = !ConsumeQuerierToken(chip::System::SystemClock().GetMonotonicTimestamp());
+            }
+            ReturnErrorCodeIf(mRateLimited, CHIP_NO_ERROR);
+
             ChipLogDetail(Discovery, "Directly sending mDns reply to peer %s on port %d", srcAddressString,
                           mSendState.GetSourcePort());
-            ReturnErrorOnFailure(mServer->DirectSend(mResponseBuilder.ReleasePacket(), mSendState.GetSourceAddress(),
-                                                     mSendState.GetSourcePort(), mSendState.GetSourceInterfaceId()));
+            ReturnErrorOnFailure(mServer->DirectSend(std::move(reply), mSendState.GetSourceAddress(), mSendState.GetSourcePort(),
+                                                     mSendState.GetSourceInterfaceId()));
         }
         else
         {
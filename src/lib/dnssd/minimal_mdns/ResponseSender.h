@@ -21,8 +21,10 @@
 #include "ResponseBuilder.h"
 #include "Server.h"
 
+#include <lib/core/CHIPConfig.h>
 #include <lib/dnssd/minimal_mdns/responders/QueryResponder.h>
 
+#include <system/SystemClock.h>
 #include <system/SystemPacketBuffer.h>
 
 namespace mdns {
@@ -85,11 +87,33 @@ private:
 ///
 /// Handles processing the query via a QueryResponderBase and then sending back the reply
 /// using appropriate paths (unicast or multicast) via the given Server.
+///
+/// When CHIP_CONFIG_MDNS_RESPONSE_CACHE_SIZE is set, unicast replies are cached: the same
+/// question asked again on the same interface is answered with the previously serialized
+/// reply instead of walking all the responders again. Questions we have no answer for (the
+/// vast majority of queries on a busy network) are cached as well, without keeping any
+/// packet. Unicast replies are also rate limited per querier, so a single host cannot make
+/// us flood the network.
 class ResponseSender : public ResponderDelegate
 {
 public:
     // TODO(cecille): Template this and set appropriately. Please see issue #8000.
     static constexpr size_t kMaxQueryResponders = 7;
+
+#if CHIP_CONFIG_MDNS_RESPONSE_CACHE_SIZE > 0
+    /// How many distinct questions the reply cache remembers
+    static constexpr size_t kResponseCacheSize = CHIP_CONFIG_MDNS_RESPONSE_CACHE_SIZE;
+    /// How long a cached reply is used. Replies contain the interface addresses, which
+    /// may change without the advertised services changing.
+    static constexpr chip::System::Clock::Timeout kResponseCacheLifetime = chip::System::Clock::Seconds16(5);
+#endif // CHIP_CONFIG_MDNS_RESPONSE_CACHE_SIZE > 0
+
+    /// How many queriers are rate limited individually
+    static constexpr size_t kMaxRateLimitedQueriers = 8;
+    /// Unicast replies a querier can get in a burst, and how fast that allowance refills
+    static constexpr uint16_t kQuerierReplyBurst       = 32;
+    static constexpr uint16_t kQuerierRepliesPerSecond = 16;
+
     ResponseSender(ServerBase * server) : mServer(server) {}
 
     CHIP_ERROR AddQueryResponder(QueryResponderBase * queryResponder);
@@ -97,21 +121,74 @@ public:
     /// Send back the response to a particular query
     CHIP_ERROR Respond(uint32_t messageId, const QueryData & query, const chip::Inet::IPPacketInfo * querySource);
 
+    /// Forget all the cached replies.
+    ///
+    /// Must be called whenever the records provided by the query responders change.
+    void InvalidateResponseCache();
+
     // Implementation of ResponderDelegate
     void AddResponse(const ResourceRecord & record) override;
 
     void SetServer(ServerBase * server) { mServer = server; }
 
 private:
+#if CHIP_CONFIG_MDNS_RESPONSE_CACHE_SIZE > 0
+    // Longest query name (in dotted form) for which replies are cached
+    static constexpr size_t kMaxCachedQueryNameLength = 64;
+
+    struct CachedResponse
+    {
+        char name[kMaxCachedQueryNameLength + 1] = {}; // empty for unused entries
+        QType type;
+        QClass klass;
+        bool unicastRequested;
+        bool includeQuery;
+        chip::Inet::InterfaceId interfaceId;
+        chip::Inet::IPAddressType addressType;
+        chip::System::Clock::Timestamp expiryTime;
+        chip::System::PacketBufferHandle reply; // null if there is nothing to reply
+    };
+#endif // CHIP_CONFIG_MDNS_RESPONSE_CACHE_SIZE > 0
+
+    struct QuerierState
+    {
+        chip::Inet::IPAddress address;
+        chip::Inet::InterfaceId interfaceId;
+        chip::System::Clock::Timestamp lastRefill;
+        uint16_t tokens = 0;
+        bool inUse      = false;
+    };
+
     CHIP_ERROR FlushReply();
     CHIP_ERROR PrepareNewReplyPacket();
 
+#if CHIP_CONFIG_MDNS_RESPONSE_CACHE_SIZE > 0
+    /// Fills `entry` with the cache key of the current query. Returns false if the reply cannot be cached.
+    bool MakeCacheKey(CachedResponse & entry) const;
+    CachedResponse * FindCachedResponse(const CachedResponse & key, chip::System::Clock::Timestamp now);
+    void StoreCachedResponse(CachedResponse & key, chip::System::Clock::Timestamp now);
+    CHIP_ERROR SendCachedResponse(const CachedResponse & entry);
+#endif // CHIP_CONFIG_MDNS_RESPONSE_CACHE_SIZE > 0
+
+    /// Takes one unicast reply from the allowance of the querier. Returns false if the querier is over its rate.
+    bool ConsumeQuerierToken(chip::System::Clock::Timestamp now);
+
     ServerBase * mServer;
     QueryResponderBase * mResponder[kMaxQueryResponders] = {};
 
     /// Current send state
     ResponseBuilder mResponseBuilder;          // packet being built
     Internal::ResponseSendingState mSendState; // sending state
+
+    uint16_t mRepliesSent = 0;     // packets sent for the current query
+    bool mRateLimited     = false; // current querier is over its rate: drop the reply
+
+#if CHIP_CONFIG_MDNS_RESPONSE_CACHE_SIZE > 0
+    /// Reply of the current query, kept to be cached
+    chip::System::PacketBufferHandle mReplyToCache;
+    CachedResponse mResponseCache[kResponseCacheSize];
+#endif // CHIP_CONFIG_MDNS_RESPONSE_CACHE_SIZE > 0
+    QuerierState mQueriers[kMaxRateLimitedQueriers];
 };
 
 } // namespace Minimal
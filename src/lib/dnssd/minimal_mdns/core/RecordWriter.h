@@ -88,7 +88,7 @@ public:
 private:
     // How  many paths to remember as 'previously written'
     // and make use of them
-    static constexpr size_t kMaxCachedReferences = 8;
+    static constexpr size_t kMaxCachedReferences = 16;
     static constexpr uint16_t kInvalidOffset     = 0xFFFF;
     static constexpr uint16_t kMaxReuseOffset    = 0x3FFF;
 
@@ -146,7 +146,9 @@ void TestLRU(nlTestSuite * inSuite, void * inContext)
                            System::Clock::Milliseconds32(1000 - mdns::Minimal::ActiveResolveAttempts::kRetryQueueSize + 2)));
 
     // add another element - this should overwrite peer 9999
-    attempts.MarkPending(MakePeerId(mdns::Minimal::ActiveResolveAttempts::kRetryQueueSize));
+    NL_TEST_ASSERT(inSuite,
+                   attempts.MarkPending(MakePeerId(mdns::Minimal::ActiveResolveAttempts::kRetryQueueSize)) ==
+                       Optional<PeerId>::Value(MakePeerId(9999)));
     mockClock.AdvanceMonotonic(32_s16);
 
     for (Optional<PeerId> peerId = attempts.NextScheduledPeer(); peerId.HasValue(); peerId = attempts.NextScheduledPeer())
@@ -237,11 +239,35 @@ void TestNextPeerOrdering(nlTestSuite * inSuite, void * inContext)
     NL_TEST_ASSERT(inSuite, !attempts.NextScheduledPeer().HasValue());
 }
 
+void TestCompleteAndFull(nlTestSuite * inSuite, void * inContext)
+{
+    System::Clock::Internal::MockClock mockClock;
+    mdns::Minimal::ActiveResolveAttempts attempts(&mockClock);
+
+    for (uint32_t i = 0; i < mdns::Minimal::ActiveResolveAttempts::kRetryQueueSize; i++)
+    {
+        NL_TEST_ASSERT(inSuite, !attempts.IsFull());
+        NL_TEST_ASSERT(inSuite, !attempts.IsPending(MakePeerId(i + 1)));
+        NL_TEST_ASSERT(inSuite, !attempts.MarkPending(MakePeerId(i + 1)).HasValue());
+        NL_TEST_ASSERT(inSuite, attempts.IsPending(MakePeerId(i + 1)));
+    }
+    NL_TEST_ASSERT(inSuite, attempts.IsFull());
+
+    // Re-marking a pending peer does not need a new entry
+    NL_TEST_ASSERT(inSuite, !attempts.MarkPending(MakePeerId(1)).HasValue());
+    NL_TEST_ASSERT(inSuite, attempts.IsFull());
+
+    NL_TEST_ASSERT(inSuite, attempts.Complete(MakePeerId(1)));
+    NL_TEST_ASSERT(inSuite, !attempts.Complete(MakePeerId(1)));
+    NL_TEST_ASSERT(inSuite, !attempts.IsFull());
+}
+
 const nlTest sTests[] = {
     NL_TEST_DEF("TestSinglePeerAddRemove", TestSinglePeerAddRemove),   //
     NL_TEST_DEF("TestRescheduleSamePeerId", TestRescheduleSamePeerId), //
     NL_TEST_DEF("TestLRU", TestLRU),                                   //
     NL_TEST_DEF("TestNextPeerOrdering", TestNextPeerOrdering),         //
+    NL_TEST_DEF("TestCompleteAndFull", TestCompleteAndFull),           //
     NL_TEST_SENTINEL()                                                 //
 };
 
@@ -16,6 +16,7 @@
  */
 #include <lib/dnssd/minimal_mdns/ResponseSender.h>
 
+#include <cctype>
 #include <string>
 #include <vector>
 
@@ -29,6 +30,7 @@
 
 #include <lib/support/CHIPMem.h>
 #include <lib/support/UnitTestRegistration.h>
+#include <system/SystemClock.h>
 
 #include <nlunit-test.h>
 
@@ -339,6 +341,111 @@ void PtrSrvTxtMultipleRespondersToServiceListing(nlTestSuite * inSuite, void * i
     NL_TEST_ASSERT(inSuite, common1.server.GetHeaderFound());
 }
 
+#if CHIP_CONFIG_MDNS_RESPONSE_CACHE_SIZE > 0
+void CachedReplyUntilInvalidated(nlTestSuite * inSuite, void * inContext)
+{
+    CommonTestElements common(inSuite, "test");
+    common.packetInfo.Clear();
+    common.packetInfo.SrcPort = 5353;
+
+    ResponseSender responseSender(&common.server);
+    NL_TEST_ASSERT(inSuite, responseSender.AddQueryResponder(&common.queryResponder) == CHIP_NO_ERROR);
+    common.queryResponder.AddResponder(&common.srvResponder);
+
+    common.recordWriter.WriteQName(common.instance);
+    QueryData queryData = QueryData(QType::ANY, QClass::IN, true, common.requestNameStart, common.requestBytesRange);
+
+    common.server.AddExpectedRecord(&common.srvRecord);
+    NL_TEST_ASSERT(inSuite, responseSender.Respond(1, queryData, &common.packetInfo) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, common.server.GetSendCalled());
+    NL_TEST_ASSERT(inSuite, common.server.GetHeaderFound());
+
+    // Records changed without invalidating: the same question gets the cached reply.
+    common.queryResponder.AddResponder(&common.txtResponder);
+    common.server.Reset();
+    common.server.AddExpectedRecord(&common.srvRecord);
+    NL_TEST_ASSERT(inSuite, responseSender.Respond(2, queryData, &common.packetInfo) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, common.server.GetSendCalled());
+    NL_TEST_ASSERT(inSuite, common.server.GetHeaderFound());
+
+    // Names are case insensitive: the same question in upper case hits the cache as well.
+    for (uint8_t i = 1; i <= 4; i++) // "test" label
+    {
+        common.requestNameStart[i] = static_cast<uint8_t>(toupper(common.requestNameStart[i]));
+    }
+    common.server.Reset();
+    common.server.AddExpectedRecord(&common.srvRecord);
+    NL_TEST_ASSERT(inSuite, responseSender.Respond(3, queryData, &common.packetInfo) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, common.server.GetSendCalled());
+    NL_TEST_ASSERT(inSuite, common.server.GetHeaderFound());
+
+    responseSender.InvalidateResponseCache();
+    common.server.Reset();
+    common.server.AddExpectedRecord(&common.srvRecord);
+    common.server.AddExpectedRecord(&common.txtRecord);
+    NL_TEST_ASSERT(inSuite, responseSender.Respond(4, queryData, &common.packetInfo) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, common.server.GetSendCalled());
+    NL_TEST_ASSERT(inSuite, common.server.GetHeaderFound());
+}
+#endif // CHIP_CONFIG_MDNS_RESPONSE_CACHE_SIZE > 0
+
+void UnicastRepliesAreRateLimited(nlTestSuite * inSuite, void * inContext)
+{
+    System::Clock::Internal::MockClock mockClock;
+    System::Clock::ClockBase * realClock = &System::SystemClock();
+    System::Clock::Internal::SetSystemClockForTesting(&mockClock);
+
+    CommonTestElements common(inSuite, "test");
+    common.packetInfo.Clear();
+    common.packetInfo.SrcPort = 5353;
+
+    ResponseSender responseSender(&common.server);
+    NL_TEST_ASSERT(inSuite, responseSender.AddQueryResponder(&common.queryResponder) == CHIP_NO_ERROR);
+    common.queryResponder.AddResponder(&common.srvResponder);
+
+    common.recordWriter.WriteQName(common.instance);
+    QueryData queryData = QueryData(QType::ANY, QClass::IN, true, common.requestNameStart, common.requestBytesRange);
+
+    for (uint16_t i = 0; i < ResponseSender::kQuerierReplyBurst; i++)
+    {
+        common.server.Reset();
+        common.server.AddExpectedRecord(&common.srvRecord);
+        NL_TEST_ASSERT(inSuite, responseSender.Respond(1, queryData, &common.packetInfo) == CHIP_NO_ERROR);
+        NL_TEST_ASSERT(inSuite, common.server.GetSendCalled());
+    }
+
+    // The burst is used up: no reply until the allowance refills.
+    common.server.Reset();
+    NL_TEST_ASSERT(inSuite, responseSender.Respond(1, queryData, &common.packetInfo) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, !common.server.GetSendCalled());
+
+    // A second later, the querier can get replies again.
+    mockClock.AdvanceMonotonic(System::Clock::Seconds16(1));
+    common.server.Reset();
+    common.server.AddExpectedRecord(&common.srvRecord);
+    NL_TEST_ASSERT(inSuite, responseSender.Respond(1, queryData, &common.packetInfo) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, common.server.GetSendCalled());
+
+    // Other queriers are not affected.
+    for (uint16_t i = 1; i < ResponseSender::kQuerierRepliesPerSecond; i++)
+    {
+        common.server.Reset();
+        common.server.AddExpectedRecord(&common.srvRecord);
+        NL_TEST_ASSERT(inSuite, responseSender.Respond(1, queryData, &common.packetInfo) == CHIP_NO_ERROR);
+    }
+    common.server.Reset();
+    NL_TEST_ASSERT(inSuite, responseSender.Respond(1, queryData, &common.packetInfo) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, !common.server.GetSendCalled());
+
+    Inet::IPAddress::FromString("fe80::1", common.packetInfo.SrcAddress);
+    common.server.Reset();
+    common.server.AddExpectedRecord(&common.srvRecord);
+    NL_TEST_ASSERT(inSuite, responseSender.Respond(1, queryData, &common.packetInfo) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, common.server.GetSendCalled());
+
+    System::Clock::Internal::SetSystemClockForTesting(realClock);
+}
+
 const nlTest sTests[] = {
     NL_TEST_DEF("SrvAnyResponseToInstance", SrvAnyResponseToInstance),                                       //
     NL_TEST_DEF("SrvTxtAnyResponseToInstance", SrvTxtAnyResponseToInstance),                                 //
@@ -350,7 +457,10 @@ const nlTest sTests[] = {
     NL_TEST_DEF("AddManyQueryResponders", AddManyQueryResponders),                                           //
     NL_TEST_DEF("PtrSrvTxtMultipleRespondersToInstance", PtrSrvTxtMultipleRespondersToInstance),             //
     NL_TEST_DEF("PtrSrvTxtMultipleRespondersToServiceListing", PtrSrvTxtMultipleRespondersToServiceListing), //
-
+#if CHIP_CONFIG_MDNS_RESPONSE_CACHE_SIZE > 0
+    NL_TEST_DEF("CachedReplyUntilInvalidated", CachedReplyUntilInvalidated),                                 //
+#endif
+    NL_TEST_DEF("UnicastRepliesAreRateLimited", UnicastRepliesAreRateLimited),                               //
     NL_TEST_SENTINEL() //
 };
 
@@ -19,6 +19,7 @@
 // set this to 1 to enable DumpCache to see the state of the cache when needed
 // #define MDNS_LOGGING 1
 #include <cstdint>
+#include <cstring>
 #include <iostream>
 #include <nlunit-test.h>
 
@@ -75,15 +76,18 @@ void TestInsert(nlTestSuite * inSuite, void * inContext)
         // Need to re-cast to uint16_t because of integer type promotion
         nodeData.mPort = static_cast<uint16_t>(port + i);
         result         = tDnssdCache.Insert(nodeData);
-        if (i < sizeOfCache)
-        {
-            NL_TEST_ASSERT(inSuite, result == CHIP_NO_ERROR);
-        }
-        else
-        {
-            NL_TEST_ASSERT(inSuite, result != CHIP_NO_ERROR);
-        }
+        // A full cache evicts its least recently used entry to make room.
+        NL_TEST_ASSERT(inSuite, result == CHIP_NO_ERROR);
+        NL_TEST_ASSERT(inSuite, tDnssdCache.Size() == ((i < sizeOfCache) ? i + 1u : static_cast<size_t>(sizeOfCache)));
     }
+    NL_TEST_ASSERT(inSuite, tDnssdCache.GetStatistics().mEvictions == 10 - sizeOfCache);
+
+    // Only the most recent entries are left.
+    peerId.SetNodeId(static_cast<NodeId>(id));
+    NL_TEST_ASSERT(inSuite, tDnssdCache.Lookup(peerId, nodeDataOut) == CHIP_ERROR_KEY_NOT_FOUND);
+    peerId.SetNodeId(static_cast<NodeId>(id + 9));
+    NL_TEST_ASSERT(inSuite, tDnssdCache.Lookup(peerId, nodeDataOut) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, nodeDataOut.mPort == port + 9);
 
     tDnssdCache.DumpCache();
     fakeClock.SetMonotonic(nodeData.mExpiryTime + ttl + System::Clock::Seconds16(1));
@@ -133,7 +137,129 @@ void TestInsert(nlTestSuite * inSuite, void * inContext)
     NL_TEST_ASSERT(inSuite, tDnssdCache.Lookup(peerId, nodeDataOut) != CHIP_NO_ERROR);
 }
 
-static const nlTest sTests[] = { NL_TEST_DEF_FN(TestCreate), NL_TEST_DEF_FN(TestInsert), NL_TEST_SENTINEL() };
+void TestLruEviction(nlTestSuite * inSuite, void * inContext)
+{
+    DnssdCache<3> tDnssdCache;
+    ResolvedNodeData nodeData;
+    ResolvedNodeData nodeDataOut;
+
+    Inet::IPAddress::FromString("1.0.0.1", nodeData.mAddress[nodeData.mNumIPs++]);
+    nodeData.mInterfaceId = Inet::InterfaceId::Null();
+    nodeData.mExpiryTime  = fakeClock.GetMonotonicTimestamp() + System::Clock::Seconds16(60);
+
+    for (NodeId nodeId = 1; nodeId <= 3; nodeId++)
+    {
+        nodeData.mPeerId = PeerId().SetCompressedFabricId(1).SetNodeId(nodeId);
+        NL_TEST_ASSERT(inSuite, tDnssdCache.Insert(nodeData) == CHIP_NO_ERROR);
+    }
+
+    // Looking node 1 up makes node 2 the least recently used entry.
+    NL_TEST_ASSERT(inSuite, tDnssdCache.Lookup(PeerId().SetCompressedFabricId(1).SetNodeId(1), nodeDataOut) == CHIP_NO_ERROR);
+
+    nodeData.mPeerId = PeerId().SetCompressedFabricId(1).SetNodeId(4);
+    NL_TEST_ASSERT(inSuite, tDnssdCache.Insert(nodeData) == CHIP_NO_ERROR);
+
+    NL_TEST_ASSERT(inSuite, tDnssdCache.Lookup(PeerId().SetCompressedFabricId(1).SetNodeId(1), nodeDataOut) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite,
+                   tDnssdCache.Lookup(PeerId().SetCompressedFabricId(1).SetNodeId(2), nodeDataOut) == CHIP_ERROR_KEY_NOT_FOUND);
+    NL_TEST_ASSERT(inSuite, tDnssdCache.Lookup(PeerId().SetCompressedFabricId(1).SetNodeId(3), nodeDataOut) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, tDnssdCache.Lookup(PeerId().SetCompressedFabricId(1).SetNodeId(4), nodeDataOut) == CHIP_NO_ERROR);
+
+    // Updating an entry keeps a single copy of it.
+    nodeData.mPort = 5540;
+    NL_TEST_ASSERT(inSuite, tDnssdCache.Insert(nodeData) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, tDnssdCache.Size() == 3);
+    NL_TEST_ASSERT(inSuite, tDnssdCache.Lookup(nodeData.mPeerId, nodeDataOut) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, nodeDataOut.mPort == 5540);
+
+    NL_TEST_ASSERT(inSuite, tDnssdCache.GetStatistics().mEvictions == 1);
+    NL_TEST_ASSERT(inSuite, tDnssdCache.GetStatistics().mHits == 5);
+    NL_TEST_ASSERT(inSuite, tDnssdCache.GetStatistics().mMisses == 1);
+}
+
+void TestExpiryAndNegativeEntries(nlTestSuite * inSuite, void * inContext)
+{
+    DnssdCache<4> tDnssdCache;
+    ResolvedNodeData nodeData;
+    ResolvedNodeData nodeDataOut;
+    const PeerId goneNode    = PeerId().SetCompressedFabricId(1).SetNodeId(1);
+    const PeerId presentNode = PeerId().SetCompressedFabricId(1).SetNodeId(2);
+
+    Inet::IPAddress::FromString("1.0.0.1", nodeData.mAddress[nodeData.mNumIPs++]);
+    nodeData.mInterfaceId = Inet::InterfaceId::Null();
+    nodeData.mPeerId      = presentNode;
+    nodeData.mExpiryTime  = fakeClock.GetMonotonicTimestamp() + System::Clock::Seconds16(2);
+    NL_TEST_ASSERT(inSuite, tDnssdCache.Insert(nodeData) == CHIP_NO_ERROR);
+
+    NL_TEST_ASSERT(inSuite,
+                   tDnssdCache.InsertNegative(goneNode, fakeClock.GetMonotonicTimestamp() + System::Clock::Seconds16(5)) ==
+                       CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, tDnssdCache.Lookup(goneNode, nodeDataOut) == CHIP_ERROR_NOT_FOUND);
+    NL_TEST_ASSERT(inSuite, tDnssdCache.Lookup(presentNode, nodeDataOut) == CHIP_NO_ERROR);
+
+    // Positive entry expires first.
+    fakeClock.AdvanceMonotonic(System::Clock::Seconds16(3));
+    NL_TEST_ASSERT(inSuite, tDnssdCache.Lookup(presentNode, nodeDataOut) == CHIP_ERROR_KEY_NOT_FOUND);
+    NL_TEST_ASSERT(inSuite, tDnssdCache.Lookup(goneNode, nodeDataOut) == CHIP_ERROR_NOT_FOUND);
+
+    // A new announcement replaces the negative entry.
+    nodeData.mPeerId     = goneNode;
+    nodeData.mExpiryTime = fakeClock.GetMonotonicTimestamp() + System::Clock::Seconds16(10);
+    NL_TEST_ASSERT(inSuite, tDnssdCache.Insert(nodeData) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, tDnssdCache.Lookup(goneNode, nodeDataOut) == CHIP_NO_ERROR);
+
+    // Inserting an already expired record removes what is known about the node.
+    nodeData.mExpiryTime = fakeClock.GetMonotonicTimestamp();
+    NL_TEST_ASSERT(inSuite, tDnssdCache.Insert(nodeData) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, tDnssdCache.Lookup(goneNode, nodeDataOut) == CHIP_ERROR_KEY_NOT_FOUND);
+    NL_TEST_ASSERT(inSuite, tDnssdCache.Size() == 0);
+
+    NL_TEST_ASSERT(inSuite, tDnssdCache.GetStatistics().mNegativeHits == 2);
+    NL_TEST_ASSERT(inSuite, tDnssdCache.GetStatistics().mExpirations == 1);
+    tDnssdCache.ResetStatistics();
+    NL_TEST_ASSERT(inSuite, tDnssdCache.GetStatistics().mHits == 0);
+}
+
+void TestUpdateHostAddresses(nlTestSuite * inSuite, void * inContext)
+{
+    DnssdCache<4> tDnssdCache;
+    ResolvedNodeData nodeData;
+    ResolvedNodeData addresses;
+    ResolvedNodeData nodeDataOut;
+
+    Inet::IPAddress::FromString("fd00::1", nodeData.mAddress[nodeData.mNumIPs++]);
+    nodeData.mInterfaceId = Inet::InterfaceId::Null();
+    nodeData.mExpiryTime  = fakeClock.GetMonotonicTimestamp() + System::Clock::Seconds16(60);
+    strcpy(nodeData.mHostName, "0102030405060708");
+
+    // The same host is commissioned into two fabrics.
+    nodeData.mPeerId = PeerId().SetCompressedFabricId(1).SetNodeId(1);
+    NL_TEST_ASSERT(inSuite, tDnssdCache.Insert(nodeData) == CHIP_NO_ERROR);
+    nodeData.mPeerId = PeerId().SetCompressedFabricId(2).SetNodeId(7);
+    NL_TEST_ASSERT(inSuite, tDnssdCache.Insert(nodeData) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, tDnssdCache.InsertNegative(PeerId().SetCompressedFabricId(3).SetNodeId(1), nodeData.mExpiryTime) ==
+                       CHIP_NO_ERROR);
+
+    Inet::IPAddress::FromString("fd00::2", addresses.mAddress[addresses.mNumIPs++]);
+    Inet::IPAddress::FromString("fd00::3", addresses.mAddress[addresses.mNumIPs++]);
+    addresses.mInterfaceId = Inet::InterfaceId::Null();
+    addresses.mExpiryTime  = fakeClock.GetMonotonicTimestamp() + System::Clock::Seconds16(30);
+
+    NL_TEST_ASSERT(inSuite, tDnssdCache.UpdateHostAddresses("1112131415161718", addresses) == 0);
+    NL_TEST_ASSERT(inSuite, tDnssdCache.UpdateHostAddresses("0102030405060708", addresses) == 2);
+
+    NL_TEST_ASSERT(inSuite, tDnssdCache.Lookup(PeerId().SetCompressedFabricId(1).SetNodeId(1), nodeDataOut) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, nodeDataOut.mNumIPs == 2);
+    NL_TEST_ASSERT(inSuite, nodeDataOut.mAddress[0] == addresses.mAddress[0]);
+    NL_TEST_ASSERT(inSuite, nodeDataOut.mAddress[1] == addresses.mAddress[1]);
+    NL_TEST_ASSERT(inSuite, nodeDataOut.mExpiryTime == addresses.mExpiryTime);
+    NL_TEST_ASSERT(inSuite,
+                   tDnssdCache.Lookup(PeerId().SetCompressedFabricId(3).SetNodeId(1), nodeDataOut) == CHIP_ERROR_NOT_FOUND);
+}
+
+static const nlTest sTests[] = { NL_TEST_DEF_FN(TestCreate), NL_TEST_DEF_FN(TestInsert), NL_TEST_DEF_FN(TestLruEviction),
+                                 NL_TEST_DEF_FN(TestExpiryAndNegativeEntries), NL_TEST_DEF_FN(TestUpdateHostAddresses),
+                                 NL_TEST_SENTINEL() };
 
 static int TestSetup(void * inContext)
 {
@@ -70,6 +70,16 @@
 #define CHIP_DEVICE_LAYER_BLE_CONN_CFG_TAG 1
 #endif // CHIP_DEVICE_LAYER_BLE_CONN_CFG_TAG
 
+/**
+ * @def CHIP_DEVICE_LAYER_OTA_WRITE_BUFFER_SIZE
+ *
+ * The size of the buffer holding downloaded OTA image data until it is
+ * written to the image file. The download is paused while the buffer is full.
+ */
+#ifndef CHIP_DEVICE_LAYER_OTA_WRITE_BUFFER_SIZE
+#define CHIP_DEVICE_LAYER_OTA_WRITE_BUFFER_SIZE (64 * 1024)
+#endif // CHIP_DEVICE_LAYER_OTA_WRITE_BUFFER_SIZE
+
 // ========== Platform-specific Configuration Overrides =========
 
 #ifndef CHIP_DEVICE_CONFIG_CHIP_TASK_STACK_SIZE
@@ -17,11 +17,52 @@
  */
 
 #include <app/clusters/ota-requestor/OTADownloader.h>
+#include <lib/support/CHIPMem.h>
+#include <lib/support/CodeUtils.h>
+#include <lib/support/TypeTraits.h>
 
 #include "OTAImageProcessorImpl.h"
 
+#include <errno.h>
+#include <fcntl.h>
+#include <inttypes.h>
+#include <stdio.h>
+#include <string.h>
+#include <unistd.h>
+
 namespace chip {
 
+namespace {
+
+bool WriteAll(int fd, const uint8_t * data, size_t length)
+{
+    while (length > 0)
+    {
+        ssize_t written = write(fd, data, length);
+        if (written < 0 && errno == EINTR)
+        {
+            continue;
+        }
+        if (written <= 0)
+        {
+            ChipLogError(SoftwareUpdate, "Cannot write OTA image: %s", strerror(errno));
+            return false;
+        }
+
+        data += written;
+        length -= static_cast<size_t>(written);
+    }
+
+    return true;
+}
+
+} // namespace
+
+OTAImageProcessorImpl::~OTAImageProcessorImpl()
+{
+    Cleanup();
+}
+
 CHIP_ERROR OTAImageProcessorImpl::PrepareDownload()
 {
     if (mParams.imageFile.empty())
@@ -36,7 +77,24 @@ CHIP_ERROR OTAImageProcessorImpl::PrepareDownload()
 
 CHIP_ERROR OTAImageProcessorImpl::Finalize()
 {
-    DeviceLayer::PlatformMgr().ScheduleWork(HandleFinalize, reinterpret_cast<intptr_t>(this));
+    // The last block has been verified already: only an image that ended early can fail here
+    if (mVerificationState == VerificationState::kDecodingHeader || mVerificationState == VerificationState::kHashingPayload)
+    {
+        ChipLogError(SoftwareUpdate, "OTA image is truncated");
+        Abort();
+        return CHIP_ERROR_INTEGRITY_CHECK_FAILED;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+        // The download has failed already, and the error has been reported to the downloader
+        ReturnErrorOnFailure(mDownloadError);
+        mFinalizing   = true;
+        mFetchPending = false;
+    }
+
+    // The writer thread schedules HandleFinalize once everything has been written
+    mCondition.notify_all();
     return CHIP_NO_ERROR;
 }
 
@@ -59,7 +117,7 @@ CHIP_ERROR OTAImageProcessorImpl::Abort()
 
 CHIP_ERROR OTAImageProcessorImpl::ProcessBlock(ByteSpan & block)
 {
-    if (!mOfs.is_open() || !mOfs.good())
+    if (mFd < 0 || mBuffer == nullptr)
     {
         return CHIP_ERROR_INTERNAL;
     }
@@ -69,17 +127,250 @@ CHIP_ERROR OTAImageProcessorImpl::ProcessBlock(ByteSpan & block)
         return CHIP_ERROR_INVALID_ARGUMENT;
     }
 
-    // Store block data for HandleProcessBlock to access
-    CHIP_ERROR err = SetBlock(block);
+    const size_t blockSize = block.size();
+    ByteSpan payload       = block;
+    CHIP_ERROR err         = VerifyBlock(payload);
+    if (err != CHIP_NO_ERROR)
+    {
+        ChipLogError(SoftwareUpdate, "Cannot verify OTA image block: %" CHIP_ERROR_FORMAT, err.Format());
+        return FailDownload(err);
+    }
+
+    err = QueueWrite(payload);
     if (err != CHIP_NO_ERROR)
     {
-        ChipLogError(SoftwareUpdate, "Cannot set block data: %" CHIP_ERROR_FORMAT, err.Format());
+        ChipLogError(SoftwareUpdate, "Cannot queue OTA image block: %" CHIP_ERROR_FORMAT, err.Format());
+        return FailDownload(err);
+    }
+
+    std::lock_guard<std::mutex> lock(mMutex);
+    mParams.downloadedBytes += blockSize;
+    mMaxBlockSize = chip::max(mMaxBlockSize, blockSize);
+
+    // Keep the download going while the file is being written, unless the writer has fallen too far behind
+    if (HasRoomForNextBlock())
+    {
+        DeviceLayer::PlatformMgr().ScheduleWork(HandleFetchNextData, reinterpret_cast<intptr_t>(this));
+    }
+    else
+    {
+        mFetchPending = true;
     }
 
-    DeviceLayer::PlatformMgr().ScheduleWork(HandleProcessBlock, reinterpret_cast<intptr_t>(this));
     return CHIP_NO_ERROR;
 }
 
+CHIP_ERROR OTAImageProcessorImpl::VerifyBlock(ByteSpan & block)
+{
+    if (mVerificationState == VerificationState::kDecodingHeader)
+    {
+        const bool isFirstBlock = (mParams.downloadedBytes == 0);
+        const ByteSpan image    = block;
+        OTAImageHeader header;
+
+        CHIP_ERROR err = mHeaderParser.AccumulateAndDecode(block, header);
+        if (err == CHIP_ERROR_INVALID_ARGUMENT && isFirstBlock)
+        {
+            if (!mAllowImagesWithoutHeader)
+            {
+                ChipLogError(SoftwareUpdate, "No OTA image header found");
+                return err;
+            }
+
+            ChipLogProgress(SoftwareUpdate, "No OTA image header found, the image will not be verified");
+            mHeaderParser.Clear();
+            mVerificationState = VerificationState::kUnverified;
+            block              = image;
+            return CHIP_NO_ERROR;
+        }
+        VerifyOrReturnError(err != CHIP_ERROR_BUFFER_TOO_SMALL, CHIP_NO_ERROR);
+        ReturnErrorOnFailure(err);
+
+        ChipLogProgress(SoftwareUpdate, "OTA image for VID 0x%04x PID 0x%04x, software version %" PRIu32, header.mVendorId,
+                        header.mProductId, header.mSoftwareVersion);
+
+        if (header.mImageDigestType != OTAImageDigestType::kSha256 || header.mImageDigest.size() != sizeof(mImageDigest))
+        {
+            ChipLogError(SoftwareUpdate, "Unsupported OTA image digest type %u", to_underlying(header.mImageDigestType));
+            return CHIP_ERROR_NOT_IMPLEMENTED;
+        }
+
+        memcpy(mImageDigest, header.mImageDigest.data(), sizeof(mImageDigest));
+        mPayloadBytesLeft = header.mPayloadSize;
+        mHeaderParser.Clear();
+        ReturnErrorOnFailure(mHash.Begin());
+        mVerificationState = VerificationState::kHashingPayload;
+    }
+
+    VerifyOrReturnError(mVerificationState != VerificationState::kUnverified, CHIP_NO_ERROR);
+    VerifyOrReturnError(block.size() <= mPayloadBytesLeft, CHIP_ERROR_INVALID_MESSAGE_LENGTH);
+    VerifyOrReturnError(!block.empty(), CHIP_NO_ERROR);
+
+    ReturnErrorOnFailure(mHash.AddData(block));
+    mPayloadBytesLeft -= block.size();
+    VerifyOrReturnError(mPayloadBytesLeft == 0, CHIP_NO_ERROR);
+
+    uint8_t digestBuffer[Crypto::kSHA256_Hash_Length];
+    MutableByteSpan digest(digestBuffer);
+    ReturnErrorOnFailure(mHash.Finish(digest));
+    if (!digest.data_equal(ByteSpan(mImageDigest)))
+    {
+        ChipLogError(SoftwareUpdate, "OTA image digest mismatch");
+        return CHIP_ERROR_INTEGRITY_CHECK_FAILED;
+    }
+
+    mVerificationState = VerificationState::kVerified;
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR OTAImageProcessorImpl::QueueWrite(ByteSpan data)
+{
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+
+        // The next block is not requested until the writer thread has taken the previous overflow chunk
+        VerifyOrReturnError(mOverflow == nullptr, CHIP_ERROR_INCORRECT_STATE);
+
+        while (!data.empty() && mBufferedBytes < kWriteBufferSize)
+        {
+            const size_t tail   = (mBufferHead + mBufferedBytes) % kWriteBufferSize;
+            const size_t length = chip::min(data.size(), chip::min(kWriteBufferSize - mBufferedBytes, kWriteBufferSize - tail));
+            memcpy(&mBuffer[tail], data.data(), length);
+            mBufferedBytes += length;
+            data = data.SubSpan(length);
+        }
+
+        // Only happens when a block is larger than the room kept for it: rather than waiting for the writer thread, the rest
+        // of the block is copied aside and written once the buffer has been
+        if (!data.empty())
+        {
+            mOverflow = static_cast<uint8_t *>(chip::Platform::MemoryAlloc(data.size()));
+            VerifyOrReturnError(mOverflow != nullptr, CHIP_ERROR_NO_MEMORY);
+            memcpy(mOverflow, data.data(), data.size());
+            mOverflowSize = data.size();
+        }
+    }
+
+    mCondition.notify_all();
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR OTAImageProcessorImpl::FailDownload(CHIP_ERROR err)
+{
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+        // Once the writer thread has failed, it has reported its own error already
+        VerifyOrReturnError(mDownloadError == CHIP_NO_ERROR, err);
+        mDownloadError = err;
+    }
+
+    DeviceLayer::PlatformMgr().ScheduleWork(HandleDownloadError, reinterpret_cast<intptr_t>(this));
+    return err;
+}
+
+void OTAImageProcessorImpl::WriterLoop()
+{
+    std::unique_lock<std::mutex> lock(mMutex);
+
+    while (true)
+    {
+        mCondition.wait(lock, [this] { return mStopping || mFinalizing || mBufferedBytes > 0 || mOverflow != nullptr; });
+        VerifyOrReturn(!mStopping);
+
+        if (mBufferedBytes == 0 && mOverflow == nullptr)
+        {
+            // Finalizing and everything has been written
+            break;
+        }
+
+        // The CHIP thread only appends after the buffered bytes, and leaves the overflow chunk alone until it has been
+        // written, so either can be written without holding the lock
+        const size_t head     = mBufferHead;
+        const bool isOverflow = (mBufferedBytes == 0);
+        const uint8_t * data  = isOverflow ? mOverflow : &mBuffer[head];
+        const size_t length   = isOverflow ? mOverflowSize : chip::min(mBufferedBytes, kWriteBufferSize - head);
+        lock.unlock();
+        const bool written = WriteAll(mFd, data, length);
+        lock.lock();
+
+        if (!written)
+        {
+            // A download that failed on the CHIP thread has been reported already
+            VerifyOrReturn(mDownloadError == CHIP_NO_ERROR);
+            mDownloadError = CHIP_ERROR_WRITE_FAILED;
+            DeviceLayer::PlatformMgr().ScheduleWork(mFinalizing ? HandleFinalize : HandleDownloadError,
+                                                    reinterpret_cast<intptr_t>(this));
+            return;
+        }
+
+        if (isOverflow)
+        {
+            chip::Platform::MemoryFree(mOverflow);
+            mOverflow     = nullptr;
+            mOverflowSize = 0;
+        }
+        else
+        {
+            mBufferHead = (head + length) % kWriteBufferSize;
+            mBufferedBytes -= length;
+        }
+
+        if (mFetchPending && HasRoomForNextBlock())
+        {
+            mFetchPending = false;
+            DeviceLayer::PlatformMgr().ScheduleWork(HandleFetchNextData, reinterpret_cast<intptr_t>(this));
+        }
+    }
+
+    lock.unlock();
+    const bool synced = (fsync(mFd) == 0);
+    lock.lock();
+
+    if (!synced)
+    {
+        ChipLogError(SoftwareUpdate, "Cannot sync OTA image: %s", strerror(errno));
+        mDownloadError = CHIP_ERROR_WRITE_FAILED;
+    }
+    DeviceLayer::PlatformMgr().ScheduleWork(HandleFinalize, reinterpret_cast<intptr_t>(this));
+}
+
+void OTAImageProcessorImpl::Cleanup()
+{
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+        mStopping = true;
+    }
+    mCondition.notify_all();
+
+    if (mWriterThread.joinable())
+    {
+        mWriterThread.join();
+    }
+
+    if (mFd >= 0)
+    {
+        close(mFd);
+        mFd = -1;
+    }
+
+    if (mBuffer != nullptr)
+    {
+        chip::Platform::MemoryFree(mBuffer);
+        mBuffer = nullptr;
+    }
+
+    if (mOverflow != nullptr)
+    {
+        chip::Platform::MemoryFree(mOverflow);
+        mOverflow     = nullptr;
+        mOverflowSize = 0;
+    }
+
+    mHeaderParser.Clear();
+    mHash.Clear();
+    mStopping = false;
+}
+
 void OTAImageProcessorImpl::HandlePrepareDownload(intptr_t context)
 {
     auto * imageProcessor = reinterpret_cast<OTAImageProcessorImpl *>(context);
@@ -94,15 +385,35 @@ void OTAImageProcessorImpl::HandlePrepareDownload(intptr_t context)
         return;
     }
 
-    imageProcessor->mOfs.open(imageProcessor->mParams.imageFile.data(),
-                              std::ofstream::out | std::ofstream::ate | std::ofstream::app);
-    if (!imageProcessor->mOfs.good())
+    imageProcessor->Cleanup();
+
+    // Any previous contents of the file are discarded
+    imageProcessor->mFd = open(imageProcessor->mParams.imageFile.data(), O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0644);
+    if (imageProcessor->mFd < 0)
     {
+        ChipLogError(SoftwareUpdate, "Cannot open OTA image file: %s", strerror(errno));
         imageProcessor->mDownloader->OnPreparedForDownload(CHIP_ERROR_OPEN_FAILED);
         return;
     }
 
-    // TODO: if file already exists and is not empty, erase previous contents
+    imageProcessor->mBuffer = static_cast<uint8_t *>(chip::Platform::MemoryAlloc(kWriteBufferSize));
+    if (imageProcessor->mBuffer == nullptr || imageProcessor->mHeaderParser.Init() != CHIP_NO_ERROR)
+    {
+        imageProcessor->Cleanup();
+        imageProcessor->mDownloader->OnPreparedForDownload(CHIP_ERROR_NO_MEMORY);
+        return;
+    }
+
+    imageProcessor->mParams.downloadedBytes = 0;
+    imageProcessor->mPayloadBytesLeft       = 0;
+    imageProcessor->mVerificationState      = VerificationState::kDecodingHeader;
+    imageProcessor->mBufferHead             = 0;
+    imageProcessor->mBufferedBytes          = 0;
+    imageProcessor->mMaxBlockSize           = 0;
+    imageProcessor->mDownloadError          = CHIP_NO_ERROR;
+    imageProcessor->mFetchPending           = false;
+    imageProcessor->mFinalizing             = false;
+    imageProcessor->mWriterThread           = std::thread(&OTAImageProcessorImpl::WriterLoop, imageProcessor);
 
     imageProcessor->mDownloader->OnPreparedForDownload(CHIP_NO_ERROR);
 }
@@ -115,10 +426,37 @@ void OTAImageProcessorImpl::HandleFinalize(intptr_t context)
         return;
     }
 
-    imageProcessor->mOfs.close();
-    imageProcessor->ReleaseBlock();
+    CHIP_ERROR err;
+    {
+        std::lock_guard<std::mutex> lock(imageProcessor->mMutex);
+        err = imageProcessor->mDownloadError;
+    }
+
+    imageProcessor->Cleanup();
+
+    if (err != CHIP_NO_ERROR)
+    {
+        ChipLogError(SoftwareUpdate, "Cannot store OTA image: %" CHIP_ERROR_FORMAT, err.Format());
+        if (imageProcessor->mDownloader == nullptr)
+        {
+            remove(imageProcessor->mParams.imageFile.data());
+            return;
+        }
+
+        // The transfer has completed, so the download has to be failed here. This aborts the image processor as well, which
+        // removes the file.
+        imageProcessor->mDownloader->EndDownload(err);
+        return;
+    }
 
-    ChipLogProgress(SoftwareUpdate, "OTA image downloaded to %s", imageProcessor->mParams.imageFile.data());
+    if (imageProcessor->mVerificationState == VerificationState::kVerified)
+    {
+        ChipLogProgress(SoftwareUpdate, "OTA image verified and downloaded to %s", imageProcessor->mParams.imageFile.data());
+    }
+    else
+    {
+        ChipLogProgress(SoftwareUpdate, "OTA image downloaded to %s", imageProcessor->mParams.imageFile.data());
+    }
 }
 
 void OTAImageProcessorImpl::HandleAbort(intptr_t context)
@@ -129,12 +467,11 @@ void OTAImageProcessorImpl::HandleAbort(intptr_t context)
         return;
     }
 
-    imageProcessor->mOfs.close();
+    imageProcessor->Cleanup();
     remove(imageProcessor->mParams.imageFile.data());
-    imageProcessor->ReleaseBlock();
 }
 
-void OTAImageProcessorImpl::HandleProcessBlock(intptr_t context)
+void OTAImageProcessorImpl::HandleFetchNextData(intptr_t context)
 {
     auto * imageProcessor = reinterpret_cast<OTAImageProcessorImpl *>(context);
     if (imageProcessor == nullptr)
@@ -148,56 +485,31 @@ void OTAImageProcessorImpl::HandleProcessBlock(intptr_t context)
         return;
     }
 
-    // TODO: Process block header if any
-
-    if (!imageProcessor->mOfs.write(reinterpret_cast<const char *>(imageProcessor->mBlock.data()),
-                                    static_cast<std::streamsize>(imageProcessor->mBlock.size())))
-    {
-        imageProcessor->mDownloader->EndDownload(CHIP_ERROR_WRITE_FAILED);
-        return;
-    }
-
-    imageProcessor->mParams.downloadedBytes += imageProcessor->mBlock.size();
     imageProcessor->mDownloader->FetchNextData();
 }
 
-CHIP_ERROR OTAImageProcessorImpl::SetBlock(ByteSpan & block)
+void OTAImageProcessorImpl::HandleDownloadError(intptr_t context)
 {
-    if ((block.data() == nullptr) || block.empty())
-    {
-        return CHIP_NO_ERROR;
-    }
-
-    // Allocate memory for block data if it has not been done yet
-    if (mBlock.empty())
+    auto * imageProcessor = reinterpret_cast<OTAImageProcessorImpl *>(context);
+    if (imageProcessor == nullptr)
     {
-        mBlock = MutableByteSpan(static_cast<uint8_t *>(chip::Platform::MemoryAlloc(block.size())), block.size());
-        if (mBlock.data() == nullptr)
-        {
-            return CHIP_ERROR_NO_MEMORY;
-        }
+        ChipLogError(SoftwareUpdate, "ImageProcessor context is null");
+        return;
     }
-
-    // Store the actual block data
-    CHIP_ERROR err = CopySpanToMutableSpan(block, mBlock);
-    if (err != CHIP_NO_ERROR)
+    else if (imageProcessor->mDownloader == nullptr)
     {
-        ChipLogError(SoftwareUpdate, "Cannot copy block data: %" CHIP_ERROR_FORMAT, err.Format());
-        return err;
+        ChipLogError(SoftwareUpdate, "mDownloader is null");
+        return;
     }
 
-    return CHIP_NO_ERROR;
-}
-
-CHIP_ERROR OTAImageProcessorImpl::ReleaseBlock()
-{
-    if (mBlock.data() != nullptr)
+    CHIP_ERROR err;
     {
-        chip::Platform::MemoryFree(mBlock.data());
+        std::lock_guard<std::mutex> lock(imageProcessor->mMutex);
+        err = imageProcessor->mDownloadError;
     }
 
-    mBlock = MutableByteSpan();
-    return CHIP_NO_ERROR;
+    // Aborts the image processor as well, which removes the file
+    imageProcessor->mDownloader->EndDownload(err);
 }
 
 } // namespace chip
@@ -19,16 +19,34 @@
 #pragma once
 
 #include <app/clusters/ota-requestor/OTADownloader.h>
+#include <crypto/CHIPCryptoPAL.h>
+#include <lib/core/OTAImageHeader.h>
 #include <platform/CHIPDeviceLayer.h>
 #include <platform/OTAImageProcessor.h>
 
-#include <fstream>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
 
 namespace chip {
 
+/**
+ * Stores a downloaded OTA image to a file.
+ *
+ * Blocks are verified as they arrive: the image header is decoded from the first blocks and the payload is hashed as it comes,
+ * so the image digest is checked as soon as the last block has been received. The payload is then copied to a bounded buffer
+ * that a writer thread drains to the file, and the next block is only requested while the buffer has room for it. The CHIP
+ * thread never waits for the writer thread: the part of a block that does not fit in the buffer is handed to the writer thread
+ * as a separate chunk.
+ *
+ * Images that do not start with an OTA image header are rejected unless the application allows them, in which case they are
+ * stored as they are, without verification.
+ */
 class OTAImageProcessorImpl : public OTAImageProcessorInterface
 {
 public:
+    ~OTAImageProcessorImpl();
+
     //////////// OTAImageProcessorInterface Implementation ///////////////
     CHIP_ERROR PrepareDownload() override;
     CHIP_ERROR Finalize() override;
@@ -38,26 +56,87 @@ public:
 
     void SetOTADownloader(OTADownloader * downloader) { mDownloader = downloader; }
 
+    /**
+     * Called to store images that do not start with an OTA image header without verifying them, rather than rejecting them.
+     */
+    void SetAllowImagesWithoutHeader(bool allow) { mAllowImagesWithoutHeader = allow; }
+
 private:
+    static constexpr size_t kWriteBufferSize = CHIP_DEVICE_LAYER_OTA_WRITE_BUFFER_SIZE;
+
+    enum class VerificationState : uint8_t
+    {
+        kDecodingHeader,
+        kHashingPayload,
+        kVerified,
+        kUnverified,
+    };
+
     //////////// Actual handlers for the OTAImageProcessorInterface ///////////////
     static void HandlePrepareDownload(intptr_t context);
     static void HandleFinalize(intptr_t context);
     static void HandleAbort(intptr_t context);
-    static void HandleProcessBlock(intptr_t context);
+    static void HandleFetchNextData(intptr_t context);
+    static void HandleDownloadError(intptr_t context);
+
+    /**
+     * Called to consume the image header at the beginning of block and add the payload in block to the image digest.
+     */
+    CHIP_ERROR VerifyBlock(ByteSpan & block);
 
     /**
-     * Called to allocate memory for mBlock if necessary and set it to block
+     * Called to copy data to the write buffer. What does not fit is copied to an overflow chunk, written after the buffer.
      */
-    CHIP_ERROR SetBlock(ByteSpan & block);
+    CHIP_ERROR QueueWrite(ByteSpan data);
 
     /**
-     * Called to release allocated memory for mBlock
+     * Called to record an error of the current download and report it to the downloader.
      */
-    CHIP_ERROR ReleaseBlock();
+    CHIP_ERROR FailDownload(CHIP_ERROR err);
+
+    /**
+     * Called to check whether the write buffer can take the next block. Must be called with mMutex held.
+     */
+    bool HasRoomForNextBlock() const
+    {
+        return mOverflow == nullptr && kWriteBufferSize - mBufferedBytes >= chip::min(mMaxBlockSize, kWriteBufferSize);
+    }
+
+    /**
+     * Body of the writer thread: writes buffered data to the file until the download is finalized or stopped.
+     */
+    void WriterLoop();
+
+    /**
+     * Called to stop the writer thread and release the resources of the current download.
+     */
+    void Cleanup();
+
+    int mFd                        = -1;
+    OTADownloader * mDownloader    = nullptr;
+    bool mAllowImagesWithoutHeader = false;
+
+    // Verification state, only used on the CHIP thread
+    OTAImageHeaderParser mHeaderParser;
+    Crypto::Hash_SHA256_stream mHash;
+    uint8_t mImageDigest[Crypto::kSHA256_Hash_Length];
+    uint64_t mPayloadBytesLeft           = 0;
+    VerificationState mVerificationState = VerificationState::kDecodingHeader;
 
-    std::ofstream mOfs;
-    MutableByteSpan mBlock;
-    OTADownloader * mDownloader;
+    // Write buffer shared with the writer thread and protected by mMutex
+    std::thread mWriterThread;
+    std::mutex mMutex;
+    std::condition_variable mCondition;
+    uint8_t * mBuffer         = nullptr;
+    size_t mBufferHead        = 0;
+    size_t mBufferedBytes     = 0;
+    uint8_t * mOverflow       = nullptr;
+    size_t mOverflowSize      = 0;
+    size_t mMaxBlockSize      = 0;
+    CHIP_ERROR mDownloadError = CHIP_NO_ERROR;
+    bool mFetchPending        = false;
+    bool mFinalizing          = false;
+    bool mStopping            = false;
 };
 
 } // namespace chip
@@ -32,6 +32,7 @@
 
 namespace {
 constexpr uint8_t kVersionMask          = 0x0F;
+constexpr uint8_t kWindowedMask         = 0x80; ///< Reserved Transfer Control bit used by the windowed transfer extension
 constexpr uint8_t kMaxFileDesignatorLen = 32;
 } // namespace
 
@@ -43,10 +44,15 @@ using namespace chip::Encoding::LittleEndian;
 // the size of the message (even if the message is incomplete or filled out incorrectly).
 BufferWriter & TransferInit::WriteToBuffer(BufferWriter & aBuffer) const
 {
-    const BitFlags<TransferControlFlags> proposedTransferCtl(Version & kVersionMask, TransferCtlOptions);
+    BitFlags<TransferControlFlags> proposedTransferCtl(Version & kVersionMask, TransferCtlOptions);
     const bool widerange =
         (StartOffset > std::numeric_limits<uint32_t>::max()) || (MaxLength > std::numeric_limits<uint32_t>::max());
 
+    if (WindowSize > 0)
+    {
+        proposedTransferCtl.SetRaw(static_cast<uint8_t>(proposedTransferCtl.Raw() | kWindowedMask));
+    }
+
     BitFlags<RangeControlFlags> rangeCtlFlags;
     rangeCtlFlags.Set(RangeControlFlags::kDefLen, MaxLength > 0);
     rangeCtlFlags.Set(RangeControlFlags::kStartOffset, StartOffset > 0);
@@ -86,6 +92,11 @@ BufferWriter & TransferInit::WriteToBuffer(BufferWriter & aBuffer) const
         aBuffer.Put(FileDesignator, static_cast<size_t>(FileDesLength));
     }
 
+    if (WindowSize > 0)
+    {
+        aBuffer.Put(WindowSize);
+    }
+
     if (Metadata != nullptr)
     {
         aBuffer.Put(Metadata, static_cast<size_t>(MetadataLength));
@@ -104,7 +115,7 @@ CHIP_ERROR TransferInit::Parse(System::PacketBufferHandle aBuffer)
     SuccessOrExit(bufReader.Read8(&proposedTransferCtl).Read8(mRangeCtlFlags.RawStorage()).Read16(&MaxBlockSize).StatusCode());
 
     Version = proposedTransferCtl & kVersionMask;
-    TransferCtlOptions.SetRaw(static_cast<uint8_t>(proposedTransferCtl & ~kVersionMask));
+    TransferCtlOptions.SetRaw(static_cast<uint8_t>(proposedTransferCtl & ~(kVersionMask | kWindowedMask)));
 
     StartOffset = 0;
     if (mRangeCtlFlags.Has(RangeControlFlags::kStartOffset))
@@ -138,15 +149,21 @@ CHIP_ERROR TransferInit::Parse(System::PacketBufferHandle aBuffer)
 
     VerifyOrExit(bufReader.HasAtLeast(FileDesLength), err = CHIP_ERROR_MESSAGE_INCOMPLETE);
     FileDesignator = &bufStart[bufReader.OctetsRead()];
+    bufReader.Skip(FileDesLength);
+
+    WindowSize = 0;
+    if (proposedTransferCtl & kWindowedMask)
+    {
+        SuccessOrExit(bufReader.Read8(&WindowSize).StatusCode());
+    }
 
     // Rest of message is metadata (could be empty)
     Metadata       = nullptr;
     MetadataLength = 0;
-    if (bufReader.Remaining() > FileDesLength)
+    if (bufReader.Remaining() > 0)
     {
-        uint16_t metadataStartIndex = static_cast<uint16_t>(bufReader.OctetsRead() + FileDesLength);
-        Metadata                    = &bufStart[metadataStartIndex];
-        MetadataLength              = static_cast<uint16_t>(aBuffer->DataLength() - metadataStartIndex);
+        Metadata       = &bufStart[bufReader.OctetsRead()];
+        MetadataLength = bufReader.Remaining();
     }
 
     // Retain ownership of the packet buffer so that the FileDesignator and Metadata pointers remain valid.
@@ -191,6 +208,7 @@ void TransferInit::LogMessage(bdx::MessageType messageType) const
     ChipLogAutomation("  Proposed Max Length: 0x" ChipLogFormatX64, ChipLogValueX64(MaxLength));
     ChipLogAutomation("  File Designator Length: %" PRIu16, FileDesLength);
     ChipLogAutomation("  File Designator: %s", fd);
+    ChipLogAutomation("  Proposed Window Size: %u", static_cast<unsigned>(WindowSize));
 }
 #endif // CHIP_AUTOMATION_LOGGING
 
@@ -215,18 +233,28 @@ bool TransferInit::operator==(const TransferInit & another) const
 
     return ((Version == another.Version) && (TransferCtlOptions == another.TransferCtlOptions) &&
             (StartOffset == another.StartOffset) && (MaxLength == another.MaxLength) && (MaxBlockSize == another.MaxBlockSize) &&
-            fileDesMatches && metadataMatches);
+            (WindowSize == another.WindowSize) && fileDesMatches && metadataMatches);
 }
 
 // WARNING: this function should never return early, since MessageSize() relies on it to calculate
 // the size of the message (even if the message is incomplete or filled out incorrectly).
 Encoding::LittleEndian::BufferWriter & SendAccept::WriteToBuffer(Encoding::LittleEndian::BufferWriter & aBuffer) const
 {
-    const BitFlags<TransferControlFlags> transferCtl(Version & kVersionMask, TransferCtlFlags);
+    BitFlags<TransferControlFlags> transferCtl(Version & kVersionMask, TransferCtlFlags);
+
+    if (WindowSize > 0)
+    {
+        transferCtl.SetRaw(static_cast<uint8_t>(transferCtl.Raw() | kWindowedMask));
+    }
 
     aBuffer.Put(transferCtl.Raw());
     aBuffer.Put16(MaxBlockSize);
 
+    if (WindowSize > 0)
+    {
+        aBuffer.Put(WindowSize);
+    }
+
     if (Metadata != nullptr)
     {
         aBuffer.Put(Metadata, static_cast<size_t>(MetadataLength));
@@ -246,7 +274,13 @@ CHIP_ERROR SendAccept::Parse(System::PacketBufferHandle aBuffer)
     Version = transferCtl & kVersionMask;
 
     // Only one of these values should be set. It is up to the caller to verify this.
-    TransferCtlFlags.SetRaw(static_cast<uint8_t>(transferCtl & ~kVersionMask));
+    TransferCtlFlags.SetRaw(static_cast<uint8_t>(transferCtl & ~(kVersionMask | kWindowedMask)));
+
+    WindowSize = 0;
+    if (transferCtl & kWindowedMask)
+    {
+        SuccessOrExit(bufReader.Read8(&WindowSize).StatusCode());
+    }
 
     // Rest of message is metadata (could be empty)
     Metadata       = nullptr;
@@ -281,6 +315,7 @@ void SendAccept::LogMessage(bdx::MessageType messageType) const
     ChipLogAutomation("SendAccept");
     ChipLogAutomation("  Transfer Control: 0x%X", static_cast<unsigned>(TransferCtlFlags.Raw() | Version));
     ChipLogAutomation("  Max Block Size: %" PRIu16, MaxBlockSize);
+    ChipLogAutomation("  Window Size: %u", static_cast<unsigned>(WindowSize));
 }
 #endif // CHIP_AUTOMATION_LOGGING
 
@@ -298,16 +333,21 @@ bool SendAccept::operator==(const SendAccept & another) const
     }
 
     return ((Version == another.Version) && (TransferCtlFlags == another.TransferCtlFlags) &&
-            (MaxBlockSize == another.MaxBlockSize) && metadataMatches);
+            (MaxBlockSize == another.MaxBlockSize) && (WindowSize == another.WindowSize) && metadataMatches);
 }
 
 // WARNING: this function should never return early, since MessageSize() relies on it to calculate
 // the size of the message (even if the message is incomplete or filled out incorrectly).
 Encoding::LittleEndian::BufferWriter & ReceiveAccept::WriteToBuffer(Encoding::LittleEndian::BufferWriter & aBuffer) const
 {
-    const BitFlags<TransferControlFlags> transferCtlFlags(Version & kVersionMask, TransferCtlFlags);
+    BitFlags<TransferControlFlags> transferCtlFlags(Version & kVersionMask, TransferCtlFlags);
     const bool widerange = (StartOffset > std::numeric_limits<uint32_t>::max()) || (Length > std::numeric_limits<uint32_t>::max());
 
+    if (WindowSize > 0)
+    {
+        transferCtlFlags.SetRaw(static_cast<uint8_t>(transferCtlFlags.Raw() | kWindowedMask));
+    }
+
     BitFlags<RangeControlFlags> rangeCtlFlags;
     rangeCtlFlags.Set(RangeControlFlags::kDefLen, Length > 0);
     rangeCtlFlags.Set(RangeControlFlags::kStartOffset, StartOffset > 0);
@@ -341,6 +381,11 @@ Encoding::LittleEndian::BufferWriter & ReceiveAccept::WriteToBuffer(Encoding::Li
         }
     }
 
+    if (WindowSize > 0)
+    {
+        aBuffer.Put(WindowSize);
+    }
+
     if (Metadata != nullptr)
     {
         aBuffer.Put(Metadata, static_cast<size_t>(MetadataLength));
@@ -361,7 +406,7 @@ CHIP_ERROR ReceiveAccept::Parse(System::PacketBufferHandle aBuffer)
     Version = transferCtl & kVersionMask;
 
     // Only one of these values should be set. It is up to the caller to verify this.
-    TransferCtlFlags.SetRaw(static_cast<uint8_t>(transferCtl & ~kVersionMask));
+    TransferCtlFlags.SetRaw(static_cast<uint8_t>(transferCtl & ~(kVersionMask | kWindowedMask)));
 
     StartOffset = 0;
     if (mRangeCtlFlags.Has(RangeControlFlags::kStartOffset))
@@ -391,6 +436,12 @@ CHIP_ERROR ReceiveAccept::Parse(System::PacketBufferHandle aBuffer)
         }
     }
 
+    WindowSize = 0;
+    if (transferCtl & kWindowedMask)
+    {
+        SuccessOrExit(bufReader.Read8(&WindowSize).StatusCode());
+    }
+
     // Rest of message is metadata (could be empty)
     Metadata       = nullptr;
     MetadataLength = 0;
@@ -426,6 +477,7 @@ void ReceiveAccept::LogMessage(bdx::MessageType messageType) const
     ChipLogAutomation("  Range Control: 0x%X", mRangeCtlFlags.Raw());
     ChipLogAutomation("  Max Block Size: %" PRIu16, MaxBlockSize);
     ChipLogAutomation("  Length: 0x" ChipLogFormatX64, ChipLogValueX64(Length));
+    ChipLogAutomation("  Window Size: %u", static_cast<unsigned>(WindowSize));
 }
 #endif // CHIP_AUTOMATION_LOGGING
 
@@ -444,7 +496,7 @@ bool ReceiveAccept::operator==(const ReceiveAccept & another) const
 
     return ((Version == another.Version) && (TransferCtlFlags == another.TransferCtlFlags) &&
             (StartOffset == another.StartOffset) && (MaxBlockSize == another.MaxBlockSize) && (Length == another.Length) &&
-            metadataMatches);
+            (WindowSize == another.WindowSize) && metadataMatches);
 }
 
 // WARNING: this function should never return early, since MessageSize() relies on it to calculate
@@ -494,6 +546,43 @@ void CounterMessage::LogMessage(bdx::MessageType messageType) const
 }
 #endif // CHIP_AUTOMATION_LOGGING
 
+// WARNING: this function should never return early, since MessageSize() relies on it to calculate
+// the size of the message (even if the message is incomplete or filled out incorrectly).
+Encoding::LittleEndian::BufferWriter & SelectiveBlockAck::WriteToBuffer(Encoding::LittleEndian::BufferWriter & aBuffer) const
+{
+    aBuffer.Put32(BlockCounter);
+    aBuffer.Put32(ReceivedMask);
+    return aBuffer;
+}
+
+CHIP_ERROR SelectiveBlockAck::Parse(System::PacketBufferHandle aBuffer)
+{
+    uint8_t * bufStart = aBuffer->Start();
+    Reader bufReader(bufStart, aBuffer->DataLength());
+    return bufReader.Read32(&BlockCounter).Read32(&ReceivedMask).StatusCode();
+}
+
+size_t SelectiveBlockAck::MessageSize() const
+{
+    BufferWriter emptyBuf(nullptr, 0);
+    return WriteToBuffer(emptyBuf).Needed();
+}
+
+bool SelectiveBlockAck::operator==(const SelectiveBlockAck & another) const
+{
+    return (BlockCounter == another.BlockCounter && ReceivedMask == another.ReceivedMask);
+}
+
+#if CHIP_AUTOMATION_LOGGING
+void SelectiveBlockAck::LogMessage(bdx::MessageType messageType) const
+{
+    (void) messageType;
+    ChipLogAutomation("BlockAck (selective)");
+    ChipLogAutomation("  Block Counter: %" PRIu32, BlockCounter);
+    ChipLogAutomation("  Received Mask: 0x%08" PRIX32, ReceivedMask);
+}
+#endif // CHIP_AUTOMATION_LOGGING
+
 // WARNING: this function should never return early, since MessageSize() relies on it to calculate
 // the size of the message (even if the message is incomplete or filled out incorrectly).
 Encoding::LittleEndian::BufferWriter & DataBlock::WriteToBuffer(Encoding::LittleEndian::BufferWriter & aBuffer) const
@@ -160,6 +160,11 @@ struct TransferInit : public BdxMessage
     const uint8_t * Metadata       = nullptr;
     size_t MetadataLength          = 0;
 
+    // Windowed transfer extension (optional). When non-zero, the reserved high bit of the Transfer Control field is set and the
+    // window size is encoded right after the file designator. Peers that do not support the extension ignore the bit and see
+    // the extra byte as the start of the metadata, so they fall back to a synchronous transfer.
+    uint8_t WindowSize = 0; ///< Proposed max number of Blocks in flight, 0 for a synchronous transfer
+
     // Retain ownership of the packet buffer so that the FileDesignator and Metadata pointers remain valid.
     System::PacketBufferHandle Buffer;
 
@@ -186,6 +191,7 @@ struct SendAccept : public BdxMessage
 
     uint8_t Version       = 0; ///< The agreed upon version for the transfer (required)
     uint16_t MaxBlockSize = 0; ///< Chosen max block size to use in transfer (required)
+    uint8_t WindowSize    = 0; ///< Chosen window size, only sent if the TransferInit proposed one. 0 for a synchronous transfer
 
     // Additional metadata (optional, TLV format)
     // WARNING: there is no guarantee at any point that this pointer will point to valid memory. The Buffer field should be used to
@@ -222,6 +228,7 @@ struct ReceiveAccept : public BdxMessage
     uint16_t MaxBlockSize = 0; ///< Chosen max block size to use in transfer
     uint64_t StartOffset  = 0; ///< Chosen start offset of data. 0 for no offset.
     uint64_t Length       = 0; ///< Length of transfer. 0 if length is indefinite.
+    uint8_t WindowSize    = 0; ///< Chosen window size, only sent if the TransferInit proposed one. 0 for a synchronous transfer
 
     // Additional metadata (optional, TLV format)
     // WARNING: there is no guarantee at any point that this pointer will point to valid memory. The Buffer field should be used to
@@ -262,6 +269,25 @@ using BlockQuery  = CounterMessage;
 using BlockAck    = CounterMessage;
 using BlockAckEOF = CounterMessage;
 
+/**
+ * A struct for representing the BlockAck messages of a windowed transfer. Acknowledges every Block before BlockCounter, plus
+ * the Blocks received out of order after it.
+ */
+struct SelectiveBlockAck : public BdxMessage
+{
+    bool operator==(const SelectiveBlockAck &) const;
+
+    uint32_t BlockCounter = 0; ///< Counter of the first Block not received yet
+    uint32_t ReceivedMask = 0; ///< Bit i is set if Block (BlockCounter + 1 + i) was received
+
+    CHIP_ERROR Parse(System::PacketBufferHandle aBuffer) override;
+    Encoding::LittleEndian::BufferWriter & WriteToBuffer(Encoding::LittleEndian::BufferWriter & aBuffer) const override;
+    size_t MessageSize() const override;
+#if CHIP_AUTOMATION_LOGGING
+    void LogMessage(bdx::MessageType messageType) const override;
+#endif // CHIP_AUTOMATION_LOGGING
+};
+
 /**
  * A struct that represents a message containing actual data (Block, BlockEOF).
  */
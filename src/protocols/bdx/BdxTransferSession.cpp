@@ -22,6 +22,8 @@
 namespace {
 constexpr uint8_t kBdxVersion = 0; ///< The version of this implementation of the BDX spec
 
+constexpr chip::System::Clock::Milliseconds32 kWindowRetransmitTimeout(CHIP_CONFIG_BDX_WINDOW_RETRANSMIT_TIMEOUT_MS);
+
 /**
  * @brief
  *   Allocate a new PacketBuffer and write data from a BDX message struct.
@@ -82,6 +84,23 @@ void TransferSession::PollOutput(OutputEvent & event, System::Clock::Timestamp c
         return;
     }
 
+    // In a windowed transfer, lost Blocks are sent again and Blocks received out of order are delivered once nothing else is
+    // pending.
+    if (IsWindowed() && mPendingOutput == OutputEventType::kNone && mState != TransferState::kErrorState)
+    {
+        if (mRole == TransferRole::kSender)
+        {
+            if (PollRetransmission(event, curTime))
+            {
+                return;
+            }
+        }
+        else
+        {
+            DeliverBufferedBlock();
+        }
+    }
+
     switch (mPendingOutput)
     {
     case OutputEventType::kNone:
@@ -147,6 +166,11 @@ CHIP_ERROR TransferSession::StartTransfer(TransferRole role, const TransferInitD
     mStartOffset           = initData.StartOffset;
     mTransferLength        = initData.Length;
 
+    // Only propose a windowed transfer if Blocks may be sent without waiting for a query.
+    const BitFlags<TransferControlFlags> proposedControlOpts(initData.TransferCtlFlags);
+    mMaxSupportedWindowSize =
+        proposedControlOpts.Has(TransferControlFlags::kSenderDrive) ? ClampWindowSize(initData.WindowSize) : 0;
+
     // Prepare TransferInit message
     TransferInit initMsg;
     initMsg.TransferCtlOptions = initData.TransferCtlFlags;
@@ -158,6 +182,7 @@ CHIP_ERROR TransferSession::StartTransfer(TransferRole role, const TransferInitD
     initMsg.FileDesLength      = initData.FileDesLength;
     initMsg.Metadata           = initData.Metadata;
     initMsg.MetadataLength     = initData.MetadataLength;
+    initMsg.WindowSize         = mMaxSupportedWindowSize;
 
     ReturnErrorOnFailure(WriteToPacketBuffer(initMsg, mPendingMsgHandle));
 
@@ -177,15 +202,16 @@ CHIP_ERROR TransferSession::StartTransfer(TransferRole role, const TransferInitD
 }
 
 CHIP_ERROR TransferSession::WaitForTransfer(TransferRole role, BitFlags<TransferControlFlags> xferControlOpts,
-                                            uint16_t maxBlockSize, System::Clock::Timeout timeout)
+                                            uint16_t maxBlockSize, System::Clock::Timeout timeout, uint8_t maxWindowSize)
 {
     VerifyOrReturnError(mState == TransferState::kUnitialized, CHIP_ERROR_INCORRECT_STATE);
 
     // Used to determine compatibility with any future TransferInit parameters
-    mRole                  = role;
-    mTimeout               = timeout;
-    mSuppportedXferOpts    = xferControlOpts;
-    mMaxSupportedBlockSize = maxBlockSize;
+    mRole                   = role;
+    mTimeout                = timeout;
+    mSuppportedXferOpts     = xferControlOpts;
+    mMaxSupportedBlockSize  = maxBlockSize;
+    mMaxSupportedWindowSize = ClampWindowSize(maxWindowSize);
 
     mState = TransferState::kAwaitingInitMsg;
 
@@ -208,6 +234,13 @@ CHIP_ERROR TransferSession::AcceptTransfer(const TransferAcceptData & acceptData
 
     mTransferMaxBlockSize = acceptData.MaxBlockSize;
 
+    // Use a windowed transfer if both nodes support one and Blocks are sent without waiting for queries
+    mWindowSize = 0;
+    if (acceptData.ControlMode == TransferControlFlags::kSenderDrive)
+    {
+        mWindowSize = ClampWindowSize(::chip::min(mMaxSupportedWindowSize, mTransferRequestData.WindowSize));
+    }
+
     if (mRole == TransferRole::kSender)
     {
         mStartOffset    = acceptData.StartOffset;
@@ -219,6 +252,7 @@ CHIP_ERROR TransferSession::AcceptTransfer(const TransferAcceptData & acceptData
         acceptMsg.MaxBlockSize   = acceptData.MaxBlockSize;
         acceptMsg.StartOffset    = acceptData.StartOffset;
         acceptMsg.Length         = acceptData.Length;
+        acceptMsg.WindowSize     = mWindowSize;
         acceptMsg.Metadata       = acceptData.Metadata;
         acceptMsg.MetadataLength = acceptData.MetadataLength;
 
@@ -236,6 +270,7 @@ CHIP_ERROR TransferSession::AcceptTransfer(const TransferAcceptData & acceptData
         acceptMsg.TransferCtlFlags.Set(acceptData.ControlMode);
         acceptMsg.Version        = mTransferVersion;
         acceptMsg.MaxBlockSize   = acceptData.MaxBlockSize;
+        acceptMsg.WindowSize     = mWindowSize;
         acceptMsg.Metadata       = acceptData.Metadata;
         acceptMsg.MetadataLength = acceptData.MetadataLength;
 
@@ -321,7 +356,14 @@ CHIP_ERROR TransferSession::PrepareBlock(const BlockData & inData)
     VerifyOrReturnError(mState == TransferState::kTransferInProgress, CHIP_ERROR_INCORRECT_STATE);
     VerifyOrReturnError(mRole == TransferRole::kSender, CHIP_ERROR_INCORRECT_STATE);
     VerifyOrReturnError(mPendingOutput == OutputEventType::kNone, CHIP_ERROR_INCORRECT_STATE);
-    VerifyOrReturnError(!mAwaitingResponse, CHIP_ERROR_INCORRECT_STATE);
+    if (IsWindowed())
+    {
+        VerifyOrReturnError(mNextBlockNum - mWindowBase < mWindowSize, CHIP_ERROR_INCORRECT_STATE);
+    }
+    else
+    {
+        VerifyOrReturnError(!mAwaitingResponse, CHIP_ERROR_INCORRECT_STATE);
+    }
 
     // Verify non-zero data is provided and is no longer than MaxBlockSize (BlockEOF may contain 0 length data)
     VerifyOrReturnError((inData.Data != nullptr) && (inData.Length <= mTransferMaxBlockSize), CHIP_ERROR_INVALID_ARGUMENT);
@@ -333,6 +375,23 @@ CHIP_ERROR TransferSession::PrepareBlock(const BlockData & inData)
 
     ReturnErrorOnFailure(WriteToPacketBuffer(blockMsg, mPendingMsgHandle));
 
+    if (IsWindowed())
+    {
+        // Keep a copy to send again if the Block is lost, the emitted message is consumed by the transport.
+        System::PacketBufferHandle blockCopy = mPendingMsgHandle.CloneData();
+        if (blockCopy.IsNull())
+        {
+            mPendingMsgHandle = nullptr;
+            return CHIP_ERROR_NO_MEMORY;
+        }
+
+        if (mWindowBase == mNextBlockNum)
+        {
+            mShouldInitRetransmitStart = true;
+        }
+        WindowSlot(mNextBlockNum) = std::move(blockCopy);
+    }
+
     const MessageType msgType = inData.IsEof ? MessageType::BlockEOF : MessageType::Block;
 
 #if CHIP_AUTOMATION_LOGGING
@@ -360,6 +419,11 @@ CHIP_ERROR TransferSession::PrepareBlockAck()
                         CHIP_ERROR_INCORRECT_STATE);
     VerifyOrReturnError(mPendingOutput == OutputEventType::kNone, CHIP_ERROR_INCORRECT_STATE);
 
+    if (IsWindowed() && mState == TransferState::kTransferInProgress)
+    {
+        return PrepareSelectiveBlockAck();
+    }
+
     CounterMessage ackMsg;
     ackMsg.BlockCounter       = mLastBlockNum;
     const MessageType msgType = (mState == TransferState::kReceivedEOF) ? MessageType::BlockAckEOF : MessageType::BlockAck;
@@ -426,6 +490,13 @@ void TransferSession::Reset()
     mTimeoutStartTime       = System::Clock::kZero;
     mShouldInitTimeoutStart = true;
     mAwaitingResponse       = false;
+
+    ClearWindow();
+    mMaxSupportedWindowSize    = 0;
+    mWindowSize                = 0;
+    mWindowBase                = 0;
+    mRetransmitStartTime       = System::Clock::kZero;
+    mShouldInitRetransmitStart = false;
 }
 
 CHIP_ERROR TransferSession::HandleMessageReceived(const PayloadHeader & payloadHeader, System::PacketBufferHandle msg,
@@ -437,7 +508,8 @@ CHIP_ERROR TransferSession::HandleMessageReceived(const PayloadHeader & payloadH
     {
         ReturnErrorOnFailure(HandleBdxMessage(payloadHeader, std::move(msg)));
 
-        mTimeoutStartTime = curTime;
+        mTimeoutStartTime    = curTime;
+        mRetransmitStartTime = curTime;
     }
     else if (payloadHeader.HasMessageType(Protocols::SecureChannel::MsgType::StatusReport))
     {
@@ -559,6 +631,7 @@ void TransferSession::HandleTransferInit(MessageType msgType, System::PacketBuff
     mTransferRequestData.FileDesLength    = transferInit.FileDesLength;
     mTransferRequestData.Metadata         = transferInit.Metadata;
     mTransferRequestData.MetadataLength   = transferInit.MetadataLength;
+    mTransferRequestData.WindowSize       = transferInit.WindowSize;
 
     mPendingMsgHandle = std::move(msgData);
     mPendingOutput    = OutputEventType::kInitReceived;
@@ -582,6 +655,12 @@ void TransferSession::HandleReceiveAccept(System::PacketBufferHandle msgData)
     // Verify that Accept parameters are compatible with the original proposed parameters
     ReturnOnFailure(VerifyProposedMode(rcvAcceptMsg.TransferCtlFlags));
 
+    // A windowed transfer must have been proposed, with at least as large a window
+    VerifyOrReturn(rcvAcceptMsg.WindowSize <= mMaxSupportedWindowSize &&
+                       (rcvAcceptMsg.WindowSize == 0 || mControlMode == TransferControlFlags::kSenderDrive),
+                   PrepareStatusReport(StatusCode::kBadMessageContents));
+    mWindowSize = ClampWindowSize(rcvAcceptMsg.WindowSize);
+
     mTransferMaxBlockSize = rcvAcceptMsg.MaxBlockSize;
     mStartOffset          = rcvAcceptMsg.StartOffset;
     mTransferLength       = rcvAcceptMsg.Length;
@@ -592,6 +671,7 @@ void TransferSession::HandleReceiveAccept(System::PacketBufferHandle msgData)
     mTransferAcceptData.MaxBlockSize   = rcvAcceptMsg.MaxBlockSize;
     mTransferAcceptData.StartOffset    = rcvAcceptMsg.StartOffset;
     mTransferAcceptData.Length         = rcvAcceptMsg.Length;
+    mTransferAcceptData.WindowSize     = mWindowSize;
     mTransferAcceptData.Metadata       = rcvAcceptMsg.Metadata;
     mTransferAcceptData.MetadataLength = rcvAcceptMsg.MetadataLength;
 
@@ -618,6 +698,12 @@ void TransferSession::HandleSendAccept(System::PacketBufferHandle msgData)
     // Verify that Accept parameters are compatible with the original proposed parameters
     ReturnOnFailure(VerifyProposedMode(sendAcceptMsg.TransferCtlFlags));
 
+    // A windowed transfer must have been proposed, with at least as large a window
+    VerifyOrReturn(sendAcceptMsg.WindowSize <= mMaxSupportedWindowSize &&
+                       (sendAcceptMsg.WindowSize == 0 || mControlMode == TransferControlFlags::kSenderDrive),
+                   PrepareStatusReport(StatusCode::kBadMessageContents));
+    mWindowSize = ClampWindowSize(sendAcceptMsg.WindowSize);
+
     // Note: if VerifyProposedMode() returned with no error, then mControlMode must match the proposed mode in the SendAccept
     // message
     mTransferMaxBlockSize = sendAcceptMsg.MaxBlockSize;
@@ -626,6 +712,7 @@ void TransferSession::HandleSendAccept(System::PacketBufferHandle msgData)
     mTransferAcceptData.MaxBlockSize   = sendAcceptMsg.MaxBlockSize;
     mTransferAcceptData.StartOffset    = mStartOffset;    // Not included in SendAccept msg, so use member
     mTransferAcceptData.Length         = mTransferLength; // Not included in SendAccept msg, so use member
+    mTransferAcceptData.WindowSize     = mWindowSize;
     mTransferAcceptData.Metadata       = sendAcceptMsg.Metadata;
     mTransferAcceptData.MetadataLength = sendAcceptMsg.MetadataLength;
 
@@ -687,6 +774,12 @@ void TransferSession::HandleBlockQueryWithSkip(System::PacketBufferHandle msgDat
 
 void TransferSession::HandleBlock(System::PacketBufferHandle msgData)
 {
+    if (IsWindowed())
+    {
+        HandleWindowedBlock(MessageType::Block, std::move(msgData));
+        return;
+    }
+
     VerifyOrReturn(mRole == TransferRole::kReceiver, PrepareStatusReport(StatusCode::kUnexpectedMessage));
     VerifyOrReturn(mState == TransferState::kTransferInProgress, PrepareStatusReport(StatusCode::kUnexpectedMessage));
     VerifyOrReturn(mAwaitingResponse, PrepareStatusReport(StatusCode::kUnexpectedMessage));
@@ -725,6 +818,12 @@ void TransferSession::HandleBlock(System::PacketBufferHandle msgData)
 
 void TransferSession::HandleBlockEOF(System::PacketBufferHandle msgData)
 {
+    if (IsWindowed())
+    {
+        HandleWindowedBlock(MessageType::BlockEOF, std::move(msgData));
+        return;
+    }
+
     VerifyOrReturn(mRole == TransferRole::kReceiver, PrepareStatusReport(StatusCode::kUnexpectedMessage));
     VerifyOrReturn(mState == TransferState::kTransferInProgress, PrepareStatusReport(StatusCode::kUnexpectedMessage));
     VerifyOrReturn(mAwaitingResponse, PrepareStatusReport(StatusCode::kUnexpectedMessage));
@@ -757,6 +856,12 @@ void TransferSession::HandleBlockEOF(System::PacketBufferHandle msgData)
 
 void TransferSession::HandleBlockAck(System::PacketBufferHandle msgData)
 {
+    if (IsWindowed())
+    {
+        HandleSelectiveBlockAck(std::move(msgData));
+        return;
+    }
+
     VerifyOrReturn(mRole == TransferRole::kSender, PrepareStatusReport(StatusCode::kUnexpectedMessage));
     VerifyOrReturn(mState == TransferState::kTransferInProgress, PrepareStatusReport(StatusCode::kUnexpectedMessage));
     VerifyOrReturn(mAwaitingResponse, PrepareStatusReport(StatusCode::kUnexpectedMessage));
@@ -780,6 +885,8 @@ void TransferSession::HandleBlockAck(System::PacketBufferHandle msgData)
 void TransferSession::HandleBlockAckEOF(System::PacketBufferHandle msgData)
 {
     VerifyOrReturn(mRole == TransferRole::kSender, PrepareStatusReport(StatusCode::kUnexpectedMessage));
+    // In a windowed transfer, a BlockEOF sent again may be acknowledged more than once
+    VerifyOrReturn(!(IsWindowed() && mState == TransferState::kTransferDone));
     VerifyOrReturn(mState == TransferState::kAwaitingEOFAck, PrepareStatusReport(StatusCode::kUnexpectedMessage));
     VerifyOrReturn(mAwaitingResponse, PrepareStatusReport(StatusCode::kUnexpectedMessage));
 
@@ -793,10 +900,319 @@ void TransferSession::HandleBlockAckEOF(System::PacketBufferHandle msgData)
     mAwaitingResponse = false;
 
     mState = TransferState::kTransferDone;
+    ClearWindow();
+
+#if CHIP_AUTOMATION_LOGGING
+    ackMsg.LogMessage(MessageType::BlockAckEOF);
+#endif // CHIP_AUTOMATION_LOGGING
+}
+
+void TransferSession::HandleRepeatedBlockEOF(MessageType msgType, System::PacketBufferHandle msgData)
+{
+    DataBlock blockMsg;
+    VerifyOrReturn(msgType == MessageType::BlockEOF);
+    VerifyOrReturn(blockMsg.Parse(std::move(msgData)) == CHIP_NO_ERROR);
+    VerifyOrReturn(blockMsg.BlockCounter == mLastBlockNum);
+
+    CounterMessage ackMsg;
+    ackMsg.BlockCounter = mLastBlockNum;
+    ReturnOnFailure(WriteToPacketBuffer(ackMsg, mPendingMsgHandle));
 
 #if CHIP_AUTOMATION_LOGGING
+    ChipLogAutomation("Sending BDX Message");
     ackMsg.LogMessage(MessageType::BlockAckEOF);
 #endif // CHIP_AUTOMATION_LOGGING
+
+    PrepareOutgoingMessageEvent(MessageType::BlockAckEOF, mPendingOutput, mMsgTypeData);
+}
+
+void TransferSession::HandleWindowedBlock(MessageType msgType, System::PacketBufferHandle msgData)
+{
+    VerifyOrReturn(mRole == TransferRole::kReceiver, PrepareStatusReport(StatusCode::kUnexpectedMessage));
+
+    // Windowed messages are not sent over MRP: if the BlockAckEOF was lost, the sender sends the BlockEOF again once its
+    // retransmission timer expires, so acknowledge it again. Other Blocks sent again along with it need no answer.
+    if (mState == TransferState::kTransferDone)
+    {
+        HandleRepeatedBlockEOF(msgType, std::move(msgData));
+        return;
+    }
+
+    VerifyOrReturn((mState == TransferState::kTransferInProgress) || (mState == TransferState::kReceivedEOF),
+                   PrepareStatusReport(StatusCode::kUnexpectedMessage));
+
+    DataBlock blockMsg;
+    const CHIP_ERROR err = blockMsg.Parse(msgData.Retain());
+    VerifyOrReturn(err == CHIP_NO_ERROR, PrepareStatusReport(StatusCode::kBadMessageContents));
+
+    const bool isEof = (msgType == MessageType::BlockEOF);
+    VerifyOrReturn((isEof || blockMsg.DataLength > 0) && (blockMsg.DataLength <= mTransferMaxBlockSize),
+                   PrepareStatusReport(StatusCode::kBadMessageContents));
+
+#if CHIP_AUTOMATION_LOGGING
+    blockMsg.LogMessage(msgType);
+#endif // CHIP_AUTOMATION_LOGGING
+
+    // A Block that was already delivered was sent again before the sender saw its acknowledgement: acknowledge it again. Once
+    // the BlockEOF was delivered, that is a BlockAckEOF.
+    if ((blockMsg.BlockCounter < mWindowBase) || (mState == TransferState::kReceivedEOF))
+    {
+        ReturnOnFailure(PrepareBlockAck());
+        return;
+    }
+
+    VerifyOrReturn(blockMsg.BlockCounter - mWindowBase < mWindowSize, PrepareStatusReport(StatusCode::kBadBlockCounter));
+    VerifyOrReturn(!mHasBufferedEOF || blockMsg.BlockCounter <= mBufferedEOFBlock,
+                   PrepareStatusReport(StatusCode::kBadBlockCounter));
+
+    if (blockMsg.BlockCounter == mWindowBase)
+    {
+        DeliverWindowedBlock(blockMsg, isEof, std::move(msgData));
+        return;
+    }
+
+    // Keep a Block received out of order until the ones before it arrive, and let the sender know which Blocks are missing.
+    System::PacketBufferHandle & slot = WindowSlot(blockMsg.BlockCounter);
+    if (slot.IsNull())
+    {
+        slot = std::move(msgData);
+        if (isEof)
+        {
+            mBufferedEOFBlock = blockMsg.BlockCounter;
+            mHasBufferedEOF   = true;
+        }
+    }
+
+    ReturnOnFailure(PrepareSelectiveBlockAck());
+}
+
+void TransferSession::DeliverWindowedBlock(const DataBlock & blockMsg, bool isEof, System::PacketBufferHandle msgData)
+{
+    if (IsTransferLengthDefinite())
+    {
+        VerifyOrReturn(mNumBytesProcessed + blockMsg.DataLength <= mTransferLength,
+                       PrepareStatusReport(StatusCode::kLengthMismatch));
+    }
+
+    mBlockEventData.Data         = blockMsg.Data;
+    mBlockEventData.Length       = blockMsg.DataLength;
+    mBlockEventData.IsEof        = isEof;
+    mBlockEventData.BlockCounter = blockMsg.BlockCounter;
+
+    mPendingMsgHandle = std::move(msgData);
+    mPendingOutput    = OutputEventType::kBlockReceived;
+
+    mNumBytesProcessed += blockMsg.DataLength;
+    mLastBlockNum = blockMsg.BlockCounter;
+    mWindowBase   = blockMsg.BlockCounter + 1;
+
+    if (isEof)
+    {
+        mAwaitingResponse = false;
+        mState            = TransferState::kReceivedEOF;
+        ClearWindow();
+    }
+}
+
+void TransferSession::DeliverBufferedBlock()
+{
+    VerifyOrReturn(mState == TransferState::kTransferInProgress);
+
+    System::PacketBufferHandle & slot = WindowSlot(mWindowBase);
+    VerifyOrReturn(!slot.IsNull());
+
+    System::PacketBufferHandle msgData = std::move(slot);
+    DataBlock blockMsg;
+    const CHIP_ERROR err = blockMsg.Parse(msgData.Retain());
+    VerifyOrReturn(err == CHIP_NO_ERROR, PrepareStatusReport(StatusCode::kBadMessageContents));
+
+    DeliverWindowedBlock(blockMsg, mHasBufferedEOF && (blockMsg.BlockCounter == mBufferedEOFBlock), std::move(msgData));
+}
+
+void TransferSession::HandleSelectiveBlockAck(System::PacketBufferHandle msgData)
+{
+    VerifyOrReturn(mRole == TransferRole::kSender, PrepareStatusReport(StatusCode::kUnexpectedMessage));
+
+    // Acknowledgements sent before the BlockAckEOF may still be in flight once the transfer is done.
+    VerifyOrReturn(mState != TransferState::kTransferDone);
+    VerifyOrReturn((mState == TransferState::kTransferInProgress) || (mState == TransferState::kAwaitingEOFAck),
+                   PrepareStatusReport(StatusCode::kUnexpectedMessage));
+
+    SelectiveBlockAck ackMsg;
+    const CHIP_ERROR err = ackMsg.Parse(std::move(msgData));
+    VerifyOrReturn(err == CHIP_NO_ERROR, PrepareStatusReport(StatusCode::kBadMessageContents));
+
+#if CHIP_AUTOMATION_LOGGING
+    ackMsg.LogMessage(MessageType::BlockAck);
+#endif // CHIP_AUTOMATION_LOGGING
+
+    // An older acknowledgement overtaken by a newer one carries no new information
+    VerifyOrReturn(ackMsg.BlockCounter >= mWindowBase);
+    VerifyOrReturn(ackMsg.BlockCounter <= mNextBlockNum, PrepareStatusReport(StatusCode::kBadBlockCounter));
+
+    // Every Block before the counter was received
+    const uint32_t acked = ackMsg.BlockCounter - mWindowBase;
+    for (uint32_t i = 0; i < acked; i++)
+    {
+        WindowSlot(mWindowBase + i) = nullptr;
+    }
+    mRetransmitMask = (acked < 32) ? (mRetransmitMask >> acked) : 0;
+    mWindowBase     = ackMsg.BlockCounter;
+
+    // Blocks received out of order are never sent again
+    for (uint32_t i = 0; (i < 31) && (mWindowBase + 1 + i < mNextBlockNum); i++)
+    {
+        if (ackMsg.ReceivedMask & (1u << i))
+        {
+            WindowSlot(mWindowBase + 1 + i) = nullptr;
+            mRetransmitMask &= ~(1u << (i + 1));
+        }
+    }
+
+    // If a later Block was received, the first missing one was most likely lost: send it again now rather than waiting for the
+    // retransmission timeout. Only do so once per Block, as every later Block received triggers the same acknowledgement.
+    if ((ackMsg.ReceivedMask != 0) && (mWindowBase != mNextBlockNum) &&
+        !(mFastRetransmitted && mFastRetransmitBlock == mWindowBase))
+    {
+        mRetransmitMask |= 1u;
+        mFastRetransmitBlock = mWindowBase;
+        mFastRetransmitted   = true;
+    }
+
+    mAwaitingResponse = (mWindowBase != mNextBlockNum) || (mState == TransferState::kAwaitingEOFAck);
+
+    // Let the caller know that more Blocks may be prepared
+    if ((acked > 0) && (mState == TransferState::kTransferInProgress))
+    {
+        mPendingOutput = OutputEventType::kAckReceived;
+    }
+}
+
+bool TransferSession::PollRetransmission(OutputEvent & event, System::Clock::Timestamp curTime)
+{
+    if (mShouldInitRetransmitStart)
+    {
+        mRetransmitStartTime       = curTime;
+        mShouldInitRetransmitStart = false;
+    }
+
+    if (((mState != TransferState::kTransferInProgress) && (mState != TransferState::kAwaitingEOFAck)) ||
+        (mWindowBase == mNextBlockNum))
+    {
+        return false;
+    }
+
+    // Without any acknowledgement for a while, the last Blocks or the acknowledgements were lost: send every unacknowledged
+    // Block again.
+    if ((mRetransmitMask == 0) && ((curTime - mRetransmitStartTime) >= kWindowRetransmitTimeout))
+    {
+        for (uint32_t i = 0; mWindowBase + i < mNextBlockNum; i++)
+        {
+            if (!WindowSlot(mWindowBase + i).IsNull())
+            {
+                mRetransmitMask |= (1u << i);
+            }
+        }
+        mRetransmitStartTime = curTime;
+    }
+
+    for (uint32_t i = 0; (mRetransmitMask != 0) && (i < 32); i++)
+    {
+        const uint32_t bit = (1u << i);
+        if ((mRetransmitMask & bit) == 0)
+        {
+            continue;
+        }
+
+        const uint32_t blockCounter = mWindowBase + i;
+        if (WindowSlot(blockCounter).IsNull())
+        {
+            mRetransmitMask &= ~bit;
+            continue;
+        }
+
+        // The stored copy must survive in case this one is lost too
+        System::PacketBufferHandle blockCopy = WindowSlot(blockCounter).CloneData();
+        if (blockCopy.IsNull())
+        {
+            // Try again on the next poll
+            return false;
+        }
+        mRetransmitMask &= ~bit;
+
+        const bool isEof = (mState == TransferState::kAwaitingEOFAck) && (blockCounter == mLastBlockNum);
+        MessageTypeData typeData;
+        OutputEventType unused;
+        PrepareOutgoingMessageEvent(isEof ? MessageType::BlockEOF : MessageType::Block, unused, typeData);
+
+        // Unlike new messages, a retransmission does not restart the transfer timeout.
+        event = OutputEvent::MsgToSendEvent(typeData, std::move(blockCopy));
+        return true;
+    }
+
+    return false;
+}
+
+CHIP_ERROR TransferSession::PrepareSelectiveBlockAck()
+{
+    const MessageType msgType = MessageType::BlockAck;
+
+    SelectiveBlockAck ackMsg;
+    ackMsg.BlockCounter = mWindowBase;
+    for (uint32_t i = 1; i < mWindowSize; i++)
+    {
+        if (!WindowSlot(mWindowBase + i).IsNull())
+        {
+            ackMsg.ReceivedMask |= (1u << (i - 1));
+        }
+    }
+
+    ReturnErrorOnFailure(WriteToPacketBuffer(ackMsg, mPendingMsgHandle));
+
+#if CHIP_AUTOMATION_LOGGING
+    ChipLogAutomation("Sending BDX Message");
+    ackMsg.LogMessage(msgType);
+#endif // CHIP_AUTOMATION_LOGGING
+
+    // The sender keeps sending Blocks without waiting for a query
+    mAwaitingResponse = true;
+
+    PrepareOutgoingMessageEvent(msgType, mPendingOutput, mMsgTypeData);
+
+    return CHIP_NO_ERROR;
+}
+
+uint8_t TransferSession::ClampWindowSize(uint8_t windowSize)
+{
+    if (windowSize > kMaxWindowSize)
+    {
+        windowSize = kMaxWindowSize;
+    }
+
+    // A window of a single Block is a synchronous transfer
+    if (windowSize < 2)
+    {
+        windowSize = 0;
+    }
+    return windowSize;
+}
+
+System::PacketBufferHandle & TransferSession::WindowSlot(uint32_t blockCounter)
+{
+    return mWindowBlocks[blockCounter % ArraySize(mWindowBlocks)];
+}
+
+void TransferSession::ClearWindow()
+{
+    for (System::PacketBufferHandle & block : mWindowBlocks)
+    {
+        block = nullptr;
+    }
+    mRetransmitMask      = 0;
+    mFastRetransmitBlock = 0;
+    mFastRetransmitted   = false;
+    mBufferedEOFBlock    = 0;
+    mHasBufferedEOF      = false;
 }
 
 void TransferSession::ResolveTransferControlOptions(const BitFlags<TransferControlFlags> & proposed)
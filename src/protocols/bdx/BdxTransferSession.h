@@ -7,6 +7,7 @@
 
 #pragma once
 
+#include <lib/core/CHIPConfig.h>
 #include <lib/core/CHIPError.h>
 #include <protocols/bdx/BdxMessages.h>
 #include <system/SystemPacketBuffer.h>
@@ -56,6 +57,10 @@ public:
         // Additional metadata (optional, TLV format)
         const uint8_t * Metadata = nullptr;
         size_t MetadataLength    = 0;
+
+        // Max number of Blocks the sender may have in flight (optional, Sender Drive only). Values below 2 request a synchronous
+        // transfer, which is also used if the peer does not support windowed transfers.
+        uint8_t WindowSize = 0;
     };
 
     struct TransferAcceptData
@@ -65,6 +70,7 @@ public:
         uint16_t MaxBlockSize = 0;
         uint64_t StartOffset  = 0; ///< Not used for SendAccept message
         uint64_t Length       = 0; ///< Not used for SendAccept message
+        uint8_t WindowSize    = 0; ///< Negotiated window size, 0 for a synchronous transfer. Not used by AcceptTransfer()
 
         // Additional metadata (optional, TLV format)
         const uint8_t * Metadata = nullptr;
@@ -191,12 +197,14 @@ public:
      * @param xferControlOpts Indicates all supported control modes. Used to respond to a TransferInit message
      * @param maxBlockSize    The max Block size that this object supports.
      * @param timeout         The amount of time to wait for a response before considering the transfer failed
+     * @param maxWindowSize   The max number of Blocks in flight this object supports in a windowed Sender Drive transfer. Values
+     *                        below 2 only allow synchronous transfers.
      *
      * @return CHIP_ERROR Result of initialization. May also indicate if the TransferSession object is unable to handle this
      *                    request.
      */
     CHIP_ERROR WaitForTransfer(TransferRole role, BitFlags<TransferControlFlags> xferControlOpts, uint16_t maxBlockSize,
-                               System::Clock::Timeout timeout);
+                               System::Clock::Timeout timeout, uint8_t maxWindowSize = 0);
 
     /**
      * @brief
@@ -244,6 +252,11 @@ public:
      * @brief
      *   Prepare a Block message. The Block counter will be populated automatically.
      *
+     *   In a windowed transfer (GetWindowSize() > 0), the next Block may be prepared as soon as the previous one was emitted by
+     *   PollOutput(), until GetWindowSize() Blocks are awaiting acknowledgement; a kAckReceived event signals that the window
+     *   moved forward. Lost Blocks are emitted again by PollOutput() without involving the caller. Since an exchange only allows
+     *   one unacknowledged reliable message, Blocks of a windowed transfer should be sent without requesting an MRP ack.
+     *
      * @param inData Contains data for filling out the Block message
      *
      * @return CHIP_ERROR The result of the preparation of a Block message. May also indicate if the TransferSession object
@@ -298,6 +311,7 @@ public:
     uint64_t GetTransferLength() const { return mTransferLength; }
     uint16_t GetTransferBlockSize() const { return mTransferMaxBlockSize; }
     size_t GetNumBytesProcessed() const { return mNumBytesProcessed; }
+    uint8_t GetWindowSize() const { return mWindowSize; }
 
     TransferSession();
 
@@ -328,6 +342,19 @@ private:
     void HandleBlockAck(System::PacketBufferHandle msgData);
     void HandleBlockAckEOF(System::PacketBufferHandle msgData);
 
+    // Windowed transfer helpers
+    bool IsWindowed() const { return mWindowSize > 0; }
+    static uint8_t ClampWindowSize(uint8_t windowSize);
+    System::PacketBufferHandle & WindowSlot(uint32_t blockCounter);
+    void HandleWindowedBlock(MessageType msgType, System::PacketBufferHandle msgData);
+    void HandleRepeatedBlockEOF(MessageType msgType, System::PacketBufferHandle msgData);
+    void HandleSelectiveBlockAck(System::PacketBufferHandle msgData);
+    void DeliverWindowedBlock(const DataBlock & blockMsg, bool isEof, System::PacketBufferHandle msgData);
+    void DeliverBufferedBlock();
+    bool PollRetransmission(OutputEvent & event, System::Clock::Timestamp curTime);
+    CHIP_ERROR PrepareSelectiveBlockAck();
+    void ClearWindow();
+
     /**
      * @brief
      *   Used when handling a TransferInit message. Determines if there are any compatible Transfer control modes between the two
@@ -379,6 +406,25 @@ private:
     System::Clock::Timestamp mTimeoutStartTime = System::Clock::kZero;
     bool mShouldInitTimeoutStart               = true;
     bool mAwaitingResponse                     = false;
+
+    // Windowed transfer state
+    static constexpr uint8_t kMaxWindowSize = CHIP_CONFIG_BDX_MAX_WINDOW_SIZE;
+    static_assert(kMaxWindowSize <= 32, "The selective acknowledgement mask limits windows to 32 Blocks");
+
+    uint8_t mMaxSupportedWindowSize = 0; ///< Window proposed in the TransferInit or supported by the responder
+    uint8_t mWindowSize             = 0; ///< Negotiated window, 0 for a synchronous transfer
+
+    // Sender: copies of the Blocks not acknowledged yet. Receiver: Blocks received ahead of mWindowBase.
+    System::PacketBufferHandle mWindowBlocks[kMaxWindowSize > 0 ? kMaxWindowSize : 1];
+    uint32_t mWindowBase          = 0; ///< Sender: oldest unacknowledged Block. Receiver: next Block to deliver.
+    uint32_t mRetransmitMask      = 0; ///< Sender: bit i is set if Block (mWindowBase + i) must be sent again
+    uint32_t mFastRetransmitBlock = 0; ///< Sender: last Block sent again because a later one was acknowledged
+    bool mFastRetransmitted       = false;
+    uint32_t mBufferedEOFBlock    = 0; ///< Receiver: counter of the BlockEOF, if it was received out of order
+    bool mHasBufferedEOF          = false;
+
+    System::Clock::Timestamp mRetransmitStartTime = System::Clock::kZero;
+    bool mShouldInitRetransmitStart               = false;
 };
 
 } // namespace bdx
@@ -21,8 +21,10 @@
 #include <lib/support/BitFlags.h>
 #include <messaging/ExchangeContext.h>
 #include <messaging/ExchangeDelegate.h>
+#include <messaging/Flags.h>
 #include <platform/CHIPDeviceLayer.h>
 #include <protocols/bdx/BdxTransferSession.h>
+#include <protocols/secure_channel/Constants.h>
 #include <system/SystemClock.h>
 #include <system/SystemLayer.h>
 
@@ -87,15 +89,31 @@ void TransferFacilitator::ScheduleImmediatePoll()
     mSystemLayer->StartTimer(System::Clock::Milliseconds32(kImmediatePollDelay), PollTimerHandler, this);
 }
 
+Messaging::SendFlags TransferFacilitator::GetSendFlags(const TransferSession::MessageTypeData & msgTypeData) const
+{
+    Messaging::SendFlags sendFlags;
+    if (!msgTypeData.HasMessageType(Protocols::SecureChannel::MsgType::StatusReport))
+    {
+        sendFlags.Set(Messaging::SendMessageFlags::kExpectResponse);
+    }
+    if (mTransfer.GetWindowSize() > 0 &&
+        (msgTypeData.HasMessageType(MessageType::Block) || msgTypeData.HasMessageType(MessageType::BlockEOF)))
+    {
+        sendFlags.Set(Messaging::SendMessageFlags::kNoAutoRequestAck);
+    }
+    return sendFlags;
+}
+
 CHIP_ERROR Responder::PrepareForTransfer(System::Layer * layer, TransferRole role, BitFlags<TransferControlFlags> xferControlOpts,
-                                         uint16_t maxBlockSize, System::Clock::Timeout timeout, System::Clock::Timeout pollFreq)
+                                         uint16_t maxBlockSize, System::Clock::Timeout timeout, System::Clock::Timeout pollFreq,
+                                         uint8_t maxWindowSize)
 {
     VerifyOrReturnError(layer != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
 
     mPollFreq    = pollFreq;
     mSystemLayer = layer;
 
-    ReturnErrorOnFailure(mTransfer.WaitForTransfer(role, xferControlOpts, maxBlockSize, timeout));
+    ReturnErrorOnFailure(mTransfer.WaitForTransfer(role, xferControlOpts, maxBlockSize, timeout, maxWindowSize));
 
     mSystemLayer->StartTimer(mPollFreq, PollTimerHandler, this);
     return CHIP_NO_ERROR;
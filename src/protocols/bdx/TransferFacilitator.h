@@ -25,6 +25,7 @@
 #include <lib/support/BitFlags.h>
 #include <messaging/ExchangeContext.h>
 #include <messaging/ExchangeDelegate.h>
+#include <messaging/Flags.h>
 #include <protocols/bdx/BdxTransferSession.h>
 #include <system/SystemLayer.h>
 
@@ -79,6 +80,13 @@ protected:
      */
     void ScheduleImmediatePoll();
 
+    /**
+     * The SendFlags for a message output by the TransferSession: every message but a StatusReport expects a response. The Blocks
+     * of a windowed transfer do not request an MRP acknowledgement, since the TransferSession sends them again itself until they
+     * are acknowledged by a BlockAck.
+     */
+    Messaging::SendFlags GetSendFlags(const TransferSession::MessageTypeData & msgTypeData) const;
+
     TransferSession mTransfer;
     Messaging::ExchangeContext * mExchangeCtx;
     System::Layer * mSystemLayer;
@@ -105,10 +113,13 @@ public:
      * @param[in] maxBlockSize    The supported maximum size of BDX Block data
      * @param[in] timeout         The chosen timeout delay for the BDX transfer
      * @param[in] pollFreq        The period for the TransferSession poll timer
+     * @param[in] maxWindowSize   The max number of Blocks in flight in a windowed Sender Drive transfer, 0 to only accept
+     *                            synchronous transfers
      */
     CHIP_ERROR PrepareForTransfer(System::Layer * layer, TransferRole role, BitFlags<TransferControlFlags> xferControlOpts,
                                   uint16_t maxBlockSize, System::Clock::Timeout timeout,
-                                  System::Clock::Timeout pollFreq = TransferFacilitator::kDefaultPollFreq);
+                                  System::Clock::Timeout pollFreq = TransferFacilitator::kDefaultPollFreq,
+                                  uint8_t maxWindowSize           = 0);
 };
 
 /**
@@ -127,6 +138,7 @@ public:
      * @param[in] layer      A System::Layer pointer to use to start the polling timer
      * @param[in] role       The role of the Initiator: Sender or Receiver of BDX data
      * @param[in] initData   Data needed for preparing a transfer request BDX message
+     *                       (a non-zero WindowSize proposes a windowed Sender Drive transfer)
      * @param[in] timeoutMs  The chosen timeout delay for the BDX transfer in milliseconds
      * @param[in] pollFreqMs The period for the TransferSession poll timer in milliseconds
      */
@@ -129,6 +129,56 @@ void TestBlockQueryWithSkipMessage(nlTestSuite * inSuite, void * inContext)
     TestHelperWrittenAndParsedMatch<BlockQueryWithSkip>(inSuite, inContext, testMsg);
 }
 
+void TestWindowedTransferInitMessage(nlTestSuite * inSuite, void * inContext)
+{
+    TransferInit testMsg;
+
+    testMsg.TransferCtlOptions.ClearAll().Set(TransferControlFlags::kSenderDrive, true);
+    testMsg.Version      = 1;
+    testMsg.WindowSize   = 8;
+    testMsg.MaxBlockSize = 256;
+
+    char testFileDes[9]    = { "test.txt" };
+    testMsg.FileDesLength  = 9;
+    testMsg.FileDesignator = reinterpret_cast<uint8_t *>(testFileDes);
+
+    uint8_t fakeData[5]    = { 7, 6, 5, 4, 3 };
+    testMsg.MetadataLength = 5;
+    testMsg.Metadata       = reinterpret_cast<uint8_t *>(fakeData);
+
+    TestHelperWrittenAndParsedMatch<TransferInit>(inSuite, inContext, testMsg);
+}
+
+void TestWindowedAcceptMessages(nlTestSuite * inSuite, void * inContext)
+{
+    SendAccept sendAccept;
+    sendAccept.Version = 1;
+    sendAccept.TransferCtlFlags.ClearAll().Set(TransferControlFlags::kSenderDrive, true);
+    sendAccept.MaxBlockSize = 256;
+    sendAccept.WindowSize   = 4;
+
+    TestHelperWrittenAndParsedMatch<SendAccept>(inSuite, inContext, sendAccept);
+
+    ReceiveAccept receiveAccept;
+    receiveAccept.Version = 1;
+    receiveAccept.TransferCtlFlags.ClearAll().Set(TransferControlFlags::kSenderDrive, true);
+    receiveAccept.Length       = 1024;
+    receiveAccept.MaxBlockSize = 256;
+    receiveAccept.WindowSize   = 4;
+
+    TestHelperWrittenAndParsedMatch<ReceiveAccept>(inSuite, inContext, receiveAccept);
+}
+
+void TestSelectiveBlockAckMessage(nlTestSuite * inSuite, void * inContext)
+{
+    SelectiveBlockAck testMsg;
+
+    testMsg.BlockCounter = 7;
+    testMsg.ReceivedMask = 0x5;
+
+    TestHelperWrittenAndParsedMatch<SelectiveBlockAck>(inSuite, inContext, testMsg);
+}
+
 // Test Suite
 
 /**
@@ -143,6 +193,9 @@ static const nlTest sTests[] =
     NL_TEST_DEF("TestCounterMessage", TestCounterMessage),
     NL_TEST_DEF("TestDataBlockMessage", TestDataBlockMessage),
     NL_TEST_DEF("TestBlockQueryWithSkipMessage", TestBlockQueryWithSkipMessage),
+    NL_TEST_DEF("TestWindowedTransferInitMessage", TestWindowedTransferInitMessage),
+    NL_TEST_DEF("TestWindowedAcceptMessages", TestWindowedAcceptMessages),
+    NL_TEST_DEF("TestSelectiveBlockAckMessage", TestSelectiveBlockAckMessage),
 
     NL_TEST_SENTINEL()
 };
@@ -2,6 +2,7 @@
 #include <protocols/bdx/BdxMessages.h>
 #include <protocols/bdx/BdxTransferSession.h>
 
+#include <algorithm>
 #include <string.h>
 
 #include <nlunit-test.h>
@@ -11,6 +12,7 @@
 #include <lib/support/CHIPMem.h>
 #include <lib/support/CodeUtils.h>
 #include <lib/support/UnitTestRegistration.h>
+#include <lib/support/logging/CHIPLogging.h>
 #include <protocols/secure_channel/Constants.h>
 #include <protocols/secure_channel/StatusReport.h>
 #include <system/SystemPacketBuffer.h>
@@ -81,12 +83,12 @@ CHIP_ERROR ReadAndVerifyTLVString(nlTestSuite * inSuite, void * inContext, const
 }
 
 CHIP_ERROR AttachHeaderAndSend(TransferSession::MessageTypeData typeData, chip::System::PacketBufferHandle msgBuf,
-                               TransferSession & receiver)
+                               TransferSession & receiver, System::Clock::Timestamp curTime = kNoAdvanceTime)
 {
     chip::PayloadHeader payloadHeader;
     payloadHeader.SetMessageType(typeData.ProtocolId, typeData.MessageType);
 
-    ReturnErrorOnFailure(receiver.HandleMessageReceived(payloadHeader, std::move(msgBuf), kNoAdvanceTime));
+    ReturnErrorOnFailure(receiver.HandleMessageReceived(payloadHeader, std::move(msgBuf), curTime));
     return CHIP_NO_ERROR;
 }
 
@@ -140,14 +142,15 @@ void VerifyNoMoreOutput(nlTestSuite * inSuite, void * inContext, TransferSession
 void SendAndVerifyTransferInit(nlTestSuite * inSuite, void * inContext, TransferSession::OutputEvent & outEvent,
                                System::Clock::Timeout timeout, TransferSession & initiator, TransferRole initiatorRole,
                                TransferSession::TransferInitData initData, TransferSession & responder,
-                               BitFlags<TransferControlFlags> & responderControlOpts, uint16_t responderMaxBlock)
+                               BitFlags<TransferControlFlags> & responderControlOpts, uint16_t responderMaxBlock,
+                               uint8_t responderMaxWindow = 0)
 {
     CHIP_ERROR err              = CHIP_NO_ERROR;
     TransferRole responderRole  = (initiatorRole == TransferRole::kSender) ? TransferRole::kReceiver : TransferRole::kSender;
     MessageType expectedInitMsg = (initiatorRole == TransferRole::kSender) ? MessageType::SendInit : MessageType::ReceiveInit;
 
     // Initializer responder to wait for transfer
-    err = responder.WaitForTransfer(responderRole, responderControlOpts, responderMaxBlock, timeout);
+    err = responder.WaitForTransfer(responderRole, responderControlOpts, responderMaxBlock, timeout, responderMaxWindow);
     NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
     VerifyNoMoreOutput(inSuite, inContext, responder);
 
@@ -169,6 +172,9 @@ void SendAndVerifyTransferInit(nlTestSuite * inSuite, void * inContext, Transfer
     NL_TEST_ASSERT(inSuite, outEvent.transferInitData.MaxBlockSize == initData.MaxBlockSize);
     NL_TEST_ASSERT(inSuite, outEvent.transferInitData.StartOffset == initData.StartOffset);
     NL_TEST_ASSERT(inSuite, outEvent.transferInitData.Length == initData.Length);
+    // The proposed window is capped by what the initiator supports
+    NL_TEST_ASSERT(inSuite,
+                   outEvent.transferInitData.WindowSize == std::min<uint8_t>(initData.WindowSize, CHIP_CONFIG_BDX_MAX_WINDOW_SIZE));
     NL_TEST_ASSERT(inSuite, outEvent.transferInitData.FileDesignator != nullptr);
     NL_TEST_ASSERT(inSuite, outEvent.transferInitData.FileDesLength == initData.FileDesLength);
     if (outEvent.EventType == TransferSession::OutputEventType::kInitReceived &&
@@ -724,6 +730,396 @@ void TestDuplicateBlockError(nlTestSuite * inSuite, void * inContext)
     }
 }
 
+// Helper method for setting up a Sender Drive transfer between an initiating sender and a responding receiver, each supporting
+// the given window size.
+void SetUpWindowedTransfer(nlTestSuite * inSuite, void * inContext, TransferSession & initiatingSender,
+                           TransferSession & respondingReceiver, uint8_t senderWindow, uint8_t receiverWindow,
+                           uint16_t transferBlockSize)
+{
+    TransferSession::OutputEvent outEvent;
+    System::Clock::Timeout timeout = System::Clock::Seconds16(24);
+
+    BitFlags<TransferControlFlags> receiverOpts;
+    receiverOpts.Set(TransferControlFlags::kSenderDrive);
+
+    TransferSession::TransferInitData initOptions;
+    initOptions.TransferCtlFlags = TransferControlFlags::kSenderDrive;
+    initOptions.MaxBlockSize     = transferBlockSize;
+    char testFileDes[9]          = { "test.txt" };
+    initOptions.FileDesLength    = static_cast<uint16_t>(strlen(testFileDes));
+    initOptions.FileDesignator   = reinterpret_cast<uint8_t *>(testFileDes);
+    initOptions.WindowSize       = senderWindow;
+
+    SendAndVerifyTransferInit(inSuite, inContext, outEvent, timeout, initiatingSender, TransferRole::kSender, initOptions,
+                              respondingReceiver, receiverOpts, transferBlockSize, receiverWindow);
+
+    TransferSession::TransferAcceptData acceptData;
+    acceptData.ControlMode  = respondingReceiver.GetControlMode();
+    acceptData.MaxBlockSize = transferBlockSize;
+
+    SendAndVerifyAcceptMsg(inSuite, inContext, outEvent, respondingReceiver, TransferRole::kReceiver, acceptData, initiatingSender,
+                           initOptions);
+}
+
+// Helper method for preparing a Block of a windowed transfer whose first byte is its Block counter, and returning the emitted
+// message without delivering it.
+void PrepareWindowedBlock(nlTestSuite * inSuite, void * inContext, TransferSession & sender,
+                          TransferSession::OutputEvent & outEvent, uint8_t blockCounter, bool isEof)
+{
+    uint8_t fakeBlockData[10] = { blockCounter };
+
+    TransferSession::BlockData blockData;
+    blockData.Data   = fakeBlockData;
+    blockData.Length = sizeof(fakeBlockData);
+    blockData.IsEof  = isEof;
+
+    CHIP_ERROR err = sender.PrepareBlock(blockData);
+    NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+    sender.PollOutput(outEvent, kNoAdvanceTime);
+    VerifyBdxMessageToSend(inSuite, inContext, outEvent, isEof ? MessageType::BlockEOF : MessageType::Block);
+}
+
+// Helper method for verifying that the receiver emits the Block with the given counter and acknowledging it.
+void ReceiveAndAckWindowedBlock(nlTestSuite * inSuite, void * inContext, TransferSession & receiver,
+                                TransferSession::OutputEvent & outEvent, uint8_t blockCounter)
+{
+    receiver.PollOutput(outEvent, kNoAdvanceTime);
+    NL_TEST_ASSERT(inSuite, outEvent.EventType == TransferSession::OutputEventType::kBlockReceived);
+    if (outEvent.EventType == TransferSession::OutputEventType::kBlockReceived && outEvent.blockdata.Data != nullptr)
+    {
+        NL_TEST_ASSERT(inSuite, outEvent.blockdata.BlockCounter == blockCounter);
+        NL_TEST_ASSERT(inSuite, outEvent.blockdata.Data[0] == blockCounter);
+    }
+
+    CHIP_ERROR err = receiver.PrepareBlockAck();
+    NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+    receiver.PollOutput(outEvent, kNoAdvanceTime);
+    VerifyBdxMessageToSend(inSuite, inContext, outEvent,
+                           outEvent.msgTypeData.MessageType == static_cast<uint8_t>(MessageType::BlockAckEOF)
+                               ? MessageType::BlockAckEOF
+                               : MessageType::BlockAck);
+}
+
+#if CHIP_CONFIG_BDX_MAX_WINDOW_SIZE >= 8
+// Test a windowed Sender Drive transfer where a Block is lost: the receiver keeps the Blocks received out of order, and the sender
+// sends the lost Block again as soon as a later one is acknowledged.
+void TestWindowedTransfer(nlTestSuite * inSuite, void * inContext)
+{
+    CHIP_ERROR err = CHIP_NO_ERROR;
+    TransferSession::OutputEvent outEvent;
+    TransferSession initiatingSender;
+    TransferSession respondingReceiver;
+    TransferSession::OutputEvent blocks[4];
+
+    SetUpWindowedTransfer(inSuite, inContext, initiatingSender, respondingReceiver, 4, 6, 10);
+    NL_TEST_ASSERT(inSuite, initiatingSender.GetWindowSize() == 4);
+    NL_TEST_ASSERT(inSuite, respondingReceiver.GetWindowSize() == 4);
+
+    // A full window may be sent without waiting for acknowledgements, but no more
+    for (uint8_t i = 0; i < 4; i++)
+    {
+        PrepareWindowedBlock(inSuite, inContext, initiatingSender, blocks[i], i, false);
+    }
+    VerifyNoMoreOutput(inSuite, inContext, initiatingSender);
+
+    uint8_t extraData[10] = { 0 };
+    TransferSession::BlockData extraBlock;
+    extraBlock.Data   = extraData;
+    extraBlock.Length = sizeof(extraData);
+    err               = initiatingSender.PrepareBlock(extraBlock);
+    NL_TEST_ASSERT(inSuite, err == CHIP_ERROR_INCORRECT_STATE);
+
+    // Block 0 is delivered and acknowledged, which lets the sender prepare another Block
+    err = AttachHeaderAndSend(blocks[0].msgTypeData, std::move(blocks[0].MsgData), respondingReceiver);
+    NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+    ReceiveAndAckWindowedBlock(inSuite, inContext, respondingReceiver, outEvent, 0);
+    VerifyNoMoreOutput(inSuite, inContext, respondingReceiver);
+    err = AttachHeaderAndSend(outEvent.msgTypeData, std::move(outEvent.MsgData), initiatingSender);
+    NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+    initiatingSender.PollOutput(outEvent, kNoAdvanceTime);
+    NL_TEST_ASSERT(inSuite, outEvent.EventType == TransferSession::OutputEventType::kAckReceived);
+    VerifyNoMoreOutput(inSuite, inContext, initiatingSender);
+
+    // Block 1 is lost: Blocks 2 and 3 are kept by the receiver, which reports the hole
+    for (uint8_t i = 2; i < 4; i++)
+    {
+        err = AttachHeaderAndSend(blocks[i].msgTypeData, std::move(blocks[i].MsgData), respondingReceiver);
+        NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+        respondingReceiver.PollOutput(outEvent, kNoAdvanceTime);
+        VerifyBdxMessageToSend(inSuite, inContext, outEvent, MessageType::BlockAck);
+        VerifyNoMoreOutput(inSuite, inContext, respondingReceiver);
+
+        err = AttachHeaderAndSend(outEvent.msgTypeData, std::move(outEvent.MsgData), initiatingSender);
+        NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+
+        // Only the first report of the hole sends the Block again
+        if (i == 2)
+        {
+            initiatingSender.PollOutput(outEvent, kNoAdvanceTime);
+            VerifyBdxMessageToSend(inSuite, inContext, outEvent, MessageType::Block);
+            blocks[1] = std::move(outEvent);
+        }
+        VerifyNoMoreOutput(inSuite, inContext, initiatingSender);
+    }
+
+    // Once Block 1 arrives, the receiver emits it and the buffered Blocks in order
+    err = AttachHeaderAndSend(blocks[1].msgTypeData, std::move(blocks[1].MsgData), respondingReceiver);
+    NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+    for (uint8_t i = 1; i < 4; i++)
+    {
+        ReceiveAndAckWindowedBlock(inSuite, inContext, respondingReceiver, outEvent, i);
+        err = AttachHeaderAndSend(outEvent.msgTypeData, std::move(outEvent.MsgData), initiatingSender);
+        NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+        initiatingSender.PollOutput(outEvent, kNoAdvanceTime);
+        NL_TEST_ASSERT(inSuite, outEvent.EventType == TransferSession::OutputEventType::kAckReceived);
+        VerifyNoMoreOutput(inSuite, inContext, initiatingSender);
+    }
+    VerifyNoMoreOutput(inSuite, inContext, respondingReceiver);
+
+    // Finish with a BlockEOF
+    PrepareWindowedBlock(inSuite, inContext, initiatingSender, outEvent, 4, true);
+    err = AttachHeaderAndSend(outEvent.msgTypeData, std::move(outEvent.MsgData), respondingReceiver);
+    NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+    ReceiveAndAckWindowedBlock(inSuite, inContext, respondingReceiver, outEvent, 4);
+    VerifyBdxMessageToSend(inSuite, inContext, outEvent, MessageType::BlockAckEOF);
+    err = AttachHeaderAndSend(outEvent.msgTypeData, std::move(outEvent.MsgData), initiatingSender);
+    NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+    initiatingSender.PollOutput(outEvent, kNoAdvanceTime);
+    NL_TEST_ASSERT(inSuite, outEvent.EventType == TransferSession::OutputEventType::kAckEOFReceived);
+    VerifyNoMoreOutput(inSuite, inContext, initiatingSender);
+}
+#endif // CHIP_CONFIG_BDX_MAX_WINDOW_SIZE >= 8
+
+// Test that a windowed transfer falls back to a synchronous one if the responder does not support windows.
+void TestWindowedTransferFallback(nlTestSuite * inSuite, void * inContext)
+{
+    TransferSession::OutputEvent outEvent;
+    TransferSession initiatingSender;
+    TransferSession respondingReceiver;
+
+    SetUpWindowedTransfer(inSuite, inContext, initiatingSender, respondingReceiver, 4, 0, 10);
+    NL_TEST_ASSERT(inSuite, initiatingSender.GetWindowSize() == 0);
+    NL_TEST_ASSERT(inSuite, respondingReceiver.GetWindowSize() == 0);
+
+    // A second Block cannot be prepared before the first one is acknowledged
+    PrepareWindowedBlock(inSuite, inContext, initiatingSender, outEvent, 0, false);
+    uint8_t extraData[10] = { 0 };
+    TransferSession::BlockData extraBlock;
+    extraBlock.Data   = extraData;
+    extraBlock.Length = sizeof(extraData);
+    NL_TEST_ASSERT(inSuite, initiatingSender.PrepareBlock(extraBlock) == CHIP_ERROR_INCORRECT_STATE);
+
+    CHIP_ERROR err = AttachHeaderAndSend(outEvent.msgTypeData, std::move(outEvent.MsgData), respondingReceiver);
+    NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+    ReceiveAndAckWindowedBlock(inSuite, inContext, respondingReceiver, outEvent, 0);
+    err = AttachHeaderAndSend(outEvent.msgTypeData, std::move(outEvent.MsgData), initiatingSender);
+    NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+    initiatingSender.PollOutput(outEvent, kNoAdvanceTime);
+    NL_TEST_ASSERT(inSuite, outEvent.EventType == TransferSession::OutputEventType::kAckReceived);
+}
+
+// Simulated link between two TransferSession objects, delivering each message after a fixed one-way latency. When lossy, every
+// kLossInterval-th message is dropped, as well as the first BlockAckEOF.
+class SimulatedLink
+{
+public:
+    static constexpr System::Clock::Milliseconds64 kLatency = System::Clock::Milliseconds64(50);
+    static constexpr uint32_t kLossInterval                 = 7;
+
+    explicit SimulatedLink(bool lossy) : mLossy(lossy) {}
+
+    bool Send(TransferSession & destination, TransferSession::OutputEvent & event, System::Clock::Timestamp now)
+    {
+        mNumSent++;
+        if (mLossy && (mNumSent % kLossInterval) == 0)
+        {
+            return true;
+        }
+        if (mLossy && !mDroppedAckEOF && event.msgTypeData.HasMessageType(MessageType::BlockAckEOF))
+        {
+            mDroppedAckEOF = true;
+            return true;
+        }
+
+        for (Message & message : mMessages)
+        {
+            if (message.destination == nullptr)
+            {
+                message.destination = &destination;
+                message.typeData    = event.msgTypeData;
+                message.msg         = std::move(event.MsgData);
+                message.arrival     = now + kLatency;
+                return true;
+            }
+        }
+        return false;
+    }
+
+    // Deliver the next message due at or before now, if any.
+    bool DeliverNext(System::Clock::Timestamp now)
+    {
+        Message * next = NextMessage();
+        if (next == nullptr || next->arrival > now)
+        {
+            return false;
+        }
+
+        TransferSession * destination = next->destination;
+        next->destination             = nullptr;
+        return AttachHeaderAndSend(next->typeData, std::move(next->msg), *destination, now) == CHIP_NO_ERROR;
+    }
+
+    // Arrival time of the next message, or fallback if there are none.
+    System::Clock::Timestamp NextArrival(System::Clock::Timestamp fallback)
+    {
+        Message * next = NextMessage();
+        return (next != nullptr && next->arrival < fallback) ? next->arrival : fallback;
+    }
+
+private:
+    struct Message
+    {
+        TransferSession * destination = nullptr;
+        TransferSession::MessageTypeData typeData;
+        System::PacketBufferHandle msg;
+        System::Clock::Timestamp arrival;
+    };
+
+    Message * NextMessage()
+    {
+        Message * next = nullptr;
+        for (Message & message : mMessages)
+        {
+            if (message.destination != nullptr && (next == nullptr || message.arrival < next->arrival))
+            {
+                next = &message;
+            }
+        }
+        return next;
+    }
+
+    Message mMessages[64];
+    uint32_t mNumSent   = 0;
+    bool mDroppedAckEOF = false;
+    bool mLossy;
+};
+
+constexpr System::Clock::Milliseconds64 SimulatedLink::kLatency;
+
+// Run a Sender Drive transfer of numBlocks Blocks over a SimulatedLink and return how long it took, or zero if it failed.
+System::Clock::Timestamp RunSimulatedTransfer(nlTestSuite * inSuite, void * inContext, uint8_t windowSize, uint32_t numBlocks,
+                                              bool lossy)
+{
+    constexpr uint16_t kBlockSize                    = 64;
+    constexpr System::Clock::Milliseconds64 kMaxTime = System::Clock::Milliseconds64(60000);
+    // Poll at least this often so that retransmission timers fire
+    constexpr System::Clock::Milliseconds64 kPollInterval = System::Clock::Milliseconds64(100);
+
+    TransferSession sender;
+    TransferSession receiver;
+    SimulatedLink link(lossy);
+    TransferSession::OutputEvent event;
+    System::Clock::Timestamp now = System::Clock::kZero;
+    uint32_t numPrepared         = 0;
+    uint32_t numReceived         = 0;
+    bool done                    = false;
+
+    SetUpWindowedTransfer(inSuite, inContext, sender, receiver, windowSize, windowSize, kBlockSize);
+
+    while (!done && now < kMaxTime)
+    {
+        // Let the sender emit everything it can, preparing Blocks as long as its window allows
+        for (;;)
+        {
+            sender.PollOutput(event, now);
+            if (event.EventType == TransferSession::OutputEventType::kMsgToSend)
+            {
+                VerifyOrReturnError(link.Send(receiver, event, now), System::Clock::kZero);
+                continue;
+            }
+            if (event.EventType == TransferSession::OutputEventType::kAckEOFReceived)
+            {
+                done = true;
+                break;
+            }
+            VerifyOrReturnError(event.EventType == TransferSession::OutputEventType::kNone ||
+                                    event.EventType == TransferSession::OutputEventType::kAckReceived,
+                                System::Clock::kZero);
+            if (event.EventType == TransferSession::OutputEventType::kAckReceived)
+            {
+                continue;
+            }
+            if (numPrepared == numBlocks)
+            {
+                break;
+            }
+
+            uint8_t blockData[kBlockSize] = { static_cast<uint8_t>(numPrepared) };
+            TransferSession::BlockData block;
+            block.Data   = blockData;
+            block.Length = sizeof(blockData);
+            block.IsEof  = (numPrepared + 1 == numBlocks);
+            if (sender.PrepareBlock(block) != CHIP_NO_ERROR)
+            {
+                break;
+            }
+            numPrepared++;
+        }
+
+        // Let the receiver acknowledge every Block, and check they are received in order
+        for (;;)
+        {
+            receiver.PollOutput(event, now);
+            if (event.EventType == TransferSession::OutputEventType::kBlockReceived)
+            {
+                NL_TEST_ASSERT(inSuite, event.blockdata.BlockCounter == numReceived);
+                NL_TEST_ASSERT(inSuite, event.blockdata.Data[0] == static_cast<uint8_t>(numReceived));
+                numReceived++;
+                VerifyOrReturnError(receiver.PrepareBlockAck() == CHIP_NO_ERROR, System::Clock::kZero);
+                continue;
+            }
+            if (event.EventType == TransferSession::OutputEventType::kMsgToSend)
+            {
+                VerifyOrReturnError(link.Send(sender, event, now), System::Clock::kZero);
+                continue;
+            }
+            VerifyOrReturnError(event.EventType == TransferSession::OutputEventType::kNone, System::Clock::kZero);
+            break;
+        }
+
+        if (!done && !link.DeliverNext(now))
+        {
+            now = link.NextArrival(now + kPollInterval);
+        }
+    }
+
+    NL_TEST_ASSERT(inSuite, done);
+    NL_TEST_ASSERT(inSuite, numReceived == numBlocks);
+    return done ? now : System::Clock::kZero;
+}
+
+#if CHIP_CONFIG_BDX_MAX_WINDOW_SIZE >= 8
+// Benchmark the throughput of synchronous and windowed Sender Drive transfers over a link with latency, and check that windowed
+// transfers recover from lost messages.
+void TestWindowedTransferThroughput(nlTestSuite * inSuite, void * inContext)
+{
+    constexpr uint32_t kNumBlocks = 64;
+
+    const System::Clock::Timestamp synchronous = RunSimulatedTransfer(inSuite, inContext, 0, kNumBlocks, false);
+    const System::Clock::Timestamp windowed    = RunSimulatedTransfer(inSuite, inContext, 8, kNumBlocks, false);
+    const System::Clock::Timestamp lossy       = RunSimulatedTransfer(inSuite, inContext, 8, kNumBlocks, true);
+
+    ChipLogProgress(BDX, "%u Blocks over a simulated %u ms link: synchronous %u ms, windowed %u ms, windowed with loss %u ms",
+                    static_cast<unsigned>(kNumBlocks), static_cast<unsigned>(SimulatedLink::kLatency.count()),
+                    static_cast<unsigned>(synchronous.count()), static_cast<unsigned>(windowed.count()),
+                    static_cast<unsigned>(lossy.count()));
+
+    NL_TEST_ASSERT(inSuite, windowed > System::Clock::kZero);
+    NL_TEST_ASSERT(inSuite, windowed * 4 < synchronous);
+    NL_TEST_ASSERT(inSuite, lossy > System::Clock::kZero);
+}
+#endif // CHIP_CONFIG_BDX_MAX_WINDOW_SIZE >= 8
+
 // Test Suite
 
 /**
@@ -737,6 +1133,11 @@ static const nlTest sTests[] =
     NL_TEST_DEF("TestBadAcceptMessageFields", TestBadAcceptMessageFields),
     NL_TEST_DEF("TestTimeout", TestTimeout),
     NL_TEST_DEF("TestDuplicateBlockError", TestDuplicateBlockError),
+#if CHIP_CONFIG_BDX_MAX_WINDOW_SIZE >= 8
+    NL_TEST_DEF("TestWindowedTransfer", TestWindowedTransfer),
+    NL_TEST_DEF("TestWindowedTransferThroughput", TestWindowedTransferThroughput),
+#endif // CHIP_CONFIG_BDX_MAX_WINDOW_SIZE >= 8
+    NL_TEST_DEF("TestWindowedTransferFallback", TestWindowedTransferFallback),
     NL_TEST_SENTINEL()
 };
 // clang-format on
@@ -320,6 +320,25 @@
 #define CHIP_SYSTEM_CONFIG_PACKETBUFFER_POOL_SIZE 15
 #endif /* CHIP_SYSTEM_CONFIG_PACKETBUFFER_POOL_SIZE */
 
+/**
+ *  @def CHIP_SYSTEM_CONFIG_PACKETBUFFER_CHAIN_BLOCK_SIZE
+ *
+ *  @brief
+ *      The space for data in each packet buffer allocated by a \c PacketBufferTLVWriter that grows a chain of buffers as it
+ *      writes, or 0 to write each message to a single buffer of its maximum length.
+ *
+ *      Small messages then only hold one small buffer, while larger ones grow the chain block by block up to their maximum
+ *      length instead of requiring a full-size buffer up front. A message that outgrows its first block is copied into a
+ *      single buffer before it is sent.
+ *
+ *  @note
+ *      This only applies when packet buffers are allocated from the heap. Every buffer of a fixed pool (the CHIP pool or
+ *      lwIP pbufs) takes a full-size entry, so chaining small blocks would only use up more of the pool.
+ */
+#ifndef CHIP_SYSTEM_CONFIG_PACKETBUFFER_CHAIN_BLOCK_SIZE
+#define CHIP_SYSTEM_CONFIG_PACKETBUFFER_CHAIN_BLOCK_SIZE 0
+#endif /* CHIP_SYSTEM_CONFIG_PACKETBUFFER_CHAIN_BLOCK_SIZE */
+
 /**
  *  @def CHIP_SYSTEM_CONFIG_PACKETBUFFER_CAPACITY_MAX
  *
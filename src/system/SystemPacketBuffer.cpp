@@ -679,6 +679,32 @@ PacketBufferHandle PacketBufferHandle::CloneData() const
     return cloneHead;
 }
 
+bool PacketBufferHandle::Coalesce(uint16_t aTrailerSize)
+{
+    if (!mBuffer->HasChainedBuffer() && mBuffer->AvailableDataLength() >= aTrailerSize)
+    {
+        return true;
+    }
+
+    const uint16_t totalLength   = mBuffer->TotalLength();
+    PacketBufferHandle coalesced = New(static_cast<size_t>(totalLength) + aTrailerSize, mBuffer->ReservedSize());
+    if (coalesced.IsNull())
+    {
+        return false;
+    }
+
+    uint8_t * data = coalesced->Start();
+    for (PacketBuffer * buffer = mBuffer; buffer != nullptr; buffer = buffer->ChainedBuffer())
+    {
+        memcpy(data, buffer->Start(), buffer->DataLength());
+        data += buffer->DataLength();
+    }
+    coalesced->SetDataLength(totalLength);
+
+    *this = std::move(coalesced);
+    return true;
+}
+
 } // namespace System
 
 namespace Encoding {
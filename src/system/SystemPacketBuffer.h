@@ -670,6 +670,18 @@ public:
      */
     PacketBufferHandle CloneData() const;
 
+    /**
+     * Make the data of this buffer (or chain) contiguous, with room for at least \a aTrailerSize octets after it.
+     *
+     *  Data that already fits in a single buffer with enough room after it is left in place. Otherwise the data is copied to a
+     *  new buffer with the same reserved size as the head of the chain, and the chain is freed.
+     *
+     *  @param[in]  aTrailerSize    Number of octets needed after the data, e.g. for a message integrity check.
+     *
+     *  @return     \c true on success, \c false if the new buffer could not be allocated, in which case this handle is unchanged.
+     */
+    CHECK_RETURN_VALUE bool Coalesce(uint16_t aTrailerSize = 0);
+
     /**
      * Perform an implementation-defined check on the validity of a PacketBufferHandle.
      *
@@ -71,12 +71,31 @@ CHIP_ERROR TLVPacketBufferBackingStore::FinalizeBuffer(chip::TLV::TLVWriter & wr
 {
     uint8_t * endPtr = bufStart + dataLen;
 
+    // A writer rolled back to a checkpoint goes on writing in the buffer it was in at the time, which may come before the
+    // current one. Move back to that buffer and empty the ones after it, GetNewBuffer() then reuses them.
+    auto holdsBufStart = [bufStart](const PacketBufferHandle & buffer) {
+        return bufStart >= buffer->Start() && bufStart <= buffer->Start() + buffer->MaxDataLength();
+    };
+    if (mUseChainedBuffers && !holdsBufStart(mCurrentBuffer))
+    {
+        for (mCurrentBuffer = mHeadBuffer.Retain(); !mCurrentBuffer.IsNull() && !holdsBufStart(mCurrentBuffer);
+             mCurrentBuffer.Advance())
+        {
+        }
+        VerifyOrReturnError(!mCurrentBuffer.IsNull(), CHIP_ERROR_INVALID_ARGUMENT);
+        for (PacketBufferHandle buffer = mCurrentBuffer->Next(); !buffer.IsNull(); buffer.Advance())
+        {
+            buffer->SetDataLength(0, mHeadBuffer);
+        }
+    }
+
     intptr_t length = endPtr - mCurrentBuffer->Start();
     if (!CanCastTo<uint16_t>(length))
     {
         return CHIP_ERROR_INVALID_ARGUMENT;
     }
-    mCurrentBuffer->SetDataLength(static_cast<uint16_t>(length));
+    // Keep the total length of the chain up to date, it is what the message layers look at.
+    mCurrentBuffer->SetDataLength(static_cast<uint16_t>(length), mHeadBuffer);
 
     return CHIP_NO_ERROR;
 }
@@ -91,7 +110,7 @@ CHIP_ERROR TLVPacketBufferBackingStore::GetNewBuffer(chip::TLV::TLVWriter & writ
     mCurrentBuffer.Advance();
     if (mCurrentBuffer.IsNull())
     {
-        mCurrentBuffer = PacketBufferHandle::New(System::PacketBuffer::kMaxSizeWithoutReserve, 0);
+        mCurrentBuffer = PacketBufferHandle::New(mNewBufferSize, 0);
         if (mCurrentBuffer.IsNull())
         {
             return CHIP_ERROR_NO_MEMORY;
@@ -24,6 +24,8 @@
 #pragma once
 
 #include <lib/core/CHIPTLV.h>
+#include <lib/support/CodeUtils.h>
+#include <system/SystemConfig.h>
 #include <system/SystemPacketBuffer.h>
 
 #include <utility>
@@ -37,10 +39,14 @@ namespace System {
 class TLVPacketBufferBackingStore : public chip::TLV::TLVBackingStore
 {
 public:
-    TLVPacketBufferBackingStore() : mHeadBuffer(nullptr), mCurrentBuffer(nullptr), mUseChainedBuffers(false) {}
-    TLVPacketBufferBackingStore(chip::System::PacketBufferHandle && buffer, bool useChainedBuffers = false)
+    TLVPacketBufferBackingStore() :
+        mHeadBuffer(nullptr), mCurrentBuffer(nullptr), mNewBufferSize(PacketBuffer::kMaxSizeWithoutReserve),
+        mUseChainedBuffers(false)
+    {}
+    TLVPacketBufferBackingStore(chip::System::PacketBufferHandle && buffer, bool useChainedBuffers = false,
+                                uint16_t newBufferSize = PacketBuffer::kMaxSizeWithoutReserve)
     {
-        Init(std::move(buffer), useChainedBuffers);
+        Init(std::move(buffer), useChainedBuffers, newBufferSize);
     }
     virtual ~TLVPacketBufferBackingStore() {}
 
@@ -52,16 +58,20 @@ public:
      *                       If true, advance to the next buffer in the chain once all data or space
      *                       in the current buffer has been consumed; a write will allocate new
      *                       packet buffers if necessary.
+     * @param[in]    newBufferSize
+     *                       Space for data in each packet buffer allocated by a write, when useChainedBuffers is true.
      *
      * @note This must take place before initializing a TLV class with this backing store.
      */
-    void Init(chip::System::PacketBufferHandle && buffer, bool useChainedBuffers = false)
+    void Init(chip::System::PacketBufferHandle && buffer, bool useChainedBuffers = false,
+              uint16_t newBufferSize = PacketBuffer::kMaxSizeWithoutReserve)
     {
         mHeadBuffer        = std::move(buffer);
         mCurrentBuffer     = mHeadBuffer.Retain();
+        mNewBufferSize     = newBufferSize;
         mUseChainedBuffers = useChainedBuffers;
     }
-    void Adopt(chip::System::PacketBufferHandle && buffer) { Init(std::move(buffer), mUseChainedBuffers); }
+    void Adopt(chip::System::PacketBufferHandle && buffer) { Init(std::move(buffer), mUseChainedBuffers, mNewBufferSize); }
 
     /**
      * Release ownership of the backing packet buffer.
@@ -84,6 +94,7 @@ public:
 protected:
     chip::System::PacketBufferHandle mHeadBuffer;
     chip::System::PacketBufferHandle mCurrentBuffer;
+    uint16_t mNewBufferSize;
     bool mUseChainedBuffers;
 };
 
@@ -124,6 +135,38 @@ public:
         mBackingStore.Init(std::move(buffer), useChainedBuffers);
         chip::TLV::TLVWriter::Init(mBackingStore);
     }
+
+    /**
+     * Initializes a TLVWriter object to write to a chain of small PacketBuffers that grows as data is written.
+     *
+     * Only the first buffer is allocated up front, so small encodings do not hold a buffer sized for the largest message.
+     * Further buffers are allocated on demand and chained, up to maxLen bytes in total. The resulting chain is coalesced into
+     * a single buffer, if needed at all, when the message is prepared for sending.
+     *
+     * When blockSize is 0, or packet buffers come from a fixed pool, a single buffer of maxLen bytes is allocated instead.
+     *
+     * @param[in]    maxLen     The maximum number of bytes that may be written, across all buffers of the chain.
+     * @param[in]    blockSize  Space for data in each buffer of the chain. The first buffer also reserves the default
+     *                          space for protocol headers.
+     *
+     * @retval #CHIP_NO_ERROR       If the writer was initialized.
+     * @retval #CHIP_ERROR_NO_MEMORY
+     *                              If the first buffer could not be allocated.
+     */
+    CHIP_ERROR InitChained(uint32_t maxLen, uint16_t blockSize = CHIP_SYSTEM_CONFIG_PACKETBUFFER_CHAIN_BLOCK_SIZE)
+    {
+#if CHIP_SYSTEM_PACKETBUFFER_STORE != CHIP_SYSTEM_PACKETBUFFER_STORE_CHIP_HEAP
+        // Each buffer of a fixed pool takes a full-size entry however little of it is used.
+        blockSize = 0;
+#endif
+        const bool useChainedBuffers = (blockSize != 0) && (blockSize < maxLen);
+
+        PacketBufferHandle buffer = PacketBufferHandle::New(useChainedBuffers ? blockSize : maxLen);
+        VerifyOrReturnError(!buffer.IsNull(), CHIP_ERROR_NO_MEMORY);
+
+        mBackingStore.Init(std::move(buffer), useChainedBuffers, blockSize);
+        return chip::TLV::TLVWriter::Init(mBackingStore, maxLen);
+    }
     /**
      * Finish the writing of a TLV encoding and release ownership of the underlying PacketBuffer.
      *
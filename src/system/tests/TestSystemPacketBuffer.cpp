@@ -131,6 +131,7 @@ public:
     static void CheckHandleAdvance(nlTestSuite * inSuite, void * inContext);
     static void CheckHandleRightSize(nlTestSuite * inSuite, void * inContext);
     static void CheckHandleCloneData(nlTestSuite * inSuite, void * inContext);
+    static void CheckHandleCoalesce(nlTestSuite * inSuite, void * inContext);
     static void CheckPacketBufferWriter(nlTestSuite * inSuite, void * inContext);
     static void CheckBuildFreeList(nlTestSuite * inSuite, void * inContext);
 
@@ -1933,6 +1934,43 @@ void PacketBufferTest::CheckHandleCloneData(nlTestSuite * inSuite, void * inCont
 #endif // CHIP_SYSTEM_PACKETBUFFER_STORE == CHIP_SYSTEM_PACKETBUFFER_STORE_CHIP_HEAP
 }
 
+void PacketBufferTest::CheckHandleCoalesce(nlTestSuite * inSuite, void * inContext)
+{
+    struct TestContext * const theContext = static_cast<struct TestContext *>(inContext);
+    PacketBufferTest * const test         = theContext->test;
+    NL_TEST_ASSERT(inSuite, test->mContext == theContext);
+
+    constexpr uint16_t kBlockSize   = 40;
+    constexpr uint16_t kTrailerSize = 16;
+    uint8_t lPayload[3 * kBlockSize];
+    for (size_t i = 0; i < sizeof(lPayload); ++i)
+    {
+        lPayload[i] = static_cast<uint8_t>(random());
+    }
+
+    // A single buffer with room for the trailer is left in place.
+    PacketBufferHandle handle = PacketBufferHandle::NewWithData(lPayload, kBlockSize, kTrailerSize);
+    NL_TEST_ASSERT(inSuite, !handle.IsNull());
+    const PacketBuffer * const original = handle.mBuffer;
+    NL_TEST_ASSERT(inSuite, handle.Coalesce(kTrailerSize));
+    NL_TEST_ASSERT(inSuite, handle.mBuffer == original);
+    NL_TEST_ASSERT(inSuite, handle->DataLength() == kBlockSize);
+
+    // A chain is gathered into one buffer that keeps the reserved size of the head and has room for the trailer.
+    handle->AddToEnd(PacketBufferHandle::NewWithData(lPayload + kBlockSize, kBlockSize, 0, 0));
+    handle->AddToEnd(PacketBufferHandle::NewWithData(lPayload + 2 * kBlockSize, kBlockSize, 0, 0));
+    NL_TEST_ASSERT(inSuite, handle->TotalLength() == sizeof(lPayload));
+
+    const uint16_t reservedSize = handle->ReservedSize();
+    NL_TEST_ASSERT(inSuite, handle.Coalesce(kTrailerSize));
+    NL_TEST_ASSERT(inSuite, !handle->HasChainedBuffer());
+    NL_TEST_ASSERT(inSuite, handle->DataLength() == sizeof(lPayload));
+    NL_TEST_ASSERT(inSuite, handle->TotalLength() == sizeof(lPayload));
+    NL_TEST_ASSERT(inSuite, handle->ReservedSize() == reservedSize);
+    NL_TEST_ASSERT(inSuite, handle->AvailableDataLength() >= kTrailerSize);
+    NL_TEST_ASSERT(inSuite, memcmp(handle->Start(), lPayload, sizeof(lPayload)) == 0);
+}
+
 void PacketBufferTest::CheckPacketBufferWriter(nlTestSuite * inSuite, void * inContext)
 {
     struct TestContext * const theContext = static_cast<struct TestContext *>(inContext);
@@ -2001,6 +2039,7 @@ const nlTest sTests[] =
     NL_TEST_DEF("PacketBuffer::HandleAdvance",          PacketBufferTest::CheckHandleAdvance),
     NL_TEST_DEF("PacketBuffer::HandleRightSize",        PacketBufferTest::CheckHandleRightSize),
     NL_TEST_DEF("PacketBuffer::HandleCloneData",        PacketBufferTest::CheckHandleCloneData),
+    NL_TEST_DEF("PacketBuffer::HandleCoalesce",         PacketBufferTest::CheckHandleCoalesce),
     NL_TEST_DEF("PacketBuffer::PacketBufferWriter",     PacketBufferTest::CheckPacketBufferWriter),
 
     NL_TEST_SENTINEL()
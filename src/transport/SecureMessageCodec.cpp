@@ -42,8 +42,11 @@ CHIP_ERROR Encrypt(Transport::SecureSession * state, PayloadHeader & payloadHead
                    System::PacketBufferHandle & msgBuf, MessageCounter & counter)
 {
     VerifyOrReturnError(!msgBuf.IsNull(), CHIP_ERROR_INVALID_ARGUMENT);
-    VerifyOrReturnError(!msgBuf->HasChainedBuffer(), CHIP_ERROR_INVALID_MESSAGE_LENGTH);
-    VerifyOrReturnError(msgBuf->TotalLength() <= kMaxAppMessageLen, CHIP_ERROR_MESSAGE_TOO_LONG);
+    VerifyOrReturnError(msgBuf->TotalLength() <= state->GetMaxAppMessageLength(), CHIP_ERROR_MESSAGE_TOO_LONG);
+
+    // The message may have been written to a chain of buffers. The AEAD operates on contiguous data and the MIC is appended
+    // in place, so gather the chain into a single buffer with room for the tag. This is a no-op for a single buffer that has room.
+    VerifyOrReturnError(msgBuf.Coalesce(kMaxTagLen), CHIP_ERROR_NO_MEMORY);
 
     uint32_t messageCounter = counter.Value();
 
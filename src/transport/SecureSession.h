@@ -80,6 +80,12 @@ public:
     PeerAddress & GetPeerAddress() { return mPeerAddress; }
     void SetPeerAddress(const PeerAddress & address) { mPeerAddress = address; }
 
+    /// Largest application message that can be sent on the session, see kMaxAppMessageLen and kMaxTcpAppMessageLen.
+    size_t GetMaxAppMessageLength() const
+    {
+        return mPeerAddress.GetTransportType() == Transport::Type::kTcp ? kMaxTcpAppMessageLen : kMaxAppMessageLen;
+    }
+
     Type GetSecureSessionType() const { return mSecureSessionType; }
     NodeId GetPeerNodeId() const { return mPeerNodeId; }
     CATValues GetPeerCATs() const { return mPeerCATs; }
@@ -26,6 +26,7 @@
 
 #include "SessionManager.h"
 
+#include <algorithm>
 #include <inttypes.h>
 #include <string.h>
 
@@ -136,6 +137,7 @@ CHIP_ERROR SessionManager::PrepareMessage(const SessionHandle & sessionHandle, P
                 return CHIP_ERROR_INTERNAL;
             }
             // TODO #11911 Update SecureMessageCodec::Encrypt for Group
+            VerifyOrReturnError(message.Coalesce(), CHIP_ERROR_NO_MEMORY);
             ReturnErrorOnFailure(payloadHeader.EncodeBeforeData(message));
 
 #if CHIP_PROGRESS_LOGGING
@@ -161,6 +163,8 @@ CHIP_ERROR SessionManager::PrepareMessage(const SessionHandle & sessionHandle, P
     }
     else
     {
+        // Transports only send single buffers
+        VerifyOrReturnError(message.Coalesce(), CHIP_ERROR_NO_MEMORY);
         ReturnErrorOnFailure(payloadHeader.EncodeBeforeData(message));
 
         MessageCounter & counter = mGlobalUnencryptedMessageCounter;
@@ -257,7 +261,13 @@ CHIP_ERROR SessionManager::SendPreparedMessage(const SessionHandle & sessionHand
 
     if (mTransportMgr != nullptr)
     {
-        return mTransportMgr->SendMessage(*destination, std::move(msgBuf));
+        CHIP_ERROR err = mTransportMgr->SendMessage(*destination, std::move(msgBuf));
+        if (err == CHIP_ERROR_SENDING_BLOCKED)
+        {
+            // The transport has too much data queued for this peer already: the caller should back off and retry later.
+            ChipLogProgress(Inet, "Transport send queue full, msg %p not sent", &preparedMessage);
+        }
+        return err;
     }
     else
     {
@@ -646,6 +656,22 @@ SecureSession * SessionManager::GetSecureSession(const SessionHandle & session)
     }
 }
 
+size_t SessionManager::GetMaxPayloadSize(const SessionHandle & session, size_t defaultSize)
+{
+    if (!session.IsSecure() || session.IsGroupSession())
+    {
+        return defaultSize;
+    }
+
+    SecureSession * secureSession = GetSecureSession(session);
+    if (secureSession == nullptr || secureSession->GetMaxAppMessageLength() <= kMaxAppMessageLen)
+    {
+        return defaultSize;
+    }
+
+    return std::max(defaultSize, secureSession->GetMaxAppMessageLength());
+}
+
 SessionHandle SessionManager::FindSecureSessionForNode(NodeId peerNodeId)
 {
     SecureSession * found = nullptr;
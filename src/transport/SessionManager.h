@@ -145,6 +145,12 @@ public:
 
     Transport::SecureSession * GetSecureSession(const SessionHandle & session);
 
+    /**
+     * Largest payload to build for a message sent on the session. Returns @p defaultSize, the size the caller uses for
+     * messages bounded by kMaxAppMessageLen, unless the session runs over TCP, which accepts up to kMaxTcpAppMessageLen.
+     */
+    size_t GetMaxPayloadSize(const SessionHandle & session, size_t defaultSize);
+
     /// @brief Set the delegate for handling incoming messages. There can be only one message delegate (probably the
     /// ExchangeManager)
     void SetMessageDelegate(SessionMessageDelegate * cb) { mCB = cb; }
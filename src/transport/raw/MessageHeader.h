@@ -22,6 +22,7 @@
 
 #pragma once
 
+#include <algorithm>
 #include <cstddef>
 #include <cstdint>
 #include <string.h>
@@ -44,6 +45,15 @@ static constexpr size_t kMaxTagLen = 16;
 
 static constexpr size_t kMaxAppMessageLen = 1200;
 
+/**
+ * Largest application message sent over a TCP session. TCP frames messages itself, so instead of the IPv6 MTU the message is
+ * bounded by CHIP_CONFIG_MAX_TCP_APP_MESSAGE_LEN, which has to fit in a packet buffer along with the message headers and MIC.
+ */
+static constexpr size_t kMaxTcpAppMessageLen = std::max<size_t>(kMaxAppMessageLen, CHIP_CONFIG_MAX_TCP_APP_MESSAGE_LEN);
+
+static_assert(kMaxTcpAppMessageLen <= System::PacketBuffer::kMaxSize - kMaxTagLen,
+              "CHIP_CONFIG_MAX_TCP_APP_MESSAGE_LEN does not fit in a packet buffer");
+
 static constexpr uint16_t kMsgUnicastSessionIdUnsecured = 0x0000;
 
 typedef int PacketHeaderFlags;
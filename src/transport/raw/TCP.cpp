@@ -47,6 +47,8 @@ constexpr uint16_t kMaxMessageSize = static_cast<uint16_t>(System::PacketBuffer:
 
 constexpr int kListenBacklogSize = 2;
 
+constexpr uint32_t kSendQueueHighWatermark = CHIP_CONFIG_TCP_SEND_QUEUE_HIGH_WATERMARK;
+
 } // namespace
 
 TCPBase::~TCPBase()
@@ -127,6 +129,16 @@ void TCPBase::Close()
     mState = State::kNotReady;
 }
 
+uint32_t TCPBase::HashPeer(const Inet::IPAddress & address, uint16_t port)
+{
+    uint32_t hash = port;
+    for (uint32_t word : address.Addr)
+    {
+        hash = hash * 31u + word;
+    }
+    return hash;
+}
+
 TCPBase::ActiveConnectionState * TCPBase::FindActiveConnection(const PeerAddress & address)
 {
     if (address.GetTransportType() != Type::kTcp)
@@ -134,19 +146,19 @@ TCPBase::ActiveConnectionState * TCPBase::FindActiveConnection(const PeerAddress
         return nullptr;
     }
 
+    const uint32_t hash = HashPeer(address.GetIPAddress(), address.GetPort());
     for (size_t i = 0; i < mActiveConnectionsSize; i++)
     {
-        if (!mActiveConnections[i].InUse())
+        ActiveConnectionState & connection = mActiveConnections[i];
+        if (!connection.InUse() || connection.mPeerHash != hash)
         {
             continue;
         }
-        Inet::IPAddress addr;
-        uint16_t port;
-        mActiveConnections[i].mEndPoint->GetPeerInfo(&addr, &port);
 
-        if ((addr == address.GetIPAddress()) && (port == address.GetPort()))
+        if ((connection.mPeerAddress.GetIPAddress() == address.GetIPAddress()) &&
+            (connection.mPeerAddress.GetPort() == address.GetPort()))
         {
-            return &mActiveConnections[i];
+            return &connection;
         }
     }
 
@@ -165,6 +177,30 @@ TCPBase::ActiveConnectionState * TCPBase::FindActiveConnection(const Inet::TCPEn
     return nullptr;
 }
 
+bool TCPBase::ReleaseIdleConnection()
+{
+    ActiveConnectionState * oldest = nullptr;
+    for (size_t i = 0; i < mActiveConnectionsSize; i++)
+    {
+        ActiveConnectionState & connection = mActiveConnections[i];
+        if (connection.InUse() && connection.IsIdle() &&
+            (oldest == nullptr || connection.mLastActivity < oldest->mLastActivity))
+        {
+            oldest = &connection;
+        }
+    }
+
+    if (oldest == nullptr)
+    {
+        return false;
+    }
+
+    ChipLogProgress(Inet, "Closing idle connection to make room for a new one");
+    oldest->Free();
+    mUsedEndPointCount--;
+    return true;
+}
+
 CHIP_ERROR TCPBase::SendMessage(const Transport::PeerAddress & address, System::PacketBufferHandle && msgBuf)
 {
     // Sent buffer data format is:
@@ -190,6 +226,13 @@ CHIP_ERROR TCPBase::SendMessage(const Transport::PeerAddress & address, System::
 
     if (connection != nullptr)
     {
+        // Let the sender know the peer is not keeping up instead of queueing without bound. A message is always
+        // accepted by an empty queue, however large.
+        uint32_t pendingLength = connection->mEndPoint->PendingSendLength();
+        VerifyOrReturnError(pendingLength == 0 || pendingLength + msgBuf->DataLength() <= kSendQueueHighWatermark,
+                            CHIP_ERROR_SENDING_BLOCKED);
+
+        connection->mLastActivity = System::SystemClock().GetMonotonicTimestamp();
         return connection->mEndPoint->Send(std::move(msgBuf));
     }
     else
@@ -202,6 +245,7 @@ CHIP_ERROR TCPBase::SendAfterConnect(const PeerAddress & addr, System::PacketBuf
 {
     // This will initiate a connection to the specified peer
     bool alreadyConnecting = false;
+    bool sendingBlocked    = false;
 
     // Iterate through the ENTIRE array. If a pending packet for
     // the address already exists, this means a connection is pending and
@@ -211,7 +255,14 @@ CHIP_ERROR TCPBase::SendAfterConnect(const PeerAddress & addr, System::PacketBuf
         {
             // same destination exists.
             alreadyConnecting = true;
-            pending->mPacketBuffer->AddToEnd(std::move(msg));
+            if (pending->mPacketBuffer->TotalLength() + msg->DataLength() > kSendQueueHighWatermark)
+            {
+                sendingBlocked = true;
+            }
+            else
+            {
+                pending->mPacketBuffer->AddToEnd(std::move(msg));
+            }
             return Loop::Break;
         }
         return Loop::Continue;
@@ -220,11 +271,11 @@ CHIP_ERROR TCPBase::SendAfterConnect(const PeerAddress & addr, System::PacketBuf
     // If already connecting, buffer was just enqueued for more sending
     if (alreadyConnecting)
     {
-        return CHIP_NO_ERROR;
+        return sendingBlocked ? CHIP_ERROR_SENDING_BLOCKED : CHIP_NO_ERROR;
     }
 
-    // Ensures sufficient active connections size exist
-    VerifyOrReturnError(mUsedEndPointCount < mActiveConnectionsSize, CHIP_ERROR_NO_MEMORY);
+    // Ensures sufficient active connections size exist, reusing the slot of an idle connection if need be
+    VerifyOrReturnError(mUsedEndPointCount < mActiveConnectionsSize || ReleaseIdleConnection(), CHIP_ERROR_NO_MEMORY);
 
     Inet::TCPEndPoint * endPoint = nullptr;
 #if INET_CONFIG_ENABLE_TCP_ENDPOINT
@@ -262,6 +313,7 @@ CHIP_ERROR TCPBase::ProcessReceivedBuffer(Inet::TCPEndPoint * endPoint, const Pe
     ActiveConnectionState * state = FindActiveConnection(endPoint);
     VerifyOrReturnError(state != nullptr, CHIP_ERROR_INTERNAL);
     state->mReceived.AddToEnd(std::move(buffer));
+    state->mLastActivity = System::SystemClock().GetMonotonicTimestamp();
 
     while (!state->mReceived.IsNull())
     {
@@ -331,16 +383,16 @@ CHIP_ERROR TCPBase::ProcessSingleMessage(const PeerAddress & peerAddress, Active
 
 CHIP_ERROR TCPBase::OnTcpReceive(Inet::TCPEndPoint * endPoint, System::PacketBufferHandle && buffer)
 {
-    Inet::IPAddress ipAddress;
-    uint16_t port;
-    Inet::InterfaceId interfaceId;
-
-    endPoint->GetPeerInfo(&ipAddress, &port);
-    endPoint->GetInterfaceId(&interfaceId);
-    PeerAddress peerAddress = PeerAddress::TCP(ipAddress, port, interfaceId);
+    TCPBase * tcp                 = reinterpret_cast<TCPBase *>(endPoint->mAppState);
+    ActiveConnectionState * state = tcp->FindActiveConnection(endPoint);
+    CHIP_ERROR err                = CHIP_ERROR_INTERNAL;
 
-    TCPBase * tcp  = reinterpret_cast<TCPBase *>(endPoint->mAppState);
-    CHIP_ERROR err = tcp->ProcessReceivedBuffer(endPoint, peerAddress, std::move(buffer));
+    if (state != nullptr)
+    {
+        // Copied, as the connection state may be released while the received messages are handled.
+        PeerAddress peerAddress = state->mPeerAddress;
+        err                     = tcp->ProcessReceivedBuffer(endPoint, peerAddress, std::move(buffer));
+    }
 
     if (err != CHIP_NO_ERROR)
     {
@@ -407,8 +459,9 @@ void TCPBase::OnConnectionComplete(Inet::TCPEndPoint * endPoint, CHIP_ERROR inet
         {
             if (!tcp->mActiveConnections[i].InUse())
             {
-                tcp->mActiveConnections[i].Init(endPoint);
-                connectionStored = true;
+                tcp->mActiveConnections[i].Init(endPoint, addr);
+                tcp->mActiveConnections[i].mLastActivity = System::SystemClock().GetMonotonicTimestamp();
+                connectionStored                         = true;
                 break;
             }
         }
@@ -445,14 +498,19 @@ void TCPBase::OnConnectionReceived(Inet::TCPEndPoint * listenEndPoint, Inet::TCP
 {
     TCPBase * tcp = reinterpret_cast<TCPBase *>(listenEndPoint->mAppState);
 
-    if (tcp->mUsedEndPointCount < tcp->mActiveConnectionsSize)
+    if (tcp->mUsedEndPointCount < tcp->mActiveConnectionsSize || tcp->ReleaseIdleConnection())
     {
+        Inet::InterfaceId interfaceId;
+        endPoint->GetInterfaceId(&interfaceId);
+
         // have space to use one more (even if considering pending connections)
         for (size_t i = 0; i < tcp->mActiveConnectionsSize; i++)
         {
             if (!tcp->mActiveConnections[i].InUse())
             {
-                tcp->mActiveConnections[i].Init(endPoint);
+                tcp->mActiveConnections[i].Init(endPoint, PeerAddress::TCP(peerAddress, peerPort, interfaceId));
+                tcp->mActiveConnections[i].mLastActivity = System::SystemClock().GetMonotonicTimestamp();
+                tcp->mUsedEndPointCount++;
                 break;
             }
         }
@@ -484,13 +542,7 @@ void TCPBase::Disconnect(const PeerAddress & address)
     {
         if (mActiveConnections[i].InUse())
         {
-            Inet::IPAddress ipAddress;
-            uint16_t port;
-            Inet::InterfaceId interfaceId;
-
-            mActiveConnections[i].mEndPoint->GetPeerInfo(&ipAddress, &port);
-            mActiveConnections[i].mEndPoint->GetInterfaceId(&interfaceId);
-            if (address == PeerAddress::TCP(ipAddress, port, interfaceId))
+            if (address == mActiveConnections[i].mPeerAddress)
             {
                 // NOTE: this leaves the socket in TIME_WAIT.
                 // Calling Abort() would clean it since SO_LINGER would be set to 0,
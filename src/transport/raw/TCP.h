@@ -34,6 +34,7 @@
 #include <lib/core/CHIPCore.h>
 #include <lib/support/CodeUtils.h>
 #include <lib/support/PoolWrapper.h>
+#include <system/SystemClock.h>
 #include <transport/raw/Base.h>
 
 namespace chip {
@@ -111,27 +112,45 @@ protected:
      */
     struct ActiveConnectionState
     {
-        void Init(Inet::TCPEndPoint * endPoint)
+        void Init(Inet::TCPEndPoint * endPoint, const PeerAddress & peerAddress = PeerAddress())
         {
-            mEndPoint = endPoint;
-            mReceived = nullptr;
+            mEndPoint     = endPoint;
+            mReceived     = nullptr;
+            mPeerAddress  = peerAddress;
+            mPeerHash     = HashPeer(peerAddress.GetIPAddress(), peerAddress.GetPort());
+            mLastActivity = System::Clock::kZero;
         }
 
         void Free()
         {
             mEndPoint->Free();
-            mEndPoint = nullptr;
-            mReceived = nullptr;
+            mEndPoint    = nullptr;
+            mReceived    = nullptr;
+            mPeerAddress = PeerAddress();
+            mPeerHash    = 0;
         }
         bool InUse() const { return mEndPoint != nullptr; }
 
+        // Whether the connection has neither data waiting to be sent nor a partially received message.
+        bool IsIdle() const { return mEndPoint->PendingSendLength() == 0 && mReceived.IsNull(); }
+
         // Associated endpoint.
         Inet::TCPEndPoint * mEndPoint;
 
         // Buffers received but not yet consumed.
         System::PacketBufferHandle mReceived;
+
+        // Peer address as of when the connection was established, and its HashPeer(), so that looking up the
+        // connection to a peer does not need to query every endpoint for its peer.
+        PeerAddress mPeerAddress;
+        uint32_t mPeerHash;
+
+        // Last time a message was sent or received on the connection.
+        System::Clock::Timestamp mLastActivity;
     };
 
+    static uint32_t HashPeer(const Inet::IPAddress & address, uint16_t port);
+
 public:
     using PendingPacketPoolType = PoolInterface<PendingPacket, const PeerAddress &, System::PacketBufferHandle &&>;
     TCPBase(ActiveConnectionState * activeConnectionsBuffer, size_t bufferSize, PendingPacketPoolType & packetBuffers) :
@@ -190,6 +209,14 @@ private:
     ActiveConnectionState * FindActiveConnection(const PeerAddress & addr);
     ActiveConnectionState * FindActiveConnection(const Inet::TCPEndPoint * endPoint);
 
+    /**
+     * Make room for one more connection when all of them are in use, by closing the connection that has been idle
+     * for the longest time.
+     *
+     * @return true if a connection was closed.
+     */
+    bool ReleaseIdleConnection();
+
     /**
      * Sends the specified message once a connection has been established.
      *
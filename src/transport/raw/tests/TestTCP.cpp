@@ -52,6 +52,7 @@ class TCPTest
 {
 public:
     static void CheckProcessReceivedBuffer(nlTestSuite * inSuite, void * inContext);
+    static void CheckIdleConnectionReuse(nlTestSuite * inSuite, void * inContext);
 };
 } // namespace Transport
 } // namespace chip
@@ -431,6 +432,37 @@ void chip::Transport::TCPTest::CheckProcessReceivedBuffer(nlTestSuite * inSuite,
     gMockTransportMgrDelegate.FinalizeMessageTest(tcp, addr);
 }
 
+void chip::Transport::TCPTest::CheckIdleConnectionReuse(nlTestSuite * inSuite, void * inContext)
+{
+    TestContext & ctx = *reinterpret_cast<TestContext *>(inContext);
+    TCPImpl tcp;
+
+    IPAddress addr;
+    IPAddress::FromString("::1", addr);
+
+    MockTransportMgrDelegate gMockTransportMgrDelegate(inSuite, ctx);
+    gMockTransportMgrDelegate.InitializeMessageTest(tcp, addr);
+
+    // Sending to ourselves uses two connections: the outgoing one and the one accepted by the listening socket.
+    gMockTransportMgrDelegate.SingleMessageTest(tcp, addr);
+    NL_TEST_ASSERT(inSuite, tcp.mUsedEndPointCount == 2);
+
+    TCPBase::ActiveConnectionState * state = tcp.FindActiveConnection(Transport::PeerAddress::TCP(addr));
+    NL_TEST_ASSERT(inSuite, state != nullptr);
+    NL_TEST_ASSERT(inSuite, state->mPeerAddress.GetIPAddress() == addr);
+    NL_TEST_ASSERT(inSuite, state->mPeerAddress.GetPort() == CHIP_PORT);
+    NL_TEST_ASSERT(inSuite, state->IsIdle());
+
+    // Both connections are idle, so one of them can be given up for a new connection.
+    NL_TEST_ASSERT(inSuite, tcp.ReleaseIdleConnection());
+    NL_TEST_ASSERT(inSuite, tcp.mUsedEndPointCount == 1);
+
+    // The other end of the loopback connection then sees the peer close and is freed too.
+    ctx.DriveIOUntil(chip::System::Clock::Seconds16(5), [&tcp]() { return !tcp.HasActiveConnections(); });
+    NL_TEST_ASSERT(inSuite, !tcp.HasActiveConnections());
+    NL_TEST_ASSERT(inSuite, tcp.mUsedEndPointCount == 0);
+}
+
 // Test Suite
 /**
  *  Test Suite that lists all the test functions.
@@ -446,6 +478,7 @@ static const nlTest sTests[] =
     NL_TEST_DEF("Simple Init Test IPV6",        CheckSimpleInitTest6),
     NL_TEST_DEF("Message Self Test IPV6",       CheckMessageTest6),
     NL_TEST_DEF("ProcessReceivedBuffer Test",   chip::Transport::TCPTest::CheckProcessReceivedBuffer),
+    NL_TEST_DEF("Idle Connection Reuse Test",   chip::Transport::TCPTest::CheckIdleConnectionReuse),
 
     NL_TEST_SENTINEL()
 };
@@ -158,6 +158,8 @@ void CheckMessageTest(nlTestSuite * inSuite, void * inContext)
 
     SessionHandle localToRemoteSession = callback.mLocalToRemoteSession.Get();
 
+    NL_TEST_ASSERT(inSuite, sessionManager.GetMaxPayloadSize(localToRemoteSession, 1024) == 1024);
+
     // Should be able to send a message to itself by just calling send.
     callback.ReceiveHandlerCallCount = 0;
 
@@ -206,6 +208,71 @@ void CheckMessageTest(nlTestSuite * inSuite, void * inContext)
     sessionManager.Shutdown();
 }
 
+void CheckTcpMessageTest(nlTestSuite * inSuite, void * inContext)
+{
+    TestContext & ctx = *reinterpret_cast<TestContext *>(inContext);
+
+    TestSessMgrCallback callback;
+    callback.LargeMessageSent = true;
+
+    IPAddress addr;
+    IPAddress::FromString("::1", addr);
+    CHIP_ERROR err = CHIP_NO_ERROR;
+
+    TransportMgr<LoopbackTransport> transportMgr;
+    SessionManager sessionManager;
+    secure_channel::MessageCounterManager gMessageCounterManager;
+
+    err = transportMgr.Init("LOOPBACK");
+    NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+
+    err = sessionManager.Init(&ctx.GetSystemLayer(), &transportMgr, &gMessageCounterManager);
+    NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+
+    callback.mSuite = inSuite;
+
+    sessionManager.SetMessageDelegate(&callback);
+
+    Optional<Transport::PeerAddress> peer(Transport::PeerAddress::TCP(addr, CHIP_PORT));
+
+    SecurePairingUsingTestSecret pairing1(1, 2);
+    err = sessionManager.NewPairing(callback.mRemoteToLocalSession, peer, kSourceNodeId, &pairing1,
+                                    CryptoContext::SessionRole::kInitiator, 1);
+    NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+
+    SecurePairingUsingTestSecret pairing2(2, 1);
+    err = sessionManager.NewPairing(callback.mLocalToRemoteSession, peer, kDestinationNodeId, &pairing2,
+                                    CryptoContext::SessionRole::kResponder, 0);
+    NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+
+    SessionHandle localToRemoteSession = callback.mLocalToRemoteSession.Get();
+
+    // TCP sessions are not bound by kMaxAppMessageLen.
+    NL_TEST_ASSERT(inSuite, kMaxTcpAppMessageLen > kMaxAppMessageLen);
+    NL_TEST_ASSERT(inSuite, sessionManager.GetMaxPayloadSize(localToRemoteSession, 1024) == kMaxTcpAppMessageLen);
+
+    callback.ReceiveHandlerCallCount = 0;
+
+    PayloadHeader payloadHeader;
+    payloadHeader.SetExchangeID(0);
+    payloadHeader.SetMessageType(chip::Protocols::Echo::MsgType::EchoRequest);
+
+    // A message larger than what fits in an IPv6 packet is sent and received over TCP.
+    chip::System::PacketBufferHandle large_buffer = chip::MessagePacketBuffer::NewWithData(LARGE_PAYLOAD, sizeof(LARGE_PAYLOAD));
+    NL_TEST_ASSERT(inSuite, !large_buffer.IsNull());
+
+    EncryptedPacketBufferHandle preparedMessage;
+    err = sessionManager.PrepareMessage(localToRemoteSession, payloadHeader, std::move(large_buffer), preparedMessage);
+    NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+
+    err = sessionManager.SendPreparedMessage(localToRemoteSession, preparedMessage);
+    NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+
+    NL_TEST_ASSERT(inSuite, callback.ReceiveHandlerCallCount == 1);
+
+    sessionManager.Shutdown();
+}
+
 void SendEncryptedPacketTest(nlTestSuite * inSuite, void * inContext)
 {
     TestContext & ctx = *reinterpret_cast<TestContext *>(inContext);
@@ -479,6 +546,7 @@ const nlTest sTests[] =
 {
     NL_TEST_DEF("Simple Init Test",               CheckSimpleInitTest),
     NL_TEST_DEF("Message Self Test",              CheckMessageTest),
+    NL_TEST_DEF("TCP Large Message Test",         CheckTcpMessageTest),
     NL_TEST_DEF("Send Encrypted Packet Test",     SendEncryptedPacketTest),
     NL_TEST_DEF("Send Bad Encrypted Packet Test", SendBadEncryptedPacketTest),
     NL_TEST_DEF("Drop stale connection Test",     StaleConnectionDropTest),
@@ -295,6 +295,13 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kIdentifyTime)), identifyTime);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -329,6 +336,13 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kTimeout)), timeout);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -362,6 +376,12 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -394,6 +414,14 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kEffectIdentifier)), effectIdentifier);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kEffectVariant)), effectVariant);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -469,6 +497,14 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kGroupId)), groupId);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kGroupName)), groupName);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -507,6 +543,14 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kStatus)), status);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kGroupId)), groupId);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -544,6 +588,13 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kGroupId)), groupId);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -580,6 +631,15 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kStatus)), status);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kGroupId)), groupId);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kGroupName)), groupName);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -620,6 +680,13 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kGroupList)), groupList);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -655,6 +722,14 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kCapacity)), capacity);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kGroupList)), groupList);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -692,6 +767,13 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kGroupId)), groupId);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -727,6 +809,14 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kStatus)), status);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kGroupId)), groupId);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -763,6 +853,12 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -795,6 +891,14 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kGroupId)), groupId);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kGroupName)), groupName);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -867,6 +971,15 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kClusterId)), clusterId);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kLength)), length);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kValue)), value);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -917,6 +1030,17 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kGroupId)), groupId);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kSceneId)), sceneId);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kTransitionTime)), transitionTime);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kSceneName)), sceneName);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kExtensionFieldSets)), extensionFieldSets);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -965,6 +1089,15 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kStatus)), status);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kGroupId)), groupId);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kSceneId)), sceneId);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -1006,6 +1139,14 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kGroupId)), groupId);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kSceneId)), sceneId);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -1049,6 +1190,18 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kStatus)), status);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kGroupId)), groupId);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kSceneId)), sceneId);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kTransitionTime)), transitionTime);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kSceneName)), sceneName);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kExtensionFieldSets)), extensionFieldSets);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -1099,6 +1252,14 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kGroupId)), groupId);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kSceneId)), sceneId);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -1138,6 +1299,15 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kStatus)), status);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kGroupId)), groupId);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kSceneId)), sceneId);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -1178,6 +1348,13 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kGroupId)), groupId);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -1213,6 +1390,14 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kStatus)), status);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kGroupId)), groupId);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -1251,6 +1436,14 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kGroupId)), groupId);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kSceneId)), sceneId);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -1290,6 +1483,15 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kStatus)), status);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kGroupId)), groupId);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kSceneId)), sceneId);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -1332,6 +1534,15 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kGroupId)), groupId);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kSceneId)), sceneId);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kTransitionTime)), transitionTime);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -1372,6 +1583,13 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kGroupId)), groupId);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -1410,6 +1628,17 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kStatus)), status);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kCapacity)), capacity);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kGroupId)), groupId);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kSceneCount)), sceneCount);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kSceneList)), sceneList);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -1461,6 +1690,17 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kGroupId)), groupId);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kSceneId)), sceneId);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kTransitionTime)), transitionTime);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kSceneName)), sceneName);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kExtensionFieldSets)), extensionFieldSets);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -1509,6 +1749,15 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kStatus)), status);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kGroupId)), groupId);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kSceneId)), sceneId);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -1550,6 +1799,14 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kGroupId)), groupId);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kSceneId)), sceneId);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -1593,6 +1850,18 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kStatus)), status);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kGroupId)), groupId);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kSceneId)), sceneId);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kTransitionTime)), transitionTime);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kSceneName)), sceneName);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kExtensionFieldSets)), extensionFieldSets);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -1646,6 +1915,17 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kMode)), mode);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kGroupIdFrom)), groupIdFrom);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kSceneIdFrom)), sceneIdFrom);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kGroupIdTo)), groupIdTo);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kSceneIdTo)), sceneIdTo);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -1694,6 +1974,15 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kStatus)), status);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kGroupIdFrom)), groupIdFrom);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kSceneIdFrom)), sceneIdFrom);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -1782,6 +2071,12 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -1812,6 +2107,12 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -1842,6 +2143,12 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -1874,6 +2181,14 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kEffectId)), effectId);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kEffectVariant)), effectVariant);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -1910,6 +2225,12 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -1943,6 +2264,15 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kOnOffControl)), onOffControl);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kOnTime)), onTime);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kOffWaitTime)), offWaitTime);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -2069,6 +2399,16 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kLevel)), level);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kTransitionTime)), transitionTime);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kOptionMask)), optionMask);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kOptionOverride)), optionOverride);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -2115,6 +2455,16 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kMoveMode)), moveMode);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kRate)), rate);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kOptionMask)), optionMask);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kOptionOverride)), optionOverride);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -2162,6 +2512,17 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kStepMode)), stepMode);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kStepSize)), stepSize);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kTransitionTime)), transitionTime);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kOptionMask)), optionMask);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kOptionOverride)), optionOverride);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -2209,6 +2570,14 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kOptionMask)), optionMask);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kOptionOverride)), optionOverride);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -2247,6 +2616,14 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kLevel)), level);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kTransitionTime)), transitionTime);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -2285,6 +2662,14 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kMoveMode)), moveMode);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kRate)), rate);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -2324,6 +2709,15 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kStepMode)), stepMode);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kStepSize)), stepSize);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kTransitionTime)), transitionTime);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -2363,6 +2757,12 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -2468,6 +2868,14 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kAlarmCode)), alarmCode);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kClusterId)), clusterId);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -2506,6 +2914,14 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kAlarmCode)), alarmCode);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kClusterId)), clusterId);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -2542,6 +2958,12 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -2576,6 +2998,16 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kStatus)), status);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kAlarmCode)), alarmCode);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kClusterId)), clusterId);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kTimeStamp)), timeStamp);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -2618,6 +3050,12 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -2648,6 +3086,12 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -2835,6 +3279,16 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kPowerProfileId)), powerProfileId);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kEnergyPhaseId)), energyPhaseId);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kPowerProfileRemoteControl)), powerProfileRemoteControl);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kPowerProfileState)), powerProfileState);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -2881,6 +3335,14 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kEnergyPhaseId)), energyPhaseId);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kScheduledTime)), scheduledTime);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -2926,6 +3388,18 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kEnergyPhaseId)), energyPhaseId);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kMacroPhaseId)), macroPhaseId);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kExpectedDuration)), expectedDuration);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kPeakPower)), peakPower);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kEnergy)), energy);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kMaxActivationDelay)), maxActivationDelay);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -2980,6 +3454,13 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kPowerProfileId)), powerProfileId);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -3018,6 +3499,16 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kTotalProfileNum)), totalProfileNum);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kPowerProfileId)), powerProfileId);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kNumOfTransferredPhases)), numOfTransferredPhases);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kTransferredPhases)), transferredPhases);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -3060,6 +3551,12 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -3095,6 +3592,16 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kTotalProfileNum)), totalProfileNum);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kPowerProfileId)), powerProfileId);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kNumOfTransferredPhases)), numOfTransferredPhases);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kTransferredPhases)), transferredPhases);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -3142,6 +3649,16 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kPowerProfileId)), powerProfileId);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kCurrency)), currency);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kPrice)), price);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kPriceTrailingDigit)), priceTrailingDigit);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -3187,6 +3704,14 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kPowerProfileCount)), powerProfileCount);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kPowerProfileRecords)), powerProfileRecords);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -3227,6 +3752,15 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kCurrency)), currency);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kPrice)), price);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kPriceTrailingDigit)), priceTrailingDigit);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -3267,6 +3801,13 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kPowerProfileId)), powerProfileId);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -3304,6 +3845,15 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kPowerProfileId)), powerProfileId);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kNumOfScheduledPhases)), numOfScheduledPhases);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kScheduledPhases)), scheduledPhases);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -3346,6 +3896,14 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kPowerProfileCount)), powerProfileCount);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kPowerProfileRecords)), powerProfileRecords);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -3386,6 +3944,15 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kPowerProfileId)), powerProfileId);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kNumOfScheduledPhases)), numOfScheduledPhases);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kScheduledPhases)), scheduledPhases);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -3425,6 +3992,12 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -3456,6 +4029,13 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kPowerProfileId)), powerProfileId);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -3490,6 +4070,13 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kPowerProfileId)), powerProfileId);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -3524,6 +4111,13 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kPowerProfileId)), powerProfileId);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -3561,6 +4155,15 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kPowerProfileId)), powerProfileId);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kNumOfScheduledPhases)), numOfScheduledPhases);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kScheduledPhases)), scheduledPhases);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -3605,6 +4208,16 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kPowerProfileId)), powerProfileId);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kCurrency)), currency);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kPrice)), price);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kPriceTrailingDigit)), priceTrailingDigit);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -3651,6 +4264,15 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kPowerProfileId)), powerProfileId);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kNumOfScheduledPhases)), numOfScheduledPhases);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kScheduledPhases)), scheduledPhases);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -3693,6 +4315,15 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kPowerProfileId)), powerProfileId);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kStartAfter)), startAfter);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kStopBefore)), stopBefore);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -3735,6 +4366,15 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kPowerProfileId)), powerProfileId);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kStartAfter)), startAfter);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kStopBefore)), stopBefore);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -3778,6 +4418,15 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kOptions)), options);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kPowerProfileId)), powerProfileId);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kPowerProfileStartTime)), powerProfileStartTime);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -3864,6 +4513,13 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kCommandId)), commandId);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -3901,6 +4557,16 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kApplianceStatus)), applianceStatus);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kRemoteEnableFlagsAndDeviceStatus2)),
+                                   remoteEnableFlagsAndDeviceStatus2);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kApplianceStatus2)), applianceStatus2);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -3940,6 +4606,12 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -3974,6 +4646,16 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kApplianceStatus)), applianceStatus);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kRemoteEnableFlagsAndDeviceStatus2)),
+                                   remoteEnableFlagsAndDeviceStatus2);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kApplianceStatus2)), applianceStatus2);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -4016,6 +4698,15 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kFunctionId)), functionId);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kFunctionDataType)), functionDataType);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kFunctionData)), functionData);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -4055,6 +4746,12 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -4085,6 +4782,12 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -4116,6 +4819,13 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kWarningEvent)), warningEvent);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -4221,6 +4931,14 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kType)), type);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kRevision)), revision);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -4309,6 +5027,16 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kNodeId)), nodeId);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kGroupId)), groupId);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kEndpointId)), endpointId);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kClusterId)), clusterId);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -4355,6 +5083,16 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kNodeId)), nodeId);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kGroupId)), groupId);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kEndpointId)), endpointId);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kClusterId)), clusterId);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -4430,6 +5168,15 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kCluster)), cluster);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kEndpoint)), endpoint);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kDeviceType)), deviceType);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -4476,6 +5223,17 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kFabricIndex)), fabricIndex);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kPrivilege)), privilege);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kAuthMode)), authMode);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kSubjects)), subjects);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kTargets)), targets);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -4525,6 +5283,14 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kFabricIndex)), fabricIndex);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kData)), data);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -4603,6 +5369,12 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -4635,6 +5407,14 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kStartFastPolling)), startFastPolling);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kFastPollTimeout)), fastPollTimeout);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -4671,6 +5451,12 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -4703,6 +5489,13 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kNewLongPollInterval)), newLongPollInterval);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -4738,6 +5531,13 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kNewShortPollInterval)), newShortPollInterval);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -4828,6 +5628,18 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kActionID)), actionID);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kName)), name);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kType)), type);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kEndpointListID)), endpointListID);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kSupportedCommands)), supportedCommands);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kStatus)), status);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -4882,6 +5694,16 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kEndpointListID)), endpointListID);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kName)), name);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kType)), type);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kEndpoints)), endpoints);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -4931,6 +5753,14 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kActionID)), actionID);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kInvokeID)), invokeID);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -4970,6 +5800,15 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kActionID)), actionID);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kInvokeID)), invokeID);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kTransitionTime)), transitionTime);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -5011,6 +5850,14 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kActionID)), actionID);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kInvokeID)), invokeID);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -5050,6 +5897,15 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kActionID)), actionID);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kInvokeID)), invokeID);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kDuration)), duration);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -5091,6 +5947,14 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kActionID)), actionID);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kInvokeID)), invokeID);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -5129,6 +5993,14 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kActionID)), actionID);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kInvokeID)), invokeID);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -5168,6 +6040,15 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kActionID)), actionID);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kInvokeID)), invokeID);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kDuration)), duration);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -5209,6 +6090,14 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kActionID)), actionID);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kInvokeID)), invokeID);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -5247,6 +6136,14 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kActionID)), actionID);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kInvokeID)), invokeID);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -5286,6 +6183,15 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kActionID)), actionID);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kInvokeID)), invokeID);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kDuration)), duration);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -5327,6 +6233,14 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kActionID)), actionID);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kInvokeID)), invokeID);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -5366,6 +6280,15 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kActionID)), actionID);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kInvokeID)), invokeID);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kDuration)), duration);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -5442,6 +6365,15 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kActionID)), actionID);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kInvokeID)), invokeID);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kNewState)), newState);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -5485,6 +6417,16 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kActionID)), actionID);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kInvokeID)), invokeID);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kNewState)), newState);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kError)), error);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -5533,6 +6475,12 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -5646,6 +6594,13 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kSoftwareVersion)), softwareVersion);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -5679,6 +6634,12 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -5709,6 +6670,12 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -5740,6 +6707,13 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kReachableNewValue)), reachableNewValue);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -5790,6 +6764,20 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kVendorId)), vendorId);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kProductId)), productId);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kSoftwareVersion)), softwareVersion);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kProtocolsSupported)), protocolsSupported);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kHardwareVersion)), hardwareVersion);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kLocation)), location);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kRequestorCanConsent)), requestorCanConsent);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kMetadataForProvider)), metadataForProvider);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -5854,6 +6842,20 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kStatus)), status);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kDelayedActionTime)), delayedActionTime);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kImageURI)), imageURI);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kSoftwareVersion)), softwareVersion);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kSoftwareVersionString)), softwareVersionString);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kUpdateToken)), updateToken);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kUserConsentNeeded)), userConsentNeeded);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kMetadataForRequestor)), metadataForRequestor);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -5910,6 +6912,14 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kUpdateToken)), updateToken);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kNewVersion)), newVersion);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -5948,6 +6958,14 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kAction)), action);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kDelayedActionTime)), delayedActionTime);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -5986,6 +7004,14 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kUpdateToken)), updateToken);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kSoftwareVersion)), softwareVersion);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -6055,6 +7081,15 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kFabricIndex)), fabricIndex);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kProviderNodeID)), providerNodeID);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kEndpoint)), endpoint);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -6105,6 +7140,17 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kProviderNodeId)), providerNodeId);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kVendorId)), vendorId);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kAnnouncementReason)), announcementReason);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kMetadataForNode)), metadataForNode);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kEndpoint)), endpoint);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -6192,6 +7238,16 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kPreviousState)), previousState);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kNewState)), newState);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kReason)), reason);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kTargetSoftwareVersion)), targetSoftwareVersion);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -6236,6 +7292,14 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kSoftwareVersion)), softwareVersion);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kProductID)), productID);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -6276,6 +7340,16 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kSoftwareVersion)), softwareVersion);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kBytesDownloaded)), bytesDownloaded);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kProgressPercent)), progressPercent);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kPlatformCode)), platformCode);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -6576,6 +7650,13 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kFailSafeExpiryLengthMs)), failSafeExpiryLengthMs);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -6618,6 +7699,15 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kExpiryLengthSeconds)), expiryLengthSeconds);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kBreadcrumb)), breadcrumb);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kTimeoutMs)), timeoutMs);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -6659,6 +7749,14 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kErrorCode)), errorCode);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kDebugText)), debugText);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -6699,6 +7797,16 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kLocation)), location);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kCountryCode)), countryCode);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kBreadcrumb)), breadcrumb);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kTimeoutMs)), timeoutMs);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -6743,6 +7851,14 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kErrorCode)), errorCode);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kDebugText)), debugText);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -6779,6 +7895,12 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -6811,6 +7933,14 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kErrorCode)), errorCode);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kDebugText)), debugText);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -6891,6 +8021,14 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kNetworkID)), networkID);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kConnected)), connected);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -6937,6 +8075,20 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kPanId)), panId);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kExtendedPanId)), extendedPanId);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kNetworkName)), networkName);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kChannel)), channel);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kVersion)), version);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kExtendedAddress)), extendedAddress);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kRssi)), rssi);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kLqi)), lqi);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -6999,6 +8151,18 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kSecurity)), security);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kSsid)), ssid);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kBssid)), bssid);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kChannel)), channel);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kWiFiBand)), wiFiBand);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kRssi)), rssi);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -7054,6 +8218,14 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kSsid)), ssid);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kBreadcrumb)), breadcrumb);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -7094,6 +8266,16 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kNetworkingStatus)), networkingStatus);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kDebugText)), debugText);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kWiFiScanResults)), wiFiScanResults);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kThreadScanResults)), threadScanResults);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -7139,6 +8321,15 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kSsid)), ssid);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kCredentials)), credentials);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kBreadcrumb)), breadcrumb);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -7181,6 +8372,14 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kOperationalDataset)), operationalDataset);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kBreadcrumb)), breadcrumb);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -7219,6 +8418,14 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kNetworkID)), networkID);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kBreadcrumb)), breadcrumb);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -7257,6 +8464,14 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kNetworkingStatus)), networkingStatus);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kDebugText)), debugText);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -7295,6 +8510,14 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kNetworkID)), networkID);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kBreadcrumb)), breadcrumb);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -7334,6 +8557,15 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kNetworkingStatus)), networkingStatus);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kDebugText)), debugText);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kErrorValue)), errorValue);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -7376,6 +8608,15 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kNetworkID)), networkID);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kNetworkIndex)), networkIndex);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kBreadcrumb)), breadcrumb);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -7474,6 +8715,15 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kIntent)), intent);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kRequestedProtocol)), requestedProtocol);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kTransferFileDesignator)), transferFileDesignator);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -7517,6 +8767,16 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kStatus)), status);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kContent)), content);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kTimeStamp)), timeStamp);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kTimeSinceBoot)), timeSinceBoot);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -7597,6 +8857,20 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kName)), name);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kFabricConnected)), fabricConnected);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kOffPremiseServicesReachableIPv4)),
+                                   offPremiseServicesReachableIPv4);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kOffPremiseServicesReachableIPv6)),
+                                   offPremiseServicesReachableIPv6);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kHardwareAddress)), hardwareAddress);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kType)), type);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -7701,6 +8975,14 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kCurrent)), current);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kPrevious)), previous);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -7739,6 +9021,14 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kCurrent)), current);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kPrevious)), previous);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -7777,6 +9067,14 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kCurrent)), current);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kPrevious)), previous);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -7814,6 +9112,13 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kBootReason)), bootReason);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -7855,6 +9160,15 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kId)), id);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kName)), name);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kFaultRecording)), faultRecording);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -7901,6 +9215,17 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kId)), id);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kName)), name);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kStackFreeCurrent)), stackFreeCurrent);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kStackFreeMinimum)), stackFreeMinimum);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kStackSize)), stackSize);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -7951,6 +9276,12 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -8019,6 +9350,13 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kSoftwareFault)), softwareFault);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -8071,6 +9409,26 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kExtAddress)), extAddress);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kAge)), age);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kRloc16)), rloc16);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kLinkFrameCounter)), linkFrameCounter);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kMleFrameCounter)), mleFrameCounter);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kLqi)), lqi);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kAverageRssi)), averageRssi);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kLastRssi)), lastRssi);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kFrameErrorRate)), frameErrorRate);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kMessageErrorRate)), messageErrorRate);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kRxOnWhenIdle)), rxOnWhenIdle);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kFullThreadDevice)), fullThreadDevice);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kFullNetworkData)), fullNetworkData);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kIsChild)), isChild);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -8164,6 +9522,24 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kActiveTimestampPresent)), activeTimestampPresent);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kPendingTimestampPresent)), pendingTimestampPresent);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kMasterKeyPresent)), masterKeyPresent);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kNetworkNamePresent)), networkNamePresent);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kExtendedPanIdPresent)), extendedPanIdPresent);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kMeshLocalPrefixPresent)), meshLocalPrefixPresent);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kDelayPresent)), delayPresent);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kPanIdPresent)), panIdPresent);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kChannelPresent)), channelPresent);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kPskcPresent)), pskcPresent);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kSecurityPolicyPresent)), securityPolicyPresent);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kChannelMaskPresent)), channelMaskPresent);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -8242,6 +9618,22 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kExtAddress)), extAddress);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kRloc16)), rloc16);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kRouterId)), routerId);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kNextHop)), nextHop);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kPathCost)), pathCost);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kLQIIn)), LQIIn);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kLQIOut)), LQIOut);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kAge)), age);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kAllocated)), allocated);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kLinkEstablished)), linkEstablished);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -8306,6 +9698,14 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kRotationTime)), rotationTime);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kFlags)), flags);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -8347,6 +9747,12 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -8592,6 +9998,13 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kConnectionStatus)), connectionStatus);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -8631,6 +10044,12 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -8726,6 +10145,13 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kReasonCode)), reasonCode);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -8762,6 +10188,14 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kAssociationFailure)), associationFailure);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kStatus)), status);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -8799,6 +10233,13 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kConnectionStatus)), connectionStatus);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -8838,6 +10279,12 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -8957,6 +10404,12 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -8987,6 +10440,12 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -9017,6 +10476,12 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -9047,6 +10512,12 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -9188,6 +10659,13 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kNewPosition)), newPosition);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -9222,6 +10700,13 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kNewPosition)), newPosition);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -9256,6 +10741,13 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kNewPosition)), newPosition);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -9290,6 +10782,13 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kPreviousPosition)), previousPosition);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -9324,6 +10823,13 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kPreviousPosition)), previousPosition);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -9360,6 +10866,15 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kNewPosition)), newPosition);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kCurrentNumberOfPressesCounted)),
+                                   currentNumberOfPressesCounted);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -9399,6 +10914,15 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kNewPosition)), newPosition);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kTotalNumberOfPressesCounted)),
+                                   totalNumberOfPressesCounted);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -9448,6 +10972,18 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kCommissioningTimeout)), commissioningTimeout);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kPAKEVerifier)), PAKEVerifier);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kDiscriminator)), discriminator);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kIterations)), iterations);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kSalt)), salt);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kPasscodeID)), passcodeID);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -9498,6 +11034,13 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kCommissioningTimeout)), commissioningTimeout);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -9531,6 +11074,12 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -9606,6 +11155,18 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kFabricIndex)), fabricIndex);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kRootPublicKey)), rootPublicKey);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kVendorId)), vendorId);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kFabricId)), fabricId);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kNodeId)), nodeId);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kLabel)), label);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -9658,6 +11219,14 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kFabricIndex)), fabricIndex);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kNoc)), noc);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -9700,6 +11269,13 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kAttestationNonce)), attestationNonce);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -9736,6 +11312,14 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kAttestationElements)), attestationElements);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kSignature)), signature);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -9773,6 +11357,13 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kCertificateType)), certificateType);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -9807,6 +11398,13 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kCertificate)), certificate);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -9841,6 +11439,13 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kCSRNonce)), CSRNonce);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -9877,6 +11482,14 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kNOCSRElements)), NOCSRElements);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kAttestationSignature)), attestationSignature);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -9918,6 +11531,17 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kNOCValue)), NOCValue);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kICACValue)), ICACValue);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kIPKValue)), IPKValue);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kCaseAdminNode)), caseAdminNode);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kAdminVendorId)), adminVendorId);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -9965,6 +11589,14 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kNOCValue)), NOCValue);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kICACValue)), ICACValue);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -10004,6 +11636,15 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kStatusCode)), statusCode);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kFabricIndex)), fabricIndex);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kDebugText)), debugText);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -10044,6 +11685,13 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kLabel)), label);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -10078,6 +11726,13 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kFabricIndex)), fabricIndex);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -10112,6 +11767,13 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kRootCertificate)), rootCertificate);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -10147,6 +11809,13 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kTrustedRootIdentifier)), trustedRootIdentifier);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -10229,6 +11898,16 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kFabricIndex)), fabricIndex);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kGroupId)), groupId);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kEndpoints)), endpoints);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kGroupName)), groupName);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -10276,6 +11955,15 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kFabricIndex)), fabricIndex);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kGroupId)), groupId);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kGroupKeySetID)), groupKeySetID);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -10325,6 +12013,20 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kGroupKeySetID)), groupKeySetID);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kSecurityPolicy)), securityPolicy);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kEpochKey0)), epochKey0);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kEpochStartTime0)), epochStartTime0);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kEpochKey1)), epochKey1);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kEpochStartTime1)), epochStartTime1);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kEpochKey2)), epochKey2);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kEpochStartTime2)), epochStartTime2);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -10385,6 +12087,13 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kGroupKeySet)), groupKeySet);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -10419,6 +12128,13 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kGroupKeySetID)), groupKeySetID);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -10453,6 +12169,13 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kGroupKeySet)), groupKeySet);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -10487,6 +12210,13 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kGroupKeySetID)), groupKeySetID);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -10521,6 +12251,13 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kGroupKeySetIDs)), groupKeySetIDs);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -10555,6 +12292,13 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kGroupKeySetIDs)), groupKeySetIDs);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -10632,6 +12376,14 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kLabel)), label);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kValue)), value);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -10708,6 +12460,14 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kLabel)), label);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kValue)), value);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -10905,6 +12665,13 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kStateValue)), stateValue);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -10946,6 +12713,15 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kLabel)), label);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kMode)), mode);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kSemanticTag)), semanticTag);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -10989,6 +12765,14 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kMfgCode)), mfgCode);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kValue)), value);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -11031,6 +12815,13 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kNewMode)), newMode);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -11157,6 +12948,14 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kCredentialType)), credentialType);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kCredentialIndex)), credentialIndex);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -11199,6 +12998,13 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kPinCode)), pinCode);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -11233,6 +13039,13 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kPinCode)), pinCode);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -11268,6 +13081,14 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kTimeout)), timeout);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kPinCode)), pinCode);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -11305,6 +13126,13 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kLogIndex)), logIndex);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -11346,6 +13174,19 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kLogEntryId)), logEntryId);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kTimestamp)), timestamp);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kEventType)), eventType);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kSource)), source);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kEventIdOrAlarmCode)), eventIdOrAlarmCode);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kUserId)), userId);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kPin)), pin);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -11401,6 +13242,16 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kUserId)), userId);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kUserStatus)), userStatus);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kUserType)), userType);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kPin)), pin);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -11444,6 +13295,13 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kUserId)), userId);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -11481,6 +13339,16 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kUserId)), userId);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kUserStatus)), userStatus);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kUserType)), userType);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kPin)), pin);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -11524,6 +13392,13 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kPinSlotIndex)), pinSlotIndex);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -11557,6 +13432,12 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -11589,6 +13470,14 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kUserId)), userId);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kUserStatus)), userStatus);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -11626,6 +13515,13 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kUserId)), userId);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -11661,6 +13557,14 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kUserId)), userId);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kUserStatus)), userStatus);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -11704,6 +13608,19 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kWeekDayIndex)), weekDayIndex);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kUserIndex)), userIndex);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kDaysMask)), daysMask);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kStartHour)), startHour);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kStartMinute)), startMinute);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kEndHour)), endHour);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kEndMinute)), endMinute);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -11757,6 +13674,14 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kWeekDayIndex)), weekDayIndex);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kUserIndex)), userIndex);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -11801,6 +13726,20 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kWeekDayIndex)), weekDayIndex);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kUserIndex)), userIndex);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kStatus)), status);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kDaysMask)), daysMask);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kStartHour)), startHour);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kStartMinute)), startMinute);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kEndHour)), endHour);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kEndMinute)), endMinute);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -11857,6 +13796,14 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kWeekDayIndex)), weekDayIndex);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kUserIndex)), userIndex);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -11897,6 +13844,16 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kYearDayIndex)), yearDayIndex);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kUserIndex)), userIndex);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kLocalStartTime)), localStartTime);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kLocalEndTime)), localEndTime);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -11941,6 +13898,14 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kYearDayIndex)), yearDayIndex);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kUserIndex)), userIndex);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -11982,6 +13947,17 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kYearDayIndex)), yearDayIndex);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kUserIndex)), userIndex);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kStatus)), status);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kLocalStartTime)), localStartTime);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kLocalEndTime)), localEndTime);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -12029,6 +14005,14 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kYearDayIndex)), yearDayIndex);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kUserIndex)), userIndex);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -12069,6 +14053,16 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kHolidayIndex)), holidayIndex);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kLocalStartTime)), localStartTime);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kLocalEndTime)), localEndTime);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kOperatingMode)), operatingMode);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -12112,6 +14106,13 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kHolidayIndex)), holidayIndex);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -12150,6 +14151,17 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kHolidayIndex)), holidayIndex);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kStatus)), status);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kLocalStartTime)), localStartTime);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kLocalEndTime)), localEndTime);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kOperatingMode)), operatingMode);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -12196,6 +14208,13 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kHolidayIndex)), holidayIndex);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -12231,6 +14250,14 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kUserId)), userId);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kUserType)), userType);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -12268,6 +14295,13 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kUserId)), userId);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -12303,6 +14337,14 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kUserId)), userId);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kUserType)), userType);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -12343,6 +14385,16 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kUserId)), userId);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kUserStatus)), userStatus);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kUserType)), userType);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kRfidCode)), rfidCode);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -12386,6 +14438,13 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kUserId)), userId);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -12423,6 +14482,16 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kUserId)), userId);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kUserStatus)), userStatus);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kUserType)), userType);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kRfidCode)), rfidCode);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -12466,6 +14535,13 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kRfidSlotIndex)), rfidSlotIndex);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -12499,6 +14575,12 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -12536,6 +14618,19 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kOperationType)), operationType);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kUserIndex)), userIndex);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kUserName)), userName);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kUserUniqueId)), userUniqueId);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kUserStatus)), userStatus);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kUserType)), userType);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kCredentialRule)), credentialRule);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -12588,6 +14683,13 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kUserIndex)), userIndex);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -12633,6 +14735,22 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kUserIndex)), userIndex);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kUserName)), userName);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kUserUniqueId)), userUniqueId);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kUserStatus)), userStatus);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kUserType)), userType);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kCredentialRule)), credentialRule);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kCredentials)), credentials);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kCreatorFabricIndex)), creatorFabricIndex);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kLastModifiedFabricIndex)), lastModifiedFabricIndex);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kNextUserIndex)), nextUserIndex);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -12694,6 +14812,13 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kUserIndex)), userIndex);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -12735,6 +14860,18 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kOperationEventSource)), operationEventSource);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kOperationEventCode)), operationEventCode);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kUserId)), userId);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kPin)), pin);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kLocalTime)), localTime);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kData)), data);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -12792,6 +14929,20 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kProgramEventSource)), programEventSource);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kProgramEventCode)), programEventCode);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kUserId)), userId);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kPin)), pin);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kUserType)), userType);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kUserStatus)), userStatus);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kLocalTime)), localTime);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kData)), data);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -12851,6 +15002,17 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kOperationType)), operationType);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kCredential)), credential);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kCredentialData)), credentialData);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kUserIndex)), userIndex);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kUserStatus)), userStatus);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -12900,6 +15062,15 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kStatus)), status);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kUserIndex)), userIndex);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kNextCredentialIndex)), nextCredentialIndex);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -12940,6 +15111,13 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kCredential)), credential);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -12977,6 +15155,15 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kCredentialExists)), credentialExists);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kUserIndex)), userIndex);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kNextCredentialIndex)), nextCredentialIndex);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -13017,6 +15204,13 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kCredential)), credential);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -13211,6 +15405,13 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kAlarmCode)), alarmCode);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -13245,6 +15446,13 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kDoorState)), doorState);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -13284,6 +15492,18 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kLockOperationType)), lockOperationType);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kOperationSource)), operationSource);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kUserIndex)), userIndex);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kFabricIndex)), fabricIndex);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kSourceNode)), sourceNode);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kCredentials)), credentials);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -13339,6 +15559,19 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kLockOperationType)), lockOperationType);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kOperationSource)), operationSource);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kOperationError)), operationError);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kUserIndex)), userIndex);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kFabricIndex)), fabricIndex);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kSourceNode)), sourceNode);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kCredentials)), credentials);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -13397,6 +15630,19 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kLockDataType)), lockDataType);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kDataOperationType)), dataOperationType);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kOperationSource)), operationSource);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kUserIndex)), userIndex);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kFabricIndex)), fabricIndex);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kSourceNode)), sourceNode);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kDataIndex)), dataIndex);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -13454,6 +15700,12 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -13484,6 +15736,12 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -13514,6 +15772,12 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -13545,6 +15809,13 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kLiftValue)), liftValue);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -13582,6 +15853,14 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kLiftPercentageValue)), liftPercentageValue);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kLiftPercent100thsValue)), liftPercent100thsValue);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -13619,6 +15898,13 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kTiltValue)), tiltValue);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -13656,6 +15942,14 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kTiltPercentageValue)), tiltPercentageValue);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kTiltPercent100thsValue)), tiltPercent100thsValue);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -13790,6 +16084,13 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kPercentOpen)), percentOpen);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -13823,6 +16124,12 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -14011,6 +16318,12 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -14041,6 +16354,12 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -14071,6 +16390,12 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -14101,6 +16426,12 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -14131,6 +16462,12 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -14161,6 +16498,12 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -14191,6 +16534,12 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -14221,6 +16570,12 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -14251,6 +16606,12 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -14281,6 +16642,12 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -14311,6 +16678,12 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -14341,6 +16714,12 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -14371,6 +16750,12 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -14401,6 +16786,12 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -14431,6 +16822,12 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -14461,6 +16858,12 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -14491,6 +16894,12 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -14529,6 +16938,14 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kMode)), mode);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kAmount)), amount);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -14571,6 +16988,17 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kNumberOfTransitionsForSequence)),
+                                   numberOfTransitionsForSequence);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kDayOfWeekForSequence)), dayOfWeekForSequence);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kModeForSequence)), modeForSequence);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kPayload)), payload);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -14619,6 +17047,17 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kNumberOfTransitionsForSequence)),
+                                   numberOfTransitionsForSequence);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kDayOfWeekForSequence)), dayOfWeekForSequence);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kModeForSequence)), modeForSequence);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kPayload)), payload);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -14668,6 +17107,18 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kTimeOfDay)), timeOfDay);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kRelayStatus)), relayStatus);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kLocalTemperature)), localTemperature);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kHumidityInPercentage)), humidityInPercentage);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kSetpoint)), setpoint);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kUnreadEntries)), unreadEntries);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -14718,6 +17169,14 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kDaysToReturn)), daysToReturn);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kModeToReturn)), modeToReturn);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -14754,6 +17213,12 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -14784,6 +17249,12 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -15111,6 +17582,17 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kHue)), hue);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kDirection)), direction);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kTransitionTime)), transitionTime);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kOptionsMask)), optionsMask);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kOptionsOverride)), optionsOverride);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -15160,6 +17642,16 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kMoveMode)), moveMode);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kRate)), rate);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kOptionsMask)), optionsMask);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kOptionsOverride)), optionsOverride);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -15207,6 +17699,17 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kStepMode)), stepMode);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kStepSize)), stepSize);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kTransitionTime)), transitionTime);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kOptionsMask)), optionsMask);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kOptionsOverride)), optionsOverride);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -15256,6 +17759,16 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kSaturation)), saturation);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kTransitionTime)), transitionTime);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kOptionsMask)), optionsMask);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kOptionsOverride)), optionsOverride);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -15302,6 +17815,16 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kMoveMode)), moveMode);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kRate)), rate);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kOptionsMask)), optionsMask);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kOptionsOverride)), optionsOverride);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -15349,6 +17872,17 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kStepMode)), stepMode);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kStepSize)), stepSize);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kTransitionTime)), transitionTime);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kOptionsMask)), optionsMask);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kOptionsOverride)), optionsOverride);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -15399,6 +17933,17 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kHue)), hue);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kSaturation)), saturation);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kTransitionTime)), transitionTime);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kOptionsMask)), optionsMask);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kOptionsOverride)), optionsOverride);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -15449,6 +17994,17 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kColorX)), colorX);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kColorY)), colorY);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kTransitionTime)), transitionTime);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kOptionsMask)), optionsMask);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kOptionsOverride)), optionsOverride);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -15498,6 +18054,16 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kRateX)), rateX);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kRateY)), rateY);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kOptionsMask)), optionsMask);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kOptionsOverride)), optionsOverride);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -15545,6 +18111,17 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kStepX)), stepX);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kStepY)), stepY);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kTransitionTime)), transitionTime);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kOptionsMask)), optionsMask);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kOptionsOverride)), optionsOverride);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -15594,6 +18171,16 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kColorTemperature)), colorTemperature);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kTransitionTime)), transitionTime);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kOptionsMask)), optionsMask);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kOptionsOverride)), optionsOverride);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -15641,6 +18228,17 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kEnhancedHue)), enhancedHue);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kDirection)), direction);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kTransitionTime)), transitionTime);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kOptionsMask)), optionsMask);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kOptionsOverride)), optionsOverride);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -15690,6 +18288,16 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kMoveMode)), moveMode);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kRate)), rate);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kOptionsMask)), optionsMask);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kOptionsOverride)), optionsOverride);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -15737,6 +18345,17 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kStepMode)), stepMode);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kStepSize)), stepSize);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kTransitionTime)), transitionTime);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kOptionsMask)), optionsMask);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kOptionsOverride)), optionsOverride);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -15787,6 +18406,17 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kEnhancedHue)), enhancedHue);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kSaturation)), saturation);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kTransitionTime)), transitionTime);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kOptionsMask)), optionsMask);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kOptionsOverride)), optionsOverride);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -15839,6 +18469,19 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kUpdateFlags)), updateFlags);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kAction)), action);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kDirection)), direction);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kTime)), time);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kStartHue)), startHue);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kOptionsMask)), optionsMask);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kOptionsOverride)), optionsOverride);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -15892,6 +18535,14 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kOptionsMask)), optionsMask);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kOptionsOverride)), optionsOverride);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -15936,6 +18587,18 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kMoveMode)), moveMode);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kRate)), rate);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kColorTemperatureMinimum)), colorTemperatureMinimum);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kColorTemperatureMaximum)), colorTemperatureMaximum);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kOptionsMask)), optionsMask);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kOptionsOverride)), optionsOverride);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -15993,6 +18656,19 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kStepMode)), stepMode);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kStepSize)), stepSize);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kTransitionTime)), transitionTime);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kColorTemperatureMinimum)), colorTemperatureMinimum);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kColorTemperatureMaximum)), colorTemperatureMaximum);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kOptionsMask)), optionsMask);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kOptionsOverride)), optionsOverride);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -17903,6 +20579,14 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kEnrollResponseCode)), enrollResponseCode);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kZoneId)), zoneId);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -17943,6 +20627,16 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kZoneStatus)), zoneStatus);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kExtendedStatus)), extendedStatus);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kZoneId)), zoneId);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kDelay)), delay);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -17985,6 +20679,12 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -18017,6 +20717,14 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kZoneType)), zoneType);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kManufacturerCode)), manufacturerCode);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -18056,6 +20764,15 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kTestModeDuration)), testModeDuration);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kCurrentZoneSensitivityLevel)),
+                                   currentZoneSensitivityLevel);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -18092,6 +20809,12 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -18122,6 +20845,12 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -18205,6 +20934,14 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kZoneId)), zoneId);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kZoneStatus)), zoneStatus);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -18249,6 +20986,15 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kArmMode)), armMode);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kArmDisarmCode)), armDisarmCode);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kZoneId)), zoneId);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -18289,6 +21035,13 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kArmNotification)), armNotification);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -18325,6 +21078,15 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kNumberOfZones)), numberOfZones);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kZoneIds)), zoneIds);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kArmDisarmCode)), armDisarmCode);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -18380,6 +21142,28 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kSection0)), section0);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kSection1)), section1);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kSection2)), section2);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kSection3)), section3);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kSection4)), section4);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kSection5)), section5);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kSection6)), section6);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kSection7)), section7);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kSection8)), section8);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kSection9)), section9);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kSection10)), section10);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kSection11)), section11);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kSection12)), section12);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kSection13)), section13);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kSection14)), section14);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kSection15)), section15);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -18458,6 +21242,12 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -18492,6 +21282,16 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kZoneId)), zoneId);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kZoneType)), zoneType);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kIeeeAddress)), ieeeAddress);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kZoneLabel)), zoneLabel);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -18534,6 +21334,12 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -18569,6 +21375,16 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kZoneId)), zoneId);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kZoneStatus)), zoneStatus);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kAudibleNotification)), audibleNotification);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kZoneLabel)), zoneLabel);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -18611,6 +21427,12 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -18646,6 +21468,16 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kPanelStatus)), panelStatus);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kSecondsRemaining)), secondsRemaining);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kAudibleNotification)), audibleNotification);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kAlarmStatus)), alarmStatus);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -18688,6 +21520,12 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -18723,6 +21561,16 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kPanelStatus)), panelStatus);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kSecondsRemaining)), secondsRemaining);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kAudibleNotification)), audibleNotification);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kAlarmStatus)), alarmStatus);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -18766,6 +21614,13 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kZoneId)), zoneId);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -18801,6 +21656,14 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kNumberOfZones)), numberOfZones);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kZoneIds)), zoneIds);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -18837,6 +21700,12 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -18869,6 +21738,14 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kNumberOfZones)), numberOfZones);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kBypassResult)), bypassResult);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -18905,6 +21782,12 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -18939,6 +21822,15 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kZoneStatusComplete)), zoneStatusComplete);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kNumberOfZones)), numberOfZones);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kZoneStatusResult)), zoneStatusResult);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -18984,6 +21876,16 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kStartingZoneId)), startingZoneId);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kMaxNumberOfZoneIds)), maxNumberOfZoneIds);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kZoneStatusMaskFlag)), zoneStatusMaskFlag);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kZoneStatusMask)), zoneStatusMask);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -19061,6 +21963,16 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kWarningInfo)), warningInfo);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kWarningDuration)), warningDuration);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kStrobeDutyCycle)), strobeDutyCycle);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kStrobeLevel)), strobeLevel);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -19104,6 +22016,13 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kSquawkInfo)), squawkInfo);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -19209,6 +22128,17 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kMajorNumber)), majorNumber);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kMinorNumber)), minorNumber);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kName)), name);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kCallSign)), callSign);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kAffiliateCallSign)), affiliateCallSign);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -19260,6 +22190,16 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kOperatorName)), operatorName);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kLineupName)), lineupName);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kPostalCode)), postalCode);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kLineupInfoType)), lineupInfoType);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -19308,6 +22248,13 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kMatch)), match);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -19343,6 +22290,14 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kChannelMatch)), channelMatch);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kErrorType)), errorType);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -19381,6 +22336,14 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kMajorNumber)), majorNumber);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kMinorNumber)), minorNumber);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -19418,6 +22381,13 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kCount)), count);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -19492,6 +22462,14 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kIdentifier)), identifier);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kName)), name);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -19535,6 +22513,14 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kTarget)), target);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kData)), data);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -19573,6 +22559,14 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kStatus)), status);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kData)), data);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -19647,6 +22641,14 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kUpdatedAt)), updatedAt);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kPosition)), position);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -19688,6 +22690,12 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -19720,6 +22728,13 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kMediaPlaybackStatus)), mediaPlaybackStatus);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -19753,6 +22768,12 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -19785,6 +22806,13 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kMediaPlaybackStatus)), mediaPlaybackStatus);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -19818,6 +22846,12 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -19850,6 +22884,13 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kMediaPlaybackStatus)), mediaPlaybackStatus);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -19883,6 +22924,12 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -19915,6 +22962,13 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kMediaPlaybackStatus)), mediaPlaybackStatus);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -19948,6 +23002,12 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -19980,6 +23040,13 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kMediaPlaybackStatus)), mediaPlaybackStatus);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -20013,6 +23080,12 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -20045,6 +23118,13 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kMediaPlaybackStatus)), mediaPlaybackStatus);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -20078,6 +23158,12 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -20110,6 +23196,13 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kMediaPlaybackStatus)), mediaPlaybackStatus);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -20143,6 +23236,12 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -20175,6 +23274,13 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kMediaPlaybackStatus)), mediaPlaybackStatus);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -20210,6 +23316,13 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kDeltaPositionMilliseconds)), deltaPositionMilliseconds);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -20245,6 +23358,13 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kMediaPlaybackStatus)), mediaPlaybackStatus);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -20280,6 +23400,13 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kDeltaPositionMilliseconds)), deltaPositionMilliseconds);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -20315,6 +23442,13 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kMediaPlaybackStatus)), mediaPlaybackStatus);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -20349,6 +23483,13 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kPosition)), position);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -20384,6 +23525,13 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kMediaPlaybackStatus)), mediaPlaybackStatus);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -20472,6 +23620,16 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kIndex)), index);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kInputType)), inputType);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kName)), name);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kDescription)), description);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -20520,6 +23678,13 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kIndex)), index);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -20553,6 +23718,12 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -20583,6 +23754,12 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -20615,6 +23792,14 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kIndex)), index);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kName)), name);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -20688,6 +23873,12 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -20750,6 +23941,13 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kKeyCode)), keyCode);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -20784,6 +23982,13 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kStatus)), status);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -20850,6 +24055,15 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kWidth)), width);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kHeight)), height);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kMetric)), metric);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -20893,6 +24107,14 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kName)), name);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kValue)), value);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -20934,6 +24156,15 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kType)), type);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kValue)), value);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kExternalIDList)), externalIDList);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -20978,6 +24209,15 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kImageUrl)), imageUrl);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kColor)), color);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kSize)), size);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -21025,6 +24265,18 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kProviderName)), providerName);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kBackground)), background);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kLogo)), logo);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kProgressBar)), progressBar);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kSplash)), splash);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kWaterMark)), waterMark);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -21081,6 +24333,15 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kAutoPlay)), autoPlay);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kData)), data);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kSearch)), search);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -21123,6 +24384,14 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kContentLaunchStatus)), contentLaunchStatus);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kData)), data);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -21163,6 +24432,15 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kContentURL)), contentURL);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kDisplayString)), displayString);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kBrandingInformation)), brandingInformation);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -21205,6 +24483,14 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kContentLaunchStatus)), contentLaunchStatus);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kData)), data);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -21280,6 +24566,15 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kIndex)), index);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kOutputType)), outputType);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kName)), name);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -21325,6 +24620,13 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kIndex)), index);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -21360,6 +24662,14 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kIndex)), index);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kName)), name);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -21434,6 +24744,14 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kCatalogVendorId)), catalogVendorId);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kApplicationId)), applicationId);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -21474,6 +24792,14 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kApplication)), application);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kEndpoint)), endpoint);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -21517,6 +24843,14 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kData)), data);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kApplication)), application);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -21555,6 +24889,14 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kStatus)), status);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kData)), data);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -21592,6 +24934,13 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kApplication)), application);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -21627,6 +24976,14 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kStatus)), status);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kData)), data);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -21664,6 +25021,13 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kApplication)), application);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -21699,6 +25063,14 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kStatus)), status);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kData)), data);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -21773,6 +25145,14 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kCatalogVendorId)), catalogVendorId);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kApplicationId)), applicationId);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -21815,6 +25195,13 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kStatus)), status);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -21902,6 +25289,13 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kTempAccountIdentifier)), tempAccountIdentifier);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -21936,6 +25330,13 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kSetupPIN)), setupPIN);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -21972,6 +25373,14 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kTempAccountIdentifier)), tempAccountIdentifier);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kSetupPIN)), setupPIN);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -22008,6 +25417,12 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -22076,6 +25491,20 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kA)), a);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kB)), b);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kC)), c);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kD)), d);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kE)), e);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kF)), f);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kG)), g);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kH)), h);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -22148,6 +25577,24 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kNullableInt)), nullableInt);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kOptionalInt)), optionalInt);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kNullableOptionalInt)), nullableOptionalInt);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kNullableString)), nullableString);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kOptionalString)), optionalString);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kNullableOptionalString)), nullableOptionalString);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kNullableStruct)), nullableStruct);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kOptionalStruct)), optionalStruct);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kNullableOptionalStruct)), nullableOptionalStruct);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kNullableList)), nullableList);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kOptionalList)), optionalList);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kNullableOptionalList)), nullableOptionalList);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -22219,6 +25666,15 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kA)), a);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kB)), b);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kC)), c);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -22267,6 +25723,19 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kA)), a);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kB)), b);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kC)), c);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kD)), d);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kE)), e);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kF)), f);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kG)), g);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -22321,6 +25790,13 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kA)), a);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -22358,6 +25834,14 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kFabricIndex)), fabricIndex);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kOperationalCert)), operationalCert);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -22399,6 +25883,12 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -22430,6 +25920,13 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kReturnValue)), returnValue);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -22463,6 +25960,12 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -22494,6 +25997,13 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kReturnValue)), returnValue);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -22527,6 +26037,12 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -22558,6 +26074,13 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kReturnValue)), returnValue);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -22591,6 +26114,12 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -22627,6 +26156,18 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kArg1)), arg1);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kArg2)), arg2);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kArg3)), arg3);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kArg4)), arg4);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kArg5)), arg5);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kArg6)), arg6);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -22677,6 +26218,14 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kArg1)), arg1);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kArg2)), arg2);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -22714,6 +26263,13 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kArg1)), arg1);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -22748,6 +26304,13 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kArg1)), arg1);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -22783,6 +26346,14 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kArg1)), arg1);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kArg2)), arg2);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -22825,6 +26396,18 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kArg1)), arg1);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kArg2)), arg2);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kArg3)), arg3);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kArg4)), arg4);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kArg5)), arg5);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kArg6)), arg6);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -22877,6 +26460,16 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kWasPresent)), wasPresent);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kWasNull)), wasNull);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kValue)), value);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kOriginalValue)), originalValue);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -22920,6 +26513,13 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kArg1)), arg1);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -23005,6 +26605,49 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kNullableIntWasNull)), nullableIntWasNull);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kNullableIntValue)), nullableIntValue);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kOptionalIntWasPresent)), optionalIntWasPresent);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kOptionalIntValue)), optionalIntValue);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kNullableOptionalIntWasPresent)),
+                                   nullableOptionalIntWasPresent);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kNullableOptionalIntWasNull)), nullableOptionalIntWasNull);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kNullableOptionalIntValue)), nullableOptionalIntValue);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kNullableStringWasNull)), nullableStringWasNull);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kNullableStringValue)), nullableStringValue);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kOptionalStringWasPresent)), optionalStringWasPresent);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kOptionalStringValue)), optionalStringValue);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kNullableOptionalStringWasPresent)),
+                                   nullableOptionalStringWasPresent);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kNullableOptionalStringWasNull)),
+                                   nullableOptionalStringWasNull);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kNullableOptionalStringValue)),
+                                   nullableOptionalStringValue);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kNullableStructWasNull)), nullableStructWasNull);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kNullableStructValue)), nullableStructValue);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kOptionalStructWasPresent)), optionalStructWasPresent);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kOptionalStructValue)), optionalStructValue);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kNullableOptionalStructWasPresent)),
+                                   nullableOptionalStructWasPresent);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kNullableOptionalStructWasNull)),
+                                   nullableOptionalStructWasNull);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kNullableOptionalStructValue)),
+                                   nullableOptionalStructValue);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kNullableListWasNull)), nullableListWasNull);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kNullableListValue)), nullableListValue);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kOptionalListWasPresent)), optionalListWasPresent);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kOptionalListValue)), optionalListValue);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kNullableOptionalListWasPresent)),
+                                   nullableOptionalListWasPresent);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kNullableOptionalListWasNull)),
+                                   nullableOptionalListWasNull);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kNullableOptionalListValue)), nullableOptionalListValue);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -23120,6 +26763,13 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kArg1)), arg1);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -23154,6 +26804,13 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kValue)), value);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -23188,6 +26845,13 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kArg1)), arg1);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -23222,6 +26886,13 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kArg1)), arg1);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -23256,6 +26927,13 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kArg1)), arg1);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -23290,6 +26968,13 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kValue)), value);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -23324,6 +27009,13 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kArg1)), arg1);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -23358,6 +27050,13 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kArg1)), arg1);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -23392,6 +27091,13 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kArg1)), arg1);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -23427,6 +27133,14 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kArg1)), arg1);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kArg2)), arg2);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -23464,6 +27178,13 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kArg1)), arg1);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -23513,6 +27234,24 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kNullableInt)), nullableInt);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kOptionalInt)), optionalInt);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kNullableOptionalInt)), nullableOptionalInt);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kNullableString)), nullableString);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kOptionalString)), optionalString);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kNullableOptionalString)), nullableOptionalString);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kNullableStruct)), nullableStruct);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kOptionalStruct)), optionalStruct);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kNullableOptionalStruct)), nullableOptionalStruct);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kNullableList)), nullableList);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kOptionalList)), optionalList);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kNullableOptionalList)), nullableOptionalList);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -23580,6 +27319,13 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kArg1)), arg1);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -23613,6 +27359,12 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -23644,6 +27396,13 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kArg1)), arg1);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -23680,6 +27439,15 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kArg1)), arg1);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kArg2)), arg2);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kArg3)), arg3);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -23984,6 +27752,18 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kArg1)), arg1);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kArg2)), arg2);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kArg3)), arg3);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kArg4)), arg4);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kArg5)), arg5);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kArg6)), arg6);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -24045,6 +27825,19 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kMessageId)), messageId);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kMessageControl)), messageControl);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kStartTime)), startTime);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kDurationInMinutes)), durationInMinutes);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kMessage)), message);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kOptionalExtendedMessageControl)),
+                                   optionalExtendedMessageControl);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -24093,6 +27886,12 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -24125,6 +27924,14 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kMessageId)), messageId);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kMessageControl)), messageControl);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -24166,6 +27973,16 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kMessageId)), messageId);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kConfirmationTime)), confirmationTime);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kMessageConfirmationControl)), messageConfirmationControl);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kMessageResponse)), messageResponse);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -24215,6 +28032,19 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kMessageId)), messageId);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kMessageControl)), messageControl);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kStartTime)), startTime);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kDurationInMinutes)), durationInMinutes);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kMessage)), message);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kOptionalExtendedMessageControl)),
+                                   optionalExtendedMessageControl);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -24265,6 +28095,13 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kEarliestImplementationTime)), earliestImplementationTime);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -24300,6 +28137,13 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kImplementationDateTime)), implementationDateTime);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -24498,6 +28342,12 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -24530,6 +28380,14 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kAlertsCount)), alertsCount);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kAlertStructures)), alertStructures);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -24568,6 +28426,14 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kAlertsCount)), alertsCount);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kAlertStructures)), alertStructures);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -24606,6 +28472,14 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kEventHeader)), eventHeader);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kEventId)), eventId);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -24677,6 +28551,16 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kTimeStamp)), timeStamp);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kLogId)), logId);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kLogLength)), logLength);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kLogPayload)), logPayload);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -24720,6 +28604,13 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kLogId)), logId);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -24757,6 +28648,16 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kTimeStamp)), timeStamp);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kLogId)), logId);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kLogLength)), logLength);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kLogPayload)), logPayload);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -24799,6 +28700,12 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -24831,6 +28738,14 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kLogQueueSize)), logQueueSize);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kLogIds)), logIds);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -24869,6 +28784,14 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kLogQueueSize)), logQueueSize);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kLogIds)), logIds);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -24948,6 +28871,16 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kProfileCount)), profileCount);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kProfileIntervalPeriod)), profileIntervalPeriod);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kMaxNumberOfIntervals)), maxNumberOfIntervals);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kListOfAttributes)), listOfAttributes);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -24990,6 +28923,12 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -25028,6 +28967,18 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kStartTime)), startTime);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kStatus)), status);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kProfileIntervalPeriod)), profileIntervalPeriod);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kNumberOfIntervalsDelivered)), numberOfIntervalsDelivered);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kAttributeId)), attributeId);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kIntervals)), intervals);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -25079,6 +29030,15 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
     return CHIP_NO_ERROR;
 }
 
+size_t Type::EncodedSize(TLV::Tag tag) const
+{
+    size_t size = TLV::EncodedContainerOverhead(tag);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kAttributeId)), attributeId);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kStartTime)), startTime);
+    size += DataModel::EncodedSize(TLV::ContextTag(to_underlying(Fields::kNumberOfIntervals)), numberOfIntervals);
+    return size;
+}
+
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -1094,6 +1094,7 @@ public:
     uint16_t identifyTime;
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
 
     using ResponseType = DataModel::NullObjectType;
 
@@ -1126,6 +1127,7 @@ public:
     uint16_t timeout;
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
 
     using ResponseType = DataModel::NullObjectType;
 
@@ -1155,6 +1157,7 @@ public:
     static constexpr ClusterId GetClusterId() { return Clusters::Identify::Id; }
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
 
     using ResponseType = Clusters::Identify::Commands::IdentifyQueryResponse::DecodableType;
 
@@ -1188,6 +1191,7 @@ public:
     IdentifyEffectVariant effectVariant;
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
 
     using ResponseType = DataModel::NullObjectType;
 
@@ -1363,6 +1367,7 @@ public:
     chip::CharSpan groupName;
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
 
     using ResponseType = Clusters::Groups::Commands::AddGroupResponse::DecodableType;
 
@@ -1398,6 +1403,7 @@ public:
     uint16_t groupId;
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
 
     using ResponseType = DataModel::NullObjectType;
 
@@ -1431,6 +1437,7 @@ public:
     uint16_t groupId;
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
 
     using ResponseType = Clusters::Groups::Commands::ViewGroupResponse::DecodableType;
 
@@ -1467,6 +1474,7 @@ public:
     chip::CharSpan groupName;
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
 
     using ResponseType = DataModel::NullObjectType;
 
@@ -1501,6 +1509,7 @@ public:
     DataModel::List<const uint16_t> groupList;
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
 
     using ResponseType = Clusters::Groups::Commands::GetGroupMembershipResponse::DecodableType;
 
@@ -1535,6 +1544,7 @@ public:
     DataModel::List<const uint16_t> groupList;
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
 
     using ResponseType = DataModel::NullObjectType;
 
@@ -1568,6 +1578,7 @@ public:
     uint16_t groupId;
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
 
     using ResponseType = Clusters::Groups::Commands::RemoveGroupResponse::DecodableType;
 
@@ -1602,6 +1613,7 @@ public:
     uint16_t groupId;
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
 
     using ResponseType = DataModel::NullObjectType;
 
@@ -1632,6 +1644,7 @@ public:
     static constexpr ClusterId GetClusterId() { return Clusters::Groups::Id; }
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
 
     using ResponseType = DataModel::NullObjectType;
 
@@ -1665,6 +1678,7 @@ public:
     chip::CharSpan groupName;
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
 
     using ResponseType = DataModel::NullObjectType;
 
@@ -1776,6 +1790,7 @@ public:
     uint8_t value;
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
     CHIP_ERROR Decode(TLV::TLVReader & reader);
 };
 
@@ -1909,6 +1924,7 @@ public:
     DataModel::List<const Structs::SceneExtensionFieldSet::Type> extensionFieldSets;
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
 
     using ResponseType = Clusters::Scenes::Commands::AddSceneResponse::DecodableType;
 
@@ -1949,6 +1965,7 @@ public:
     uint8_t sceneId;
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
 
     using ResponseType = DataModel::NullObjectType;
 
@@ -1985,6 +2002,7 @@ public:
     uint8_t sceneId;
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
 
     using ResponseType = Clusters::Scenes::Commands::ViewSceneResponse::DecodableType;
 
@@ -2028,6 +2046,7 @@ public:
     DataModel::List<const Structs::SceneExtensionFieldSet::Type> extensionFieldSets;
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
 
     using ResponseType = DataModel::NullObjectType;
 
@@ -2067,6 +2086,7 @@ public:
     uint8_t sceneId;
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
 
     using ResponseType = Clusters::Scenes::Commands::RemoveSceneResponse::DecodableType;
 
@@ -2104,6 +2124,7 @@ public:
     uint8_t sceneId;
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
 
     using ResponseType = DataModel::NullObjectType;
 
@@ -2138,6 +2159,7 @@ public:
     uint16_t groupId;
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
 
     using ResponseType = Clusters::Scenes::Commands::RemoveAllScenesResponse::DecodableType;
 
@@ -2172,6 +2194,7 @@ public:
     uint16_t groupId;
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
 
     using ResponseType = DataModel::NullObjectType;
 
@@ -2207,6 +2230,7 @@ public:
     uint8_t sceneId;
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
 
     using ResponseType = Clusters::Scenes::Commands::StoreSceneResponse::DecodableType;
 
@@ -2244,6 +2268,7 @@ public:
     uint8_t sceneId;
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
 
     using ResponseType = DataModel::NullObjectType;
 
@@ -2282,6 +2307,7 @@ public:
     uint16_t transitionTime;
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
 
     using ResponseType = DataModel::NullObjectType;
 
@@ -2316,6 +2342,7 @@ public:
     uint16_t groupId;
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
 
     using ResponseType = Clusters::Scenes::Commands::GetSceneMembershipResponse::DecodableType;
 
@@ -2356,6 +2383,7 @@ public:
     DataModel::List<const uint8_t> sceneList;
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
 
     using ResponseType = DataModel::NullObjectType;
 
@@ -2400,6 +2428,7 @@ public:
     DataModel::List<const Structs::SceneExtensionFieldSet::Type> extensionFieldSets;
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
 
     using ResponseType = Clusters::Scenes::Commands::EnhancedAddSceneResponse::DecodableType;
 
@@ -2440,6 +2469,7 @@ public:
     uint8_t sceneId;
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
 
     using ResponseType = DataModel::NullObjectType;
 
@@ -2476,6 +2506,7 @@ public:
     uint8_t sceneId;
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
 
     using ResponseType = Clusters::Scenes::Commands::EnhancedViewSceneResponse::DecodableType;
 
@@ -2519,6 +2550,7 @@ public:
     DataModel::List<const Structs::SceneExtensionFieldSet::Type> extensionFieldSets;
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
 
     using ResponseType = DataModel::NullObjectType;
 
@@ -2564,6 +2596,7 @@ public:
     uint8_t sceneIdTo;
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
 
     using ResponseType = Clusters::Scenes::Commands::CopySceneResponse::DecodableType;
 
@@ -2604,6 +2637,7 @@ public:
     uint8_t sceneIdFrom;
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
 
     using ResponseType = DataModel::NullObjectType;
 
@@ -2849,6 +2883,7 @@ public:
     static constexpr ClusterId GetClusterId() { return Clusters::OnOff::Id; }
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
 
     using ResponseType = DataModel::NullObjectType;
 
@@ -2877,6 +2912,7 @@ public:
     static constexpr ClusterId GetClusterId() { return Clusters::OnOff::Id; }
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
 
     using ResponseType = DataModel::NullObjectType;
 
@@ -2905,6 +2941,7 @@ public:
     static constexpr ClusterId GetClusterId() { return Clusters::OnOff::Id; }
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
 
     using ResponseType = DataModel::NullObjectType;
 
@@ -2938,6 +2975,7 @@ public:
     OnOffDelayedAllOffEffectVariant effectVariant;
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
 
     using ResponseType = DataModel::NullObjectType;
 
@@ -2968,6 +3006,7 @@ public:
     static constexpr ClusterId GetClusterId() { return Clusters::OnOff::Id; }
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
 
     using ResponseType = DataModel::NullObjectType;
 
@@ -3003,6 +3042,7 @@ public:
     uint16_t offWaitTime;
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
 
     using ResponseType = DataModel::NullObjectType;
 
@@ -3318,6 +3358,7 @@ public:
     uint8_t optionOverride;
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
 
     using ResponseType = DataModel::NullObjectType;
 
@@ -3359,6 +3400,7 @@ public:
     uint8_t optionOverride;
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
 
     using ResponseType = DataModel::NullObjectType;
 
@@ -3402,6 +3444,7 @@ public:
     uint8_t optionOverride;
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
 
     using ResponseType = DataModel::NullObjectType;
 
@@ -3440,6 +3483,7 @@ public:
     uint8_t optionOverride;
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
 
     using ResponseType = DataModel::NullObjectType;
 
@@ -3475,6 +3519,7 @@ public:
     uint16_t transitionTime;
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
 
     using ResponseType = DataModel::NullObjectType;
 
@@ -3510,6 +3555,7 @@ public:
     uint8_t rate;
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
 
     using ResponseType = DataModel::NullObjectType;
 
@@ -3547,6 +3593,7 @@ public:
     uint16_t transitionTime;
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
 
     using ResponseType = DataModel::NullObjectType;
 
@@ -3578,6 +3625,7 @@ public:
     static constexpr ClusterId GetClusterId() { return Clusters::LevelControl::Id; }
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
 
     using ResponseType = DataModel::NullObjectType;
 
@@ -3887,6 +3935,7 @@ public:
     chip::ClusterId clusterId;
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
 
     using ResponseType = DataModel::NullObjectType;
 
@@ -3922,6 +3971,7 @@ public:
     chip::ClusterId clusterId;
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
 
     using ResponseType = DataModel::NullObjectType;
 
@@ -3952,6 +4002,7 @@ public:
     static constexpr ClusterId GetClusterId() { return Clusters::Alarms::Id; }
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
 
     using ResponseType = DataModel::NullObjectType;
 
@@ -3989,6 +4040,7 @@ public:
     uint32_t timeStamp;
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
 
     using ResponseType = DataModel::NullObjectType;
 
@@ -4021,6 +4073,7 @@ public:
     static constexpr ClusterId GetClusterId() { return Clusters::Alarms::Id; }
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
 
     using ResponseType = Clusters::Alarms::Commands::GetAlarmResponse::DecodableType;
 
@@ -4049,6 +4102,7 @@ public:
     static constexpr ClusterId GetClusterId() { return Clusters::Alarms::Id; }
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
 
     using ResponseType = DataModel::NullObjectType;
 
@@ -4513,6 +4567,7 @@ public:
     uint8_t powerProfileState;
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
     CHIP_ERROR Decode(TLV::TLVReader & reader);
 };
 
@@ -4533,6 +4588,7 @@ public:
     uint16_t scheduledTime;
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
     CHIP_ERROR Decode(TLV::TLVReader & reader);
 };
 
@@ -4561,6 +4617,7 @@ public:
     uint16_t maxActivationDelay;
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
     CHIP_ERROR Decode(TLV::TLVReader & reader);
 };
 
@@ -4696,6 +4753,7 @@ public:
     uint8_t powerProfileId;
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
 
     using ResponseType = Clusters::PowerProfile::Commands::PowerProfileResponse::DecodableType;
 
@@ -4734,6 +4792,7 @@ public:
     DataModel::List<const Structs::TransferredPhase::Type> transferredPhases;
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
 
     using ResponseType = DataModel::NullObjectType;
 
@@ -4766,6 +4825,7 @@ public:
     static constexpr ClusterId GetClusterId() { return Clusters::PowerProfile::Id; }
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
 
     using ResponseType = Clusters::PowerProfile::Commands::PowerProfileStateResponse::DecodableType;
 
@@ -4803,6 +4863,7 @@ public:
     DataModel::List<const Structs::TransferredPhase::Type> transferredPhases;
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
 
     using ResponseType = DataModel::NullObjectType;
 
@@ -4844,6 +4905,7 @@ public:
     uint8_t priceTrailingDigit;
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
 
     using ResponseType = DataModel::NullObjectType;
 
@@ -4881,6 +4943,7 @@ public:
     DataModel::List<const Structs::PowerProfileRecord::Type> powerProfileRecords;
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
 
     using ResponseType = DataModel::NullObjectType;
 
@@ -4918,6 +4981,7 @@ public:
     uint8_t priceTrailingDigit;
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
 
     using ResponseType = DataModel::NullObjectType;
 
@@ -4952,6 +5016,7 @@ public:
     uint8_t powerProfileId;
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
 
     using ResponseType = Clusters::PowerProfile::Commands::GetPowerProfilePriceResponse::DecodableType;
 
@@ -4988,6 +5053,7 @@ public:
     DataModel::List<const Structs::ScheduledPhase::Type> scheduledPhases;
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
 
     using ResponseType = DataModel::NullObjectType;
 
@@ -5024,6 +5090,7 @@ public:
     DataModel::List<const Structs::PowerProfileRecord::Type> powerProfileRecords;
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
 
     using ResponseType = DataModel::NullObjectType;
 
@@ -5061,6 +5128,7 @@ public:
     DataModel::List<const Structs::ScheduledPhase::Type> scheduledPhases;
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
 
     using ResponseType = DataModel::NullObjectType;
 
@@ -5092,6 +5160,7 @@ public:
     static constexpr ClusterId GetClusterId() { return Clusters::PowerProfile::Id; }
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
 
     using ResponseType = Clusters::PowerProfile::Commands::GetOverallSchedulePriceResponse::DecodableType;
 
@@ -5123,6 +5192,7 @@ public:
     uint8_t powerProfileId;
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
 
     using ResponseType = Clusters::PowerProfile::Commands::PowerProfileScheduleConstraintsResponse::DecodableType;
 
@@ -5155,6 +5225,7 @@ public:
     uint8_t powerProfileId;
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
 
     using ResponseType = Clusters::PowerProfile::Commands::EnergyPhasesScheduleResponse::DecodableType;
 
@@ -5187,6 +5258,7 @@ public:
     uint8_t powerProfileId;
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
 
     using ResponseType = Clusters::PowerProfile::Commands::EnergyPhasesScheduleStateResponse::DecodableType;
 
@@ -5223,6 +5295,7 @@ public:
     DataModel::List<const Structs::ScheduledPhase::Type> scheduledPhases;
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
 
     using ResponseType = DataModel::NullObjectType;
 
@@ -5263,6 +5336,7 @@ public:
     uint8_t priceTrailingDigit;
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
 
     using ResponseType = DataModel::NullObjectType;
 
@@ -5302,6 +5376,7 @@ public:
     DataModel::List<const Structs::ScheduledPhase::Type> scheduledPhases;
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
 
     using ResponseType = DataModel::NullObjectType;
 
@@ -5340,6 +5415,7 @@ public:
     uint16_t stopBefore;
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
 
     using ResponseType = DataModel::NullObjectType;
 
@@ -5378,6 +5454,7 @@ public:
     uint16_t stopBefore;
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
 
     using ResponseType = DataModel::NullObjectType;
 
@@ -5416,6 +5493,7 @@ public:
     uint16_t powerProfileStartTime;
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
 
     using ResponseType = Clusters::PowerProfile::Commands::GetPowerProfilePriceExtendedResponse::DecodableType;
 
@@ -5669,6 +5747,7 @@ public:
     CommandIdentification commandId;
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
 
     using ResponseType = DataModel::NullObjectType;
 
@@ -5705,6 +5784,7 @@ public:
     ApplianceStatus applianceStatus2;
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
 
     using ResponseType = DataModel::NullObjectType;
 
@@ -5736,6 +5816,7 @@ public:
     static constexpr ClusterId GetClusterId() { return Clusters::ApplianceControl::Id; }
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
 
     using ResponseType = Clusters::ApplianceControl::Commands::SignalStateResponse::DecodableType;
 
@@ -5771,6 +5852,7 @@ public:
     ApplianceStatus applianceStatus2;
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
 
     using ResponseType = DataModel::NullObjectType;
 
@@ -5809,6 +5891,7 @@ public:
     DataModel::List<const uint8_t> functionData;
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
 
     using ResponseType = DataModel::NullObjectType;
 
@@ -5840,6 +5923,7 @@ public:
     static constexpr ClusterId GetClusterId() { return Clusters::ApplianceControl::Id; }
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
 
     using ResponseType = DataModel::NullObjectType;
 
@@ -5868,6 +5952,7 @@ public:
     static constexpr ClusterId GetClusterId() { return Clusters::ApplianceControl::Id; }
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
 
     using ResponseType = DataModel::NullObjectType;
 
@@ -5899,6 +5984,7 @@ public:
     WarningEvent warningEvent;
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
 
     using ResponseType = DataModel::NullObjectType;
 
@@ -6083,6 +6169,7 @@ public:
     uint16_t revision;
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
     CHIP_ERROR Decode(TLV::TLVReader & reader);
 };
 
@@ -6238,6 +6325,7 @@ public:
     chip::ClusterId clusterId;
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
 
     using ResponseType = DataModel::NullObjectType;
 
@@ -6279,6 +6367,7 @@ public:
     chip::ClusterId clusterId;
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
 
     using ResponseType = DataModel::NullObjectType;
 
@@ -6389,6 +6478,7 @@ public:
     DataModel::Nullable<uint32_t> deviceType;
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
     CHIP_ERROR Decode(TLV::TLVReader & reader);
 };
 
@@ -6415,6 +6505,7 @@ public:
     DataModel::Nullable<DataModel::List<const Structs::Target::Type>> targets;
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
     bool MatchesFabricIndex(FabricIndex fabricIndex_) const { return fabricIndex == fabricIndex_; }
 };
 
@@ -6444,6 +6535,7 @@ public:
     chip::ByteSpan data;
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
     CHIP_ERROR Decode(TLV::TLVReader & reader);
     bool MatchesFabricIndex(FabricIndex fabricIndex_) const { return fabricIndex == fabricIndex_; }
 };
@@ -6583,6 +6675,7 @@ public:
     static constexpr ClusterId GetClusterId() { return Clusters::PollControl::Id; }
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
 
     using ResponseType = Clusters::PollControl::Commands::CheckInResponse::DecodableType;
 
@@ -6616,6 +6709,7 @@ public:
     uint16_t fastPollTimeout;
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
 
     using ResponseType = DataModel::NullObjectType;
 
@@ -6646,6 +6740,7 @@ public:
     static constexpr ClusterId GetClusterId() { return Clusters::PollControl::Id; }
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
 
     using ResponseType = DataModel::NullObjectType;
 
@@ -6677,6 +6772,7 @@ public:
     uint32_t newLongPollInterval;
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
 
     using ResponseType = DataModel::NullObjectType;
 
@@ -6709,6 +6805,7 @@ public:
     uint16_t newShortPollInterval;
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
 
     using ResponseType = DataModel::NullObjectType;
 
@@ -6946,6 +7043,7 @@ public:
     ActionStateEnum status;
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
     CHIP_ERROR Decode(TLV::TLVReader & reader);
 };
 
@@ -6970,6 +7068,7 @@ public:
     DataModel::List<const chip::EndpointId> endpoints;
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
 };
 
 struct DecodableType
@@ -7069,6 +7168,7 @@ public:
     Optional<uint32_t> invokeID;
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
 
     using ResponseType = DataModel::NullObjectType;
 
@@ -7106,6 +7206,7 @@ public:
     uint16_t transitionTime;
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
 
     using ResponseType = DataModel::NullObjectType;
 
@@ -7142,6 +7243,7 @@ public:
     Optional<uint32_t> invokeID;
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
 
     using ResponseType = DataModel::NullObjectType;
 
@@ -7179,6 +7281,7 @@ public:
     uint32_t duration;
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
 
     using ResponseType = DataModel::NullObjectType;
 
@@ -7215,6 +7318,7 @@ public:
     Optional<uint32_t> invokeID;
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
 
     using ResponseType = DataModel::NullObjectType;
 
@@ -7250,6 +7354,7 @@ public:
     Optional<uint32_t> invokeID;
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
 
     using ResponseType = DataModel::NullObjectType;
 
@@ -7287,6 +7392,7 @@ public:
     uint32_t duration;
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
 
     using ResponseType = DataModel::NullObjectType;
 
@@ -7323,6 +7429,7 @@ public:
     Optional<uint32_t> invokeID;
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
 
     using ResponseType = DataModel::NullObjectType;
 
@@ -7358,6 +7465,7 @@ public:
     Optional<uint32_t> invokeID;
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
 
     using ResponseType = DataModel::NullObjectType;
 
@@ -7395,6 +7503,7 @@ public:
     uint32_t duration;
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
 
     using ResponseType = DataModel::NullObjectType;
 
@@ -7431,6 +7540,7 @@ public:
     Optional<uint32_t> invokeID;
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
 
     using ResponseType = DataModel::NullObjectType;
 
@@ -7468,6 +7578,7 @@ public:
     uint32_t duration;
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
 
     using ResponseType = DataModel::NullObjectType;
 
@@ -7608,6 +7719,7 @@ public:
     ActionStateEnum newState;
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
 };
 
 struct DecodableType
@@ -7649,6 +7761,7 @@ public:
     ActionErrorEnum error;
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
 };
 
 struct DecodableType
@@ -7694,6 +7807,7 @@ public:
     static constexpr ClusterId GetClusterId() { return Clusters::Basic::Id; }
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
 
     using ResponseType = DataModel::NullObjectType;
 
@@ -8031,6 +8145,7 @@ public:
     uint32_t softwareVersion;
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
 };
 
 struct DecodableType
@@ -8061,6 +8176,7 @@ public:
     static constexpr ClusterId GetClusterId() { return Clusters::Basic::Id; }
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
 };
 
 struct DecodableType
@@ -8089,6 +8205,7 @@ public:
     static constexpr ClusterId GetClusterId() { return Clusters::Basic::Id; }
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
 };
 
 struct DecodableType
@@ -8120,6 +8237,7 @@ public:
     bool reachableNewValue;
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
 };
 
 struct DecodableType
@@ -8234,6 +8352,7 @@ public:
     Optional<chip::ByteSpan> metadataForProvider;
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
 
     using ResponseType = Clusters::OtaSoftwareUpdateProvider::Commands::QueryImageResponse::DecodableType;
 
@@ -8287,6 +8406,7 @@ public:
     Optional<chip::ByteSpan> metadataForRequestor;
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
 
     using ResponseType = DataModel::NullObjectType;
 
@@ -8328,6 +8448,7 @@ public:
     uint32_t newVersion;
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
 
     using ResponseType = Clusters::OtaSoftwareUpdateProvider::Commands::ApplyUpdateResponse::DecodableType;
 
@@ -8363,6 +8484,7 @@ public:
     uint32_t delayedActionTime;
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
 
     using ResponseType = DataModel::NullObjectType;
 
@@ -8398,6 +8520,7 @@ public:
     uint32_t softwareVersion;
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
 
     using ResponseType = DataModel::NullObjectType;
 
@@ -8537,6 +8660,7 @@ public:
     chip::EndpointId endpoint;
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
     CHIP_ERROR Decode(TLV::TLVReader & reader);
     bool MatchesFabricIndex(FabricIndex fabricIndex_) const { return fabricIndex == fabricIndex_; }
 };
@@ -8581,6 +8705,7 @@ public:
     chip::EndpointId endpoint;
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
 
     using ResponseType = DataModel::NullObjectType;
 
@@ -8736,6 +8861,7 @@ public:
     DataModel::Nullable<uint32_t> targetSoftwareVersion;
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
 };
 
 struct DecodableType
@@ -8774,6 +8900,7 @@ public:
     uint16_t productID;
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
 };
 
 struct DecodableType
@@ -8814,6 +8941,7 @@ public:
     DataModel::Nullable<int64_t> platformCode;
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
 };
 
 struct DecodableType
@@ -9574,6 +9702,7 @@ public:
     uint32_t failSafeExpiryLengthMs;
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
     CHIP_ERROR Decode(TLV::TLVReader & reader);
 };
 
@@ -9638,6 +9767,7 @@ public:
     uint32_t timeoutMs;
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
 
     using ResponseType = Clusters::GeneralCommissioning::Commands::ArmFailSafeResponse::DecodableType;
 
@@ -9674,6 +9804,7 @@ public:
     chip::CharSpan debugText;
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
 
     using ResponseType = DataModel::NullObjectType;
 
@@ -9713,6 +9844,7 @@ public:
     uint32_t timeoutMs;
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
 
     using ResponseType = Clusters::GeneralCommissioning::Commands::SetRegulatoryConfigResponse::DecodableType;
 
@@ -9750,6 +9882,7 @@ public:
     chip::CharSpan debugText;
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
 
     using ResponseType = DataModel::NullObjectType;
 
@@ -9780,6 +9913,7 @@ public:
     static constexpr ClusterId GetClusterId() { return Clusters::GeneralCommissioning::Id; }
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
 
     using ResponseType = Clusters::GeneralCommissioning::Commands::CommissioningCompleteResponse::DecodableType;
 
@@ -9813,6 +9947,7 @@ public:
     chip::CharSpan debugText;
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
 
     using ResponseType = DataModel::NullObjectType;
 
@@ -9984,6 +10119,7 @@ public:
     bool connected;
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
     CHIP_ERROR Decode(TLV::TLVReader & reader);
 };
 
@@ -10016,6 +10152,7 @@ public:
     uint8_t lqi;
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
     CHIP_ERROR Decode(TLV::TLVReader & reader);
 };
 
@@ -10044,6 +10181,7 @@ public:
     int8_t rssi;
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
     CHIP_ERROR Decode(TLV::TLVReader & reader);
 };
 
@@ -10121,6 +10259,7 @@ public:
     uint64_t breadcrumb;
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
 
     using ResponseType = Clusters::NetworkCommissioning::Commands::ScanNetworksResponse::DecodableType;
 
@@ -10160,6 +10299,7 @@ public:
     DataModel::List<const Structs::ThreadInterfaceScanResult::Type> threadScanResults;
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
 
     using ResponseType = DataModel::NullObjectType;
 
@@ -10199,6 +10339,7 @@ public:
     uint64_t breadcrumb;
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
 
     using ResponseType = Clusters::NetworkCommissioning::Commands::NetworkConfigResponse::DecodableType;
 
@@ -10235,6 +10376,7 @@ public:
     uint64_t breadcrumb;
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
 
     using ResponseType = Clusters::NetworkCommissioning::Commands::NetworkConfigResponse::DecodableType;
 
@@ -10270,6 +10412,7 @@ public:
     uint64_t breadcrumb;
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
 
     using ResponseType = Clusters::NetworkCommissioning::Commands::NetworkConfigResponse::DecodableType;
 
@@ -10305,6 +10448,7 @@ public:
     chip::CharSpan debugText;
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
 
     using ResponseType = DataModel::NullObjectType;
 
@@ -10340,6 +10484,7 @@ public:
     uint64_t breadcrumb;
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
 
     using ResponseType = Clusters::NetworkCommissioning::Commands::ConnectNetworkResponse::DecodableType;
 
@@ -10377,6 +10522,7 @@ public:
     int32_t errorValue;
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
 
     using ResponseType = DataModel::NullObjectType;
 
@@ -10415,6 +10561,7 @@ public:
     uint64_t breadcrumb;
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
 
     using ResponseType = Clusters::NetworkCommissioning::Commands::NetworkConfigResponse::DecodableType;
 
@@ -10655,6 +10802,7 @@ public:
     chip::ByteSpan transferFileDesignator;
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
 
     using ResponseType = Clusters::DiagnosticLogs::Commands::RetrieveLogsResponse::DecodableType;
 
@@ -10695,6 +10843,7 @@ public:
     uint32_t timeSinceBoot;
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
 
     using ResponseType = DataModel::NullObjectType;
 
@@ -10879,6 +11028,7 @@ public:
     InterfaceType type;
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
     CHIP_ERROR Decode(TLV::TLVReader & reader);
 };
 
@@ -11068,6 +11218,7 @@ public:
     DataModel::List<const HardwareFaultType> previous;
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
 };
 
 struct DecodableType
@@ -11104,6 +11255,7 @@ public:
     DataModel::List<const RadioFaultType> previous;
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
 };
 
 struct DecodableType
@@ -11140,6 +11292,7 @@ public:
     DataModel::List<const NetworkFaultType> previous;
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
 };
 
 struct DecodableType
@@ -11174,6 +11327,7 @@ public:
     BootReasonType bootReason;
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
 };
 
 struct DecodableType
@@ -11209,6 +11363,7 @@ public:
     chip::ByteSpan faultRecording;
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
     CHIP_ERROR Decode(TLV::TLVReader & reader);
 };
 
@@ -11235,6 +11390,7 @@ public:
     uint32_t stackSize;
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
     CHIP_ERROR Decode(TLV::TLVReader & reader);
 };
 
@@ -11267,6 +11423,7 @@ public:
     static constexpr ClusterId GetClusterId() { return Clusters::SoftwareDiagnostics::Id; }
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
 
     using ResponseType = DataModel::NullObjectType;
 
@@ -11411,6 +11568,7 @@ public:
     Structs::SoftwareFault::Type softwareFault;
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
 };
 
 struct DecodableType
@@ -11499,6 +11657,7 @@ public:
     bool isChild;
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
     CHIP_ERROR Decode(TLV::TLVReader & reader);
 };
 
@@ -11539,6 +11698,7 @@ public:
     bool channelMaskPresent;
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
     CHIP_ERROR Decode(TLV::TLVReader & reader);
 };
 
@@ -11575,6 +11735,7 @@ public:
     bool linkEstablished;
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
     CHIP_ERROR Decode(TLV::TLVReader & reader);
 };
 
@@ -11595,6 +11756,7 @@ public:
     uint16_t flags;
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
     CHIP_ERROR Decode(TLV::TLVReader & reader);
 };
 
@@ -11627,6 +11789,7 @@ public:
     static constexpr ClusterId GetClusterId() { return Clusters::ThreadNetworkDiagnostics::Id; }
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
 
     using ResponseType = DataModel::NullObjectType;
 
@@ -12546,6 +12709,7 @@ public:
     ThreadConnectionStatus connectionStatus;
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
 };
 
 struct DecodableType
@@ -12634,6 +12798,7 @@ public:
     static constexpr ClusterId GetClusterId() { return Clusters::WiFiNetworkDiagnostics::Id; }
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
 
     using ResponseType = DataModel::NullObjectType;
 
@@ -12893,6 +13058,7 @@ public:
     uint16_t reasonCode;
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
 };
 
 struct DecodableType
@@ -12928,6 +13094,7 @@ public:
     uint16_t status;
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
 };
 
 struct DecodableType
@@ -12962,6 +13129,7 @@ public:
     WiFiConnectionStatus connectionStatus;
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
 };
 
 struct DecodableType
@@ -13024,6 +13192,7 @@ public:
     static constexpr ClusterId GetClusterId() { return Clusters::EthernetNetworkDiagnostics::Id; }
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
 
     using ResponseType = DataModel::NullObjectType;
 
@@ -13309,6 +13478,7 @@ public:
     static constexpr ClusterId GetClusterId() { return Clusters::BridgedDeviceBasic::Id; }
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
 
     using ResponseType = DataModel::NullObjectType;
 
@@ -13337,6 +13507,7 @@ public:
     static constexpr ClusterId GetClusterId() { return Clusters::BridgedDeviceBasic::Id; }
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
 
     using ResponseType = DataModel::NullObjectType;
 
@@ -13365,6 +13536,7 @@ public:
     static constexpr ClusterId GetClusterId() { return Clusters::BridgedDeviceBasic::Id; }
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
 
     using ResponseType = DataModel::NullObjectType;
 
@@ -13393,6 +13565,7 @@ public:
     static constexpr ClusterId GetClusterId() { return Clusters::BridgedDeviceBasic::Id; }
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
 
     using ResponseType = DataModel::NullObjectType;
 
@@ -13773,6 +13946,7 @@ public:
     uint8_t newPosition;
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
 };
 
 struct DecodableType
@@ -13806,6 +13980,7 @@ public:
     uint8_t newPosition;
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
 };
 
 struct DecodableType
@@ -13839,6 +14014,7 @@ public:
     uint8_t newPosition;
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
 };
 
 struct DecodableType
@@ -13872,6 +14048,7 @@ public:
     uint8_t previousPosition;
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
 };
 
 struct DecodableType
@@ -13905,6 +14082,7 @@ public:
     uint8_t previousPosition;
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
 };
 
 struct DecodableType
@@ -13940,6 +14118,7 @@ public:
     uint8_t currentNumberOfPressesCounted;
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
 };
 
 struct DecodableType
@@ -13976,6 +14155,7 @@ public:
     uint8_t totalNumberOfPressesCounted;
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
 };
 
 struct DecodableType
@@ -14062,6 +14242,7 @@ public:
     uint16_t passcodeID;
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
 
     using ResponseType = DataModel::NullObjectType;
 
@@ -14099,6 +14280,7 @@ public:
     uint16_t commissioningTimeout;
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
 
     using ResponseType = DataModel::NullObjectType;
 
@@ -14128,6 +14310,7 @@ public:
     static constexpr ClusterId GetClusterId() { return Clusters::AdministratorCommissioning::Id; }
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
 
     using ResponseType = DataModel::NullObjectType;
 
@@ -14283,6 +14466,7 @@ public:
     chip::CharSpan label;
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
     CHIP_ERROR Decode(TLV::TLVReader & reader);
 };
 
@@ -14303,6 +14487,7 @@ public:
     chip::ByteSpan noc;
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
     CHIP_ERROR Decode(TLV::TLVReader & reader);
 };
 
@@ -14398,6 +14583,7 @@ public:
     chip::ByteSpan attestationNonce;
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
 
     using ResponseType = Clusters::OperationalCredentials::Commands::AttestationResponse::DecodableType;
 
@@ -14432,6 +14618,7 @@ public:
     chip::ByteSpan signature;
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
 
     using ResponseType = DataModel::NullObjectType;
 
@@ -14465,6 +14652,7 @@ public:
     uint8_t certificateType;
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
 
     using ResponseType = Clusters::OperationalCredentials::Commands::CertificateChainResponse::DecodableType;
 
@@ -14497,6 +14685,7 @@ public:
     chip::ByteSpan certificate;
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
 
     using ResponseType = DataModel::NullObjectType;
 
@@ -14529,6 +14718,7 @@ public:
     chip::ByteSpan CSRNonce;
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
 
     using ResponseType = Clusters::OperationalCredentials::Commands::OpCSRResponse::DecodableType;
 
@@ -14563,6 +14753,7 @@ public:
     chip::ByteSpan attestationSignature;
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
 
     using ResponseType = DataModel::NullObjectType;
 
@@ -14604,6 +14795,7 @@ public:
     uint16_t adminVendorId;
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
 
     using ResponseType = Clusters::OperationalCredentials::Commands::NOCResponse::DecodableType;
 
@@ -14642,6 +14834,7 @@ public:
     Optional<chip::ByteSpan> ICACValue;
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
 
     using ResponseType = Clusters::OperationalCredentials::Commands::NOCResponse::DecodableType;
 
@@ -14679,6 +14872,7 @@ public:
     chip::CharSpan debugText;
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
 
     using ResponseType = DataModel::NullObjectType;
 
@@ -14713,6 +14907,7 @@ public:
     chip::CharSpan label;
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
 
     using ResponseType = Clusters::OperationalCredentials::Commands::NOCResponse::DecodableType;
 
@@ -14745,6 +14940,7 @@ public:
     uint8_t fabricIndex;
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
 
     using ResponseType = Clusters::OperationalCredentials::Commands::NOCResponse::DecodableType;
 
@@ -14777,6 +14973,7 @@ public:
     chip::ByteSpan rootCertificate;
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
 
     using ResponseType = DataModel::NullObjectType;
 
@@ -14809,6 +15006,7 @@ public:
     chip::ByteSpan trustedRootIdentifier;
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
 
     using ResponseType = DataModel::NullObjectType;
 
@@ -14975,6 +15173,7 @@ public:
     chip::CharSpan groupName;
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
 };
 
 struct DecodableType
@@ -15004,6 +15203,7 @@ public:
     uint16_t groupKeySetID;
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
     CHIP_ERROR Decode(TLV::TLVReader & reader);
 };
 
@@ -15036,6 +15236,7 @@ public:
     uint64_t epochStartTime2;
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
     CHIP_ERROR Decode(TLV::TLVReader & reader);
 };
 
@@ -15096,6 +15297,7 @@ public:
     Structs::GroupKeySet::Type groupKeySet;
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
 
     using ResponseType = DataModel::NullObjectType;
 
@@ -15128,6 +15330,7 @@ public:
     uint16_t groupKeySetID;
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
 
     using ResponseType = Clusters::GroupKeyManagement::Commands::KeySetReadResponse::DecodableType;
 
@@ -15160,6 +15363,7 @@ public:
     Structs::GroupKeySet::Type groupKeySet;
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
 
     using ResponseType = DataModel::NullObjectType;
 
@@ -15192,6 +15396,7 @@ public:
     uint16_t groupKeySetID;
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
 
     using ResponseType = DataModel::NullObjectType;
 
@@ -15224,6 +15429,7 @@ public:
     DataModel::List<const uint16_t> groupKeySetIDs;
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
 
     using ResponseType = Clusters::GroupKeyManagement::Commands::KeySetReadAllIndicesResponse::DecodableType;
 
@@ -15256,6 +15462,7 @@ public:
     DataModel::List<const uint16_t> groupKeySetIDs;
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
 
     using ResponseType = DataModel::NullObjectType;
 
@@ -15401,6 +15608,7 @@ public:
     chip::CharSpan value;
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
     CHIP_ERROR Decode(TLV::TLVReader & reader);
 };
 
@@ -15494,6 +15702,7 @@ public:
     chip::CharSpan value;
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
     CHIP_ERROR Decode(TLV::TLVReader & reader);
 };
 
@@ -15826,6 +16035,7 @@ public:
     bool stateValue;
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
 };
 
 struct DecodableType
@@ -15861,6 +16071,7 @@ public:
     uint32_t semanticTag;
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
     CHIP_ERROR Decode(TLV::TLVReader & reader);
 };
 
@@ -15881,6 +16092,7 @@ public:
     uint16_t value;
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
     CHIP_ERROR Decode(TLV::TLVReader & reader);
 };
 
@@ -15916,6 +16128,7 @@ public:
     uint8_t newMode;
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
 
     using ResponseType = DataModel::NullObjectType;
 
@@ -16588,6 +16801,7 @@ public:
     uint16_t credentialIndex;
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
     CHIP_ERROR Decode(TLV::TLVReader & reader);
 };
 
@@ -16838,6 +17052,7 @@ public:
     Optional<chip::ByteSpan> pinCode;
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
 
     using ResponseType = DataModel::NullObjectType;
 
@@ -16870,6 +17085,7 @@ public:
     Optional<chip::ByteSpan> pinCode;
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
 
     using ResponseType = DataModel::NullObjectType;
 
@@ -16904,6 +17120,7 @@ public:
     Optional<chip::ByteSpan> pinCode;
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
 
     using ResponseType = DataModel::NullObjectType;
 
@@ -16937,6 +17154,7 @@ public:
     uint16_t logIndex;
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
 
     using ResponseType = Clusters::DoorLock::Commands::GetLogRecordResponse::DecodableType;
 
@@ -16981,6 +17199,7 @@ public:
     chip::ByteSpan pin;
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
 
     using ResponseType = DataModel::NullObjectType;
 
@@ -17025,6 +17244,7 @@ public:
     chip::ByteSpan pin;
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
 
     using ResponseType = DataModel::NullObjectType;
 
@@ -17060,6 +17280,7 @@ public:
     uint16_t userId;
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
 
     using ResponseType = Clusters::DoorLock::Commands::GetPINCodeResponse::DecodableType;
 
@@ -17098,6 +17319,7 @@ public:
     DataModel::Nullable<chip::ByteSpan> pin;
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
 
     using ResponseType = DataModel::NullObjectType;
 
@@ -17133,6 +17355,7 @@ public:
     uint16_t pinSlotIndex;
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
 
     using ResponseType = DataModel::NullObjectType;
 
@@ -17162,6 +17385,7 @@ public:
     static constexpr ClusterId GetClusterId() { return Clusters::DoorLock::Id; }
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
 
     using ResponseType = DataModel::NullObjectType;
 
@@ -17195,6 +17419,7 @@ public:
     DlUserStatus userStatus;
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
 
     using ResponseType = DataModel::NullObjectType;
 
@@ -17228,6 +17453,7 @@ public:
     uint16_t userId;
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
 
     using ResponseType = Clusters::DoorLock::Commands::GetUserStatusResponse::DecodableType;
 
@@ -17262,6 +17488,7 @@ public:
     DlUserStatus userStatus;
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
 
     using ResponseType = DataModel::NullObjectType;
 
@@ -17307,6 +17534,7 @@ public:
     uint8_t endMinute;
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
 
     using ResponseType = DataModel::NullObjectType;
 
@@ -17347,6 +17575,7 @@ public:
     uint16_t userIndex;
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
 
     using ResponseType = Clusters::DoorLock::Commands::GetWeekDayScheduleResponse::DecodableType;
 
@@ -17394,6 +17623,7 @@ public:
     uint8_t endMinute;
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
 
     using ResponseType = DataModel::NullObjectType;
 
@@ -17435,6 +17665,7 @@ public:
     uint16_t userIndex;
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
 
     using ResponseType = DataModel::NullObjectType;
 
@@ -17474,6 +17705,7 @@ public:
     uint32_t localEndTime;
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
 
     using ResponseType = DataModel::NullObjectType;
 
@@ -17511,6 +17743,7 @@ public:
     uint16_t userIndex;
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
 
     using ResponseType = Clusters::DoorLock::Commands::GetYearDayScheduleResponse::DecodableType;
 
@@ -17552,6 +17785,7 @@ public:
     uint32_t localEndTime;
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
 
     using ResponseType = DataModel::NullObjectType;
 
@@ -17590,6 +17824,7 @@ public:
     uint16_t userIndex;
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
 
     using ResponseType = DataModel::NullObjectType;
 
@@ -17629,6 +17864,7 @@ public:
     DlOperatingMode operatingMode;
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
 
     using ResponseType = DataModel::NullObjectType;
 
@@ -17664,6 +17900,7 @@ public:
     uint8_t holidayIndex;
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
 
     using ResponseType = Clusters::DoorLock::Commands::GetHolidayScheduleResponse::DecodableType;
 
@@ -17704,6 +17941,7 @@ public:
     DlOperatingMode operatingMode;
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
 
     using ResponseType = DataModel::NullObjectType;
 
@@ -17740,6 +17978,7 @@ public:
     uint8_t holidayIndex;
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
 
     using ResponseType = DataModel::NullObjectType;
 
@@ -17774,6 +18013,7 @@ public:
     DlUserType userType;
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
 
     using ResponseType = DataModel::NullObjectType;
 
@@ -17807,6 +18047,7 @@ public:
     uint16_t userId;
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
 
     using ResponseType = Clusters::DoorLock::Commands::GetUserTypeResponse::DecodableType;
 
@@ -17841,6 +18082,7 @@ public:
     DlUserType userType;
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
 
     using ResponseType = DataModel::NullObjectType;
 
@@ -17880,6 +18122,7 @@ public:
     chip::ByteSpan rfidCode;
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
 
     using ResponseType = DataModel::NullObjectType;
 
@@ -17915,6 +18158,7 @@ public:
     uint16_t userId;
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
 
     using ResponseType = Clusters::DoorLock::Commands::GetRFIDCodeResponse::DecodableType;
 
@@ -17953,6 +18197,7 @@ public:
     DataModel::Nullable<chip::ByteSpan> rfidCode;
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
 
     using ResponseType = DataModel::NullObjectType;
 
@@ -17988,6 +18233,7 @@ public:
     uint16_t rfidSlotIndex;
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
 
     using ResponseType = DataModel::NullObjectType;
 
@@ -18017,6 +18263,7 @@ public:
     static constexpr ClusterId GetClusterId() { return Clusters::DoorLock::Id; }
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
 
     using ResponseType = DataModel::NullObjectType;
 
@@ -18060,6 +18307,7 @@ public:
     DlCredentialRule credentialRule;
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
 
     using ResponseType = DataModel::NullObjectType;
 
@@ -18098,6 +18346,7 @@ public:
     uint16_t userIndex;
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
 
     using ResponseType = Clusters::DoorLock::Commands::GetUserResponse::DecodableType;
 
@@ -18148,6 +18397,7 @@ public:
     uint16_t nextUserIndex;
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
 
     using ResponseType = DataModel::NullObjectType;
 
@@ -18189,6 +18439,7 @@ public:
     uint16_t userIndex;
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
 
     using ResponseType = DataModel::NullObjectType;
 
@@ -18231,6 +18482,7 @@ public:
     Optional<chip::CharSpan> data;
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
 
     using ResponseType = DataModel::NullObjectType;
 
@@ -18282,6 +18534,7 @@ public:
     Optional<chip::CharSpan> data;
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
 
     using ResponseType = DataModel::NullObjectType;
 
@@ -18329,6 +18582,7 @@ public:
     DlUserStatus userStatus;
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
 
     using ResponseType = Clusters::DoorLock::Commands::SetCredentialResponse::DecodableType;
 
@@ -18369,6 +18623,7 @@ public:
     DataModel::Nullable<uint16_t> nextCredentialIndex;
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
 
     using ResponseType = DataModel::NullObjectType;
 
@@ -18403,6 +18658,7 @@ public:
     Structs::DlCredential::Type credential;
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
 
     using ResponseType = Clusters::DoorLock::Commands::GetCredentialStatusResponse::DecodableType;
 
@@ -18439,6 +18695,7 @@ public:
     DataModel::Nullable<uint16_t> nextCredentialIndex;
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
 
     using ResponseType = DataModel::NullObjectType;
 
@@ -18473,6 +18730,7 @@ public:
     Structs::DlCredential::Type credential;
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
 
     using ResponseType = DataModel::NullObjectType;
 
@@ -19149,6 +19407,7 @@ public:
     DlAlarmCode alarmCode;
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
 };
 
 struct DecodableType
@@ -19182,6 +19441,7 @@ public:
     DlDoorState doorState;
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
 };
 
 struct DecodableType
@@ -19225,6 +19485,7 @@ public:
     Optional<DataModel::Nullable<DataModel::List<const Structs::DlCredential::Type>>> credentials;
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
 };
 
 struct DecodableType
@@ -19275,6 +19536,7 @@ public:
     Optional<DataModel::Nullable<DataModel::List<const Structs::DlCredential::Type>>> credentials;
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
 };
 
 struct DecodableType
@@ -19326,6 +19588,7 @@ public:
     DataModel::Nullable<uint16_t> dataIndex;
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
 };
 
 struct DecodableType
@@ -19460,6 +19723,7 @@ public:
     static constexpr ClusterId GetClusterId() { return Clusters::WindowCovering::Id; }
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
 
     using ResponseType = DataModel::NullObjectType;
 
@@ -19488,6 +19752,7 @@ public:
     static constexpr ClusterId GetClusterId() { return Clusters::WindowCovering::Id; }
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
 
     using ResponseType = DataModel::NullObjectType;
 
@@ -19516,6 +19781,7 @@ public:
     static constexpr ClusterId GetClusterId() { return Clusters::WindowCovering::Id; }
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
 
     using ResponseType = DataModel::NullObjectType;
 
@@ -19547,6 +19813,7 @@ public:
     uint16_t liftValue;
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
 
     using ResponseType = DataModel::NullObjectType;
 
@@ -19581,6 +19848,7 @@ public:
     chip::Percent100ths liftPercent100thsValue;
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
 
     using ResponseType = DataModel::NullObjectType;
 
@@ -19614,6 +19882,7 @@ public:
     uint16_t tiltValue;
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
 
     using ResponseType = DataModel::NullObjectType;
 
@@ -19648,6 +19917,7 @@ public:
     chip::Percent100ths tiltPercent100thsValue;
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
 
     using ResponseType = DataModel::NullObjectType;
 
@@ -20041,6 +20311,7 @@ public:
     uint8_t percentOpen;
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
 
     using ResponseType = DataModel::NullObjectType;
 
@@ -20070,6 +20341,7 @@ public:
     static constexpr ClusterId GetClusterId() { return Clusters::BarrierControl::Id; }
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
 
     using ResponseType = DataModel::NullObjectType;
 
@@ -20687,6 +20959,7 @@ public:
     static constexpr ClusterId GetClusterId() { return Clusters::PumpConfigurationAndControl::Id; }
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
 };
 
 struct DecodableType
@@ -20715,6 +20988,7 @@ public:
     static constexpr ClusterId GetClusterId() { return Clusters::PumpConfigurationAndControl::Id; }
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
 };
 
 struct DecodableType
@@ -20743,6 +21017,7 @@ public:
     static constexpr ClusterId GetClusterId() { return Clusters::PumpConfigurationAndControl::Id; }
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
 };
 
 struct DecodableType
@@ -20771,6 +21046,7 @@ public:
     static constexpr ClusterId GetClusterId() { return Clusters::PumpConfigurationAndControl::Id; }
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
 };
 
 struct DecodableType
@@ -20799,6 +21075,7 @@ public:
     static constexpr ClusterId GetClusterId() { return Clusters::PumpConfigurationAndControl::Id; }
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
 };
 
 struct DecodableType
@@ -20827,6 +21104,7 @@ public:
     static constexpr ClusterId GetClusterId() { return Clusters::PumpConfigurationAndControl::Id; }
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
 };
 
 struct DecodableType
@@ -20855,6 +21133,7 @@ public:
     static constexpr ClusterId GetClusterId() { return Clusters::PumpConfigurationAndControl::Id; }
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
 };
 
 struct DecodableType
@@ -20883,6 +21162,7 @@ public:
     static constexpr ClusterId GetClusterId() { return Clusters::PumpConfigurationAndControl::Id; }
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
 };
 
 struct DecodableType
@@ -20911,6 +21191,7 @@ public:
     static constexpr ClusterId GetClusterId() { return Clusters::PumpConfigurationAndControl::Id; }
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
 };
 
 struct DecodableType
@@ -20939,6 +21220,7 @@ public:
     static constexpr ClusterId GetClusterId() { return Clusters::PumpConfigurationAndControl::Id; }
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
 };
 
 struct DecodableType
@@ -20967,6 +21249,7 @@ public:
     static constexpr ClusterId GetClusterId() { return Clusters::PumpConfigurationAndControl::Id; }
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
 };
 
 struct DecodableType
@@ -20995,6 +21278,7 @@ public:
     static constexpr ClusterId GetClusterId() { return Clusters::PumpConfigurationAndControl::Id; }
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
 };
 
 struct DecodableType
@@ -21023,6 +21307,7 @@ public:
     static constexpr ClusterId GetClusterId() { return Clusters::PumpConfigurationAndControl::Id; }
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
 };
 
 struct DecodableType
@@ -21051,6 +21336,7 @@ public:
     static constexpr ClusterId GetClusterId() { return Clusters::PumpConfigurationAndControl::Id; }
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
 };
 
 struct DecodableType
@@ -21079,6 +21365,7 @@ public:
     static constexpr ClusterId GetClusterId() { return Clusters::PumpConfigurationAndControl::Id; }
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
 };
 
 struct DecodableType
@@ -21107,6 +21394,7 @@ public:
     static constexpr ClusterId GetClusterId() { return Clusters::PumpConfigurationAndControl::Id; }
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
 };
 
 struct DecodableType
@@ -21135,6 +21423,7 @@ public:
     static constexpr ClusterId GetClusterId() { return Clusters::PumpConfigurationAndControl::Id; }
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
 };
 
 struct DecodableType
@@ -21254,6 +21543,7 @@ public:
     int8_t amount;
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
 
     using ResponseType = DataModel::NullObjectType;
 
@@ -21293,6 +21583,7 @@ public:
     DataModel::List<const uint8_t> payload;
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
 
     using ResponseType = DataModel::NullObjectType;
 
@@ -21334,6 +21625,7 @@ public:
     DataModel::List<const uint8_t> payload;
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
 
     using ResponseType = DataModel::NullObjectType;
 
@@ -21379,6 +21671,7 @@ public:
     uint16_t unreadEntries;
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
 
     using ResponseType = DataModel::NullObjectType;
 
@@ -21418,6 +21711,7 @@ public:
     chip::BitFlags<ModeForSequence> modeToReturn;
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
 
     using ResponseType = Clusters::Thermostat::Commands::GetWeeklyScheduleResponse::DecodableType;
 
@@ -21448,6 +21742,7 @@ public:
     static constexpr ClusterId GetClusterId() { return Clusters::Thermostat::Id; }
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
 
     using ResponseType = DataModel::NullObjectType;
 
@@ -21476,6 +21771,7 @@ public:
     static constexpr ClusterId GetClusterId() { return Clusters::Thermostat::Id; }
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
 
     using ResponseType = Clusters::Thermostat::Commands::GetRelayStatusLogResponse::DecodableType;
 
@@ -22691,6 +22987,7 @@ public:
     uint8_t optionsOverride;
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
 
     using ResponseType = DataModel::NullObjectType;
 
@@ -22733,6 +23030,7 @@ public:
     uint8_t optionsOverride;
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
 
     using ResponseType = DataModel::NullObjectType;
 
@@ -22776,6 +23074,7 @@ public:
     uint8_t optionsOverride;
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
 
     using ResponseType = DataModel::NullObjectType;
 
@@ -22818,6 +23117,7 @@ public:
     uint8_t optionsOverride;
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
 
     using ResponseType = DataModel::NullObjectType;
 
@@ -22859,6 +23159,7 @@ public:
     uint8_t optionsOverride;
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
 
     using ResponseType = DataModel::NullObjectType;
 
@@ -22902,6 +23203,7 @@ public:
     uint8_t optionsOverride;
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
 
     using ResponseType = DataModel::NullObjectType;
 
@@ -22946,6 +23248,7 @@ public:
     uint8_t optionsOverride;
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
 
     using ResponseType = DataModel::NullObjectType;
 
@@ -22990,6 +23293,7 @@ public:
     uint8_t optionsOverride;
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
 
     using ResponseType = DataModel::NullObjectType;
 
@@ -23032,6 +23336,7 @@ public:
     uint8_t optionsOverride;
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
 
     using ResponseType = DataModel::NullObjectType;
 
@@ -23075,6 +23380,7 @@ public:
     uint8_t optionsOverride;
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
 
     using ResponseType = DataModel::NullObjectType;
 
@@ -23117,6 +23423,7 @@ public:
     uint8_t optionsOverride;
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
 
     using ResponseType = DataModel::NullObjectType;
 
@@ -23160,6 +23467,7 @@ public:
     uint8_t optionsOverride;
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
 
     using ResponseType = DataModel::NullObjectType;
 
@@ -23202,6 +23510,7 @@ public:
     uint8_t optionsOverride;
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
 
     using ResponseType = DataModel::NullObjectType;
 
@@ -23245,6 +23554,7 @@ public:
     uint8_t optionsOverride;
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
 
     using ResponseType = DataModel::NullObjectType;
 
@@ -23289,6 +23599,7 @@ public:
     uint8_t optionsOverride;
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
 
     using ResponseType = DataModel::NullObjectType;
 
@@ -23337,6 +23648,7 @@ public:
     uint8_t optionsOverride;
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
 
     using ResponseType = DataModel::NullObjectType;
 
@@ -23377,6 +23689,7 @@ public:
     uint8_t optionsOverride;
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
 
     using ResponseType = DataModel::NullObjectType;
 
@@ -23420,6 +23733,7 @@ public:
     uint8_t optionsOverride;
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
 
     using ResponseType = DataModel::NullObjectType;
 
@@ -23469,6 +23783,7 @@ public:
     uint8_t optionsOverride;
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
 
     using ResponseType = DataModel::NullObjectType;
 
@@ -28680,6 +28995,7 @@ public:
     uint8_t zoneId;
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
 
     using ResponseType = DataModel::NullObjectType;
 
@@ -28719,6 +29035,7 @@ public:
     uint16_t delay;
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
 
     using ResponseType = DataModel::NullObjectType;
 
@@ -28751,6 +29068,7 @@ public:
     static constexpr ClusterId GetClusterId() { return Clusters::IasZone::Id; }
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
 
     using ResponseType = Clusters::IasZone::Commands::InitiateNormalOperationModeResponse::DecodableType;
 
@@ -28784,6 +29102,7 @@ public:
     uint16_t manufacturerCode;
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
 
     using ResponseType = Clusters::IasZone::Commands::ZoneEnrollResponse::DecodableType;
 
@@ -28819,6 +29138,7 @@ public:
     uint8_t currentZoneSensitivityLevel;
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
 
     using ResponseType = Clusters::IasZone::Commands::InitiateTestModeResponse::DecodableType;
 
@@ -28849,6 +29169,7 @@ public:
     static constexpr ClusterId GetClusterId() { return Clusters::IasZone::Id; }
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
 
     using ResponseType = DataModel::NullObjectType;
 
@@ -28877,6 +29198,7 @@ public:
     static constexpr ClusterId GetClusterId() { return Clusters::IasZone::Id; }
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
 
     using ResponseType = DataModel::NullObjectType;
 
@@ -29158,6 +29480,7 @@ public:
     chip::BitFlags<IasZoneStatus> zoneStatus;
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
     CHIP_ERROR Decode(TLV::TLVReader & reader);
 };
 
@@ -29287,6 +29610,7 @@ public:
     uint8_t zoneId;
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
 
     using ResponseType = Clusters::IasAce::Commands::ArmResponse::DecodableType;
 
@@ -29321,6 +29645,7 @@ public:
     IasAceArmNotification armNotification;
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
 
     using ResponseType = DataModel::NullObjectType;
 
@@ -29357,6 +29682,7 @@ public:
     chip::CharSpan armDisarmCode;
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
 
     using ResponseType = Clusters::IasAce::Commands::BypassResponse::DecodableType;
 
@@ -29421,6 +29747,7 @@ public:
     uint16_t section15;
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
 
     using ResponseType = DataModel::NullObjectType;
 
@@ -29465,6 +29792,7 @@ public:
     static constexpr ClusterId GetClusterId() { return Clusters::IasAce::Id; }
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
 
     using ResponseType = DataModel::NullObjectType;
 
@@ -29502,6 +29830,7 @@ public:
     chip::CharSpan zoneLabel;
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
 
     using ResponseType = DataModel::NullObjectType;
 
@@ -29534,6 +29863,7 @@ public:
     static constexpr ClusterId GetClusterId() { return Clusters::IasAce::Id; }
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
 
     using ResponseType = DataModel::NullObjectType;
 
@@ -29571,6 +29901,7 @@ public:
     chip::CharSpan zoneLabel;
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
 
     using ResponseType = DataModel::NullObjectType;
 
@@ -29603,6 +29934,7 @@ public:
     static constexpr ClusterId GetClusterId() { return Clusters::IasAce::Id; }
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
 
     using ResponseType = DataModel::NullObjectType;
 
@@ -29640,6 +29972,7 @@ public:
     IasAceAlarmStatus alarmStatus;
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
 
     using ResponseType = DataModel::NullObjectType;
 
@@ -29672,6 +30005,7 @@ public:
     static constexpr ClusterId GetClusterId() { return Clusters::IasAce::Id; }
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
 
     using ResponseType = Clusters::IasAce::Commands::GetZoneIdMapResponse::DecodableType;
 
@@ -29709,6 +30043,7 @@ public:
     IasAceAlarmStatus alarmStatus;
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
 
     using ResponseType = DataModel::NullObjectType;
 
@@ -29744,6 +30079,7 @@ public:
     uint8_t zoneId;
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
 
     using ResponseType = Clusters::IasAce::Commands::GetZoneInformationResponse::DecodableType;
 
@@ -29778,6 +30114,7 @@ public:
     DataModel::List<const uint8_t> zoneIds;
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
 
     using ResponseType = DataModel::NullObjectType;
 
@@ -29808,6 +30145,7 @@ public:
     static constexpr ClusterId GetClusterId() { return Clusters::IasAce::Id; }
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
 
     using ResponseType = Clusters::IasAce::Commands::GetPanelStatusResponse::DecodableType;
 
@@ -29841,6 +30179,7 @@ public:
     DataModel::List<const IasAceBypassResult> bypassResult;
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
 
     using ResponseType = DataModel::NullObjectType;
 
@@ -29871,6 +30210,7 @@ public:
     static constexpr ClusterId GetClusterId() { return Clusters::IasAce::Id; }
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
 
     using ResponseType = DataModel::NullObjectType;
 
@@ -29906,6 +30246,7 @@ public:
     DataModel::List<const Structs::IasAceZoneStatusResult::Type> zoneStatusResult;
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
 
     using ResponseType = DataModel::NullObjectType;
 
@@ -29946,6 +30287,7 @@ public:
     uint16_t zoneStatusMask;
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
 
     using ResponseType = Clusters::IasAce::Commands::GetZoneStatusResponse::DecodableType;
 
@@ -30077,6 +30419,7 @@ public:
     uint8_t strobeLevel;
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
 
     using ResponseType = DataModel::NullObjectType;
 
@@ -30112,6 +30455,7 @@ public:
     chip::BitFlags<SquawkInfo> squawkInfo;
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
 
     using ResponseType = DataModel::NullObjectType;
 
@@ -30300,6 +30644,7 @@ public:
     chip::CharSpan affiliateCallSign;
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
     CHIP_ERROR Decode(TLV::TLVReader & reader);
 };
 
@@ -30324,6 +30669,7 @@ public:
     ChannelLineupInfoType lineupInfoType;
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
     CHIP_ERROR Decode(TLV::TLVReader & reader);
 };
 
@@ -30374,6 +30720,7 @@ public:
     chip::CharSpan match;
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
 
     using ResponseType = Clusters::Channel::Commands::ChangeChannelResponse::DecodableType;
 
@@ -30408,6 +30755,7 @@ public:
     ChannelErrorType errorType;
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
 
     using ResponseType = DataModel::NullObjectType;
 
@@ -30443,6 +30791,7 @@ public:
     uint16_t minorNumber;
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
 
     using ResponseType = DataModel::NullObjectType;
 
@@ -30476,6 +30825,7 @@ public:
     uint16_t count;
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
 
     using ResponseType = DataModel::NullObjectType;
 
@@ -30612,6 +30962,7 @@ public:
     chip::CharSpan name;
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
     CHIP_ERROR Decode(TLV::TLVReader & reader);
 };
 
@@ -30654,6 +31005,7 @@ public:
     chip::CharSpan data;
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
 
     using ResponseType = Clusters::TargetNavigator::Commands::NavigateTargetResponse::DecodableType;
 
@@ -30689,6 +31041,7 @@ public:
     chip::CharSpan data;
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
 
     using ResponseType = DataModel::NullObjectType;
 
@@ -30837,6 +31190,7 @@ public:
     uint64_t position;
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
     CHIP_ERROR Decode(TLV::TLVReader & reader);
 };
 
@@ -30974,6 +31328,7 @@ public:
     static constexpr ClusterId GetClusterId() { return Clusters::MediaPlayback::Id; }
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
 
     using ResponseType = Clusters::MediaPlayback::Commands::MediaPlayResponse::DecodableType;
 
@@ -31005,6 +31360,7 @@ public:
     MediaPlaybackStatus mediaPlaybackStatus;
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
 
     using ResponseType = DataModel::NullObjectType;
 
@@ -31034,6 +31390,7 @@ public:
     static constexpr ClusterId GetClusterId() { return Clusters::MediaPlayback::Id; }
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
 
     using ResponseType = Clusters::MediaPlayback::Commands::MediaPauseResponse::DecodableType;
 
@@ -31065,6 +31422,7 @@ public:
     MediaPlaybackStatus mediaPlaybackStatus;
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
 
     using ResponseType = DataModel::NullObjectType;
 
@@ -31094,6 +31452,7 @@ public:
     static constexpr ClusterId GetClusterId() { return Clusters::MediaPlayback::Id; }
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
 
     using ResponseType = Clusters::MediaPlayback::Commands::MediaStopResponse::DecodableType;
 
@@ -31125,6 +31484,7 @@ public:
     MediaPlaybackStatus mediaPlaybackStatus;
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
 
     using ResponseType = DataModel::NullObjectType;
 
@@ -31154,6 +31514,7 @@ public:
     static constexpr ClusterId GetClusterId() { return Clusters::MediaPlayback::Id; }
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
 
     using ResponseType = Clusters::MediaPlayback::Commands::MediaStartOverResponse::DecodableType;
 
@@ -31185,6 +31546,7 @@ public:
     MediaPlaybackStatus mediaPlaybackStatus;
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
 
     using ResponseType = DataModel::NullObjectType;
 
@@ -31214,6 +31576,7 @@ public:
     static constexpr ClusterId GetClusterId() { return Clusters::MediaPlayback::Id; }
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
 
     using ResponseType = Clusters::MediaPlayback::Commands::MediaPreviousResponse::DecodableType;
 
@@ -31245,6 +31608,7 @@ public:
     MediaPlaybackStatus mediaPlaybackStatus;
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
 
     using ResponseType = DataModel::NullObjectType;
 
@@ -31274,6 +31638,7 @@ public:
     static constexpr ClusterId GetClusterId() { return Clusters::MediaPlayback::Id; }
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
 
     using ResponseType = Clusters::MediaPlayback::Commands::MediaNextResponse::DecodableType;
 
@@ -31305,6 +31670,7 @@ public:
     MediaPlaybackStatus mediaPlaybackStatus;
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
 
     using ResponseType = DataModel::NullObjectType;
 
@@ -31334,6 +31700,7 @@ public:
     static constexpr ClusterId GetClusterId() { return Clusters::MediaPlayback::Id; }
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
 
     using ResponseType = Clusters::MediaPlayback::Commands::MediaRewindResponse::DecodableType;
 
@@ -31365,6 +31732,7 @@ public:
     MediaPlaybackStatus mediaPlaybackStatus;
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
 
     using ResponseType = DataModel::NullObjectType;
 
@@ -31394,6 +31762,7 @@ public:
     static constexpr ClusterId GetClusterId() { return Clusters::MediaPlayback::Id; }
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
 
     using ResponseType = Clusters::MediaPlayback::Commands::MediaFastForwardResponse::DecodableType;
 
@@ -31425,6 +31794,7 @@ public:
     MediaPlaybackStatus mediaPlaybackStatus;
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
 
     using ResponseType = DataModel::NullObjectType;
 
@@ -31457,6 +31827,7 @@ public:
     uint64_t deltaPositionMilliseconds;
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
 
     using ResponseType = Clusters::MediaPlayback::Commands::MediaSkipForwardResponse::DecodableType;
 
@@ -31489,6 +31860,7 @@ public:
     MediaPlaybackStatus mediaPlaybackStatus;
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
 
     using ResponseType = DataModel::NullObjectType;
 
@@ -31521,6 +31893,7 @@ public:
     uint64_t deltaPositionMilliseconds;
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
 
     using ResponseType = Clusters::MediaPlayback::Commands::MediaSkipBackwardResponse::DecodableType;
 
@@ -31553,6 +31926,7 @@ public:
     MediaPlaybackStatus mediaPlaybackStatus;
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
 
     using ResponseType = DataModel::NullObjectType;
 
@@ -31585,6 +31959,7 @@ public:
     uint64_t position;
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
 
     using ResponseType = Clusters::MediaPlayback::Commands::MediaSeekResponse::DecodableType;
 
@@ -31617,6 +31992,7 @@ public:
     MediaPlaybackStatus mediaPlaybackStatus;
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
 
     using ResponseType = DataModel::NullObjectType;
 
@@ -31823,6 +32199,7 @@ public:
     chip::CharSpan description;
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
     CHIP_ERROR Decode(TLV::TLVReader & reader);
 };
 
@@ -31873,6 +32250,7 @@ public:
     uint8_t index;
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
 
     using ResponseType = DataModel::NullObjectType;
 
@@ -31902,6 +32280,7 @@ public:
     static constexpr ClusterId GetClusterId() { return Clusters::MediaInput::Id; }
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
 
     using ResponseType = DataModel::NullObjectType;
 
@@ -31930,6 +32309,7 @@ public:
     static constexpr ClusterId GetClusterId() { return Clusters::MediaInput::Id; }
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
 
     using ResponseType = DataModel::NullObjectType;
 
@@ -31963,6 +32343,7 @@ public:
     chip::CharSpan name;
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
 
     using ResponseType = DataModel::NullObjectType;
 
@@ -32090,6 +32471,7 @@ public:
     static constexpr ClusterId GetClusterId() { return Clusters::LowPower::Id; }
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
 
     using ResponseType = DataModel::NullObjectType;
 
@@ -32304,6 +32686,7 @@ public:
     KeypadInputCecKeyCode keyCode;
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
 
     using ResponseType = Clusters::KeypadInput::Commands::SendKeyResponse::DecodableType;
 
@@ -32336,6 +32719,7 @@ public:
     KeypadInputStatus status;
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
 
     using ResponseType = DataModel::NullObjectType;
 
@@ -32470,6 +32854,7 @@ public:
     ContentLaunchMetricType metric;
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
     CHIP_ERROR Decode(TLV::TLVReader & reader);
 };
 
@@ -32490,6 +32875,7 @@ public:
     chip::CharSpan value;
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
     CHIP_ERROR Decode(TLV::TLVReader & reader);
 };
 
@@ -32512,6 +32898,7 @@ public:
     DataModel::List<const Structs::ContentLaunchAdditionalInfo::Type> externalIDList;
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
 };
 
 struct DecodableType
@@ -32540,6 +32927,7 @@ public:
     Structs::ContentLaunchDimension::Type size;
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
     CHIP_ERROR Decode(TLV::TLVReader & reader);
 };
 
@@ -32568,6 +32956,7 @@ public:
     Structs::ContentLaunchStyleInformation::Type waterMark;
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
     CHIP_ERROR Decode(TLV::TLVReader & reader);
 };
 
@@ -32622,6 +33011,7 @@ public:
     DataModel::List<const Structs::ContentLaunchParamater::Type> search;
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
 
     using ResponseType = Clusters::ContentLauncher::Commands::LaunchContentResponse::DecodableType;
 
@@ -32658,6 +33048,7 @@ public:
     chip::CharSpan data;
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
 
     using ResponseType = DataModel::NullObjectType;
 
@@ -32695,6 +33086,7 @@ public:
     DataModel::List<const Structs::ContentLaunchBrandingInformation::Type> brandingInformation;
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
 
     using ResponseType = Clusters::ContentLauncher::Commands::LaunchURLResponse::DecodableType;
 
@@ -32731,6 +33123,7 @@ public:
     chip::CharSpan data;
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
 
     using ResponseType = DataModel::NullObjectType;
 
@@ -32865,6 +33258,7 @@ public:
     chip::CharSpan name;
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
     CHIP_ERROR Decode(TLV::TLVReader & reader);
 };
 
@@ -32905,6 +33299,7 @@ public:
     uint8_t index;
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
 
     using ResponseType = DataModel::NullObjectType;
 
@@ -32939,6 +33334,7 @@ public:
     chip::CharSpan name;
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
 
     using ResponseType = DataModel::NullObjectType;
 
@@ -33070,6 +33466,7 @@ public:
     chip::CharSpan applicationId;
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
     CHIP_ERROR Decode(TLV::TLVReader & reader);
 };
 
@@ -33090,6 +33487,7 @@ public:
     chip::CharSpan endpoint;
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
     CHIP_ERROR Decode(TLV::TLVReader & reader);
 };
 
@@ -33152,6 +33550,7 @@ public:
     Structs::ApplicationLauncherApp::Type application;
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
 
     using ResponseType = Clusters::ApplicationLauncher::Commands::LaunchAppResponse::DecodableType;
 
@@ -33187,6 +33586,7 @@ public:
     chip::CharSpan data;
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
 
     using ResponseType = DataModel::NullObjectType;
 
@@ -33220,6 +33620,7 @@ public:
     Structs::ApplicationLauncherApp::Type application;
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
 
     using ResponseType = Clusters::ApplicationLauncher::Commands::StopAppResponse::DecodableType;
 
@@ -33254,6 +33655,7 @@ public:
     chip::CharSpan data;
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
 
     using ResponseType = DataModel::NullObjectType;
 
@@ -33287,6 +33689,7 @@ public:
     Structs::ApplicationLauncherApp::Type application;
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
 
     using ResponseType = Clusters::ApplicationLauncher::Commands::HideAppResponse::DecodableType;
 
@@ -33321,6 +33724,7 @@ public:
     chip::CharSpan data;
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
 
     using ResponseType = DataModel::NullObjectType;
 
@@ -33445,6 +33849,7 @@ public:
     chip::CharSpan applicationId;
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
     CHIP_ERROR Decode(TLV::TLVReader & reader);
 };
 
@@ -33480,6 +33885,7 @@ public:
     ApplicationBasicStatus status;
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
 
     using ResponseType = DataModel::NullObjectType;
 
@@ -33687,6 +34093,7 @@ public:
     chip::CharSpan tempAccountIdentifier;
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
 
     using ResponseType = Clusters::AccountLogin::Commands::GetSetupPINResponse::DecodableType;
 
@@ -33719,6 +34126,7 @@ public:
     chip::CharSpan setupPIN;
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
 
     using ResponseType = DataModel::NullObjectType;
 
@@ -33753,6 +34161,7 @@ public:
     chip::CharSpan setupPIN;
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
 
     using ResponseType = DataModel::NullObjectType;
 
@@ -33783,6 +34192,7 @@ public:
     static constexpr ClusterId GetClusterId() { return Clusters::AccountLogin::Id; }
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
 
     using ResponseType = DataModel::NullObjectType;
 
@@ -33899,6 +34309,7 @@ public:
     double h;
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
     CHIP_ERROR Decode(TLV::TLVReader & reader);
 };
 
@@ -33939,6 +34350,7 @@ public:
     Optional<DataModel::Nullable<DataModel::List<const SimpleEnum>>> nullableOptionalList;
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
 };
 
 struct DecodableType
@@ -33976,6 +34388,7 @@ public:
     Structs::SimpleStruct::Type c;
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
     CHIP_ERROR Decode(TLV::TLVReader & reader);
 };
 
@@ -34006,6 +34419,7 @@ public:
     DataModel::List<const uint8_t> g;
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
 };
 
 struct DecodableType
@@ -34034,6 +34448,7 @@ public:
     DataModel::List<const Structs::NestedStructList::Type> a;
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
 };
 
 struct DecodableType
@@ -34058,6 +34473,7 @@ public:
     chip::ByteSpan operationalCert;
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
     CHIP_ERROR Decode(TLV::TLVReader & reader);
 };
 
@@ -34245,6 +34661,7 @@ public:
     static constexpr ClusterId GetClusterId() { return Clusters::TestCluster::Id; }
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
 
     using ResponseType = DataModel::NullObjectType;
 
@@ -34276,6 +34693,7 @@ public:
     uint8_t returnValue;
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
 
     using ResponseType = DataModel::NullObjectType;
 
@@ -34305,6 +34723,7 @@ public:
     static constexpr ClusterId GetClusterId() { return Clusters::TestCluster::Id; }
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
 
     using ResponseType = DataModel::NullObjectType;
 
@@ -34336,6 +34755,7 @@ public:
     uint8_t returnValue;
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
 
     using ResponseType = DataModel::NullObjectType;
 
@@ -34365,6 +34785,7 @@ public:
     static constexpr ClusterId GetClusterId() { return Clusters::TestCluster::Id; }
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
 
     using ResponseType = Clusters::TestCluster::Commands::TestSpecificResponse::DecodableType;
 
@@ -34396,6 +34817,7 @@ public:
     bool returnValue;
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
 
     using ResponseType = DataModel::NullObjectType;
 
@@ -34425,6 +34847,7 @@ public:
     static constexpr ClusterId GetClusterId() { return Clusters::TestCluster::Id; }
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
 
     using ResponseType = DataModel::NullObjectType;
 
@@ -34466,6 +34889,7 @@ public:
     bool arg6;
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
 
     using ResponseType = DataModel::NullObjectType;
 
@@ -34505,6 +34929,7 @@ public:
     uint8_t arg2;
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
 
     using ResponseType = Clusters::TestCluster::Commands::TestAddArgumentsResponse::DecodableType;
 
@@ -34538,6 +34963,7 @@ public:
     DataModel::List<const uint8_t> arg1;
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
 
     using ResponseType = DataModel::NullObjectType;
 
@@ -34570,6 +34996,7 @@ public:
     bool arg1;
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
 
     using ResponseType = Clusters::TestCluster::Commands::TestSimpleArgumentResponse::DecodableType;
 
@@ -34604,6 +35031,7 @@ public:
     SimpleEnum arg2;
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
 
     using ResponseType = DataModel::NullObjectType;
 
@@ -34647,6 +35075,7 @@ public:
     bool arg6;
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
 
     using ResponseType = Clusters::TestCluster::Commands::TestStructArrayArgumentResponse::DecodableType;
 
@@ -34690,6 +35119,7 @@ public:
     Optional<DataModel::Nullable<uint8_t>> originalValue;
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
 
     using ResponseType = DataModel::NullObjectType;
 
@@ -34725,6 +35155,7 @@ public:
     Structs::SimpleStruct::Type arg1;
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
 
     using ResponseType = Clusters::TestCluster::Commands::BooleanResponse::DecodableType;
 
@@ -34811,6 +35242,7 @@ public:
     Optional<DataModel::List<const SimpleEnum>> nullableOptionalListValue;
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
 
     using ResponseType = DataModel::NullObjectType;
 
@@ -34870,6 +35302,7 @@ public:
     Structs::NestedStruct::Type arg1;
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
 
     using ResponseType = Clusters::TestCluster::Commands::BooleanResponse::DecodableType;
 
@@ -34902,6 +35335,7 @@ public:
     bool value;
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
 
     using ResponseType = DataModel::NullObjectType;
 
@@ -34934,6 +35368,7 @@ public:
     DataModel::List<const Structs::SimpleStruct::Type> arg1;
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
 
     using ResponseType = Clusters::TestCluster::Commands::BooleanResponse::DecodableType;
 
@@ -34966,6 +35401,7 @@ public:
     Structs::SimpleStruct::Type arg1;
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
 
     using ResponseType = DataModel::NullObjectType;
 
@@ -34998,6 +35434,7 @@ public:
     DataModel::List<const uint8_t> arg1;
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
 
     using ResponseType = Clusters::TestCluster::Commands::BooleanResponse::DecodableType;
 
@@ -35030,6 +35467,7 @@ public:
     uint64_t value;
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
 
     using ResponseType = DataModel::NullObjectType;
 
@@ -35062,6 +35500,7 @@ public:
     Structs::NestedStructList::Type arg1;
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
 
     using ResponseType = Clusters::TestCluster::Commands::BooleanResponse::DecodableType;
 
@@ -35094,6 +35533,7 @@ public:
     DataModel::List<const Structs::NestedStructList::Type> arg1;
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
 
     using ResponseType = Clusters::TestCluster::Commands::BooleanResponse::DecodableType;
 
@@ -35126,6 +35566,7 @@ public:
     DataModel::List<const uint8_t> arg1;
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
 
     using ResponseType = Clusters::TestCluster::Commands::TestListInt8UReverseResponse::DecodableType;
 
@@ -35160,6 +35601,7 @@ public:
     SimpleEnum arg2;
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
 
     using ResponseType = Clusters::TestCluster::Commands::TestEnumsResponse::DecodableType;
 
@@ -35193,6 +35635,7 @@ public:
     Optional<DataModel::Nullable<uint8_t>> arg1;
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
 
     using ResponseType = Clusters::TestCluster::Commands::TestNullableOptionalResponse::DecodableType;
 
@@ -35247,6 +35690,7 @@ public:
     Optional<DataModel::Nullable<DataModel::List<const SimpleEnum>>> nullableOptionalList;
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
 
     using ResponseType = Clusters::TestCluster::Commands::TestComplexNullableOptionalResponse::DecodableType;
 
@@ -35290,6 +35734,7 @@ public:
     Structs::SimpleStruct::Type arg1;
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
 
     using ResponseType = Clusters::TestCluster::Commands::SimpleStructResponse::DecodableType;
 
@@ -35319,6 +35764,7 @@ public:
     static constexpr ClusterId GetClusterId() { return Clusters::TestCluster::Id; }
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
 
     using ResponseType = DataModel::NullObjectType;
 
@@ -35350,6 +35796,7 @@ public:
     Optional<bool> arg1;
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
 
     using ResponseType = DataModel::NullObjectType;
 
@@ -35386,6 +35833,7 @@ public:
     bool arg3;
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
 
     using ResponseType = Clusters::TestCluster::Commands::TestEmitTestEventResponse::DecodableType;
 
@@ -36508,6 +36956,7 @@ public:
     DataModel::List<const SimpleEnum> arg6;
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
 };
 
 struct DecodableType
@@ -36733,6 +37182,7 @@ public:
     chip::BitFlags<MessagingExtendedControlMask> optionalExtendedMessageControl;
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
 
     using ResponseType = DataModel::NullObjectType;
 
@@ -36767,6 +37217,7 @@ public:
     static constexpr ClusterId GetClusterId() { return Clusters::Messaging::Id; }
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
 
     using ResponseType = DataModel::NullObjectType;
 
@@ -36800,6 +37251,7 @@ public:
     chip::BitFlags<MessagingControlMask> messageControl;
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
 
     using ResponseType = DataModel::NullObjectType;
 
@@ -36839,6 +37291,7 @@ public:
     chip::ByteSpan messageResponse;
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
 
     using ResponseType = DataModel::NullObjectType;
 
@@ -36884,6 +37337,7 @@ public:
     chip::BitFlags<MessagingExtendedControlMask> optionalExtendedMessageControl;
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
 
     using ResponseType = DataModel::NullObjectType;
 
@@ -36921,6 +37375,7 @@ public:
     uint32_t earliestImplementationTime;
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
 
     using ResponseType = DataModel::NullObjectType;
 
@@ -36953,6 +37408,7 @@ public:
     uint32_t implementationDateTime;
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
 
     using ResponseType = DataModel::NullObjectType;
 
@@ -37514,6 +37970,7 @@ public:
     static constexpr ClusterId GetClusterId() { return Clusters::ApplianceEventsAndAlert::Id; }
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
 
     using ResponseType = Clusters::ApplianceEventsAndAlert::Commands::GetAlertsResponse::DecodableType;
 
@@ -37547,6 +38004,7 @@ public:
     DataModel::List<const chip::BitFlags<AlertStructure>> alertStructures;
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
 
     using ResponseType = DataModel::NullObjectType;
 
@@ -37582,6 +38040,7 @@ public:
     DataModel::List<const chip::BitFlags<AlertStructure>> alertStructures;
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
 
     using ResponseType = DataModel::NullObjectType;
 
@@ -37617,6 +38076,7 @@ public:
     EventIdentification eventId;
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
 
     using ResponseType = DataModel::NullObjectType;
 
@@ -37750,6 +38210,7 @@ public:
     DataModel::List<const uint8_t> logPayload;
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
 
     using ResponseType = DataModel::NullObjectType;
 
@@ -37785,6 +38246,7 @@ public:
     uint32_t logId;
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
 
     using ResponseType = Clusters::ApplianceStatistics::Commands::LogResponse::DecodableType;
 
@@ -37823,6 +38285,7 @@ public:
     DataModel::List<const uint8_t> logPayload;
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
 
     using ResponseType = DataModel::NullObjectType;
 
@@ -37855,6 +38318,7 @@ public:
     static constexpr ClusterId GetClusterId() { return Clusters::ApplianceStatistics::Id; }
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
 
     using ResponseType = Clusters::ApplianceStatistics::Commands::LogQueueResponse::DecodableType;
 
@@ -37888,6 +38352,7 @@ public:
     DataModel::List<const uint32_t> logIds;
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
 
     using ResponseType = DataModel::NullObjectType;
 
@@ -37923,6 +38388,7 @@ public:
     DataModel::List<const uint32_t> logIds;
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
 
     using ResponseType = DataModel::NullObjectType;
 
@@ -38072,6 +38538,7 @@ public:
     DataModel::List<const uint16_t> listOfAttributes;
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
 
     using ResponseType = DataModel::NullObjectType;
 
@@ -38104,6 +38571,7 @@ public:
     static constexpr ClusterId GetClusterId() { return Clusters::ElectricalMeasurement::Id; }
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
 
     using ResponseType = DataModel::NullObjectType;
 
@@ -38145,6 +38613,7 @@ public:
     DataModel::List<const uint8_t> intervals;
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
 
     using ResponseType = DataModel::NullObjectType;
 
@@ -38186,6 +38655,7 @@ public:
     uint8_t numberOfIntervals;
 
     CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const;
+    size_t EncodedSize(TLV::Tag tag) const;
 
     using ResponseType = DataModel::NullObjectType;
 